@@ -11,15 +11,34 @@ namespace PHiLiP {
 using FadType = Sacado::Fad::DFad<double>; ///< Sacado AD type for first derivatives.
 using FadFadType = Sacado::Fad::DFad<FadType>; ///< Sacado AD type that allows 2nd derivatives.
 
-static constexpr int dimForwardAD = 1; ///< Size of the forward vector mode for CoDiPack.
-static constexpr int dimReverseAD = 1; ///< Size of the reverse vector mode for CoDiPack.
+/// Size of the forward vector mode for CoDiPack.
+/** Number of input directions propagated by each primal re-evaluation of the Hessian tapes.
+ *  The directions are stored in fixed-size arrays such that no heap allocation occurs per active scalar.
+ */
+#if PHILIP_DIM == 1
+static constexpr int dimForwardAD = 4;
+#else
+static constexpr int dimForwardAD = 8;
+#endif
+/// Size of the reverse vector mode for CoDiPack.
+/** Number of residual rows obtained by each reverse sweep of the Jacobian tapes.
+ *  A cell has nstate*(p+1)^dim residuals, such that a sweep of size one requires that many tape evaluations.
+ */
+#if PHILIP_DIM == 1
+static constexpr int dimReverseAD = 4;
+#else
+static constexpr int dimReverseAD = 8;
+#endif
+/// Size of the reverse vector mode for the Hessian computation.
+/** The Hessian is only taken of the scalar dual-weighted residual, for which larger sizes are never used. */
+static constexpr int dimReverseHessianAD = 1;
 
 using codi_FadType = codi::RealForwardGen<double, codi::Direction<double,dimForwardAD>>; ///< Tapeless forward mode.
 //using codi_FadType = codi::RealForwardGen<double, codi::DirectionVar<double>>;
 
 using codi_JacobianComputationType = codi::RealReverseIndexVec<dimReverseAD>; ///< Reverse mode type for Jacobian computation using TapeHelper.
 using codi_HessianComputationType  = codi::RealReversePrimalIndexGen< codi::RealForwardVec<dimForwardAD>,
-                                                  codi::Direction< codi::RealForwardVec<dimForwardAD>, dimReverseAD>
+                                                  codi::Direction< codi::RealForwardVec<dimForwardAD>, dimReverseHessianAD>
                                                 >; ///< Nested reverse-forward mode type for Jacobian and Hessian computation using TapeHelper.
 
 //using RadFadType = Sacado::Rad::ADvar<FadType>; ///< Sacado AD type that allows 2nd derivatives.
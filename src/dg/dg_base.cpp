@@ -1,9 +1,12 @@
 #include<limits>
 #include<fstream>
+#include<mutex>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/tensor.h>
 
 #include <deal.II/base/qprojector.h>
+#include <deal.II/base/work_stream.h>
+#include <deal.II/base/graph_coloring.h>
 
 #include <deal.II/grid/tria.h>
 #include <deal.II/distributed/shared_tria.h>
@@ -33,6 +36,7 @@
 // Finally, we take our exact solution from the library as well as volume_quadrature
 // and additional tools.
 #include <EpetraExt_Transpose_RowMatrix.h>
+#include <Epetra_Vector.h>
 #include <deal.II/distributed/grid_refinement.h>
 #include <deal.II/dofs/dof_renumbering.h>
 #include <deal.II/grid/grid_refinement.h>
@@ -46,6 +50,7 @@
 #include "dg_base.hpp"
 #include "global_counter.hpp"
 #include "post_processor/physics_post_processor.h"
+#include "profiling/performance_profiler.h"
 
 unsigned int n_vmult;
 unsigned int dRdW_form;
@@ -95,7 +100,7 @@ DGBase<dim,real,MeshType>::DGBase(
     , high_order_grid(std::make_shared<HighOrderGrid<dim,real,MeshType>>(grid_degree_input, triangulation, all_parameters->check_valid_metric_Jacobian, all_parameters->do_renumber_dofs, all_parameters->output_high_order_grid))
     , fe_q_artificial_dissipation(1)
     , dof_handler_artificial_dissipation(*triangulation, false)
-    , mpi_communicator(MPI_COMM_WORLD)
+    , mpi_communicator(get_triangulation_mpi_communicator(*triangulation))
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
     , freeze_artificial_dissipation(false)
     , max_artificial_dissipation_coeff(0.0)
@@ -108,6 +113,19 @@ DGBase<dim,real,MeshType>::DGBase(
 
 }
 
+template <int dim, typename real, typename MeshType>
+DGBase<dim,real,MeshType>::~DGBase()
+{
+    // An exception cannot leave the destructor, such that a failed background output aborts.
+    try {
+        if (pending_vtk_output.valid()) pending_vtk_output.get();
+        if (pending_face_vtk_output.valid()) pending_face_vtk_output.get();
+    } catch (const std::exception &e) {
+        std::cerr << "Writing the vtk output in the background failed: " << e.what() << " Aborting..." << std::endl;
+        std::abort();
+    }
+}
+
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::reinit()
 {
@@ -310,7 +328,13 @@ unsigned int DGBase<dim,real,MeshType>::get_max_fe_degree()
         if(cell->is_locally_owned() && cell->active_fe_index() > max_fe_degree)
             max_fe_degree = cell->active_fe_index();
 
-    return dealii::Utilities::MPI::max(max_fe_degree, MPI_COMM_WORLD);
+    return dealii::Utilities::MPI::max(max_fe_degree, mpi_communicator);
+}
+
+template <int dim, typename real, typename MeshType>
+MPI_Comm DGBase<dim,real,MeshType>::get_mpi_communicator() const
+{
+    return mpi_communicator;
 }
 
 template <int dim, typename real, typename MeshType>
@@ -322,7 +346,7 @@ unsigned int DGBase<dim,real,MeshType>::get_min_fe_degree()
         if(cell->is_locally_owned() && cell->active_fe_index() < min_fe_degree)
             min_fe_degree = cell->active_fe_index();
 
-    return dealii::Utilities::MPI::min(min_fe_degree, MPI_COMM_WORLD);
+    return dealii::Utilities::MPI::min(min_fe_degree, mpi_communicator);
 }
 
 template <int dim, typename real, typename MeshType>
@@ -520,28 +544,31 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
     }
 
 
-    assemble_volume_term_and_build_operators(
-        current_cell,
-        current_cell_index,
-        current_dofs_indices,
-        current_metric_dofs_indices,
-        poly_degree,
-        grid_degree,
-        soln_basis_int,
-        flux_basis_int,
-        flux_basis_stiffness,
-        soln_basis_projection_oper_int,
-        soln_basis_projection_oper_ext,
-        metric_oper_int,
-        mapping_basis,
-        mapping_support_points,
-        fe_values_collection_volume,
-        fe_values_collection_volume_lagrange,
-        current_fe_ref,
-        current_cell_rhs,
-        current_cell_rhs_aux,
-        compute_auxiliary_right_hand_side,
-        compute_dRdW, compute_dRdX, compute_d2R);
+    {
+        Profiling::ScopedTimer volume_timer("volume_term");
+        assemble_volume_term_and_build_operators(
+            current_cell,
+            current_cell_index,
+            current_dofs_indices,
+            current_metric_dofs_indices,
+            poly_degree,
+            grid_degree,
+            soln_basis_int,
+            flux_basis_int,
+            flux_basis_stiffness,
+            soln_basis_projection_oper_int,
+            soln_basis_projection_oper_ext,
+            metric_oper_int,
+            mapping_basis,
+            mapping_support_points,
+            fe_values_collection_volume,
+            fe_values_collection_volume_lagrange,
+            current_fe_ref,
+            current_cell_rhs,
+            current_cell_rhs_aux,
+            compute_auxiliary_right_hand_side,
+            compute_dRdW, compute_dRdX, compute_d2R);
+    }
 
     (void) fe_values_collection_face_int;
     (void) fe_values_collection_face_ext;
@@ -557,6 +584,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
 
             const unsigned int boundary_id = current_face->boundary_id();
 
+            Profiling::ScopedTimer boundary_timer("boundary_term");
             assemble_boundary_term_and_build_operators(
                 current_cell,
                 current_cell_index,
@@ -622,6 +650,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
                                                                            store_vol_flux_nodes,
                                                                            store_surf_flux_nodes);
 
+                Profiling::ScopedTimer face_timer("face_term");
                 assemble_face_term_and_build_operators(
                     current_cell,
                     neighbor_cell,
@@ -792,6 +821,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
                                                                store_vol_flux_nodes,
                                                                store_surf_flux_nodes);
 
+            Profiling::ScopedTimer face_timer("face_term");
             assemble_face_term_and_build_operators(
                 current_cell,
                 neighbor_cell,
@@ -1087,6 +1117,216 @@ void DGBase<dim,real,MeshType>::reinit_operators_for_cell_residual_loop(
     mapping_basis.build_1D_shape_functions_at_flux_nodes(high_order_grid->oneD_fe_system, oneD_quadrature_collection[poly_degree_ext], oneD_face_quadrature);
 }
 
+template <int dim, typename real, typename MeshType>
+DGBase<dim,real,MeshType>::AssembleResidualScratchData::AssembleResidualScratchData(DGBase<dim,real,MeshType> &dg_input)
+    : dg(dg_input)
+    , high_order_mapping(dg.high_order_grid->mapping_fe_field.get())
+    , mapping_collection(*(dg.high_order_grid->mapping_fe_field))
+    , fe_values_collection_volume (mapping_collection, dg.fe_collection, dg.volume_quadrature_collection, dg.volume_update_flags)
+    , fe_values_collection_face_int (mapping_collection, dg.fe_collection, dg.face_quadrature_collection, dg.face_update_flags)
+    , fe_values_collection_face_ext (mapping_collection, dg.fe_collection, dg.face_quadrature_collection, dg.neighbor_face_update_flags)
+    , fe_values_collection_subface (mapping_collection, dg.fe_collection, dg.face_quadrature_collection, dg.face_update_flags)
+    , fe_values_collection_volume_lagrange (mapping_collection, dg.fe_collection_lagrange, dg.volume_quadrature_collection, dg.volume_update_flags)
+    , soln_basis_int(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , soln_basis_ext(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , flux_basis_int(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , flux_basis_ext(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , flux_basis_stiffness(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree(), true)
+    , soln_basis_projection_oper_int(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , soln_basis_projection_oper_ext(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , mapping_basis(1, dg.high_order_grid->fe_system.tensor_degree(), dg.high_order_grid->fe_system.tensor_degree())
+{
+    dg.reinit_operators_for_cell_residual_loop(
+        dg.max_degree, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree(),
+        soln_basis_int, soln_basis_ext,
+        flux_basis_int, flux_basis_ext,
+        flux_basis_stiffness,
+        soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
+        mapping_basis);
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::make_colored_locally_owned_cells()
+{
+    using CellIterator = typename dealii::DoFHandler<dim>::active_cell_iterator;
+
+    // A cell writes in its own residual and in the residual of its face neighbors.
+    // Use the active cell indices as the conflict indices.
+    const std::function<std::vector<dealii::types::global_dof_index>(const CellIterator &)> get_conflict_indices =
+        [](const CellIterator &cell) {
+            std::vector<dealii::types::global_dof_index> conflict_indices;
+            if (!cell->is_locally_owned()) return conflict_indices;
+
+            conflict_indices.push_back(cell->active_cell_index());
+            for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+                if (cell->face(iface)->at_boundary()) {
+                    if (cell->has_periodic_neighbor(iface) && cell->periodic_neighbor(iface)->is_active()) {
+                        conflict_indices.push_back(cell->periodic_neighbor(iface)->active_cell_index());
+                    }
+                } else if (cell->neighbor(iface)->is_active()) {
+                    // Finer neighbors are not written to; they list the current cell as their own neighbor.
+                    conflict_indices.push_back(cell->neighbor(iface)->active_cell_index());
+                }
+            }
+            return conflict_indices;
+        };
+
+    colored_locally_owned_cells = dealii::GraphColoring::make_graph_coloring(dof_handler.begin_active(), dof_handler.end(), get_conflict_indices);
+
+    // Non-locally owned cells have no conflicts and are not assembled.
+    for (auto &color : colored_locally_owned_cells) {
+        color.erase(std::remove_if(color.begin(), color.end(), [](const CellIterator &cell) { return !cell->is_locally_owned(); }), color.end());
+    }
+    colored_locally_owned_cells.erase(
+        std::remove_if(colored_locally_owned_cells.begin(), colored_locally_owned_cells.end(),
+                       [](const std::vector<CellIterator> &color) { return color.empty(); }),
+        colored_locally_owned_cells.end());
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::add_to_derivative_matrix(
+    dealii::TrilinosWrappers::SparseMatrix &matrix,
+    const dealii::types::global_dof_index row,
+    const std::vector<dealii::types::global_dof_index> &columns,
+    const std::vector<real> &values,
+    const bool elide_zero_values)
+{
+    AssembleResidualCopyData *const copy_data = thread_copy_data.get();
+    if (copy_data == nullptr) {
+        matrix.add(row, columns, values, elide_zero_values);
+        return;
+    }
+    copy_data->matrix_rows.push_back({&matrix, row, columns, values, elide_zero_values});
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::set_hyper_reduction_row_weights(const dealii::LinearAlgebra::distributed::Vector<double> &row_weights)
+{
+    hyper_reduction_row_weights.reinit(solution);
+    hyper_reduction_row_weights.copy_locally_owned_data_from(row_weights);
+    hyper_reduction_row_weights.update_ghost_values();
+
+    // The weights are equal on the dofs of a cell, such that its first dof tells whether it is sampled.
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    const auto is_sampled = [&](const auto &cell) {
+        dofs_indices.resize(fe_collection[cell->active_fe_index()].n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        return hyper_reduction_row_weights[dofs_indices[0]] != 0.0;
+    };
+
+    // The face terms of a sampled cell are also computed by its neighbors.
+    cell_is_in_sample_mesh.assign(triangulation->n_active_cells(), false);
+    unsigned int n_sampled_cells = 0;
+    unsigned int n_sample_mesh_cells = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const bool cell_is_sampled = is_sampled(cell);
+        bool in_sample_mesh = cell_is_sampled;
+        for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell && !in_sample_mesh; ++iface) {
+            if (cell->face(iface)->at_boundary()) {
+                if (cell->has_periodic_neighbor(iface) && cell->periodic_neighbor(iface)->is_active()) {
+                    in_sample_mesh = is_sampled(cell->periodic_neighbor(iface));
+                }
+            } else if (cell->neighbor(iface)->is_active()) {
+                in_sample_mesh = is_sampled(cell->neighbor(iface));
+            } else {
+                for (unsigned int isubface=0; isubface < cell->face(iface)->n_children(); ++isubface) {
+                    if (is_sampled(cell->neighbor_child_on_subface(iface, isubface))) in_sample_mesh = true;
+                }
+            }
+        }
+        cell_is_in_sample_mesh[cell->active_cell_index()] = in_sample_mesh;
+        if (cell_is_sampled) ++n_sampled_cells;
+        if (in_sample_mesh) ++n_sample_mesh_cells;
+    }
+    use_hyper_reduction = true;
+
+    pcout << "Hyper-reduction samples " << dealii::Utilities::MPI::sum(n_sampled_cells, mpi_communicator)
+          << " cells and assembles " << dealii::Utilities::MPI::sum(n_sample_mesh_cells, mpi_communicator)
+          << " of the " << triangulation->n_global_active_cells() << " cells." << std::endl;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::clear_hyper_reduction()
+{
+    use_hyper_reduction = false;
+    cell_is_in_sample_mesh.clear();
+    hyper_reduction_row_weights.reinit(0);
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::update_system_matrix_transpose()
+{
+    if (!system_matrix_transpose_is_outdated) return;
+
+    Epetra_CrsMatrix *input_matrix  = const_cast<Epetra_CrsMatrix *>(&(system_matrix.trilinos_matrix()));
+    Epetra_CrsMatrix *output_matrix;
+    epetra_rowmatrixtransposer_dRdW = std::make_unique<Epetra_RowMatrixTransposer> ( input_matrix );
+    const bool make_data_contiguous = true;
+    int error_transpose = epetra_rowmatrixtransposer_dRdW->CreateTranspose( make_data_contiguous, output_matrix);
+    if (error_transpose) {
+        std::cout << "Failed to create dRdW transpose... Aborting" << std::endl;
+        //std::abort();
+    }
+    bool copy_values = true;
+    system_matrix_transpose.reinit(*output_matrix, copy_values);
+    delete(output_matrix);
+
+    system_matrix_transpose_is_outdated = false;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::mark_system_matrix_as_modified()
+{
+    system_matrix_transpose_is_outdated = true;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::apply_dRdW(
+    const dealii::LinearAlgebra::distributed::Vector<double> &direction,
+    dealii::LinearAlgebra::distributed::Vector<double> &dRdW_times_direction_output)
+{
+    AssertThrow(all_parameters->use_weak_form, dealii::ExcMessage("Matrix-free dRdW is only available for the weak form."));
+
+    if (!dRdW_direction.partitioners_are_compatible(*solution.get_partitioner())) {
+        dRdW_direction.reinit(solution);
+        dRdW_times_direction.reinit(right_hand_side);
+    }
+    dRdW_direction.copy_locally_owned_data_from(direction);
+    dRdW_direction.update_ghost_values();
+    dRdW_times_direction = 0.0;
+
+    matrix_free_derivatives = MatrixFreeDerivatives::dRdW_times_direction;
+    assemble_residual();
+    matrix_free_derivatives = MatrixFreeDerivatives::none;
+
+    // Contributions of the faces shared with other processors.
+    dRdW_times_direction.compress(dealii::VectorOperation::add);
+    dRdW_times_direction_output.copy_locally_owned_data_from(dRdW_times_direction);
+    dRdW_times_direction_output.update_ghost_values();
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::assemble_dRdW_diagonal_blocks(std::vector<dealii::FullMatrix<real>> &diagonal_blocks)
+{
+    AssertThrow(all_parameters->use_weak_form, dealii::ExcMessage("Matrix-free dRdW is only available for the weak form."));
+
+    // The face terms also add to the blocks of the ghost neighbors, which are later discarded.
+    diagonal_blocks.resize(triangulation->n_active_cells());
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (cell->is_artificial()) continue;
+        const unsigned int n_dofs_cell = fe_collection[cell->active_fe_index()].n_dofs_per_cell();
+        diagonal_blocks[cell->active_cell_index()].reinit(n_dofs_cell, n_dofs_cell);
+    }
+
+    dRdW_diagonal_blocks = &diagonal_blocks;
+    matrix_free_derivatives = MatrixFreeDerivatives::dRdW_diagonal_blocks;
+    assemble_residual();
+    matrix_free_derivatives = MatrixFreeDerivatives::none;
+    dRdW_diagonal_blocks = nullptr;
+}
+
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R, const double CFL_mass)
 {
@@ -1096,11 +1336,21 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         &&  !(compute_dRdX && compute_d2R)
             , dealii::ExcMessage("Can only do one at a time compute_dRdW or compute_dRdX or compute_d2R"));
 
+    // The assembly of the AD derivatives is reported separately from the residual evaluations
+    Profiling::ScopedTimer assembly_timer((compute_dRdW || compute_dRdX || compute_d2R) ? "assemble_derivatives" : "assemble_residual");
+
     max_artificial_dissipation_coeff = 0.0;
     //pcout << "Assembling DG residual...";
     if (compute_dRdW) {
         pcout << " with dRdW...";
 
+        // Not allocated by allocate_system() when only the matrix-free derivatives were expected.
+        if (system_matrix.m() != solution.size() || solution_dRdW.size() != solution.size()) {
+            allocate_dRdW();
+            solution_dRdW.reinit(solution);
+            volume_nodes_dRdW.reinit(high_order_grid->volume_nodes);
+        }
+
         auto diff_sol = solution;
         diff_sol -= solution_dRdW;
         const double l2_norm_sol = diff_sol.l2_norm();
@@ -1198,40 +1448,11 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
     right_hand_side = 0;
 
 
-    //const dealii::MappingManifold<dim,dim> mapping;
-    //const dealii::MappingQ<dim,dim> mapping(10);//;max_degree+1);
-    //const dealii::MappingQ<dim,dim> mapping(high_order_grid->max_degree);
-    //const dealii::MappingQGeneric<dim,dim> mapping(high_order_grid->max_degree);
-    const auto mapping = (*(high_order_grid->mapping_fe_field));
-
-    dealii::hp::MappingCollection<dim> mapping_collection(mapping);
-
-    dealii::hp::FEValues<dim,dim>        fe_values_collection_volume (mapping_collection, fe_collection, volume_quadrature_collection, this->volume_update_flags); ///< FEValues of volume.
-    dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_int (mapping_collection, fe_collection, face_quadrature_collection, this->face_update_flags); ///< FEValues of interior face.
-    dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_ext (mapping_collection, fe_collection, face_quadrature_collection, this->neighbor_face_update_flags); ///< FEValues of exterior face.
-    dealii::hp::FESubfaceValues<dim,dim> fe_values_collection_subface (mapping_collection, fe_collection, face_quadrature_collection, this->face_update_flags); ///< FEValues of subface.
-
-    dealii::hp::FEValues<dim,dim>        fe_values_collection_volume_lagrange (mapping_collection, fe_collection_lagrange, volume_quadrature_collection, this->volume_update_flags);
-
-    const unsigned int init_grid_degree = high_order_grid->fe_system.tensor_degree();
-    OPERATOR::basis_functions<dim,2*dim> soln_basis_int(1, max_degree, init_grid_degree); 
-    OPERATOR::basis_functions<dim,2*dim> soln_basis_ext(1, max_degree, init_grid_degree); 
-    OPERATOR::basis_functions<dim,2*dim> flux_basis_int(1, max_degree, init_grid_degree); 
-    OPERATOR::basis_functions<dim,2*dim> flux_basis_ext(1, max_degree, init_grid_degree); 
-    OPERATOR::local_basis_stiffness<dim,2*dim> flux_basis_stiffness(1, max_degree, init_grid_degree, true); 
-    OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper_int(1, max_degree, init_grid_degree); 
-    OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper_ext(1, max_degree, init_grid_degree); 
-    OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis(1, init_grid_degree, init_grid_degree);
-
-    reinit_operators_for_cell_residual_loop(
-        max_degree, max_degree, init_grid_degree, 
-        soln_basis_int, soln_basis_ext, 
-        flux_basis_int, flux_basis_ext, 
-        flux_basis_stiffness, 
-        soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
-        mapping_basis);
 
-    solution.update_ghost_values();
+    {
+        Profiling::ScopedTimer ghost_exchange_timer("ghost_exchange");
+        solution.update_ghost_values();
+    }
 
 
     int assembly_error = 0;
@@ -1243,40 +1464,145 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         // updates model variables only if there is a model
         if(all_parameters->pde_type == Parameters::AllParameters::PartialDifferentialEquation::physics_model) update_model_variables();
 
+        // clears the stored metric terms if the grid has moved since they were computed.
+        if(all_parameters->use_metric_terms_cache) metric_terms_cache.check_grid_and_reinit(high_order_grid->get_volume_nodes_version(), triangulation->n_active_cells());
+
         // assembles and solves for auxiliary variable if necessary.
-        assemble_auxiliary_residual();
+        {
+            Profiling::ScopedTimer auxiliary_timer("auxiliary_residual");
+            assemble_auxiliary_residual();
+        }
 
         dealii::Timer timer;
         if(all_parameters->store_residual_cpu_time){
             timer.start();
         }
 
-        auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
-        for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
-            if (!soln_cell->is_locally_owned()) continue;
+        // Volume terms assembled by groups of cells, which the cell loop then adds to the residual.
+        assemble_volume_terms_in_cell_batches();
 
-            // Add right-hand side contributions this cell can compute
-            assemble_cell_residual (
-                soln_cell,
-                metric_cell,
-                compute_dRdW, compute_dRdX, compute_d2R,
-                fe_values_collection_volume,
-                fe_values_collection_face_int,
-                fe_values_collection_face_ext,
-                fe_values_collection_subface,
-                fe_values_collection_volume_lagrange,
-                soln_basis_int,
-                soln_basis_ext,
-                flux_basis_int,
-                flux_basis_ext,
-                flux_basis_stiffness,
-                soln_basis_projection_oper_int,
-                soln_basis_projection_oper_ext,
-                mapping_basis,
-                false,
-                right_hand_side,
-                auxiliary_right_hand_side);
-        } // end of cell loop
+        // The derivatives are seeded in local Fad variables, such that each thread differentiates its own cells.
+        // Only the rows of the sparse derivative matrices go through the copy data, see add_to_derivative_matrix().
+        const bool use_threads = (all_parameters->n_threads_per_process > 1);
+        if (use_threads) {
+            using CellIterator = typename dealii::DoFHandler<dim>::active_cell_iterator;
+            if (colored_locally_owned_cells.empty()) make_colored_locally_owned_cells();
+
+            const auto assemble_cell = [&](const CellIterator &soln_cell, AssembleResidualCopyData &, AssembleResidualCopyData &copy_data) {
+                copy_data.matrix_rows.clear();
+                if (use_hyper_reduction && !cell_is_in_sample_mesh[soln_cell->active_cell_index()]) return;
+                std::unique_ptr<AssembleResidualScratchData> &thread_scratch = thread_scratch_data.get();
+                if (!thread_scratch || thread_scratch->high_order_mapping != high_order_grid->mapping_fe_field.get()) {
+                    thread_scratch = std::make_unique<AssembleResidualScratchData>(*this);
+                }
+                AssembleResidualScratchData &scratch = *thread_scratch;
+                thread_copy_data.get() = &copy_data;
+                const CellIterator metric_cell(triangulation.get(), soln_cell->level(), soln_cell->index(), &high_order_grid->dof_handler_grid);
+                // Add right-hand side contributions this cell can compute
+                assemble_cell_residual (
+                    soln_cell,
+                    metric_cell,
+                    compute_dRdW, compute_dRdX, compute_d2R,
+                    scratch.fe_values_collection_volume,
+                    scratch.fe_values_collection_face_int,
+                    scratch.fe_values_collection_face_ext,
+                    scratch.fe_values_collection_subface,
+                    scratch.fe_values_collection_volume_lagrange,
+                    scratch.soln_basis_int,
+                    scratch.soln_basis_ext,
+                    scratch.flux_basis_int,
+                    scratch.flux_basis_ext,
+                    scratch.flux_basis_stiffness,
+                    scratch.soln_basis_projection_oper_int,
+                    scratch.soln_basis_projection_oper_ext,
+                    scratch.mapping_basis,
+                    false,
+                    right_hand_side,
+                    auxiliary_right_hand_side);
+                thread_copy_data.get() = nullptr;
+            };
+            // Cells of the same color do not write in the same residual, but the colored WorkStream runs
+            // the copiers concurrently and the Trilinos matrices are not thread-safe.
+            std::mutex derivative_matrices_mutex;
+            const auto copy_cell = [&derivative_matrices_mutex](const AssembleResidualCopyData &copy_data) {
+                if (copy_data.matrix_rows.empty()) return;
+                const std::lock_guard<std::mutex> lock(derivative_matrices_mutex);
+                for (const auto &matrix_row : copy_data.matrix_rows) {
+                    matrix_row.matrix->add(matrix_row.row, matrix_row.columns, matrix_row.values, matrix_row.elide_zero_values);
+                }
+            };
+
+            // The calling thread only assembles some of the cells, such that the timers of the terms
+            // would measure an arbitrary subset. Only the whole threaded loop is timed.
+            Profiling::ScopedTimer threaded_cell_loop_timer("threaded_cell_loop");
+            const Profiling::ScopedSuspension suspend_inner_timers;
+            dealii::WorkStream::run(colored_locally_owned_cells,
+                                    assemble_cell,
+                                    copy_cell,
+                                    AssembleResidualCopyData(),
+                                    AssembleResidualCopyData());
+        } else {
+            //const dealii::MappingManifold<dim,dim> mapping;
+            //const dealii::MappingQ<dim,dim> mapping(10);//;max_degree+1);
+            //const dealii::MappingQ<dim,dim> mapping(high_order_grid->max_degree);
+            //const dealii::MappingQGeneric<dim,dim> mapping(high_order_grid->max_degree);
+            const auto mapping = (*(high_order_grid->mapping_fe_field));
+
+            dealii::hp::MappingCollection<dim> mapping_collection(mapping);
+
+            dealii::hp::FEValues<dim,dim>        fe_values_collection_volume (mapping_collection, fe_collection, volume_quadrature_collection, this->volume_update_flags); ///< FEValues of volume.
+            dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_int (mapping_collection, fe_collection, face_quadrature_collection, this->face_update_flags); ///< FEValues of interior face.
+            dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_ext (mapping_collection, fe_collection, face_quadrature_collection, this->neighbor_face_update_flags); ///< FEValues of exterior face.
+            dealii::hp::FESubfaceValues<dim,dim> fe_values_collection_subface (mapping_collection, fe_collection, face_quadrature_collection, this->face_update_flags); ///< FEValues of subface.
+
+            dealii::hp::FEValues<dim,dim>        fe_values_collection_volume_lagrange (mapping_collection, fe_collection_lagrange, volume_quadrature_collection, this->volume_update_flags);
+
+            const unsigned int init_grid_degree = high_order_grid->fe_system.tensor_degree();
+            OPERATOR::basis_functions<dim,2*dim> soln_basis_int(1, max_degree, init_grid_degree); 
+            OPERATOR::basis_functions<dim,2*dim> soln_basis_ext(1, max_degree, init_grid_degree); 
+            OPERATOR::basis_functions<dim,2*dim> flux_basis_int(1, max_degree, init_grid_degree); 
+            OPERATOR::basis_functions<dim,2*dim> flux_basis_ext(1, max_degree, init_grid_degree); 
+            OPERATOR::local_basis_stiffness<dim,2*dim> flux_basis_stiffness(1, max_degree, init_grid_degree, true); 
+            OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper_int(1, max_degree, init_grid_degree); 
+            OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper_ext(1, max_degree, init_grid_degree); 
+            OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis(1, init_grid_degree, init_grid_degree);
+
+            reinit_operators_for_cell_residual_loop(
+                max_degree, max_degree, init_grid_degree, 
+                soln_basis_int, soln_basis_ext, 
+                flux_basis_int, flux_basis_ext, 
+                flux_basis_stiffness, 
+                soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
+                mapping_basis);
+
+            auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
+            for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
+                if (!soln_cell->is_locally_owned()) continue;
+                if (use_hyper_reduction && !cell_is_in_sample_mesh[soln_cell->active_cell_index()]) continue;
+
+                // Add right-hand side contributions this cell can compute
+                assemble_cell_residual (
+                    soln_cell,
+                    metric_cell,
+                    compute_dRdW, compute_dRdX, compute_d2R,
+                    fe_values_collection_volume,
+                    fe_values_collection_face_int,
+                    fe_values_collection_face_ext,
+                    fe_values_collection_subface,
+                    fe_values_collection_volume_lagrange,
+                    soln_basis_int,
+                    soln_basis_ext,
+                    flux_basis_int,
+                    flux_basis_ext,
+                    flux_basis_stiffness,
+                    soln_basis_projection_oper_int,
+                    soln_basis_projection_oper_ext,
+                    mapping_basis,
+                    false,
+                    right_hand_side,
+                    auxiliary_right_hand_side);
+            } // end of cell loop
+        }
 
         if(all_parameters->store_residual_cpu_time){
             timer.stop();
@@ -1284,6 +1610,8 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         }
     } catch(...) {
         assembly_error = 1;
+        // A cell interrupted in the threaded loop leaves the copy data of its thread set.
+        thread_copy_data.clear();
     }
     const int mpi_assembly_error = dealii::Utilities::MPI::sum(assembly_error, mpi_communicator);
 
@@ -1309,10 +1637,20 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         //}
     }
 
-    right_hand_side.compress(dealii::VectorOperation::add);
-    right_hand_side.update_ghost_values();
+    {
+        Profiling::ScopedTimer ghost_exchange_timer("ghost_exchange");
+        right_hand_side.compress(dealii::VectorOperation::add);
+        if (use_hyper_reduction) right_hand_side.scale(hyper_reduction_row_weights);
+        right_hand_side.update_ghost_values();
+    }
     if ( compute_dRdW ) {
         system_matrix.compress(dealii::VectorOperation::add);
+        if (use_hyper_reduction) {
+            // The rows of the matrix are the locally owned dofs, in the same order as the vector entries.
+            Epetra_CrsMatrix &epetra_system_matrix = const_cast<Epetra_CrsMatrix &>(system_matrix.trilinos_matrix());
+            const Epetra_Vector epetra_row_weights(View, epetra_system_matrix.RowMap(), hyper_reduction_row_weights.begin());
+            epetra_system_matrix.LeftScale(epetra_row_weights);
+        }
 
         if (global_mass_matrix.m() != system_matrix.m()) {
             const bool do_inverse_mass_matrix = false;
@@ -1323,19 +1661,8 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
             add_time_scaled_mass_matrices();
         }
 
-        Epetra_CrsMatrix *input_matrix  = const_cast<Epetra_CrsMatrix *>(&(system_matrix.trilinos_matrix()));
-        Epetra_CrsMatrix *output_matrix;
-        epetra_rowmatrixtransposer_dRdW = std::make_unique<Epetra_RowMatrixTransposer> ( input_matrix );
-        const bool make_data_contiguous = true;
-        int error_transpose = epetra_rowmatrixtransposer_dRdW->CreateTranspose( make_data_contiguous, output_matrix);
-        if (error_transpose) {
-            std::cout << "Failed to create dRdW transpose... Aborting" << std::endl;
-            //std::abort();
-        }
-        bool copy_values = true;
-        system_matrix_transpose.reinit(*output_matrix, copy_values);
-        delete(output_matrix);
-
+        // The transpose is only built once an adjoint requests it.
+        system_matrix_transpose_is_outdated = true;
     }
     if ( compute_dRdX ) dRdXv.compress(dealii::VectorOperation::add);
     if ( compute_d2R ) {
@@ -1461,6 +1788,77 @@ unsigned int DGBase<dim,real,MeshType>::n_dofs () const
 }
 
 
+/// DataOut type exposing the patches it has built.
+/** Allows the vtk files to be written from a copy of the patches once the DG state has moved on. */
+template <typename DataOutType>
+class DataOutWithPatchAccess : public DataOutType
+{
+public:
+    using DataOutType::get_patches;
+    using DataOutType::get_dataset_names;
+    using DataOutType::get_nonscalar_data_ranges;
+};
+
+/// Writes the vtu file of the current process and, if master_filename is not empty, the pvtu record.
+template <int patch_dim, int spacedim, typename NonscalarDataRanges>
+void write_vtu_and_pvtu_record (
+    const std::vector<dealii::DataOutBase::Patch<patch_dim,spacedim>> &patches,
+    const std::vector<std::string> &dataset_names,
+    const NonscalarDataRanges &nonscalar_data_ranges,
+    const dealii::DataOutBase::VtkFlags &vtkflags,
+    const std::string &filename,
+    const std::string &master_filename,
+    const std::vector<std::string> &piece_filenames)
+{
+    std::ofstream output(filename);
+    dealii::DataOutBase::write_vtu(patches, dataset_names, nonscalar_data_ranges, vtkflags, output);
+
+    if (!master_filename.empty()) {
+        std::ofstream master_output(master_filename);
+        dealii::DataOutBase::write_pvtu_record(master_output, piece_filenames, dataset_names, nonscalar_data_ranges, vtkflags);
+    }
+}
+
+/// Writes the files built by data_out, either right away or on a background thread.
+/** In the background case, the previous output tracked by pending_output must have been completed,
+ *  see DGBase::wait_for_pending_vtk_output().
+ */
+template <typename DataOutType>
+void launch_vtk_output (
+    const DataOutWithPatchAccess<DataOutType> &data_out,
+    const dealii::DataOutBase::VtkFlags &vtkflags,
+    const std::string &filename,
+    const std::string &master_filename,
+    const std::vector<std::string> &piece_filenames,
+    const bool asynchronous,
+    std::future<void> &pending_output)
+{
+    Assert(!pending_output.valid(), dealii::ExcMessage("The previous vtk output has not been completed."));
+
+    if (!asynchronous) {
+        write_vtu_and_pvtu_record(data_out.get_patches(), data_out.get_dataset_names(), data_out.get_nonscalar_data_ranges(),
+                                  vtkflags, filename, master_filename, piece_filenames);
+        return;
+    }
+    pending_output = std::async(std::launch::async,
+        [patches = data_out.get_patches(),
+         dataset_names = data_out.get_dataset_names(),
+         nonscalar_data_ranges = data_out.get_nonscalar_data_ranges(),
+         vtkflags, filename, master_filename, piece_filenames] ()
+        {
+            write_vtu_and_pvtu_record(patches, dataset_names, nonscalar_data_ranges,
+                                      vtkflags, filename, master_filename, piece_filenames);
+        });
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::wait_for_pending_vtk_output ()
+{
+    Profiling::ScopedTimer wait_timer("wait_for_vtk_output");
+    if (pending_vtk_output.valid()) pending_vtk_output.get();
+    if (pending_face_vtk_output.valid()) pending_face_vtk_output.get();
+}
+
 #if PHILIP_DIM > 1
 template <int dim, typename DoFHandlerType = dealii::DoFHandler<dim>>
 class DataOutEulerFaces : public dealii::DataOutFaces<dim, DoFHandlerType>
@@ -1630,8 +2028,11 @@ public:
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::output_face_results_vtk (const unsigned int cycle, const double current_time)// const
 {
+    Profiling::ScopedTimer output_timer("output_face_vtk");
+    // At most one output is pending, such that a single copy of the patches is held.
+    wait_for_pending_vtk_output();
 
-    DataOutEulerFaces<dim, dealii::DoFHandler<dim>> data_out;
+    DataOutWithPatchAccess<DataOutEulerFaces<dim, dealii::DoFHandler<dim>>> data_out;
 
     data_out.attach_dof_handler (dof_handler);
 
@@ -1723,12 +2124,11 @@ void DGBase<dim,real,MeshType>::output_face_results_vtk (const unsigned int cycl
     filename += dealii::Utilities::int_to_string(cycle, 4) + ".";
     filename += dealii::Utilities::int_to_string(iproc, 4);
     filename += ".vtu";
-    std::ofstream output(filename);
-    data_out.write_vtu(output);
     //std::cout << "Writing out file: " << filename << std::endl;
 
+    std::vector<std::string> filenames;
+    std::string master_fn;
     if (iproc == 0) {
-        std::vector<std::string> filenames;
         for (unsigned int iproc = 0; iproc < dealii::Utilities::MPI::n_mpi_processes(mpi_communicator); ++iproc) {
             std::string fn = "surface_solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
             fn += dealii::Utilities::int_to_string(cycle, 4) + ".";
@@ -1736,24 +2136,27 @@ void DGBase<dim,real,MeshType>::output_face_results_vtk (const unsigned int cycl
             fn += ".vtu";
             filenames.push_back(fn);
         }
-        std::string master_fn = this->all_parameters->solution_vtk_files_directory_name + "/" + "surface_solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
+        master_fn = this->all_parameters->solution_vtk_files_directory_name + "/" + "surface_solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
         master_fn += dealii::Utilities::int_to_string(cycle, 4) + ".pvtu";
-        std::ofstream master_output(master_fn);
-        data_out.write_pvtu_record(master_output, filenames);
     }
 
+    // The patches only depend on the DG state while being built; compression and writing may overlap with the time stepping.
+    launch_vtk_output(data_out, vtkflags, filename, master_fn, filenames, this->all_parameters->enable_asynchronous_vtk_output, pending_face_vtk_output);
 }
 #endif
 
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle, const double current_time)// const
 {
+    Profiling::ScopedTimer output_timer("output_vtk");
+    // At most one output is pending, such that a single copy of the patches is held.
+    wait_for_pending_vtk_output();
 #if PHILIP_DIM>1
     if(this->all_parameters->output_face_results_vtk) output_face_results_vtk (cycle, current_time);
 #endif
 
     const bool enable_higher_order_vtk_output = this->all_parameters->enable_higher_order_vtk_output;
-    dealii::DataOut<dim, dealii::DoFHandler<dim>> data_out;
+    DataOutWithPatchAccess<dealii::DataOut<dim, dealii::DoFHandler<dim>>> data_out;
 
     data_out.attach_dof_handler (dof_handler);
 
@@ -1827,12 +2230,11 @@ void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle, co
     filename += dealii::Utilities::int_to_string(cycle, 4) + ".";
     filename += dealii::Utilities::int_to_string(iproc, 4);
     filename += ".vtu";
-    std::ofstream output(filename);
-    data_out.write_vtu(output);
     //std::cout << "Writing out file: " << filename << std::endl;
 
+    std::vector<std::string> filenames;
+    std::string master_fn;
     if (iproc == 0) {
-        std::vector<std::string> filenames;
         for (unsigned int iproc = 0; iproc < dealii::Utilities::MPI::n_mpi_processes(mpi_communicator); ++iproc) {
             std::string fn = "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
             fn += dealii::Utilities::int_to_string(cycle, 4) + ".";
@@ -1840,12 +2242,12 @@ void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle, co
             fn += ".vtu";
             filenames.push_back(fn);
         }
-        std::string master_fn = this->all_parameters->solution_vtk_files_directory_name + "/" + "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
+        master_fn = this->all_parameters->solution_vtk_files_directory_name + "/" + "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
         master_fn += dealii::Utilities::int_to_string(cycle, 4) + ".pvtu";
-        std::ofstream master_output(master_fn);
-        data_out.write_pvtu_record(master_output, filenames);
     }
 
+    // The patches only depend on the DG state while being built; compression and writing may overlap with the time stepping.
+    launch_vtk_output(data_out, vtkflags, filename, master_fn, filenames, this->all_parameters->enable_asynchronous_vtk_output, pending_vtk_output);
 }
 
 template <int dim, typename real, typename MeshType>
@@ -1896,6 +2298,13 @@ void DGBase<dim,real,MeshType>::allocate_system (
     max_dt_cell.reinit(triangulation->n_active_cells());
     cell_volume.reinit(triangulation->n_active_cells());
 
+    // Cells are colored again, and the scratch data of the threads rebuilt, at the next threaded residual assembly.
+    colored_locally_owned_cells.clear();
+    thread_scratch_data.clear();
+
+    // The sampled cells are only valid for the previous mesh and distribution of the dofs.
+    clear_hyper_reduction();
+
     // allocates model variables only if there is a model
     if(all_parameters->pde_type == Parameters::AllParameters::PartialDifferentialEquation::physics_model) allocate_model_variables();
 
@@ -1919,19 +2328,14 @@ void DGBase<dim,real,MeshType>::allocate_system (
 
     // System matrix allocation
     if (compute_dRdW || compute_dRdX || compute_d2R) {
-        dealii::DynamicSparsityPattern dsp(locally_relevant_dofs);
-        dealii::DoFTools::make_flux_sparsity_pattern(dof_handler, dsp);
-        dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_relevant_dofs);
-
-        sparsity_pattern.copy_from(dsp);
-        
-        system_matrix.reinit(locally_owned_dofs, sparsity_pattern, mpi_communicator);
+        allocate_dRdW();
     }
 
     // Make sure that derivatives are cleared when reallocating DG objects.
     // The call to assemble the derivatives will reallocate those derivatives
     // if they are ever needed.
     system_matrix_transpose.clear();
+    system_matrix_transpose_is_outdated = false;
     dRdXv.clear();
     d2RdWdX.clear();
     d2RdWdW.clear();
@@ -2008,6 +2412,19 @@ void DGBase<dim,real,MeshType>::allocate_second_derivatives ()
     }
 }
 
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::allocate_dRdW ()
+{
+    // System matrix allocation
+    dealii::DynamicSparsityPattern dsp(locally_relevant_dofs);
+    dealii::DoFTools::make_flux_sparsity_pattern(dof_handler, dsp);
+    dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_relevant_dofs);
+
+    sparsity_pattern.copy_from(dsp);
+
+    system_matrix.reinit(locally_owned_dofs, sparsity_pattern, mpi_communicator);
+}
+
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::allocate_dRdX ()
 {
@@ -2015,7 +2432,7 @@ void DGBase<dim,real,MeshType>::allocate_dRdX ()
     dealii::SparsityPattern dRdXv_sparsity_pattern = get_dRdX_sparsity_pattern ();
     const dealii::IndexSet &row_parallel_partitioning = locally_owned_dofs;
     const dealii::IndexSet &col_parallel_partitioning = high_order_grid->locally_owned_dofs_grid;
-    dRdXv.reinit(row_parallel_partitioning, col_parallel_partitioning, dRdXv_sparsity_pattern, MPI_COMM_WORLD);
+    dRdXv.reinit(row_parallel_partitioning, col_parallel_partitioning, dRdXv_sparsity_pattern, mpi_communicator);
 }
 
 template <int dim, typename real, typename MeshType>
@@ -2450,6 +2867,7 @@ void DGBase<dim,real,MeshType>::apply_inverse_global_mass_matrix(
         dealii::LinearAlgebra::distributed::Vector<double> &output_vector,
         const bool use_auxiliary_eq)
 {
+    Profiling::ScopedTimer inverse_mass_timer("inverse_mass_application");
     using FR_enum = Parameters::AllParameters::Flux_Reconstruction;
     using FR_Aux_enum = Parameters::AllParameters::Flux_Reconstruction_Aux;
     const FR_enum FR_Type = this->all_parameters->flux_reconstruction_type;
@@ -2794,11 +3212,13 @@ template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::add_mass_matrices(const real scale)
 {
     system_matrix.add(scale, global_mass_matrix);
+    system_matrix_transpose_is_outdated = true;
 }
 template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::add_time_scaled_mass_matrices()
 {
     system_matrix.add(1.0, time_scaled_global_mass_matrix);
+    system_matrix_transpose_is_outdated = true;
 }
 template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::time_scaled_mass_matrices(const real dt_scale)
@@ -5,6 +5,7 @@
 #include <deal.II/base/parameter_handler.h>
 
 #include <deal.II/base/qprojector.h>
+#include <deal.II/base/thread_local_storage.h>
 
 #include <deal.II/grid/tria.h>
 
@@ -21,6 +22,7 @@
 #include <deal.II/hp/fe_values.h>
 
 #include <deal.II/lac/vector.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
@@ -41,8 +43,10 @@
 #include "parameters/all_parameters.h"
 #include "operators/operators.h"
 #include "artificial_dissipation_factory.h"
+#include "metric_terms_cache.hpp"
 
 #include <time.h>
+#include <future>
 #include <deal.II/base/timer.h>
 
 // Template specialization of MappingFEField
@@ -109,7 +113,8 @@ public:
     const unsigned int max_grid_degree;
 
     /// Destructor
-    virtual ~DGBase() = default;
+    /** Completes the vtk files still being written in the background, and aborts if writing them failed. */
+    virtual ~DGBase();
 
     /// Principal constructor that will call delegated constructor.
     /** Will initialize mapping, fe_dg, all_parameters, volume_quadrature, and face_quadrature
@@ -159,6 +164,8 @@ public:
 
     std::shared_ptr<Triangulation> triangulation; ///< Mesh
 
+    /// Communicator over which the triangulation, and therefore the solution and the matrices, are distributed.
+    MPI_Comm get_mpi_communicator() const;
 
     /// Sets the associated high order grid with the provided one.
     void set_high_order_grid(std::shared_ptr<HighOrderGrid<dim,real,MeshType>> new_high_order_grid);
@@ -186,6 +193,12 @@ public:
                                   const bool compute_d2R = true);
 
 private:
+    /// Allocates the residual derivatives w.r.t the solution, i.e. the system_matrix.
+    /** Is called by allocate_system() if any derivative is requested, or when assembling dRdW
+     *  if the system_matrix has not been allocated.
+     */
+    virtual void allocate_dRdW ();
+
     /// Allocates the second derivatives.
     /** Is called when assembling the residual's second derivatives, and is currently empty
      *  due to being cleared by the allocate_system().
@@ -337,11 +350,45 @@ public:
 
     /// System matrix corresponding to the derivative of the right_hand_side with
     /// respect to the solution TRANSPOSED.
+    /** Only built by update_system_matrix_transpose(), which must be called before using it.
+     */
     dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose;
 
     /// Epetra_RowMatrixTransposer used to transpose the system_matrix.
     std::unique_ptr<Epetra_RowMatrixTransposer> epetra_rowmatrixtransposer_dRdW;
 
+    /// Builds system_matrix_transpose if the system_matrix has been assembled since its last transpose.
+    /** The transpose is only needed by the adjoint-based methods. It is therefore not built by
+     *  assemble_residual(), such that a plain steady or implicit solve does not store the Jacobian twice.
+     */
+    void update_system_matrix_transpose();
+
+    /// Flags the system_matrix_transpose as outdated after the system_matrix was modified in place.
+    /** add_mass_matrices() and add_time_scaled_mass_matrices() already do so.
+     */
+    void mark_system_matrix_as_modified();
+
+    /// Applies dRdW to a direction without assembling the Jacobian.
+    /** The residual of each cell is evaluated with forward-mode automatic differentiation (FadType),
+     *  where the solution coefficients are seeded with the given direction. Therefore, only a single
+     *  derivative is carried and no global matrix is stored.
+     *  The right_hand_side is also re-evaluated at the current solution.
+     *  Only available for the weak form.
+     */
+    void apply_dRdW(
+        const dealii::LinearAlgebra::distributed::Vector<double> &direction,
+        dealii::LinearAlgebra::distributed::Vector<double> &dRdW_times_direction_output);
+
+    /// Assembles the diagonal blocks of dRdW, one dense block per active cell, without the global Jacobian.
+    /** The blocks are indexed by active_cell_index, and only the blocks of the locally owned cells should be used.
+     *  A face shared with another processor is only assembled by one of them, such that the other processor
+     *  misses its contribution to the block. This is acceptable since the blocks are used to build
+     *  cheap block-Jacobi preconditioners for the matrix-free solvers.
+     *  The right_hand_side is also re-evaluated at the current solution.
+     *  Only available for the weak form.
+     */
+    void assemble_dRdW_diagonal_blocks(std::vector<dealii::FullMatrix<real>> &diagonal_blocks);
+
     //AztecOO dRdW_preconditioner_builder;
 
     /// System matrix corresponding to the derivative of the right_hand_side with
@@ -417,6 +464,9 @@ private:
     /// CFL used to add mass matrix in the optimization FlowConstraints class
     double CFL_mass_dRdW;
 
+    /// Whether the system_matrix has been assembled since system_matrix_transpose was last built.
+    bool system_matrix_transpose_is_outdated = false;
+
     /// Modal coefficients of the solution used to compute dRdX last
     /// Will be used to avoid recomputing dRdX.
     dealii::LinearAlgebra::distributed::Vector<double> solution_dRdX;
@@ -521,6 +571,20 @@ public:
     void output_results_vtk (const unsigned int cycle, const double current_time=0.0); ///< Output solution
     void output_face_results_vtk (const unsigned int cycle, const double current_time=0.0); ///< Output Euler face solution
 
+    /// Waits until the vtk files being written in the background have been written.
+    /** Only relevant if enable_asynchronous_vtk_output is set. Rethrows any exception raised while writing.
+     *  Also called before each new vtk output, such that at most one output is pending. */
+    void wait_for_pending_vtk_output ();
+
+private:
+    /// Background writing of the last volume vtk output.
+    /** The patches are copied into the task such that it does not depend on the DG state. */
+    std::future<void> pending_vtk_output;
+    /// Background writing of the last face vtk output.
+    std::future<void> pending_face_vtk_output;
+
+public:
+
     bool update_artificial_diss;
     /// Main loop of the DG class.
     /** Evaluates the right-hand-side \f$ \mathbf{R(\mathbf{u}}) \f$ of the system
@@ -556,6 +620,22 @@ public:
     //void assemble_residual_dRdW ();
     void assemble_residual (const bool compute_dRdW=false, const bool compute_dRdX=false, const bool compute_d2R=false, const double CFL_mass = 0.0);
 
+    /// Restricts assemble_residual() to a weighted sample of the cells, e.g. for hyper-reduced models.
+    /** The weights must be equal on the degrees of freedom of a cell. Only the cells of nonzero weight
+     *  and their face neighbors are assembled, such that the rows of the sampled cells are complete.
+     *  The rows of the right-hand side and of the Jacobian are then multiplied by their weight,
+     *  which removes the rows of the cells that are not sampled.
+     *  The auxiliary equations and the derivatives other than dRdW are still assembled on all the cells.
+     *  The sample is cleared by allocate_system().
+     */
+    void set_hyper_reduction_row_weights (const dealii::LinearAlgebra::distributed::Vector<double> &row_weights);
+
+    /// Assembles the residual on all the cells again.
+    void clear_hyper_reduction ();
+
+    /// Flag indicating that assemble_residual() is restricted by set_hyper_reduction_row_weights().
+    bool use_hyper_reduction = false;
+
     /// Used in assemble_residual().
     /** IMPORTANT: This does not fully compute the cell residual since it might not
      *  perform the work on all the faces.
@@ -651,7 +731,119 @@ public:
     /// Computational time for assembling residual.
     double assemble_residual_time;
 
+    /// Metric terms of each cell stored between residual evaluations.
+    /** Only filled if use_metric_terms_cache is set, and cleared whenever the volume nodes change.
+     */
+    MetricTermsCache<dim,real> metric_terms_cache;
+
 protected:
+    /// Derivatives assembled along with the residual without assembling the global Jacobian.
+    enum class MatrixFreeDerivatives {
+        none,                 ///< Residual only, or the derivatives requested to assemble_residual().
+        dRdW_times_direction, ///< Jacobian-vector product, see apply_dRdW().
+        dRdW_diagonal_blocks  ///< Diagonal blocks of the Jacobian, see assemble_dRdW_diagonal_blocks().
+    };
+    /// Matrix-free derivatives currently being assembled.
+    /** Only set by apply_dRdW() and assemble_dRdW_diagonal_blocks() during their residual assembly.
+     */
+    MatrixFreeDerivatives matrix_free_derivatives = MatrixFreeDerivatives::none;
+
+    /// Direction of the Jacobian-vector product, with the ghost values of the solution.
+    dealii::LinearAlgebra::distributed::Vector<double> dRdW_direction;
+
+    /// Jacobian-vector product accumulated by the cells, with the ghost values of the right_hand_side.
+    dealii::LinearAlgebra::distributed::Vector<double> dRdW_times_direction;
+
+    /// Diagonal blocks of dRdW accumulated by the cells, indexed by active_cell_index.
+    std::vector<dealii::FullMatrix<real>> *dRdW_diagonal_blocks = nullptr;
+
+    /// Scratch objects used by each thread to assemble the cell residuals.
+    /** Each thread builds its own FEValues and operators once, on its first threaded residual assembly after
+     *  allocate_system(), and keeps them in thread_scratch_data for the following assemblies.
+     */
+    struct AssembleResidualScratchData
+    {
+        /// Constructor. Builds the FEValues and the operators for the maximum polynomial degree.
+        explicit AssembleResidualScratchData(DGBase<dim,real,MeshType> &dg);
+
+        /// DG object being assembled.
+        DGBase<dim,real,MeshType> &dg;
+        /// Mapping of the high-order grid from which the scratch data was built.
+        const dealii::Mapping<dim> *const high_order_mapping;
+        /// Copy of the mapping of the high-order grid, which follows the volume nodes.
+        const dealii::hp::MappingCollection<dim> mapping_collection;
+
+        dealii::hp::FEValues<dim,dim>        fe_values_collection_volume; ///< FEValues of volume.
+        dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_int; ///< FEValues of interior face.
+        dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_ext; ///< FEValues of exterior face.
+        dealii::hp::FESubfaceValues<dim,dim> fe_values_collection_subface; ///< FEValues of subface.
+        dealii::hp::FEValues<dim,dim>        fe_values_collection_volume_lagrange; ///< FEValues of volume with Lagrange basis.
+
+        OPERATOR::basis_functions<dim,2*dim>         soln_basis_int; ///< Interior solution basis.
+        OPERATOR::basis_functions<dim,2*dim>         soln_basis_ext; ///< Exterior solution basis.
+        OPERATOR::basis_functions<dim,2*dim>         flux_basis_int; ///< Interior flux basis.
+        OPERATOR::basis_functions<dim,2*dim>         flux_basis_ext; ///< Exterior flux basis.
+        OPERATOR::local_basis_stiffness<dim,2*dim>   flux_basis_stiffness; ///< Flux basis stiffness for the skew-symmetric form.
+        OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper_int; ///< Interior solution projection operator.
+        OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper_ext; ///< Exterior solution projection operator.
+        OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis; ///< Mapping shape functions.
+    };
+
+    /// Scratch data of each thread, cleared by allocate_system() since it depends on the finite elements and the grid.
+    /** Also rebuilt by a thread when the mapping of the high-order grid is replaced.
+     */
+    dealii::Threads::ThreadLocalStorage<std::unique_ptr<AssembleResidualScratchData>> thread_scratch_data;
+
+    /// Data copied from each thread to the global derivative matrices.
+    /** Cells of the same color directly add their contributions to the right-hand side and to the
+     *  matrix-free derivatives without conflicting with each other. The rows of the sparse matrices,
+     *  which are not thread-safe, are instead stored here by add_to_derivative_matrix() and added by the copier.
+     *  Also used as the scratch data handed to dealii::WorkStream, the actual scratch data being kept in thread_scratch_data.
+     */
+    struct AssembleResidualCopyData
+    {
+        /// Row of a derivative matrix assembled by a cell.
+        struct MatrixRow
+        {
+            dealii::TrilinosWrappers::SparseMatrix *matrix; ///< Derivative matrix to which the row is added.
+            dealii::types::global_dof_index row; ///< Global index of the row.
+            std::vector<dealii::types::global_dof_index> columns; ///< Global indices of the columns.
+            std::vector<real> values; ///< Values added to the columns.
+            bool elide_zero_values; ///< Whether the zero values are skipped when added.
+        };
+        /// Rows assembled by the cell, in the order they were added.
+        std::vector<MatrixRow> matrix_rows;
+    };
+
+    /// Copy data of the cell being assembled by each thread, nullptr outside of the threaded cell loop.
+    dealii::Threads::ThreadLocalStorage<AssembleResidualCopyData *> thread_copy_data{nullptr};
+
+    /// Adds a row to a derivative matrix, or stores it in the copy data of the thread during a threaded assembly.
+    void add_to_derivative_matrix(
+        dealii::TrilinosWrappers::SparseMatrix &matrix,
+        const dealii::types::global_dof_index row,
+        const std::vector<dealii::types::global_dof_index> &columns,
+        const std::vector<real> &values,
+        const bool elide_zero_values = true);
+
+    /// Locally owned cells grouped in colors such that the cells of a given color can be assembled concurrently.
+    /** Two cells share a color only if they do not write in the residual of the same cell.
+     *  Built by make_colored_locally_owned_cells() and cleared by allocate_system().
+     */
+    std::vector<std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator>> colored_locally_owned_cells;
+
+    /// Colors the locally owned cells for the threaded assembly of the residual.
+    /** A cell conflicts with itself and every face neighbor (including periodic ones),
+     *  since the face terms are added to the neighbor's residual and cached metric terms.
+     */
+    void make_colored_locally_owned_cells();
+
+    /// Weights of the rows of the residual set by set_hyper_reduction_row_weights(), with the ghost entries.
+    dealii::LinearAlgebra::distributed::Vector<double> hyper_reduction_row_weights;
+
+    /// Flags indicating the cells, by active cell index, assembled when use_hyper_reduction is true.
+    std::vector<bool> cell_is_in_sample_mesh;
+
     /// The current time set in set_current_time()
     real current_time;
     /// Continuous distribution of artificial dissipation.
@@ -875,6 +1067,11 @@ public:
     /// Asembles the auxiliary equations' residuals and solves.
     virtual void assemble_auxiliary_residual () = 0;
 
+    /// Assembles the volume terms of groups of cells together, before the cell loop of assemble_residual().
+    /** Only done by the strong form, see DGStrong::assemble_volume_terms_in_cell_batches().
+    */
+    virtual void assemble_volume_terms_in_cell_batches () = 0;
+
     /// Allocate the dual vector for optimization.
     /** Currently only used in weak form.
     */
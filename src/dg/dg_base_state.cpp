@@ -183,6 +183,36 @@ void DGBaseState<dim, nstate, real, MeshType>::set_use_auxiliary_eq() {
     this->use_auxiliary_eq = pde_physics_double->has_nonzero_diffusion;
 }
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGBaseState<dim, nstate, real, MeshType>::request_volume_integrals(const unsigned int n_integrands,
+                                                                        const VolumeIntegrands &integrands) {
+    volume_integrands = integrands;
+    n_volume_integrands = n_integrands;
+
+    const unsigned int n_active_cells = this->triangulation->n_active_cells();
+    volume_integrals_cell.assign(n_active_cells * n_integrands, 0.0);
+    volume_integrals_pending_cell.assign(n_active_cells, 0);
+    for (const auto &cell : this->dof_handler.active_cell_iterators()) {
+        if (cell->is_locally_owned()) volume_integrals_pending_cell[cell->active_cell_index()] = 1;
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+bool DGBaseState<dim, nstate, real, MeshType>::get_local_volume_integrals(std::vector<real> &local_integrals) const {
+    local_integrals.assign(n_volume_integrands, 0.0);
+    if (volume_integrals_pending_cell.size() != this->triangulation->n_active_cells()) return false;
+
+    for (const auto &cell : this->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        const unsigned int cell_index = cell->active_cell_index();
+        if (volume_integrals_pending_cell[cell_index]) return false;
+        for (unsigned int i = 0; i < n_volume_integrands; ++i) {
+            local_integrals[i] += volume_integrals_cell[cell_index * n_volume_integrands + i];
+        }
+    }
+    return true;
+}
+
 template <int dim, int nstate, typename real, typename MeshType>
 real DGBaseState<dim, nstate, real, MeshType>::evaluate_CFL(std::vector<std::array<real, nstate> > soln_at_q,
                                                             const real artificial_dissipation, const real cell_diameter,
@@ -1,8 +1,11 @@
 #ifndef PHILIP_DG_BASE_STATE_HPP
 #define PHILIP_DG_BASE_STATE_HPP
 
+#include <deal.II/base/tensor.h>
 #include <deal.II/distributed/tria.h>
 
+#include <functional>
+
 #include "dg_base.hpp"
 #include "parameters/all_parameters.h"
 namespace PHiLiP {
@@ -98,6 +101,26 @@ class DGBaseState : public DGBase<dim, real, MeshType>
     /// Set use_auxiliary_eq flag
     void set_use_auxiliary_eq();
 
+    /// Integrands evaluated from the solution and its gradient at a volume quadrature node.
+    using VolumeIntegrands = std::function<void(
+        const std::array<real,nstate> &soln_at_q,
+        const std::array<dealii::Tensor<1,dim,real>,nstate> &soln_grad_at_q,
+        std::vector<real> &integrand_values)>;
+
+    /// Requests the volume integrals of the integrands at the solution of the next residual assembly.
+    /** The strong form evaluates the integrands in its volume cell loop, at the volume quadrature nodes
+     *  of the residual, with the solution gradient given by the auxiliary variables. Each locally owned cell
+     *  only contributes during the first residual assembly following the request, such that the integrals
+     *  correspond to that solution even if the residual is evaluated again, e.g. by the next Runge-Kutta stages.
+     */
+    void request_volume_integrals(const unsigned int n_integrands, const VolumeIntegrands &integrands);
+
+    /// Sums the requested volume integrals over the locally owned cells.
+    /** Returns false if a locally owned cell has not been assembled since the last request.
+     *  The integrals are not reduced over the processors.
+     */
+    bool get_local_volume_integrals(std::vector<real> &local_integrals) const;
+
    protected:
     /// Evaluate the time it takes for the maximum wavespeed to cross the cell domain.
     /** Currently only uses the convective eigenvalues. Future changes would take in account
@@ -113,6 +136,19 @@ class DGBaseState : public DGBase<dim, real, MeshType>
     /** Usually called after setting physics.
      */
     void reset_numerical_fluxes();
+
+    /// Integrands of the volume integrals requested by request_volume_integrals().
+    VolumeIntegrands volume_integrands;
+
+    /// Number of integrands returned by volume_integrands.
+    unsigned int n_volume_integrands = 0;
+
+    /// Volume integrals of each active cell, the n_volume_integrands values of a cell being contiguous.
+    std::vector<real> volume_integrals_cell;
+
+    /// Flags the active cells that have not been assembled since the last request.
+    /** Stored as char rather than bool, such that cells assembled concurrently write to different bytes. */
+    std::vector<char> volume_integrals_pending_cell;
 }; // end of DGBaseState class
 
 }  // namespace PHiLiP
@@ -0,0 +1,103 @@
+#include "metric_terms_cache.hpp"
+
+namespace PHiLiP {
+
+template <int dim, typename real>
+bool MetricTermsCache<dim,real>::check_grid_and_reinit(
+    const unsigned int volume_nodes_version,
+    const unsigned int n_active_cells)
+{
+    const bool grid_changed = (volume_nodes_version != volume_nodes_version_cache)
+                           || (volume_terms.size() != n_active_cells);
+
+    if (grid_changed) {
+        clear();
+        volume_terms.resize(n_active_cells);
+        facet_terms.resize(n_active_cells);
+        volume_nodes_version_cache = volume_nodes_version;
+    }
+    return grid_changed;
+}
+
+template <int dim, typename real>
+void MetricTermsCache<dim,real>::clear()
+{
+    volume_terms.clear();
+    facet_terms.clear();
+}
+
+template <int dim, typename real>
+bool MetricTermsCache<dim,real>::load_volume_terms(
+    const unsigned int cell_index,
+    const unsigned int poly_degree,
+    MetricOperators    &metric_oper) const
+{
+    if (cell_index >= volume_terms.size()) return false;
+    const MetricTerms &terms = volume_terms[cell_index];
+    if (terms.poly_degree != poly_degree) return false;
+
+    metric_oper.metric_cofactor_vol = terms.metric_cofactor;
+    metric_oper.det_Jac_vol = terms.det_Jac;
+    if (metric_oper.store_vol_flux_nodes) {
+        metric_oper.flux_nodes_vol = terms.flux_nodes;
+    }
+    return true;
+}
+
+template <int dim, typename real>
+void MetricTermsCache<dim,real>::store_volume_terms(
+    const unsigned int    cell_index,
+    const unsigned int    poly_degree,
+    const MetricOperators &metric_oper)
+{
+    if (cell_index >= volume_terms.size()) return;
+    MetricTerms &terms = volume_terms[cell_index];
+
+    terms.metric_cofactor = metric_oper.metric_cofactor_vol;
+    terms.det_Jac = metric_oper.det_Jac_vol;
+    if (metric_oper.store_vol_flux_nodes) {
+        terms.flux_nodes = metric_oper.flux_nodes_vol;
+    }
+    terms.poly_degree = poly_degree;
+}
+
+template <int dim, typename real>
+bool MetricTermsCache<dim,real>::load_facet_terms(
+    const unsigned int cell_index,
+    const unsigned int iface,
+    const unsigned int poly_degree,
+    MetricOperators    &metric_oper) const
+{
+    if (cell_index >= facet_terms.size()) return false;
+    const MetricTerms &terms = facet_terms[cell_index][iface];
+    if (terms.poly_degree != poly_degree) return false;
+
+    metric_oper.metric_cofactor_surf = terms.metric_cofactor;
+    metric_oper.det_Jac_surf = terms.det_Jac;
+    if (metric_oper.store_surf_flux_nodes) {
+        metric_oper.flux_nodes_surf[iface] = terms.flux_nodes;
+    }
+    return true;
+}
+
+template <int dim, typename real>
+void MetricTermsCache<dim,real>::store_facet_terms(
+    const unsigned int    cell_index,
+    const unsigned int    iface,
+    const unsigned int    poly_degree,
+    const MetricOperators &metric_oper)
+{
+    if (cell_index >= facet_terms.size()) return;
+    MetricTerms &terms = facet_terms[cell_index][iface];
+
+    terms.metric_cofactor = metric_oper.metric_cofactor_surf;
+    terms.det_Jac = metric_oper.det_Jac_surf;
+    if (metric_oper.store_surf_flux_nodes) {
+        terms.flux_nodes = metric_oper.flux_nodes_surf[iface];
+    }
+    terms.poly_degree = poly_degree;
+}
+
+template class MetricTermsCache <PHILIP_DIM, double>;
+
+} // PHiLiP namespace
@@ -0,0 +1,98 @@
+#ifndef PHILIP_METRIC_TERMS_CACHE_HPP
+#define PHILIP_METRIC_TERMS_CACHE_HPP
+
+#include <deal.II/base/tensor.h>
+
+#include "operators/operators.h"
+
+namespace PHiLiP {
+
+/// Stores the metric terms of every cell such that they are not rebuilt at every residual evaluation.
+/** The strong form builds the metric cofactor matrix, the determinant of the metric Jacobian
+ *  and the physical flux nodes on the fly with sum-factorization, for every cell and facet,
+ *  every time the residual is assembled. For a grid that does not move (e.g. explicit time
+ *  stepping on a fixed curvilinear mesh), those terms are identical between residual evaluations.
+ *
+ *  The metric terms are stored by active_cell_index (and face number for the facet terms).
+ *  The entire cache is cleared as soon as the high-order grid volume nodes have been modified
+ *  since it was filled, or the triangulation changed.
+ */
+template <int dim, typename real>
+class MetricTermsCache
+{
+public:
+    /// Metric operators filled from, or copied into, the cache.
+    using MetricOperators = OPERATOR::metric_operators<real,dim,2*dim>;
+
+    /// Constructor.
+    MetricTermsCache() = default;
+
+    /// Compares the volume nodes version to the one used to fill the cache, and clears the cache if they differ.
+    /** The version is HighOrderGrid::get_volume_nodes_version(), such that no node comparison
+     *  nor communication is needed. Returns true if the cache has been cleared.
+     */
+    bool check_grid_and_reinit(
+        const unsigned int volume_nodes_version,
+        const unsigned int n_active_cells);
+
+    /// Clears all the stored metric terms.
+    void clear();
+
+    /// Copies the stored volume metric terms into metric_oper.
+    /** Returns false if the terms of that cell have not been stored for the given polynomial degree.
+     */
+    bool load_volume_terms(
+        const unsigned int cell_index,
+        const unsigned int poly_degree,
+        MetricOperators    &metric_oper) const;
+
+    /// Stores the volume metric terms built in metric_oper.
+    void store_volume_terms(
+        const unsigned int    cell_index,
+        const unsigned int    poly_degree,
+        const MetricOperators &metric_oper);
+
+    /// Copies the stored facet metric terms of face iface into metric_oper.
+    /** Returns false if the terms of that facet have not been stored for the given polynomial degree.
+     */
+    bool load_facet_terms(
+        const unsigned int cell_index,
+        const unsigned int iface,
+        const unsigned int poly_degree,
+        MetricOperators    &metric_oper) const;
+
+    /// Stores the facet metric terms of face iface built in metric_oper.
+    void store_facet_terms(
+        const unsigned int    cell_index,
+        const unsigned int    iface,
+        const unsigned int    poly_degree,
+        const MetricOperators &metric_oper);
+
+protected:
+    /// Metric terms evaluated at the cubature nodes of a volume or of a single facet.
+    struct MetricTerms
+    {
+        /// Polynomial degree for which the terms have been evaluated.
+        /** Set to dealii::numbers::invalid_unsigned_int when nothing is stored. */
+        unsigned int poly_degree = dealii::numbers::invalid_unsigned_int;
+        /// Metric cofactor matrix at the cubature nodes.
+        dealii::Tensor<2,dim,std::vector<real>> metric_cofactor;
+        /// Determinant of the metric Jacobian at the cubature nodes.
+        std::vector<real> det_Jac;
+        /// Physical flux nodes, only stored if the metric operators store them.
+        dealii::Tensor<1,dim,std::vector<real>> flux_nodes;
+    };
+
+    /// Volume metric terms of each active cell.
+    std::vector<MetricTerms> volume_terms;
+
+    /// Facet metric terms of each face of each active cell.
+    std::vector<std::array<MetricTerms,2*dim>> facet_terms;
+
+    /// Version of the volume nodes used to fill the cache.
+    unsigned int volume_nodes_version_cache = dealii::numbers::invalid_unsigned_int;
+};
+
+} // PHiLiP namespace
+
+#endif
@@ -1,4 +1,5 @@
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/fe/fe_values.h>
 
@@ -16,6 +17,7 @@
 #include <deal.II/fe/fe_dgq.h> // Used for flux interpolation
 
 #include "strong_dg.hpp"
+#include "profiling/performance_profiler.h"
 
 namespace PHiLiP {
 
@@ -92,11 +94,17 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operator
 
     //build the volume metric cofactor matrix and the determinant of the volume metric Jacobian
     //Also, computes the physical volume flux nodes if needed from flag passed to constructor in dg.cpp
-    metric_oper.build_volume_metric_operators(
-        this->volume_quadrature_collection[poly_degree].size(), n_grid_nodes,
-        mapping_support_points,
-        mapping_basis,
-        this->all_parameters->use_invariant_curl_form);
+    //If the metric terms are cached, they are only built the first time the cell is visited on the current grid.
+    const bool use_metric_terms_cache = this->all_parameters->use_metric_terms_cache;
+    if(!use_metric_terms_cache || !this->metric_terms_cache.load_volume_terms(current_cell_index, poly_degree, metric_oper)){
+        Profiling::ScopedTimer metric_timer("metric_construction");
+        metric_oper.build_volume_metric_operators(
+            this->volume_quadrature_collection[poly_degree].size(), n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        if(use_metric_terms_cache) this->metric_terms_cache.store_volume_terms(current_cell_index, poly_degree, metric_oper);
+    }
 
     if(compute_auxiliary_right_hand_side){
         assemble_volume_term_auxiliary_equation (
@@ -107,6 +115,11 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operator
             metric_oper,
             local_auxiliary_RHS);
     }
+    else if(current_cell_index < volume_rhs_is_batched.size() && volume_rhs_is_batched[current_cell_index]){
+        //the volume term was assembled with the other cells of its batch in assemble_volume_terms_in_cell_batches()
+        local_rhs_int_cell += batched_volume_rhs[current_cell_index];
+        volume_rhs_is_batched[current_cell_index] = 0;
+    }
     else{
         assemble_volume_term_strong(
             cell,
@@ -152,13 +165,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_and_build_operat
     const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
     const unsigned int n_grid_nodes  = n_metric_dofs / dim;
     //build the surface metric operators for interior
-    metric_oper.build_facet_metric_operators(
-        iface,
-        this->face_quadrature_collection[poly_degree].size(),
-        n_grid_nodes,
-        mapping_support_points,
-        mapping_basis,
-        this->all_parameters->use_invariant_curl_form);
+    const bool use_metric_terms_cache = this->all_parameters->use_metric_terms_cache;
+    if(!use_metric_terms_cache || !this->metric_terms_cache.load_facet_terms(current_cell_index, iface, poly_degree, metric_oper)){
+        Profiling::ScopedTimer metric_timer("metric_construction");
+        metric_oper.build_facet_metric_operators(
+            iface,
+            this->face_quadrature_collection[poly_degree].size(),
+            n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        if(use_metric_terms_cache) this->metric_terms_cache.store_facet_terms(current_cell_index, iface, poly_degree, metric_oper);
+    }
 
     if(compute_auxiliary_right_hand_side){
         assemble_boundary_term_auxiliary_equation (
@@ -225,13 +243,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
     const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
     const unsigned int n_grid_nodes  = n_metric_dofs / dim;
     //build the surface metric operators for interior
-    metric_oper_int.build_facet_metric_operators(
-        iface,
-        this->face_quadrature_collection[poly_degree_int].size(),
-        n_grid_nodes,
-        mapping_support_points,
-        mapping_basis,
-        this->all_parameters->use_invariant_curl_form);
+    const bool use_metric_terms_cache = this->all_parameters->use_metric_terms_cache;
+    if(!use_metric_terms_cache || !this->metric_terms_cache.load_facet_terms(current_cell_index, iface, poly_degree_int, metric_oper_int)){
+        Profiling::ScopedTimer metric_timer("metric_construction");
+        metric_oper_int.build_facet_metric_operators(
+            iface,
+            this->face_quadrature_collection[poly_degree_int].size(),
+            n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        if(use_metric_terms_cache) this->metric_terms_cache.store_facet_terms(current_cell_index, iface, poly_degree_int, metric_oper_int);
+    }
 
     if(poly_degree_ext != soln_basis_ext.current_degree){
         soln_basis_ext.current_degree    = poly_degree_ext; 
@@ -245,7 +268,10 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
                                                       mapping_basis);
     }
 
-    if(!compute_auxiliary_right_hand_side){//only for primary equations
+    const bool neighbor_metric_terms_cached = !compute_auxiliary_right_hand_side && use_metric_terms_cache
+                                           && this->metric_terms_cache.load_volume_terms(neighbor_cell_index, poly_degree_ext, metric_oper_ext);
+    if(!compute_auxiliary_right_hand_side && !neighbor_metric_terms_cached){//only for primary equations
+        Profiling::ScopedTimer metric_timer("metric_construction");
         //get neighbor metric operator
         //rewrite the high_order_grid->volume_nodes in a way we can use sum-factorization on.
         //that is, splitting up the vector by the dimension.
@@ -267,6 +293,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
             mapping_support_points_neigh,
             mapping_basis,
             this->all_parameters->use_invariant_curl_form);
+        if(use_metric_terms_cache) this->metric_terms_cache.store_volume_terms(neighbor_cell_index, poly_degree_ext, metric_oper_ext);
     }
 
     if(compute_auxiliary_right_hand_side){
@@ -876,71 +903,15 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
 *
 ****************************************************/
 template <int dim, int nstate, typename real, typename MeshType>
-void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
+void DGStrong<dim,nstate,real,MeshType>::evaluate_cell_volume_and_max_dt(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
     const dealii::types::global_dof_index                  current_cell_index,
-    const std::vector<dealii::types::global_dof_index>     &cell_dofs_indices,
     const unsigned int                                     poly_degree,
-    OPERATOR::basis_functions<dim,2*dim>                   &soln_basis,
-    OPERATOR::basis_functions<dim,2*dim>                   &flux_basis,
-    OPERATOR::local_basis_stiffness<dim,2*dim>             &flux_basis_stiffness,
-    OPERATOR::vol_projection_operator<dim,2*dim>           &soln_basis_projection_oper,
-    OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
-    dealii::Vector<real>                                   &local_rhs_int_cell)
+    const std::vector<std::array<real,nstate>>             &soln_at_q,
+    const OPERATOR::metric_operators<real,dim,2*dim>       &metric_oper)
 {
-    (void) current_cell_index;
-
-    const unsigned int n_quad_pts  = this->volume_quadrature_collection[poly_degree].size();
-    const unsigned int n_dofs_cell = this->fe_collection[poly_degree].dofs_per_cell;
-    const unsigned int n_shape_fns = n_dofs_cell / nstate; 
-    const unsigned int n_quad_pts_1D  = this->oneD_quadrature_collection[poly_degree].size();
-    assert(n_quad_pts == pow(n_quad_pts_1D, dim));
+    const unsigned int n_quad_pts = this->volume_quadrature_collection[poly_degree].size();
     const std::vector<double> &vol_quad_weights = this->volume_quadrature_collection[poly_degree].get_weights();
-    const std::vector<double> &oneD_vol_quad_weights = this->oneD_quadrature_collection[poly_degree].get_weights();
-
-    AssertDimension (n_dofs_cell, cell_dofs_indices.size());
-
-    // Fetch the modal soln coefficients and the modal auxiliary soln coefficients
-    // We immediately separate them by state as to be able to use sum-factorization
-    // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
-    // mult would sum the states at the quadrature point.
-    std::array<std::vector<real>,nstate> soln_coeff;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_coeff;
-    for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
-        if(ishape == 0)
-            soln_coeff[istate].resize(n_shape_fns);
-        soln_coeff[istate][ishape] = DGBase<dim,real,MeshType>::solution(cell_dofs_indices[idof]);
-        for(int idim=0; idim<dim; idim++){
-            if(ishape == 0)
-                aux_soln_coeff[istate][idim].resize(n_shape_fns);
-            if(this->use_auxiliary_eq){
-                aux_soln_coeff[istate][idim][ishape] = DGBase<dim,real,MeshType>::auxiliary_solution[idim](cell_dofs_indices[idof]);
-            }
-            else{
-                aux_soln_coeff[istate][idim][ishape] = 0.0;
-            }
-        }
-    }
-    std::array<std::vector<real>,nstate> soln_at_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_q; //auxiliary sol at flux nodes
-    std::vector<std::array<real,nstate>> soln_at_q_for_max_CFL(n_quad_pts);//Need soln written in a different for to use pre-existing max CFL function
-    // Interpolate each state to the quadrature points using sum-factorization
-    // with the basis functions in each reference direction.
-    for(int istate=0; istate<nstate; istate++){
-        soln_at_q[istate].resize(n_quad_pts);
-        soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q[istate],
-                                         soln_basis.oneD_vol_operator);
-        for(int idim=0; idim<dim; idim++){
-            aux_soln_at_q[istate][idim].resize(n_quad_pts);
-            soln_basis.matrix_vector_mult_1D(aux_soln_coeff[istate][idim], aux_soln_at_q[istate][idim],
-                                             soln_basis.oneD_vol_operator);
-        }
-        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-            soln_at_q_for_max_CFL[iquad][istate] = soln_at_q[istate][iquad];
-        }
-    }
 
     // For pseudotime, we need to compute the time_scaled_solution.
     // Thus, we need to evaluate the max_dt_cell (as previously done in dg/weak_dg.cpp -> assemble_volume_term_explicit)
@@ -972,35 +943,92 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
     const real cell_diameter = cell_volume / std::pow(diameter,dim-1);
     const real cell_radius = 0.5 * cell_diameter;
     this->cell_volume[current_cell_index] = cell_volume;
-    this->max_dt_cell[current_cell_index] = this->evaluate_CFL ( soln_at_q_for_max_CFL, max_artificial_diss, cell_radius, poly_degree);
+    this->max_dt_cell[current_cell_index] = this->evaluate_CFL ( soln_at_q, max_artificial_diss, cell_radius, poly_degree);
+}
 
-    //get entropy projected variables
-    std::array<std::vector<real>,nstate> entropy_var_at_q;
-    std::array<std::vector<real>,nstate> projected_entropy_var_at_q;
-    if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-        for(int istate=0; istate<nstate; istate++){
-            entropy_var_at_q[istate].resize(n_quad_pts);
-            projected_entropy_var_at_q[istate].resize(n_quad_pts);
-        }
-        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-            std::array<real,nstate> soln_state;
-            for(int istate=0; istate<nstate; istate++){
-                soln_state[istate] = soln_at_q[istate][iquad];
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index                  current_cell_index,
+    const std::vector<dealii::types::global_dof_index>     &cell_dofs_indices,
+    const unsigned int                                     poly_degree,
+    OPERATOR::basis_functions<dim,2*dim>                   &soln_basis,
+    OPERATOR::basis_functions<dim,2*dim>                   &flux_basis,
+    OPERATOR::local_basis_stiffness<dim,2*dim>             &flux_basis_stiffness,
+    OPERATOR::vol_projection_operator<dim,2*dim>           &soln_basis_projection_oper,
+    OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
+    dealii::Vector<real>                                   &local_rhs_int_cell)
+{
+    const unsigned int n_quad_pts  = this->volume_quadrature_collection[poly_degree].size();
+    const unsigned int n_dofs_cell = this->fe_collection[poly_degree].dofs_per_cell;
+    const unsigned int n_shape_fns = n_dofs_cell / nstate; 
+    const unsigned int n_quad_pts_1D  = this->oneD_quadrature_collection[poly_degree].size();
+    assert(n_quad_pts == pow(n_quad_pts_1D, dim));
+    const std::vector<double> &vol_quad_weights = this->volume_quadrature_collection[poly_degree].get_weights();
+
+    AssertDimension (n_dofs_cell, cell_dofs_indices.size());
+
+    // Fetch the modal soln coefficients and the modal auxiliary soln coefficients.
+    // The states are interleaved, such that the sum-factorization applies each basis entry
+    // to all the states at once, and the values at a quadrature point are directly in the
+    // std::array<real,nstate> layout used by the physics.
+    std::vector<std::array<real,nstate>> soln_coeff(n_shape_fns);
+    std::array<std::vector<std::array<real,nstate>>,dim> aux_soln_coeff;
+    for(int idim=0; idim<dim; idim++){
+        aux_soln_coeff[idim].resize(n_shape_fns);
+    }
+    for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
+        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
+        soln_coeff[ishape][istate] = DGBase<dim,real,MeshType>::solution(cell_dofs_indices[idof]);
+        for(int idim=0; idim<dim; idim++){
+            if(this->use_auxiliary_eq){
+                aux_soln_coeff[idim][ishape][istate] = DGBase<dim,real,MeshType>::auxiliary_solution[idim](cell_dofs_indices[idof]);
             }
-            std::array<real,nstate> entropy_var;
-            entropy_var = this->pde_physics_double->compute_entropy_variables(soln_state);
-            for(int istate=0; istate<nstate; istate++){
-                entropy_var_at_q[istate][iquad] = entropy_var[istate];
+            else{
+                aux_soln_coeff[idim][ishape][istate] = 0.0;
             }
         }
-        for(int istate=0; istate<nstate; istate++){
-            std::vector<real> entropy_var_coeff(n_shape_fns);;
-            soln_basis_projection_oper.matrix_vector_mult_1D(entropy_var_at_q[istate],
-                                                             entropy_var_coeff,
-                                                             soln_basis_projection_oper.oneD_vol_operator);
-            soln_basis.matrix_vector_mult_1D(entropy_var_coeff,
-                                             projected_entropy_var_at_q[istate],
-                                             soln_basis.oneD_vol_operator);
+    }
+    // Interpolate all the states to the quadrature points using sum-factorization
+    // with the basis functions in each reference direction.
+    std::vector<std::array<real,nstate>> soln_at_q(n_quad_pts);
+    std::array<std::vector<std::array<real,nstate>>,dim> aux_soln_at_q; //auxiliary sol at flux nodes
+    soln_basis.matrix_vector_mult_1D_interleaved(soln_coeff, soln_at_q,
+                                                 soln_basis.oneD_vol_operator);
+    for(int idim=0; idim<dim; idim++){
+        aux_soln_at_q[idim].resize(n_quad_pts);
+        soln_basis.matrix_vector_mult_1D_interleaved(aux_soln_coeff[idim], aux_soln_at_q[idim],
+                                                     soln_basis.oneD_vol_operator);
+    }
+
+    evaluate_cell_volume_and_max_dt(cell, current_cell_index, poly_degree, soln_at_q, metric_oper);
+
+    const bool use_split_form = this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form;
+
+    //get entropy projected variables
+    std::vector<std::array<real,nstate>> projected_entropy_var_at_q;
+    if (use_split_form){
+        std::vector<std::array<real,nstate>> entropy_var_at_q(n_quad_pts);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            entropy_var_at_q[iquad] = this->pde_physics_double->compute_entropy_variables(soln_at_q[iquad]);
+        }
+        std::vector<std::array<real,nstate>> entropy_var_coeff(n_shape_fns);
+        soln_basis_projection_oper.matrix_vector_mult_1D_interleaved(entropy_var_at_q,
+                                                                     entropy_var_coeff,
+                                                                     soln_basis_projection_oper.oneD_vol_operator);
+        projected_entropy_var_at_q.resize(n_quad_pts);
+        soln_basis.matrix_vector_mult_1D_interleaved(entropy_var_coeff,
+                                                     projected_entropy_var_at_q,
+                                                     soln_basis.oneD_vol_operator);
+    }
+    //get the conservative variables from the projected entropy variables once per node,
+    //since every node is used in n_quad_pts_1D two-point fluxes in each direction.
+    std::vector<std::array<real,nstate>> soln_from_projected_entropy_var_at_q;
+    if (use_split_form){
+        soln_from_projected_entropy_var_at_q.resize(n_quad_pts);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            soln_from_projected_entropy_var_at_q[iquad] = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (projected_entropy_var_at_q[iquad]);
         }
     }
 
@@ -1009,18 +1037,32 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
     //From the paper: Cicchino, Alexander, et al. "Provably stable flux reconstruction high-order methods on curvilinear elements." Journal of Computational Physics 463 (2022): 111259.
     //For conservative DG, we compute the reference flux as per Eq. (9), to then recover the second volume integral in Eq. (17).
     //For curvilinear split-form in Eq. (22), we apply a two-pt flux of the metric-cofactor matrix on the matrix operator constructed by the entropy stable/conservtive 2pt flux.
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> conv_ref_flux_at_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> diffusive_ref_flux_at_q;
-    std::array<std::vector<real>,nstate> source_at_q;
-    std::array<std::vector<real>,nstate> physical_source_at_q;
+    std::array<std::vector<std::array<real,nstate>>,dim> conv_ref_flux_at_q;
+    std::array<std::vector<std::array<real,nstate>>,dim> diffusive_ref_flux_at_q;
+    std::vector<std::array<real,nstate>> source_at_q;
+    std::vector<std::array<real,nstate>> physical_source_at_q;
+    for(int idim=0; idim<dim; idim++){
+        if (!use_split_form){
+            conv_ref_flux_at_q[idim].resize(n_quad_pts);
+        }
+        diffusive_ref_flux_at_q[idim].resize(n_quad_pts);
+    }
+    if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
+        source_at_q.resize(n_quad_pts);
+    }
+    if(this->pde_physics_double->has_nonzero_physical_source) {
+        physical_source_at_q.resize(n_quad_pts);
+    }
 
     // The matrix of two-pt fluxes for Hadamard products
     std::array<std::array<dealii::FullMatrix<real>,dim>,nstate> conv_ref_2pt_flux_at_q;
-    //Hadamard tensor-product sparsity pattern
-    std::vector<std::array<unsigned int,dim>> Hadamard_rows_sparsity(n_quad_pts * n_quad_pts_1D);//size n^{d+1}
-    std::vector<std::array<unsigned int,dim>> Hadamard_columns_sparsity(n_quad_pts * n_quad_pts_1D);
+    //Hadamard tensor-product sparsity pattern and sparse operators, shared by all the cells of that degree.
+    const HadamardVolumeOperators *Hadamard_operators = nullptr;
+    //solutions and two-point fluxes along the line of nodes of a single direction
+    std::vector<std::array<real,nstate>> soln_state_line;
+    std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> conv_phys_flux_2pt_line;
     //allocate reference 2pt flux for Hadamard product
-    if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+    if (use_split_form){
         for(int istate=0; istate<nstate; istate++){
             for(int idim=0; idim<dim; idim++){
                 conv_ref_2pt_flux_at_q[istate][idim].reinit(n_quad_pts, n_quad_pts_1D);//size n^d x n
@@ -1028,18 +1070,31 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
         }
         //extract the dof pairs that give non-zero entries for each direction
         //to use the "sum-factorized" Hadamard product.
-        flux_basis.sum_factorized_Hadamard_sparsity_pattern(n_quad_pts_1D, n_quad_pts_1D, Hadamard_rows_sparsity, Hadamard_columns_sparsity);
+        Hadamard_operators = &get_Hadamard_volume_operators(poly_degree, flux_basis, flux_basis_stiffness);
+        soln_state_line.resize(n_quad_pts_1D);
+        conv_phys_flux_2pt_line.resize(n_quad_pts_1D);
     }
 
+    //volume integrals requested with request_volume_integrals(), only on the first assembly following the request
+    const bool integrate_volume_integrands = (current_cell_index < this->volume_integrals_pending_cell.size())
+                                          && this->volume_integrals_pending_cell[current_cell_index];
+    std::vector<real> integrand_values(integrate_volume_integrands ? this->n_volume_integrands : 0);
 
     for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
         //extract soln and auxiliary soln at quad pt to be used in physics
-        std::array<real,nstate> soln_state;
+        std::array<real,nstate> soln_state = soln_at_q[iquad];
         std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state;
         for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_q[istate][iquad];
             for(int idim=0; idim<dim; idim++){
-                aux_soln_state[istate][idim] = aux_soln_at_q[istate][idim][iquad];
+                aux_soln_state[istate][idim] = aux_soln_at_q[idim][iquad][istate];
+            }
+        }
+
+        if(integrate_volume_integrands){
+            this->volume_integrands(soln_state, aux_soln_state, integrand_values);
+            const real JxW_iquad = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+            for(unsigned int i_integrand=0; i_integrand<this->n_volume_integrands; i_integrand++){
+                this->volume_integrals_cell[current_cell_index * this->n_volume_integrands + i_integrand] += integrand_values[i_integrand] * JxW_iquad;
             }
         }
 
@@ -1057,54 +1112,39 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
         // If 2pt flux, transform to reference at construction to improve performance.
         // We technically use a REFERENCE 2pt flux for all entropy stable schemes.
         std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux;
-        if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+        if (use_split_form){
             //get the soln for iquad from projected entropy variables
-            std::array<real,nstate> entropy_var;
-            for(int istate=0; istate<nstate; istate++){
-                entropy_var[istate] = projected_entropy_var_at_q[istate][iquad];
-            }
-            soln_state = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var);
+            soln_state = soln_from_projected_entropy_var_at_q[iquad];
             
-            //loop over all the non-zero entries for "sum-factorized" Hadamard product that corresponds to the iquad.
-            for(unsigned int row_index = iquad * n_quad_pts_1D, column_index = 0; 
-               // Hadamard_rows_sparsity[row_index][0] == iquad; 
-                column_index < n_quad_pts_1D; 
-                row_index++, column_index++){
-
-                if(Hadamard_rows_sparsity[row_index][0] != iquad){
-                    pcout<<"The volume Hadamard rows sparsity pattern does not match. Aborting..."<<std::endl;
-                    std::abort();
+            //The non-zero entries of the "sum-factorized" Hadamard product that correspond to the iquad
+            //are the n_quad_pts_1D nodes on the line through iquad in each reference direction.
+            for(int ref_dim=0; ref_dim<dim; ref_dim++){
+                for(unsigned int column_index=0; column_index<n_quad_pts_1D; column_index++){
+                    const unsigned int flux_quad = Hadamard_operators->columns_sparsity[iquad * n_quad_pts_1D + column_index][ref_dim];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
+                    soln_state_line[column_index] = soln_from_projected_entropy_var_at_q[flux_quad];
                 }
 
-                // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
-                // The way it is stored in metric_operators is to use sum-factorization in each direction,
-                // but here it is cleaner to apply a reference transformation in each Tensor block returned by physics.
+                //Compute the physical fluxes for the whole line at once
+                this->pde_physics_double->convective_numerical_split_flux_batch(soln_state, soln_state_line, conv_phys_flux_2pt_line);
 
-                for(int ref_dim=0; ref_dim<dim; ref_dim++){
-                    const unsigned int flux_quad = Hadamard_columns_sparsity[row_index][ref_dim];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
+                for(unsigned int column_index=0; column_index<n_quad_pts_1D; column_index++){
+                    const unsigned int flux_quad = Hadamard_operators->columns_sparsity[iquad * n_quad_pts_1D + column_index][ref_dim];
 
+                    // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
+                    // The way it is stored in metric_operators is to use sum-factorization in each direction,
+                    // but here it is cleaner to apply a reference transformation in each Tensor block returned by physics.
                     dealii::Tensor<2,dim,real> metric_cofactor_flux_basis;
                     for(int idim=0; idim<dim; idim++){
                         for(int jdim=0; jdim<dim; jdim++){
                             metric_cofactor_flux_basis[idim][jdim] = metric_oper.metric_cofactor_vol[idim][jdim][flux_quad];
                         }
                     }
-                    std::array<real,nstate> soln_state_flux_basis;
-                    std::array<real,nstate> entropy_var_flux_basis;
-                    for(int istate=0; istate<nstate; istate++){
-                        entropy_var_flux_basis[istate] = projected_entropy_var_at_q[istate][flux_quad];
-                    }
-                    soln_state_flux_basis = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_flux_basis);
-
-                    //Compute the physical flux
-                    std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux_2pt;
-                    conv_phys_flux_2pt = this->pde_physics_double->convective_numerical_split_flux(soln_state, soln_state_flux_basis);
                      
                     for(int istate=0; istate<nstate; istate++){
                         dealii::Tensor<1,dim,real> conv_ref_flux_2pt;
                         //For each state, transform the physical flux to a reference flux.
                         metric_oper.transform_physical_to_reference(
-                            conv_phys_flux_2pt[istate],
+                            conv_phys_flux_2pt_line[column_index][istate],
                             0.5*(metric_cofactor + metric_cofactor_flux_basis),
                             conv_ref_flux_2pt);
                         //write into reference Hadamard flux matrix
@@ -1124,25 +1164,23 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
         diffusive_phys_flux = this->pde_physics_double->dissipative_flux(soln_state, aux_soln_state, current_cell_index);
 
         // Manufactured source
-        std::array<real,nstate> manufactured_source;
         if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
             dealii::Point<dim,real> vol_flux_node;
             for(int idim=0; idim<dim; idim++){
                 vol_flux_node[idim] = metric_oper.flux_nodes_vol[idim][iquad];
             }
             //compute the manufactured source
-            manufactured_source = this->pde_physics_double->source_term (vol_flux_node, soln_state, this->current_time, current_cell_index);
+            source_at_q[iquad] = this->pde_physics_double->source_term (vol_flux_node, soln_state, this->current_time, current_cell_index);
         }
 
         // Physical source
-        std::array<real,nstate> physical_source;
         if(this->pde_physics_double->has_nonzero_physical_source) {
             dealii::Point<dim,real> vol_flux_node;
             for(int idim=0; idim<dim; idim++){
                 vol_flux_node[idim] = metric_oper.flux_nodes_vol[idim][iquad];
             }
             //compute the physical source
-            physical_source = this->pde_physics_double->physical_source_term (vol_flux_node, soln_state, aux_soln_state, current_cell_index);
+            physical_source_at_q[iquad] = this->pde_physics_double->physical_source_term (vol_flux_node, soln_state, aux_soln_state, current_cell_index);
         }
 
         //Write the values in a way that we can use sum-factorization on.
@@ -1150,7 +1188,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
             dealii::Tensor<1,dim,real> conv_ref_flux;
             dealii::Tensor<1,dim,real> diffusive_ref_flux;
             //Trnasform to reference fluxes
-            if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+            if (use_split_form){
                 //Do Nothing. 
                 //I am leaving this block here so the diligent reader
                 //remembers that, for entropy stable schemes, we construct
@@ -1172,140 +1210,456 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
 
             //Write the data in a way that we can use sum-factorization on.
             //Since sum-factorization improves the speed for matrix-vector multiplications,
-            //We need the values to have their inner elements be vectors.
+            //We need the values to have their inner elements be vectors of interleaved states.
             for(int idim=0; idim<dim; idim++){
-                //allocate
-                if(iquad == 0){
-                    conv_ref_flux_at_q[istate][idim].resize(n_quad_pts);
-                    diffusive_ref_flux_at_q[istate][idim].resize(n_quad_pts);
-                }
-                //write data
-                if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+                if (use_split_form){
                     //Do nothing because written in a Hadamard product sum-factorized form above.
                 }
                 else{
-                    conv_ref_flux_at_q[istate][idim][iquad] = conv_ref_flux[idim];
+                    conv_ref_flux_at_q[idim][iquad][istate] = conv_ref_flux[idim];
                 }
 
-                diffusive_ref_flux_at_q[istate][idim][iquad] = diffusive_ref_flux[idim];
-            }
-            if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-                if(iquad == 0){
-                    source_at_q[istate].resize(n_quad_pts);
-                }
-                source_at_q[istate][iquad] = manufactured_source[istate];
-            }
-            if(this->pde_physics_double->has_nonzero_physical_source) {
-                if(iquad == 0){
-                    physical_source_at_q[istate].resize(n_quad_pts);
-                }
-                physical_source_at_q[istate][iquad] = physical_source[istate];
+                diffusive_ref_flux_at_q[idim][iquad][istate] = diffusive_ref_flux[idim];
             }
         }
     }
+    if(integrate_volume_integrands) this->volume_integrals_pending_cell[current_cell_index] = 0;
 
-    // Get a flux basis reference gradient operator in a sum-factorized Hadamard product sparse form. Then apply the divergence.
-    std::array<dealii::FullMatrix<real>,dim> flux_basis_stiffness_skew_symm_oper_sparse;
-    if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-        for(int idim=0; idim<dim; idim++){
-            flux_basis_stiffness_skew_symm_oper_sparse[idim].reinit(n_quad_pts, n_quad_pts_1D);
-        }
-        flux_basis.sum_factorized_Hadamard_basis_assembly(n_quad_pts_1D, n_quad_pts_1D, 
-                                                          Hadamard_rows_sparsity, Hadamard_columns_sparsity,
-                                                          flux_basis_stiffness.oneD_skew_symm_vol_oper, 
-                                                          oneD_vol_quad_weights,
-                                                          flux_basis_stiffness_skew_symm_oper_sparse);
-    }
+    //Compute reference divergence of the reference fluxes.
+    std::vector<std::array<real,nstate>> conv_flux_divergence(n_quad_pts); 
+    std::vector<std::array<real,nstate>> diffusive_flux_divergence(n_quad_pts); 
 
-    //For each state we:
-    //  1. Compute reference divergence.
-    //  2. Then compute and write the rhs for the given state.
-    for(int istate=0; istate<nstate; istate++){
-
-        //Compute reference divergence of the reference fluxes.
-        std::vector<real> conv_flux_divergence(n_quad_pts); 
-        std::vector<real> diffusive_flux_divergence(n_quad_pts); 
-
-        if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-            //2pt flux Hadamard Product, and then multiply by vector of ones scaled by 1.
-            // Same as the volume term in Eq. (15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485. but, 
-            // where we use the reference skew-symmetric stiffness operator of the flux basis for the Q operator and the reference two-point flux as to make use of Alex's Hadamard product
-            // sum-factorization type algorithm that exploits the structure of the flux basis in the reference space to have O(n^{d+1}).
+    if (use_split_form){
+        // Flux basis reference gradient operator in a sum-factorized Hadamard product sparse form. Then apply the divergence.
+        const std::array<dealii::FullMatrix<real>,dim> &flux_basis_stiffness_skew_symm_oper_sparse = Hadamard_operators->flux_basis_stiffness_skew_symm_oper_sparse;
 
+        //2pt flux Hadamard Product, and then multiply by vector of ones scaled by 1.
+        // Same as the volume term in Eq. (15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485. but, 
+        // where we use the reference skew-symmetric stiffness operator of the flux basis for the Q operator and the reference two-point flux as to make use of Alex's Hadamard product
+        // sum-factorization type algorithm that exploits the structure of the flux basis in the reference space to have O(n^{d+1}).
+        dealii::FullMatrix<real> divergence_ref_flux_Hadamard_product(n_quad_pts, n_quad_pts_1D);
+        for(int istate=0; istate<nstate; istate++){
             for(int ref_dim=0; ref_dim<dim; ref_dim++){
-                dealii::FullMatrix<real> divergence_ref_flux_Hadamard_product(n_quad_pts, n_quad_pts_1D);
                 flux_basis.Hadamard_product(flux_basis_stiffness_skew_symm_oper_sparse[ref_dim], conv_ref_2pt_flux_at_q[istate][ref_dim], divergence_ref_flux_Hadamard_product); 
                 //Hadamard product times the vector of ones.
                 for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
                     if(ref_dim == 0){
-                        conv_flux_divergence[iquad] = 0.0;
+                        conv_flux_divergence[iquad][istate] = 0.0;
                     }
                     for(unsigned int iquad_1D=0; iquad_1D<n_quad_pts_1D; iquad_1D++){
-                        conv_flux_divergence[iquad] += divergence_ref_flux_Hadamard_product[iquad][iquad_1D];
+                        conv_flux_divergence[iquad][istate] += divergence_ref_flux_Hadamard_product[iquad][iquad_1D];
                     }
                 }
             }
-            
         }
-        else{
-            //Reference divergence of the reference convective flux.
-            flux_basis.divergence_matrix_vector_mult_1D(conv_ref_flux_at_q[istate], conv_flux_divergence,
-                                                        flux_basis.oneD_vol_operator,
-                                                        flux_basis.oneD_grad_operator);
-        }
-        //Reference divergence of the reference diffusive flux.
-        flux_basis.divergence_matrix_vector_mult_1D(diffusive_ref_flux_at_q[istate], diffusive_flux_divergence,
-                                                    flux_basis.oneD_vol_operator,
-                                                    flux_basis.oneD_grad_operator);
-
-
-        // Strong form
-        // The right-hand side sends all the term to the side of the source term
-        // Therefore, 
-        // \divergence ( Fconv + Fdiss ) = source 
-        // has the right-hand side
-        // rhs = - \divergence( Fconv + Fdiss ) + source 
-        // Since we have done an integration by parts, the volume term resulting from the divergence of Fconv and Fdiss
-        // is negative. Therefore, negative of negative means we add that volume term to the right-hand-side
-        std::vector<real> rhs(n_shape_fns);
+    }
+    else{
+        //Reference divergence of the reference convective flux.
+        flux_basis.divergence_matrix_vector_mult_1D_interleaved(conv_ref_flux_at_q, conv_flux_divergence,
+                                                                flux_basis.oneD_vol_operator,
+                                                                flux_basis.oneD_grad_operator);
+    }
+    //Reference divergence of the reference diffusive flux.
+    flux_basis.divergence_matrix_vector_mult_1D_interleaved(diffusive_ref_flux_at_q, diffusive_flux_divergence,
+                                                            flux_basis.oneD_vol_operator,
+                                                            flux_basis.oneD_grad_operator);
+
+
+    // Strong form
+    // The right-hand side sends all the term to the side of the source term
+    // Therefore, 
+    // \divergence ( Fconv + Fdiss ) = source 
+    // has the right-hand side
+    // rhs = - \divergence( Fconv + Fdiss ) + source 
+    // Since we have done an integration by parts, the volume term resulting from the divergence of Fconv and Fdiss
+    // is negative. Therefore, negative of negative means we add that volume term to the right-hand-side
+    std::vector<std::array<real,nstate>> rhs(n_shape_fns);
+    //weighted integrands of the inner products, allocated once for all the terms of the cell
+    std::vector<std::array<real,nstate>> weighted_integrand(n_quad_pts);
+
+    // Convective
+    if (use_split_form){
+        std::vector<real> ones(n_quad_pts, 1.0);
+        soln_basis.inner_product_1D_interleaved(conv_flux_divergence, ones, rhs, weighted_integrand, soln_basis.oneD_vol_operator, false, -1.0);
+    }
+    else {
+        soln_basis.inner_product_1D_interleaved(conv_flux_divergence, vol_quad_weights, rhs, weighted_integrand, soln_basis.oneD_vol_operator, false, -1.0);
+    }
 
-        // Convective
-        if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-            std::vector<real> ones(n_quad_pts, 1.0);
-            soln_basis.inner_product_1D(conv_flux_divergence, ones, rhs, soln_basis.oneD_vol_operator, false, -1.0);
+    // Diffusive
+    // Note that for diffusion, the negative is defined in the physics. Since we used the auxiliary
+    // variable, put a negative here.
+    soln_basis.inner_product_1D_interleaved(diffusive_flux_divergence, vol_quad_weights, rhs, weighted_integrand, soln_basis.oneD_vol_operator, true, -1.0);
+
+    // Sources
+    if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term
+       || this->pde_physics_double->has_nonzero_physical_source) {
+        std::vector<real> JxW(n_quad_pts);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            JxW[iquad] = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
         }
-        else {
-            soln_basis.inner_product_1D(conv_flux_divergence, vol_quad_weights, rhs, soln_basis.oneD_vol_operator, false, -1.0);
+        // Manufactured source
+        if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
+            soln_basis.inner_product_1D_interleaved(source_at_q, JxW, rhs, weighted_integrand, soln_basis.oneD_vol_operator, true, 1.0);
+        }
+        // Physical source
+        if(this->pde_physics_double->has_nonzero_physical_source) {
+            soln_basis.inner_product_1D_interleaved(physical_source_at_q, JxW, rhs, weighted_integrand, soln_basis.oneD_vol_operator, true, 1.0);
         }
+    }
 
-        // Diffusive
-        // Note that for diffusion, the negative is defined in the physics. Since we used the auxiliary
-        // variable, put a negative here.
-        soln_basis.inner_product_1D(diffusive_flux_divergence, vol_quad_weights, rhs, soln_basis.oneD_vol_operator, true, -1.0);
+    for(int istate=0; istate<nstate; istate++){
+        for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
+            local_rhs_int_cell(istate*n_shape_fns + ishape) += rhs[ishape][istate];
+        }
+    }
+}
 
-        // Manufactured source
-        if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-            std::vector<real> JxW(n_quad_pts);
-            for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                JxW[iquad] = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+template <int dim, int nstate, typename real, typename MeshType>
+DGStrong<dim,nstate,real,MeshType>::CellBatchScratchData::CellBatchScratchData(DGStrong<dim,nstate,real,MeshType> &dg)
+    : max_degree(dg.max_degree)
+    , grid_degree(dg.high_order_grid->fe_system.tensor_degree())
+    , soln_basis(1, max_degree, grid_degree)
+    , flux_basis(1, max_degree, grid_degree)
+    , flux_basis_stiffness(1, max_degree, grid_degree, true)
+    , soln_basis_projection_oper(1, max_degree, grid_degree)
+    , mapping_basis(1, grid_degree, grid_degree)
+    , metric_degree(dealii::numbers::invalid_unsigned_int)
+{
+    // The operators are built for the degree of the first batch.
+    soln_basis.current_degree = dealii::numbers::invalid_unsigned_int;
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_volume_terms_in_cell_batches()
+{
+    if(!this->all_parameters->use_cell_batches_in_volume_terms) return;
+    if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+        pcout << "ERROR: use_cell_batches_in_volume_terms is only implemented for the conservative strong form, without split form. Aborting..." << std::endl;
+        std::abort();
+    }
+    Profiling::ScopedTimer cell_batches_timer("volume_term_cell_batches");
+
+    const unsigned int n_active_cells = this->triangulation->n_active_cells();
+    batched_volume_rhs.resize(n_active_cells);
+    volume_rhs_is_batched.assign(n_active_cells, 0);
+
+    // Group the cells assembled by the cell loop by polynomial degree.
+    std::vector<CellBatch> cell_batches;
+    std::vector<unsigned int> batch_being_filled(this->max_degree+1, dealii::numbers::invalid_unsigned_int);
+    for (const auto &cell : this->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        if (this->use_hyper_reduction && !this->cell_is_in_sample_mesh[cell->active_cell_index()]) continue;
+
+        const unsigned int poly_degree = cell->active_fe_index();
+        unsigned int &ibatch = batch_being_filled[poly_degree];
+        if (ibatch == dealii::numbers::invalid_unsigned_int) {
+            ibatch = cell_batches.size();
+            cell_batches.emplace_back();
+            cell_batches.back().poly_degree = poly_degree;
+        }
+        CellBatch &batch = cell_batches[ibatch];
+        batch.cells[batch.n_cells++] = cell;
+        if (batch.n_cells == n_cells_per_batch) ibatch = dealii::numbers::invalid_unsigned_int;
+    }
+
+    // Each batch only writes in the volume right-hand sides of its own cells, such that the batches
+    // are assembled by the threads of the process without anything to copy.
+    using CopyData = typename DGBase<dim,real,MeshType>::AssembleResidualCopyData;
+    const auto assemble_batch = [&](const typename std::vector<CellBatch>::const_iterator &batch, CopyData &, CopyData &) {
+        std::unique_ptr<CellBatchScratchData> &scratch = thread_cell_batch_scratch_data.get();
+        if (!scratch || scratch->max_degree != this->max_degree || scratch->grid_degree != this->high_order_grid->fe_system.tensor_degree()) {
+            scratch = std::make_unique<CellBatchScratchData>(*this);
+        }
+        assemble_volume_term_cell_batch(*batch, *scratch);
+    };
+    const auto copy_batch = [](const CopyData &) {};
+    dealii::WorkStream::run(cell_batches.cbegin(), cell_batches.cend(), assemble_batch, copy_batch, CopyData(), CopyData());
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_cell_batch(
+    const CellBatch      &batch,
+    CellBatchScratchData &scratch)
+{
+    const unsigned int poly_degree = batch.poly_degree;
+    const unsigned int grid_degree = scratch.grid_degree;
+    if(poly_degree != scratch.soln_basis.current_degree){
+        scratch.soln_basis.current_degree = poly_degree;
+        scratch.flux_basis.current_degree = poly_degree;
+        scratch.mapping_basis.current_degree = poly_degree;
+        this->reinit_operators_for_cell_residual_loop(poly_degree, poly_degree, grid_degree,
+                                                      scratch.soln_basis, scratch.soln_basis,
+                                                      scratch.flux_basis, scratch.flux_basis,
+                                                      scratch.flux_basis_stiffness,
+                                                      scratch.soln_basis_projection_oper, scratch.soln_basis_projection_oper,
+                                                      scratch.mapping_basis);
+    }
+    //if have source term need to store vol flux nodes.
+    const bool use_manufactured_source = this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term;
+    const bool use_physical_source = this->pde_physics_double->has_nonzero_physical_source;
+    if(poly_degree != scratch.metric_degree){
+        for(auto &metric_oper : scratch.metric_opers){
+            metric_oper = std::make_unique<OPERATOR::metric_operators<real,dim,2*dim>>(nstate, poly_degree, grid_degree, use_manufactured_source);
+        }
+        scratch.metric_degree = poly_degree;
+    }
+
+    const dealii::FESystem<dim,dim> &fe_soln = this->fe_collection[poly_degree];
+    const unsigned int n_quad_pts  = this->volume_quadrature_collection[poly_degree].size();
+    const unsigned int n_dofs_cell = fe_soln.dofs_per_cell;
+    const unsigned int n_shape_fns = n_dofs_cell / nstate;
+    const std::vector<double> &vol_quad_weights = this->volume_quadrature_collection[poly_degree].get_weights();
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_grid_nodes  = n_metric_dofs / dim;
+    const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
+    const bool use_metric_terms_cache = this->all_parameters->use_metric_terms_cache;
+
+    // The lanes of the cells missing from the last batch of a degree stay zero and are not evaluated by the physics.
+    const std::array<real,n_batch_lanes> zero_lanes{};
+    scratch.soln_coeff.assign(n_shape_fns, zero_lanes);
+    for(int idim=0; idim<dim; idim++){
+        scratch.aux_soln_coeff[idim].assign(n_shape_fns, zero_lanes);
+        scratch.mapping_support_points[idim].resize(n_grid_nodes);
+    }
+    scratch.cell_dofs_indices.resize(n_dofs_cell);
+    scratch.metric_dof_indices.resize(n_metric_dofs);
+
+    for(unsigned int icell=0; icell<batch.n_cells; ++icell){
+        const typename dealii::DoFHandler<dim>::active_cell_iterator &cell = batch.cells[icell];
+        const dealii::types::global_dof_index cell_index = cell->active_cell_index();
+        OPERATOR::metric_operators<real,dim,2*dim> &metric_oper = *scratch.metric_opers[icell];
+
+        //build the volume metric cofactor matrix and the determinant of the volume metric Jacobian,
+        //which the cell loop then loads from the cache if it is used.
+        if(!use_metric_terms_cache || !this->metric_terms_cache.load_volume_terms(cell_index, poly_degree, metric_oper)){
+            const typename dealii::DoFHandler<dim>::active_cell_iterator metric_cell(
+                this->triangulation.get(), cell->level(), cell->index(), &(this->high_order_grid->dof_handler_grid));
+            metric_cell->get_dof_indices(scratch.metric_dof_indices);
+            for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
+                const real val = (this->high_order_grid->volume_nodes[scratch.metric_dof_indices[idof]]);
+                const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
+                const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
+                const unsigned int igrid_node = index_renumbering[ishape];
+                scratch.mapping_support_points[istate][igrid_node] = val; 
+            }
+            metric_oper.build_volume_metric_operators(
+                n_quad_pts, n_grid_nodes,
+                scratch.mapping_support_points,
+                scratch.mapping_basis,
+                this->all_parameters->use_invariant_curl_form);
+            if(use_metric_terms_cache) this->metric_terms_cache.store_volume_terms(cell_index, poly_degree, metric_oper);
+        }
+
+        // Fetch the modal soln coefficients and the modal auxiliary soln coefficients in the lanes of the cell.
+        cell->get_dof_indices(scratch.cell_dofs_indices);
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+            const unsigned int istate = fe_soln.system_to_component_index(idof).first;
+            const unsigned int ishape = fe_soln.system_to_component_index(idof).second;
+            const unsigned int ilane = icell*nstate + istate;
+            scratch.soln_coeff[ishape][ilane] = this->solution(scratch.cell_dofs_indices[idof]);
+            if(this->use_auxiliary_eq){
+                for(int idim=0; idim<dim; idim++){
+                    scratch.aux_soln_coeff[idim][ishape][ilane] = this->auxiliary_solution[idim](scratch.cell_dofs_indices[idof]);
+                }
             }
-            soln_basis.inner_product_1D(source_at_q[istate], JxW, rhs, soln_basis.oneD_vol_operator, true, 1.0);
         }
+    }
 
-        // Physical source
-        if(this->pde_physics_double->has_nonzero_physical_source) {
-            std::vector<real> JxW(n_quad_pts);
-            for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                JxW[iquad] = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+    // Interpolate all the states of all the cells to the quadrature points at once.
+    scratch.soln_at_q.resize(n_quad_pts);
+    scratch.soln_basis.matrix_vector_mult_1D_interleaved(scratch.soln_coeff, scratch.soln_at_q,
+                                                         scratch.soln_basis.oneD_vol_operator);
+    for(int idim=0; idim<dim; idim++){
+        scratch.aux_soln_at_q[idim].resize(n_quad_pts);
+        scratch.soln_basis.matrix_vector_mult_1D_interleaved(scratch.aux_soln_coeff[idim], scratch.aux_soln_at_q[idim],
+                                                             scratch.soln_basis.oneD_vol_operator);
+    }
+
+    // Solution of the cells in the layout of the physics, and their convective fluxes in a single call.
+    scratch.cell_soln_at_q.resize(batch.n_cells * n_quad_pts);
+    for(unsigned int icell=0; icell<batch.n_cells; ++icell){
+        for(unsigned int iquad=0; iquad<n_quad_pts; ++iquad){
+            for(int istate=0; istate<nstate; istate++){
+                scratch.cell_soln_at_q[icell*n_quad_pts + iquad][istate] = scratch.soln_at_q[iquad][icell*nstate + istate];
             }
-            soln_basis.inner_product_1D(physical_source_at_q[istate], JxW, rhs, soln_basis.oneD_vol_operator, true, 1.0);
         }
+        const std::vector<std::array<real,nstate>> soln_at_q(scratch.cell_soln_at_q.begin() + icell*n_quad_pts,
+                                                             scratch.cell_soln_at_q.begin() + (icell+1)*n_quad_pts);
+        evaluate_cell_volume_and_max_dt(batch.cells[icell], batch.cells[icell]->active_cell_index(), poly_degree, soln_at_q, *scratch.metric_opers[icell]);
+    }
+    this->pde_physics_double->convective_flux_batch(scratch.cell_soln_at_q, scratch.cell_conv_phys_flux);
 
-        for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
-            local_rhs_int_cell(istate*n_shape_fns + ishape) += rhs[ishape];
+    //Convert the physical fluxes into reference fluxes, as in assemble_volume_term_strong().
+    for(int idim=0; idim<dim; idim++){
+        scratch.conv_ref_flux_at_q[idim].assign(n_quad_pts, zero_lanes);
+        scratch.diffusive_ref_flux_at_q[idim].assign(n_quad_pts, zero_lanes);
+    }
+    if(use_manufactured_source || use_physical_source){
+        scratch.source_at_q.assign(n_quad_pts, zero_lanes);
+    }
+    for(unsigned int icell=0; icell<batch.n_cells; ++icell){
+        const dealii::types::global_dof_index cell_index = batch.cells[icell]->active_cell_index();
+        OPERATOR::metric_operators<real,dim,2*dim> &metric_oper = *scratch.metric_opers[icell];
+
+        //volume integrals requested with request_volume_integrals(), only on the first assembly following the request
+        const bool integrate_volume_integrands = (cell_index < this->volume_integrals_pending_cell.size())
+                                              && this->volume_integrals_pending_cell[cell_index];
+        scratch.integrand_values.resize(integrate_volume_integrands ? this->n_volume_integrands : 0);
+
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            const std::array<real,nstate> &soln_state = scratch.cell_soln_at_q[icell*n_quad_pts + iquad];
+            std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state;
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    aux_soln_state[istate][idim] = scratch.aux_soln_at_q[idim][iquad][icell*nstate + istate];
+                }
+            }
+
+            if(integrate_volume_integrands){
+                this->volume_integrands(soln_state, aux_soln_state, scratch.integrand_values);
+                const real JxW_iquad = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+                for(unsigned int i_integrand=0; i_integrand<this->n_volume_integrands; i_integrand++){
+                    this->volume_integrals_cell[cell_index * this->n_volume_integrands + i_integrand] += scratch.integrand_values[i_integrand] * JxW_iquad;
+                }
+            }
+
+            dealii::Tensor<2,dim,real> metric_cofactor;
+            for(int idim=0; idim<dim; idim++){
+                for(int jdim=0; jdim<dim; jdim++){
+                    metric_cofactor[idim][jdim] = metric_oper.metric_cofactor_vol[idim][jdim][iquad];
+                }
+            }
+
+            //Compute the physical dissipative flux
+            const std::array<dealii::Tensor<1,dim,real>,nstate> diffusive_phys_flux
+                = this->pde_physics_double->dissipative_flux(soln_state, aux_soln_state, cell_index);
+
+            // Sources, scaled by the determinant of the metric Jacobian since the quadrature weights are shared by the cells.
+            if(use_manufactured_source || use_physical_source){
+                dealii::Point<dim,real> vol_flux_node;
+                for(int idim=0; idim<dim; idim++){
+                    vol_flux_node[idim] = metric_oper.flux_nodes_vol[idim][iquad];
+                }
+                const real det_Jac = metric_oper.det_Jac_vol[iquad];
+                if(use_manufactured_source){
+                    const std::array<real,nstate> source = this->pde_physics_double->source_term (vol_flux_node, soln_state, this->current_time, cell_index);
+                    for(int istate=0; istate<nstate; istate++){
+                        scratch.source_at_q[iquad][icell*nstate + istate] += source[istate] * det_Jac;
+                    }
+                }
+                if(use_physical_source){
+                    const std::array<real,nstate> source = this->pde_physics_double->physical_source_term (vol_flux_node, soln_state, aux_soln_state, cell_index);
+                    for(int istate=0; istate<nstate; istate++){
+                        scratch.source_at_q[iquad][icell*nstate + istate] += source[istate] * det_Jac;
+                    }
+                }
+            }
+
+            const std::array<dealii::Tensor<1,dim,real>,nstate> &conv_phys_flux = scratch.cell_conv_phys_flux[icell*n_quad_pts + iquad];
+            for(int istate=0; istate<nstate; istate++){
+                dealii::Tensor<1,dim,real> conv_ref_flux;
+                dealii::Tensor<1,dim,real> diffusive_ref_flux;
+                metric_oper.transform_physical_to_reference(
+                    conv_phys_flux[istate],
+                    metric_cofactor,
+                    conv_ref_flux);
+                metric_oper.transform_physical_to_reference(
+                    diffusive_phys_flux[istate],
+                    metric_cofactor,
+                    diffusive_ref_flux);
+                for(int idim=0; idim<dim; idim++){
+                    scratch.conv_ref_flux_at_q[idim][iquad][icell*nstate + istate] = conv_ref_flux[idim];
+                    scratch.diffusive_ref_flux_at_q[idim][iquad][icell*nstate + istate] = diffusive_ref_flux[idim];
+                }
+            }
         }
+        if(integrate_volume_integrands) this->volume_integrals_pending_cell[cell_index] = 0;
+    }
+
+    //Reference divergence of the reference fluxes of all the cells.
+    scratch.conv_flux_divergence.resize(n_quad_pts);
+    scratch.diffusive_flux_divergence.resize(n_quad_pts);
+    scratch.flux_basis.divergence_matrix_vector_mult_1D_interleaved(scratch.conv_ref_flux_at_q, scratch.conv_flux_divergence,
+                                                                    scratch.flux_basis.oneD_vol_operator,
+                                                                    scratch.flux_basis.oneD_grad_operator);
+    scratch.flux_basis.divergence_matrix_vector_mult_1D_interleaved(scratch.diffusive_ref_flux_at_q, scratch.diffusive_flux_divergence,
+                                                                    scratch.flux_basis.oneD_vol_operator,
+                                                                    scratch.flux_basis.oneD_grad_operator);
+
+    // rhs = - \divergence( Fconv + Fdiss ) + source, see assemble_volume_term_strong().
+    scratch.rhs.resize(n_shape_fns);
+    scratch.soln_basis.inner_product_1D_interleaved(scratch.conv_flux_divergence, vol_quad_weights, scratch.rhs, scratch.weighted_input,
+                                                    scratch.soln_basis.oneD_vol_operator, false, -1.0);
+    scratch.soln_basis.inner_product_1D_interleaved(scratch.diffusive_flux_divergence, vol_quad_weights, scratch.rhs, scratch.weighted_input,
+                                                    scratch.soln_basis.oneD_vol_operator, true, -1.0);
+    if(use_manufactured_source || use_physical_source){
+        scratch.soln_basis.inner_product_1D_interleaved(scratch.source_at_q, vol_quad_weights, scratch.rhs, scratch.weighted_input,
+                                                        scratch.soln_basis.oneD_vol_operator, true, 1.0);
+    }
 
+    for(unsigned int icell=0; icell<batch.n_cells; ++icell){
+        const dealii::types::global_dof_index cell_index = batch.cells[icell]->active_cell_index();
+        dealii::Vector<real> &cell_rhs = batched_volume_rhs[cell_index];
+        if(cell_rhs.size() != n_dofs_cell) cell_rhs.reinit(n_dofs_cell);
+        for(int istate=0; istate<nstate; istate++){
+            for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
+                cell_rhs(istate*n_shape_fns + ishape) = scratch.rhs[ishape][icell*nstate + istate];
+            }
+        }
+        volume_rhs_is_batched[cell_index] = 1;
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+const typename DGStrong<dim,nstate,real,MeshType>::HadamardVolumeOperators &
+DGStrong<dim,nstate,real,MeshType>::get_Hadamard_volume_operators(
+    const unsigned int                         poly_degree,
+    OPERATOR::basis_functions<dim,2*dim>       &flux_basis,
+    OPERATOR::local_basis_stiffness<dim,2*dim> &flux_basis_stiffness)
+{
+    std::lock_guard<std::mutex> lock(Hadamard_volume_operators_mutex);
+    if(Hadamard_volume_operators.size() <= poly_degree){
+        Hadamard_volume_operators.resize(poly_degree+1);
+    }
+    std::unique_ptr<HadamardVolumeOperators> &Hadamard_operators = Hadamard_volume_operators[poly_degree];
+    if(Hadamard_operators) return *Hadamard_operators;
+
+    Hadamard_operators = std::make_unique<HadamardVolumeOperators>();
+    const unsigned int n_quad_pts_1D = this->oneD_quadrature_collection[poly_degree].size();
+    const unsigned int n_quad_pts = pow(n_quad_pts_1D, dim);
+    const std::vector<double> &oneD_vol_quad_weights = this->oneD_quadrature_collection[poly_degree].get_weights();
+
+    //extract the dof pairs that give non-zero entries for each direction
+    //to use the "sum-factorized" Hadamard product.
+    Hadamard_operators->rows_sparsity.resize(n_quad_pts * n_quad_pts_1D);//size n^{d+1}
+    Hadamard_operators->columns_sparsity.resize(n_quad_pts * n_quad_pts_1D);
+    flux_basis.sum_factorized_Hadamard_sparsity_pattern(n_quad_pts_1D, n_quad_pts_1D,
+                                                        Hadamard_operators->rows_sparsity,
+                                                        Hadamard_operators->columns_sparsity);
+    //the volume term loops over the rows in order, with n_quad_pts_1D non-zero entries per row.
+    for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+        for(unsigned int row_index = iquad * n_quad_pts_1D; row_index < (iquad+1) * n_quad_pts_1D; row_index++){
+            if(Hadamard_operators->rows_sparsity[row_index][0] != iquad){
+                pcout<<"The volume Hadamard rows sparsity pattern does not match. Aborting..."<<std::endl;
+                std::abort();
+            }
+        }
+    }
+
+    // Get a flux basis reference gradient operator in a sum-factorized Hadamard product sparse form.
+    for(int idim=0; idim<dim; idim++){
+        Hadamard_operators->flux_basis_stiffness_skew_symm_oper_sparse[idim].reinit(n_quad_pts, n_quad_pts_1D);
     }
+    flux_basis.sum_factorized_Hadamard_basis_assembly(n_quad_pts_1D, n_quad_pts_1D, 
+                                                      Hadamard_operators->rows_sparsity,
+                                                      Hadamard_operators->columns_sparsity,
+                                                      flux_basis_stiffness.oneD_skew_symm_vol_oper, 
+                                                      oneD_vol_quad_weights,
+                                                      Hadamard_operators->flux_basis_stiffness_skew_symm_oper_sparse);
+    return *Hadamard_operators;
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
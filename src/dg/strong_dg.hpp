@@ -1,6 +1,10 @@
 #ifndef __STRONG_DISCONTINUOUSGALERKIN_H__
 #define __STRONG_DISCONTINUOUSGALERKIN_H__
 
+#include <array>
+#include <memory>
+#include <mutex>
+
 #include "dg_base_state.hpp"
 
 namespace PHiLiP {
@@ -35,6 +39,15 @@ public:
      */
     void assemble_auxiliary_residual ();
 
+    /// Assembles the volume terms of the locally owned cells by batches of n_cells_per_batch cells of the same degree.
+    /** Only if use_cell_batches_in_volume_terms is set. The states of the cells of a batch are interleaved,
+     *  such that the sum-factorization kernels apply each basis entry to all the cells and states in their innermost loop,
+     *  and the convective fluxes of the batch are evaluated by a single convective_flux_batch() call.
+     *  The right-hand sides are stored in batched_volume_rhs, and added by assemble_volume_term_and_build_operators()
+     *  in the cell loop, which still builds the volume metric terms used by the face terms.
+     */
+    void assemble_volume_terms_in_cell_batches ();
+
     /// Allocate the dual vector for optimization.
     void allocate_dual_vector ();
 
@@ -255,6 +268,91 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper,
         dealii::Vector<real>                               &local_rhs_int_cell);
 
+    /// Stores the volume and the maximum time step of a cell, from its solution at the volume cubature nodes.
+    void evaluate_cell_volume_and_max_dt(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index              current_cell_index,
+        const unsigned int                                 poly_degree,
+        const std::vector<std::array<real,nstate>>         &soln_at_q,
+        const OPERATOR::metric_operators<real,dim,2*dim>   &metric_oper);
+
+    /// Number of cells whose volume terms are assembled together, i.e. the number of doubles in an AVX2 register.
+    static constexpr unsigned int n_cells_per_batch = 4;
+
+    /// Number of interleaved lanes of a cell batch, the states of every cell of the batch.
+    static constexpr int n_batch_lanes = n_cells_per_batch * nstate;
+
+    /// Cells of the same polynomial degree whose volume terms are assembled together.
+    struct CellBatch
+    {
+        /// Cells of the batch, of which only the first n_cells are used.
+        std::array<typename dealii::DoFHandler<dim>::active_cell_iterator,n_cells_per_batch> cells;
+        /// Number of cells of the batch, smaller than n_cells_per_batch for the last batch of a degree.
+        unsigned int n_cells = 0;
+        /// Polynomial degree of the cells.
+        unsigned int poly_degree = 0;
+    };
+
+    /// Scratch objects used by each thread to assemble the volume terms of the cell batches.
+    /** The lane vectors interleave the states of the cells, such that [i][icell*nstate + istate] is the state istate
+     *  of the cell icell of the batch at the node i. They are only reallocated when the polynomial degree changes.
+     */
+    struct CellBatchScratchData
+    {
+        /// Constructor. Builds the operators for the maximum polynomial degree.
+        explicit CellBatchScratchData(DGStrong<dim,nstate,real,MeshType> &dg);
+
+        const unsigned int max_degree; ///< Maximum polynomial degree for which the operators were built.
+        const unsigned int grid_degree; ///< Grid degree for which the operators were built.
+
+        OPERATOR::basis_functions<dim,2*dim>         soln_basis; ///< Solution basis.
+        OPERATOR::basis_functions<dim,2*dim>         flux_basis; ///< Flux basis.
+        OPERATOR::local_basis_stiffness<dim,2*dim>   flux_basis_stiffness; ///< Flux basis stiffness, rebuilt with the other operators.
+        OPERATOR::vol_projection_operator<dim,2*dim> soln_basis_projection_oper; ///< Solution projection operator, rebuilt with the other operators.
+        OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis; ///< Mapping shape functions.
+
+        /// Volume metric operators of each cell of the batch, built for metric_degree.
+        std::array<std::unique_ptr<OPERATOR::metric_operators<real,dim,2*dim>>,n_cells_per_batch> metric_opers;
+        /// Polynomial degree of metric_opers.
+        unsigned int metric_degree;
+
+        std::array<std::vector<real>,dim> mapping_support_points; ///< Grid nodes of a cell split by direction.
+        std::vector<dealii::types::global_dof_index> cell_dofs_indices; ///< Solution dofs of a cell.
+        std::vector<dealii::types::global_dof_index> metric_dof_indices; ///< Grid dofs of a cell.
+
+        std::vector<std::array<real,n_batch_lanes>> soln_coeff; ///< Modal solution coefficients.
+        std::array<std::vector<std::array<real,n_batch_lanes>>,dim> aux_soln_coeff; ///< Modal auxiliary solution coefficients.
+        std::vector<std::array<real,n_batch_lanes>> soln_at_q; ///< Solution at the volume cubature nodes.
+        std::array<std::vector<std::array<real,n_batch_lanes>>,dim> aux_soln_at_q; ///< Auxiliary solution at the volume cubature nodes.
+        std::array<std::vector<std::array<real,n_batch_lanes>>,dim> conv_ref_flux_at_q; ///< Reference convective flux.
+        std::array<std::vector<std::array<real,n_batch_lanes>>,dim> diffusive_ref_flux_at_q; ///< Reference dissipative flux.
+        std::vector<std::array<real,n_batch_lanes>> source_at_q; ///< Sources times the determinant of the metric Jacobian.
+        std::vector<std::array<real,n_batch_lanes>> conv_flux_divergence; ///< Reference divergence of the convective flux.
+        std::vector<std::array<real,n_batch_lanes>> diffusive_flux_divergence; ///< Reference divergence of the dissipative flux.
+        std::vector<std::array<real,n_batch_lanes>> rhs; ///< Volume right-hand side.
+        std::vector<std::array<real,n_batch_lanes>> weighted_input; ///< Scratch vector of inner_product_1D_interleaved().
+
+        std::vector<std::array<real,nstate>> cell_soln_at_q; ///< Solution of the cells at the volume cubature nodes, cell after cell.
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> cell_conv_phys_flux; ///< Physical convective flux of the cells, cell after cell.
+        std::vector<real> integrand_values; ///< Requested volume integrands at a node.
+    };
+
+    /// Assembles the volume right-hand side of the cells of a batch into batched_volume_rhs.
+    void assemble_volume_term_cell_batch(
+        const CellBatch      &batch,
+        CellBatchScratchData &scratch);
+
+    /// Scratch data of each thread assembling the cell batches.
+    dealii::Threads::ThreadLocalStorage<std::unique_ptr<CellBatchScratchData>> thread_cell_batch_scratch_data;
+
+    /// Volume right-hand sides assembled by assemble_volume_terms_in_cell_batches(), indexed by active_cell_index.
+    std::vector<dealii::Vector<real>> batched_volume_rhs;
+
+    /// Whether batched_volume_rhs holds the volume term of the cell for the residual being assembled.
+    /** Cleared by the cell loop when it adds the volume term to the cell residual.
+     */
+    std::vector<char> volume_rhs_is_batched;
+
     /// Strong form primary equation's boundary right-hand-side.
     void assemble_boundary_term_strong(
         const unsigned int                                 iface, 
@@ -368,6 +466,35 @@ protected:
         const dealii::FEValues<dim,dim> &fe_values_lagrange);
     
 
+    /// Operators of the volume "sum-factorized" Hadamard product for a given polynomial degree.
+    /** They only depend on the one-dimensional flux basis and cubature, and are therefore
+     *  shared by all the cells of the same polynomial degree.
+     */
+    struct HadamardVolumeOperators
+    {
+        /// Non-zero row indices of the \f$ n^d \times n\f$ sparse Hadamard operators.
+        std::vector<std::array<unsigned int,dim>> rows_sparsity;
+        /// Non-zero column indices of the \f$ n^d \times n\f$ sparse Hadamard operators.
+        std::vector<std::array<unsigned int,dim>> columns_sparsity;
+        /// Flux basis skew-symmetric stiffness operator in each reference direction, stored in the sparse Hadamard form.
+        std::array<dealii::FullMatrix<real>,dim> flux_basis_stiffness_skew_symm_oper_sparse;
+    };
+
+    /// Returns the volume Hadamard product operators of poly_degree, and builds them the first time.
+    /** flux_basis and flux_basis_stiffness must have been built for poly_degree.
+     *  Safe to call from several threads.
+     */
+    const HadamardVolumeOperators &get_Hadamard_volume_operators(
+        const unsigned int                         poly_degree,
+        OPERATOR::basis_functions<dim,2*dim>       &flux_basis,
+        OPERATOR::local_basis_stiffness<dim,2*dim> &flux_basis_stiffness);
+
+    /// Volume Hadamard product operators indexed by polynomial degree.
+    std::vector<std::unique_ptr<HadamardVolumeOperators>> Hadamard_volume_operators;
+
+    /// Guards the construction of Hadamard_volume_operators when the residual is assembled with threads.
+    std::mutex Hadamard_volume_operators_mutex;
+
     using DGBase<dim,real,MeshType>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
     
 }; // end of DGStrong class
@@ -1084,7 +1084,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
                 AssertIsFinite(residual_derivatives[idof]);
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
+            this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
         if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
@@ -1092,7 +1092,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
                 const unsigned int i_dx = idof+x_start;
                 residual_derivatives[idof] = rhs[itest].dx(i_dx).val();
             }
-            this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
+            this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
         }
 
     }
@@ -1110,13 +1110,13 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
                 const unsigned int j_dx = jdof+w_start;
                 dWidW[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices[idof], soln_dof_indices, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices[idof], soln_dof_indices, dWidW);
 
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices[idof], metric_dof_indices, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices[idof], metric_dof_indices, dWidX);
         }
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
 
@@ -1127,7 +1127,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
                 const unsigned int j_dx = jdof+x_start;
                 dXidX[jdof] = dXi.dx(j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices[idof], metric_dof_indices, dXidX);
         }
     }
 }
@@ -1236,34 +1236,33 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
         AssertIsFinite(local_rhs_cell(itest));
     }
 
-    if (compute_dRdW) {
+    if (compute_dRdW || compute_dRdX) {
+        // A single evaluation provides both the solution and metric columns of the Jacobian.
         typename TH::JacobianType& jac = th.createJacobian();
         th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
 
+        if (compute_dRdW) {
             std::vector<real> residual_derivatives(n_soln_dofs);
-            for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
-                const unsigned int i_dx = idof+w_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
-                AssertIsFinite(residual_derivatives[idof]);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+                    const unsigned int i_dx = idof+w_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                    AssertIsFinite(residual_derivatives[idof]);
+                }
+                const bool elide_zero_values = false;
+                this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
             }
-            const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
-        th.deleteJacobian(jac);
-
-    }
 
-    if (compute_dRdX) {
-        typename TH::JacobianType& jac = th.createJacobian();
-        th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
-            for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
-                const unsigned int i_dx = idof+x_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+                    const unsigned int i_dx = idof+x_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                }
+                this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
             }
-            this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
         }
         th.deleteJacobian(jac);
     }
@@ -1287,13 +1286,13 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+w_start;
                 dWidW[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices[idof], soln_dof_indices, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices[idof], soln_dof_indices, dWidW);
 
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_start;
                 dWidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices[idof], metric_dof_indices, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices[idof], metric_dof_indices, dWidX);
         }
 
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
@@ -1304,7 +1303,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+x_start;
                 dXidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices[idof], metric_dof_indices, dXidX);
         }
 
         th.deleteHessian(hes);
@@ -1442,6 +1441,19 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
             *(DGBaseState<dim,nstate,real,MeshType>::diss_num_flux_rad),
             local_rhs_cell,
             compute_dRdW, compute_dRdX, compute_d2R);
+    } else if (this->matrix_free_derivatives != DGBase<dim,real,MeshType>::MatrixFreeDerivatives::none) {
+        assemble_boundary_matrix_free_derivatives(
+            cell,
+            current_cell_index,
+            face_number,
+            boundary_id,
+            fe_values_boundary,
+            penalty,
+            fe_soln,
+            quadrature,
+            metric_dof_indices,
+            soln_dof_indices,
+            local_rhs_cell);
     } else {
         assemble_boundary_residual(
         cell,
@@ -2133,7 +2145,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 residual_derivatives[idof] = rhs_int[itest_int].dx(i_dx).val();
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+            this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
             // dR_int_dW_ext
             residual_derivatives.resize(n_soln_dofs_ext);
@@ -2141,7 +2153,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+w_ext_start;
                 residual_derivatives[idof] = rhs_int[itest_int].dx(i_dx).val();
             }
-            this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+            this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
         }
 
         for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
@@ -2152,7 +2164,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 residual_derivatives[idof] = rhs_ext[itest_ext].dx(i_dx).val();
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+            this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
             // dR_ext_dW_ext
             residual_derivatives.resize(n_soln_dofs_ext);
@@ -2160,7 +2172,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+w_ext_start;
                 residual_derivatives[idof] = rhs_ext[itest_ext].dx(i_dx).val();
             }
-            this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+            this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
         }
     }
     if (compute_dRdX) {
@@ -2171,14 +2183,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+x_int_start;
                 residual_derivatives[idof] = rhs_int[itest_int].dx(i_dx).val();
             }
-            this->dRdXv.add(soln_dof_indices_int[itest_int], metric_dof_indices_int, residual_derivatives);
+            this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_int[itest_int], metric_dof_indices_int, residual_derivatives);
 
             // dR_int_dX_ext
             for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
                 const unsigned int i_dx = idof+x_ext_start;
                 residual_derivatives[idof] = rhs_int[itest_int].dx(i_dx).val();
             }
-            this->dRdXv.add(soln_dof_indices_int[itest_int], metric_dof_indices_ext, residual_derivatives);
+            this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_int[itest_int], metric_dof_indices_ext, residual_derivatives);
         }
         for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
             // dR_ext_dX_int
@@ -2187,7 +2199,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+x_int_start;
                 residual_derivatives[idof] = rhs_ext[itest_ext].dx(i_dx).val();
             }
-            this->dRdXv.add(soln_dof_indices_ext[itest_ext], metric_dof_indices_int, residual_derivatives);
+            this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_ext[itest_ext], metric_dof_indices_int, residual_derivatives);
 
             // dR_ext_dX_ext
             // residual_derivatives.resize(n_metric_dofs);
@@ -2195,7 +2207,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+x_ext_start;
                 residual_derivatives[idof] = rhs_ext[itest_ext].dx(i_dx).val();
             }
-            this->dRdXv.add(soln_dof_indices_ext[itest_ext], metric_dof_indices_ext, residual_derivatives);
+            this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_ext[itest_ext], metric_dof_indices_ext, residual_derivatives);
         }
     }
 
@@ -2215,28 +2227,28 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int j_dx = jdof+w_int_start;
                 dWidWint[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_int[idof], soln_dof_indices_int, dWidWint);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_int[idof], soln_dof_indices_int, dWidWint);
 
             // dWint_dWext
             for (unsigned int jdof=0; jdof<n_soln_dofs_ext; ++jdof) {
                 const unsigned int j_dx = jdof+w_ext_start;
                 dWidWext[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_int[idof], soln_dof_indices_ext, dWidWext);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_int[idof], soln_dof_indices_ext, dWidWext);
 
             // dWint_dXint
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_int_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_int[idof], metric_dof_indices_int, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_int[idof], metric_dof_indices_int, dWidX);
 
             // dWint_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_int[idof], metric_dof_indices_ext, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_int[idof], metric_dof_indices_ext, dWidX);
         }
         // dWext
         for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) {
@@ -2249,28 +2261,28 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int j_dx = jdof+w_int_start;
                 dWidWint[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_ext[idof], soln_dof_indices_int, dWidWint);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_ext[idof], soln_dof_indices_int, dWidWint);
 
             // dWext_dWext
             for (unsigned int jdof=0; jdof<n_soln_dofs_ext; ++jdof) {
                 const unsigned int j_dx = jdof+w_ext_start;
                 dWidWext[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_ext[idof], soln_dof_indices_ext, dWidWext);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_ext[idof], soln_dof_indices_ext, dWidWext);
 
             // dWext_dXint
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_int_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_ext[idof], metric_dof_indices_int, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_ext[idof], metric_dof_indices_int, dWidX);
 
             // dWext_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_ext[idof], metric_dof_indices_ext, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_ext[idof], metric_dof_indices_ext, dWidX);
         }
 
         // dXint
@@ -2284,14 +2296,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int j_dx = jdof+x_int_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_int[idof], metric_dof_indices_int, dWidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_int[idof], metric_dof_indices_int, dWidX);
 
             // dXint_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_int[idof], metric_dof_indices_ext, dWidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_int[idof], metric_dof_indices_ext, dWidX);
         }
         // dXext
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
@@ -2304,14 +2316,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int j_dx = jdof+x_int_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_ext[idof], metric_dof_indices_int, dWidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_ext[idof], metric_dof_indices_int, dWidX);
 
             // dXext_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_ext[idof], metric_dof_indices_ext, dWidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_ext[idof], metric_dof_indices_ext, dWidX);
         }
     }
 }
@@ -2488,7 +2500,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
                 const bool elide_zero_values = false;
-                this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+                this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
                 // dR_int_dW_ext
                 residual_derivatives.resize(n_soln_dofs_ext);
@@ -2496,7 +2508,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     const unsigned int i_dx = idof+w_ext_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+                this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
             }
 
             for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
@@ -2510,7 +2522,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
                 const bool elide_zero_values = false;
-                this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+                this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
                 // dR_ext_dW_ext
                 residual_derivatives.resize(n_soln_dofs_ext);
@@ -2518,7 +2530,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     const unsigned int i_dx = idof+w_ext_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+                this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
             }
         }
 
@@ -2534,14 +2546,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     const unsigned int i_dx = idof+x_int_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->dRdXv.add(soln_dof_indices_int[itest_int], metric_dof_indices_int, residual_derivatives);
+                this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_int[itest_int], metric_dof_indices_int, residual_derivatives);
 
                 // dR_int_dX_ext
                 for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
                     const unsigned int i_dx = idof+x_ext_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->dRdXv.add(soln_dof_indices_int[itest_int], metric_dof_indices_ext, residual_derivatives);
+                this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_int[itest_int], metric_dof_indices_ext, residual_derivatives);
             }
 
             for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
@@ -2553,14 +2565,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     const unsigned int i_dx = idof+x_int_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->dRdXv.add(soln_dof_indices_ext[itest_ext], metric_dof_indices_int, residual_derivatives);
+                this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_ext[itest_ext], metric_dof_indices_int, residual_derivatives);
 
                 // dR_ext_dX_ext
                 for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
                     const unsigned int i_dx = idof+x_ext_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->dRdXv.add(soln_dof_indices_ext[itest_ext], metric_dof_indices_ext, residual_derivatives);
+                this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices_ext[itest_ext], metric_dof_indices_ext, residual_derivatives);
             }
         }
 
@@ -2586,28 +2598,28 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+w_int_start;
                 dWidW[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_int[idof], soln_dof_indices_int, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_int[idof], soln_dof_indices_int, dWidW);
 
             // dWint_dWext
             for (unsigned int jdof=0; jdof<n_soln_dofs_ext; ++jdof) {
                 const unsigned int j_dx = jdof+w_ext_start;
                 dWidW[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_int[idof], soln_dof_indices_ext, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_int[idof], soln_dof_indices_ext, dWidW);
 
             // dWint_dXint
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_int_start;
                 dWidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_int[idof], metric_dof_indices_int, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_int[idof], metric_dof_indices_int, dWidX);
 
             // dWint_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dWidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_int[idof], metric_dof_indices_ext, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_int[idof], metric_dof_indices_ext, dWidX);
         }
 
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
@@ -2619,14 +2631,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+x_int_start;
                 dXidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_int[idof], metric_dof_indices_int, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_int[idof], metric_dof_indices_int, dXidX);
 
             // dXint_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dXidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_int[idof], metric_dof_indices_ext, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_int[idof], metric_dof_indices_ext, dXidX);
         }
 
         dWidW.resize(n_soln_dofs_ext);
@@ -2640,28 +2652,28 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+w_int_start;
                 dWidW[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_ext[idof], soln_dof_indices_int, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_ext[idof], soln_dof_indices_int, dWidW);
 
             // dWext_dWext
             for (unsigned int jdof=0; jdof<n_soln_dofs_ext; ++jdof) {
                 const unsigned int j_dx = jdof+w_ext_start;
                 dWidW[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices_ext[idof], soln_dof_indices_ext, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices_ext[idof], soln_dof_indices_ext, dWidW);
 
             // dWext_dXint
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_int_start;
                 dWidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_ext[idof], metric_dof_indices_int, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_ext[idof], metric_dof_indices_int, dWidX);
 
             // dWext_dXext
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dWidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices_ext[idof], metric_dof_indices_ext, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices_ext[idof], metric_dof_indices_ext, dWidX);
         }
 
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
@@ -2673,13 +2685,13 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+x_int_start;
                 dXidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_ext[idof], metric_dof_indices_int, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_ext[idof], metric_dof_indices_int, dXidX);
 
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_ext_start;
                 dXidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices_ext[idof], metric_dof_indices_ext, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices_ext[idof], metric_dof_indices_ext, dXidX);
         }
 
         th.deleteHessian(hes);
@@ -3166,7 +3178,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
                 AssertIsFinite(residual_derivatives[idof]);
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
+            this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
         if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
@@ -3174,7 +3186,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
                 const unsigned int i_dx = idof+x_start;
                 residual_derivatives[idof] = rhs[itest].dx(i_dx).val();
             }
-            this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
+            this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
         }
         //if (compute_d2R) {
         //    const unsigned int global_residual_row = soln_dof_indices[itest];
@@ -3202,13 +3214,13 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
                 const unsigned int j_dx = jdof+w_start;
                 dWidW[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices[idof], soln_dof_indices, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices[idof], soln_dof_indices, dWidW);
 
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_start;
                 dWidX[jdof] = dWi.dx(j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices[idof], metric_dof_indices, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices[idof], metric_dof_indices, dWidX);
         }
 
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
@@ -3220,7 +3232,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
                 const unsigned int j_dx = jdof+x_start;
                 dXidX[jdof] = dXi.dx(j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices[idof], metric_dof_indices, dXidX);
         }
     }
 
@@ -3325,34 +3337,33 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
         AssertIsFinite(local_rhs_cell(itest));
     }
 
-    if (compute_dRdW) {
+    if (compute_dRdW || compute_dRdX) {
+        // A single evaluation provides both the solution and metric columns of the Jacobian.
         typename TH::JacobianType& jac = th.createJacobian();
         th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
 
+        if (compute_dRdW) {
             std::vector<real> residual_derivatives(n_soln_dofs);
-            for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
-                const unsigned int i_dx = idof+w_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
-                AssertIsFinite(residual_derivatives[idof]);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+                    const unsigned int i_dx = idof+w_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                    AssertIsFinite(residual_derivatives[idof]);
+                }
+                const bool elide_zero_values = false;
+                this->add_to_derivative_matrix(this->system_matrix, soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
             }
-            const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
-        th.deleteJacobian(jac);
-
-    }
 
-    if (compute_dRdX) {
-        typename TH::JacobianType& jac = th.createJacobian();
-        th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
-            for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
-                const unsigned int i_dx = idof+x_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+                    const unsigned int i_dx = idof+x_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                }
+                this->add_to_derivative_matrix(this->dRdXv, soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
             }
-            this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
         }
         th.deleteJacobian(jac);
     }
@@ -3376,13 +3387,13 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+w_start;
                 dWidW[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdW.add(soln_dof_indices[idof], soln_dof_indices, dWidW);
+            this->add_to_derivative_matrix(this->d2RdWdW, soln_dof_indices[idof], soln_dof_indices, dWidW);
 
             for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
                 const unsigned int j_dx = jdof+x_start;
                 dWidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdWdX.add(soln_dof_indices[idof], metric_dof_indices, dWidX);
+            this->add_to_derivative_matrix(this->d2RdWdX, soln_dof_indices[idof], metric_dof_indices, dWidX);
         }
 
         for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
@@ -3393,7 +3404,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
                 const unsigned int j_dx = jdof+x_start;
                 dXidX[jdof] = hes(i_dependent,i_dx,j_dx);
             }
-            this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
+            this->add_to_derivative_matrix(this->d2RdXdX, metric_dof_indices[idof], metric_dof_indices, dXidX);
         }
 
         th.deleteHessian(hes);
@@ -3508,6 +3519,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
             fe_values_lagrange,
             *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_rad),
             compute_dRdW, compute_dRdX, compute_d2R);
+    } else if (this->matrix_free_derivatives != DGBase<dim,real,MeshType>::MatrixFreeDerivatives::none) {
+        assemble_volume_matrix_free_derivatives(
+            cell,
+            current_cell_index,
+            fe_values_vol,
+            fe_soln, quadrature,
+            metric_dof_indices, soln_dof_indices,
+            local_rhs_cell);
     } else {
         assemble_volume_residual(
         cell,
@@ -3597,6 +3616,27 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
             local_rhs_int_cell,
             local_rhs_ext_cell,
             compute_dRdW, compute_dRdX, compute_d2R);
+    } else if (this->matrix_free_derivatives != DGBase<dim,real,MeshType>::MatrixFreeDerivatives::none) {
+        assemble_face_matrix_free_derivatives(
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            face_subface_int,
+            face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            fe_values_int,
+            fe_values_ext,
+            penalty,
+            fe_int,
+            fe_ext,
+            face_quadrature,
+            metric_dof_indices_int,
+            metric_dof_indices_ext,
+            soln_dof_indices_int,
+            soln_dof_indices_ext,
+            local_rhs_int_cell,
+            local_rhs_ext_cell);
     } else {
         assemble_face_residual(
         cell,
@@ -3627,6 +3667,276 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
 #endif
 
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::seed_matrix_free_derivatives(
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    const bool seed_derivatives,
+    LocalSolution<FadType, dim, nstate> &local_solution) const
+{
+    const bool seed_direction = (this->matrix_free_derivatives == DGBase<dim,real,MeshType>::MatrixFreeDerivatives::dRdW_times_direction);
+    const unsigned int n_soln_dofs = soln_dof_indices.size();
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        const real val = this->solution(soln_dof_indices[idof]);
+        if (!seed_derivatives) {
+            // Constants carry no derivative array, such that operations on them stay scalar.
+            local_solution.coefficients[idof] = val;
+        } else if (seed_direction) {
+            local_solution.coefficients[idof] = FadType(1, val);
+            local_solution.coefficients[idof].fastAccessDx(0) = this->dRdW_direction(soln_dof_indices[idof]);
+        } else {
+            local_solution.coefficients[idof] = FadType(n_soln_dofs, idof, val);
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::store_matrix_free_derivatives(
+    const std::vector<FadType> &rhs,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    const dealii::types::global_dof_index cell_index)
+{
+    const unsigned int n_soln_dofs = soln_dof_indices.size();
+    if (this->matrix_free_derivatives == DGBase<dim,real,MeshType>::MatrixFreeDerivatives::dRdW_times_direction) {
+        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+            // Terms that do not depend on the solution have no derivatives.
+            this->dRdW_times_direction(soln_dof_indices[itest]) += rhs[itest].dx(0);
+        }
+    } else {
+        dealii::FullMatrix<real> &block = (*(this->dRdW_diagonal_blocks))[cell_index];
+        AssertDimension(block.m(), n_soln_dofs);
+        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+            if (rhs[itest].size() == 0) continue;
+            for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+                block(itest,idof) += rhs[itest].fastAccessDx(idof);
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_volume_matrix_free_derivatives(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::FEValues<dim,dim> &fe_values_vol,
+    const dealii::FESystem<dim,dim> &fe_soln,
+    const dealii::Quadrature<dim> &quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    dealii::Vector<real> &local_rhs_cell)
+{
+    const bool compute_metric_derivatives = true;
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs = fe_soln.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs, soln_dof_indices.size());
+
+    LocalSolution<FadType, dim, nstate> local_solution(fe_soln);
+    LocalSolution<FadType, dim, dim> local_metric(fe_metric);
+
+    const bool seed_derivatives = true;
+    seed_matrix_free_derivatives(soln_dof_indices, seed_derivatives, local_solution);
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        const real val = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+        local_metric.coefficients[idof] = val;
+    }
+
+    std::vector<real> local_dual(n_soln_dofs);
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_dual[itest] = this->dual[soln_dof_indices[itest]];
+    }
+
+    FadType dual_dot_residual = 0.0;
+    std::vector<FadType> rhs(n_soln_dofs);
+    assemble_volume_term<FadType>(
+        cell,
+        current_cell_index,
+        local_solution, local_metric, local_dual,
+        quadrature,
+        *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_fad),
+        rhs, dual_dot_residual,
+        compute_metric_derivatives, fe_values_vol);
+
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_rhs_cell(itest) += rhs[itest].val();
+        AssertIsFinite(local_rhs_cell(itest));
+    }
+    store_matrix_free_derivatives(rhs, soln_dof_indices, current_cell_index);
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_matrix_free_derivatives(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const unsigned int face_number,
+    const unsigned int boundary_id,
+    const dealii::FEFaceValuesBase<dim,dim> &fe_values_boundary,
+    const real penalty,
+    const dealii::FESystem<dim,dim> &fe_soln,
+    const dealii::Quadrature<dim-1> &quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    dealii::Vector<real> &local_rhs_cell)
+{
+    const bool compute_metric_derivatives = true;
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs = fe_soln.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs, soln_dof_indices.size());
+
+    LocalSolution<FadType, dim, nstate> local_solution(fe_soln);
+    LocalSolution<FadType, dim, dim> local_metric(fe_metric);
+
+    const bool seed_derivatives = true;
+    seed_matrix_free_derivatives(soln_dof_indices, seed_derivatives, local_solution);
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        const real val = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+        local_metric.coefficients[idof] = val;
+    }
+
+    std::vector<real> local_dual(n_soln_dofs);
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_dual[itest] = this->dual[soln_dof_indices[itest]];
+    }
+
+    FadType dual_dot_residual = 0.0;
+    std::vector<FadType> rhs(n_soln_dofs);
+    assemble_boundary_term(
+        cell,
+        current_cell_index,
+        local_solution,
+        local_metric,
+        local_dual,
+        face_number,
+        boundary_id,
+        *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_fad),
+        *(DGBaseState<dim,nstate,real,MeshType>::conv_num_flux_fad),
+        *(DGBaseState<dim,nstate,real,MeshType>::diss_num_flux_fad),
+        fe_values_boundary,
+        penalty,
+        quadrature,
+        rhs,
+        dual_dot_residual,
+        compute_metric_derivatives);
+
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_rhs_cell(itest) += rhs[itest].val();
+        AssertIsFinite(local_rhs_cell(itest));
+    }
+    store_matrix_free_derivatives(rhs, soln_dof_indices, current_cell_index);
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_face_matrix_free_derivatives(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::types::global_dof_index neighbor_cell_index,
+    const std::pair<unsigned int, int> face_subface_int,
+    const std::pair<unsigned int, int> face_subface_ext,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+    const real penalty,
+    const dealii::FESystem<dim,dim> &fe_int,
+    const dealii::FESystem<dim,dim> &fe_ext,
+    const dealii::Quadrature<dim-1> &face_quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
+    dealii::Vector<real>          &local_rhs_int_cell,
+    dealii::Vector<real>          &local_rhs_ext_cell)
+{
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs_int = fe_int.dofs_per_cell;
+    const unsigned int n_soln_dofs_ext = fe_ext.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs_int, soln_dof_indices_int.size());
+    AssertDimension (n_soln_dofs_ext, soln_dof_indices_ext.size());
+
+    LocalSolution<FadType, dim, nstate> soln_int(fe_int);
+    LocalSolution<FadType, dim, nstate> soln_ext(fe_ext);
+    LocalSolution<FadType, dim, dim> metric_int(fe_metric);
+    LocalSolution<FadType, dim, dim> metric_ext(fe_metric);
+
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        const real val = this->high_order_grid->volume_nodes[metric_dof_indices_int[idof]];
+        metric_int.coefficients[idof] = val;
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        const real val = this->high_order_grid->volume_nodes[metric_dof_indices_ext[idof]];
+        metric_ext.coefficients[idof] = val;
+    }
+
+    std::vector<double> dual_int(n_soln_dofs_int);
+    std::vector<double> dual_ext(n_soln_dofs_ext);
+    for (unsigned int itest=0; itest<n_soln_dofs_int; ++itest) {
+        dual_int[itest] = this->dual[soln_dof_indices_int[itest]];
+    }
+    for (unsigned int itest=0; itest<n_soln_dofs_ext; ++itest) {
+        dual_ext[itest] = this->dual[soln_dof_indices_ext[itest]];
+    }
+
+    std::vector<FadType> rhs_int(n_soln_dofs_int);
+    std::vector<FadType> rhs_ext(n_soln_dofs_ext);
+    FadType dual_dot_residual = 0.0;
+
+    // The diagonal blocks do not need the derivatives coupling both cells.
+    // Each side is therefore seeded on its own, with the other side's coefficients left as constants,
+    // such that a sweep carries the derivatives of one cell instead of those of the face pair.
+    // The Jacobian-vector product seeds both sides with the direction in a single sweep.
+    const bool compute_blocks = (this->matrix_free_derivatives == DGBase<dim,real,MeshType>::MatrixFreeDerivatives::dRdW_diagonal_blocks);
+    const unsigned int n_sweeps = compute_blocks ? 2 : 1;
+    for (unsigned int isweep = 0; isweep < n_sweeps; ++isweep) {
+        const bool seed_int = !compute_blocks || isweep == 0;
+        const bool seed_ext = !compute_blocks || isweep == 1;
+        seed_matrix_free_derivatives(soln_dof_indices_int, seed_int, soln_int);
+        seed_matrix_free_derivatives(soln_dof_indices_ext, seed_ext, soln_ext);
+
+        const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = false;
+        assemble_face_term(
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            soln_int, soln_ext, metric_int, metric_ext,
+            dual_int,
+            dual_ext,
+            face_subface_int,
+            face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_fad),
+            *(DGBaseState<dim,nstate,real,MeshType>::conv_num_flux_fad),
+            *(DGBaseState<dim,nstate,real,MeshType>::diss_num_flux_fad),
+            fe_values_int,
+            fe_values_ext,
+            penalty,
+            face_quadrature,
+            rhs_int,
+            rhs_ext,
+            dual_dot_residual,
+            compute_dRdW, compute_dRdX, compute_d2R);
+
+        if (isweep == 0) {
+            for (unsigned int itest=0; itest<n_soln_dofs_int; ++itest) {
+                local_rhs_int_cell(itest) += rhs_int[itest].val();
+                AssertIsFinite(local_rhs_int_cell(itest));
+            }
+            for (unsigned int itest=0; itest<n_soln_dofs_ext; ++itest) {
+                local_rhs_ext_cell(itest) += rhs_ext[itest].val();
+                AssertIsFinite(local_rhs_ext_cell(itest));
+            }
+        }
+        if (seed_int) store_matrix_free_derivatives(rhs_int, soln_dof_indices_int, current_cell_index);
+        if (seed_ext) store_matrix_free_derivatives(rhs_ext, soln_dof_indices_ext, neighbor_cell_index);
+    }
+}
+
 template <int dim, int nstate, typename real, typename MeshType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operators(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
@@ -3919,6 +4229,12 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_auxiliary_residual ()
     //Do Nothing.
 }
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_volume_terms_in_cell_batches ()
+{
+    //Do Nothing.
+}
+
 template <int dim, int nstate, typename real, typename MeshType>
 void DGWeak<dim,nstate,real,MeshType>::allocate_dual_vector ()
 {
@@ -160,6 +160,9 @@ private:
     /// Assembles the auxiliary equations' residuals and solves for the auxiliary variables.
     void assemble_auxiliary_residual ();
 
+    /// The weak form assembles its volume terms in the cell loop.
+    void assemble_volume_terms_in_cell_batches ();
+
     /// Allocate the dual vector for optimization.
     void allocate_dual_vector ();
 
@@ -428,6 +431,79 @@ private:
         dealii::Vector<real>          &local_rhs_ext_cell,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
 
+    /// Evaluate the integral over the cell volume and its matrix-free derivatives.
+    /** Compute the right-hand side, and either its product with DGBase::dRdW_direction
+     *  or its derivatives with respect to the cell's own solution coefficients.
+     *  Uses the tapeless forward-mode FadType, such that no local Jacobian is formed
+     *  for the Jacobian-vector product.
+     */
+    void assemble_volume_matrix_free_derivatives(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::FEValues<dim,dim> &fe_values_vol,
+        const dealii::FESystem<dim,dim> &fe_soln,
+        const dealii::Quadrature<dim> &quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        dealii::Vector<real> &local_rhs_cell);
+
+    /// Evaluate the integral over the boundary and its matrix-free derivatives.
+    /** See assemble_volume_matrix_free_derivatives(). */
+    void assemble_boundary_matrix_free_derivatives(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const unsigned int face_number,
+        const unsigned int boundary_id,
+        const dealii::FEFaceValuesBase<dim,dim> &fe_values_boundary,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_soln,
+        const dealii::Quadrature<dim-1> &quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        dealii::Vector<real> &local_rhs_cell);
+
+    /// Evaluate the integral over the internal face and its matrix-free derivatives.
+    /** See assemble_volume_matrix_free_derivatives().
+     *  The diagonal blocks of both cells are updated, but not the blocks coupling them.
+     *  They are evaluated one cell at a time, only seeding the solution of that cell.
+     */
+    void assemble_face_matrix_free_derivatives(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::types::global_dof_index neighbor_cell_index,
+        const std::pair<unsigned int, int> face_subface_int,
+        const std::pair<unsigned int, int> face_subface_ext,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_int,
+        const dealii::FESystem<dim,dim> &fe_ext,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
+        dealii::Vector<real>          &local_rhs_int_cell,
+        dealii::Vector<real>          &local_rhs_ext_cell);
+
+    /// Seeds the solution coefficients of a cell for the matrix-free derivatives.
+    /** For the Jacobian-vector product, the single derivative of each coefficient is the direction.
+     *  For the diagonal blocks, coefficient idof is seeded with derivative idof.
+     *  If seed_derivatives is false, the coefficients are set as constants without derivatives.
+     */
+    void seed_matrix_free_derivatives(
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        const bool seed_derivatives,
+        LocalSolution<FadType, dim, nstate> &local_solution) const;
+
+    /// Adds the matrix-free derivatives of the local residual of a cell seeded by seed_matrix_free_derivatives().
+    void store_matrix_free_derivatives(
+        const std::vector<FadType> &rhs,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        const dealii::types::global_dof_index cell_index);
+
     /// Evaluate the integral over the cell volume
     void assemble_volume_term_explicit(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
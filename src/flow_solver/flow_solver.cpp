@@ -1,4 +1,5 @@
 #include "flow_solver.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -8,8 +9,12 @@
 #include "reduced_order/pod_basis_offline.h"
 #include "physics/initial_conditions/set_initial_condition.h"
 #include "mesh/mesh_adaptation/mesh_adaptation.h"
+#include "profiling/performance_profiler.h"
 #include <deal.II/base/timer.h>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
 namespace PHiLiP {
 
 namespace FlowSolver {
@@ -25,9 +30,9 @@ FlowSolver<dim, nstate>::FlowSolver(
 : FlowSolverBase()
 , flow_solver_case(flow_solver_case_input)
 , parameter_handler(parameter_handler_input)
-, mpi_communicator(MPI_COMM_WORLD)
-, mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
-, n_mpi(dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD))
+, mpi_communicator(flow_solver_case_input->get_mpi_communicator())
+, mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
+, n_mpi(dealii::Utilities::MPI::n_mpi_processes(mpi_communicator))
 , pcout(std::cout, mpi_rank==0)
 , all_param(*parameters_input)
 , flow_solver_param(all_param.flow_solver_param)
@@ -39,10 +44,13 @@ FlowSolver<dim, nstate>::FlowSolver(
 , do_output_solution_at_fixed_times(ode_param.output_solution_at_fixed_times)
 , number_of_fixed_times_to_output_solution(ode_param.number_of_fixed_times_to_output_solution)
 , output_solution_at_exact_fixed_times(ode_param.output_solution_at_exact_fixed_times)
+, restart_time_step(ode_param.initial_time_step)
 , dg(DGFactory<dim,double>::create_discontinuous_galerkin(&all_param, poly_degree, flow_solver_param.max_poly_degree_for_adaptation, grid_degree, flow_solver_case->generate_grid()))
 {
     flow_solver_case->set_higher_order_grid(dg);
-    if (ode_param.allocate_matrix_dRdW) {
+    // The matrix-free implicit solver never assembles dRdW.
+    const bool allocate_dRdW = ode_param.allocate_matrix_dRdW && !all_param.linear_solver_param.matrix_free_jacobian;
+    if (allocate_dRdW) {
         pcout << "Note: Allocating DG with AD matrix dRdW only." << std::endl;
         dg->allocate_system(true,false,false); // FlowSolver only requires dRdW to be allocated
     } else {
@@ -76,14 +84,32 @@ FlowSolver<dim, nstate>::FlowSolver(
         const std::string restart_filename_without_extension = get_restart_filename_without_extension(flow_solver_param.restart_file_index);
 #if PHILIP_DIM>1
         dg->triangulation->load(flow_solver_param.restart_files_directory_name + std::string("/") + restart_filename_without_extension);
-        
-        // Note: Future development with hp-capabilities, see section "Note on usage with DoFHandler with hp-capabilities"
-        // ----- Ref: https://www.dealii.org/current/doxygen/deal.II/classparallel_1_1distributed_1_1SolutionTransfer.html
+
+        // The loaded mesh is partitioned by p4est for the current number of processes, such that the
+        // DoFs are distributed again before deserializing the data in the order it was attached:
+        // the p-distribution, the high-order grid volume nodes, and then the solution.
+        using SolutionTransfer = dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>>;
+        dg->dof_handler.deserialize_active_fe_indices();
+
+        dg->high_order_grid->allocate();
+        dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_no_ghost;
+        volume_nodes_no_ghost.reinit(dg->high_order_grid->locally_owned_dofs_grid, this->mpi_communicator);
+        SolutionTransfer grid_transfer(dg->high_order_grid->dof_handler_grid);
+        grid_transfer.deserialize(volume_nodes_no_ghost);
+        dg->high_order_grid->volume_nodes = volume_nodes_no_ghost; //< assignment
+        dg->high_order_grid->volume_nodes.update_ghost_values();
+        dg->high_order_grid->mark_volume_nodes_as_modified();
+        dg->high_order_grid->update_surface_nodes();
+        dg->high_order_grid->update_mapping_fe_field();
+
+        dg->allocate_system(allocate_dRdW,false,false);
         dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
         solution_no_ghost.reinit(dg->locally_owned_dofs, this->mpi_communicator);
-        dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>> solution_transfer(dg->dof_handler);
+        SolutionTransfer solution_transfer(dg->dof_handler);
         solution_transfer.deserialize(solution_no_ghost);
         dg->solution = solution_no_ghost; //< assignment
+
+        read_restart_ode_state(flow_solver_param.restart_file_index);
 #endif
         pcout << "done." << std::endl;
     } else {
@@ -342,17 +368,25 @@ void FlowSolver<dim,nstate>::output_restart_files(
     const double time_step_input,
     const std::shared_ptr <dealii::TableHandler> unsteady_data_table) const
 {
+    Profiling::ScopedTimer output_timer("output_restart");
     pcout << "  ... Writing restart files ... " << std::endl;
     const std::string restart_filename_without_extension = get_restart_filename_without_extension(current_restart_index);
 
-    // solution files
-    dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>> solution_transfer(dg->dof_handler);
-    // Note: Future development with hp-capabilities, see section "Note on usage with DoFHandler with hp-capabilities"
-    // ----- Ref: https://www.dealii.org/current/doxygen/deal.II/classparallel_1_1distributed_1_1SolutionTransfer.html
+    // Mesh, p-distribution, volume nodes and solution files.
+    // The cell data of all the processes is written collectively by p4est as binary blocks,
+    // and can be read back on a different number of processes.
+    using SolutionTransfer = dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>>;
+    dg->dof_handler.prepare_for_serialization_of_active_fe_indices();
+    SolutionTransfer grid_transfer(dg->high_order_grid->dof_handler_grid);
+    grid_transfer.prepare_for_serialization(dg->high_order_grid->volume_nodes);
+    SolutionTransfer solution_transfer(dg->dof_handler);
     solution_transfer.prepare_for_serialization(dg->solution);
     dg->triangulation->save(flow_solver_param.restart_files_directory_name + std::string("/") + restart_filename_without_extension);
-    
-    // unsteady data table
+
+    // ODE state and unsteady data table
+    write_restart_ode_state(current_restart_index, time_step_input, *unsteady_data_table);
+
+    // unsteady data table in text format for post-processing
     if(mpi_rank==0) {
         std::string restart_unsteady_data_table_filename = flow_solver_param.unsteady_data_table_filename+std::string("-")+restart_filename_without_extension+std::string(".txt");
         std::ofstream unsteady_data_table_file(flow_solver_param.restart_files_directory_name + std::string("/") + restart_unsteady_data_table_filename);
@@ -362,6 +396,41 @@ void FlowSolver<dim,nstate>::output_restart_files(
     // parameter file; written last to ensure necessary data/solution files have been written before
     write_restart_parameter_file(current_restart_index, time_step_input);
 }
+
+template <int dim, int nstate>
+void FlowSolver<dim,nstate>::write_restart_ode_state(
+    const unsigned int restart_index_input,
+    const double time_step_input,
+    const dealii::TableHandler &unsteady_data_table) const
+{
+    if(mpi_rank==0) {
+        const std::string restart_filename = get_restart_filename_without_extension(restart_index_input)+std::string(".ode");
+        std::ofstream restart_file(flow_solver_param.restart_files_directory_name + std::string("/") + restart_filename, std::ios::binary);
+        boost::archive::binary_oarchive archive(restart_file);
+        archive << ode_solver->current_time;
+        archive << ode_solver->current_iteration;
+        archive << ode_solver->current_desired_time_for_output_solution_every_dt_time_intervals;
+        archive << time_step_input;
+        archive << unsteady_data_table;
+    }
+}
+
+template <int dim, int nstate>
+void FlowSolver<dim,nstate>::read_restart_ode_state(const unsigned int restart_index_input)
+{
+    const std::string restart_filename = get_restart_filename_without_extension(restart_index_input)+std::string(".ode");
+    std::ifstream restart_file(flow_solver_param.restart_files_directory_name + std::string("/") + restart_filename, std::ios::binary);
+    if(!restart_file.good()) {
+        pcout << "Error: Cannot open the ODE state restart file " << restart_filename << "." << std::endl;
+        std::abort();
+    }
+    boost::archive::binary_iarchive archive(restart_file);
+    archive >> ode_solver->current_time;
+    archive >> ode_solver->current_iteration;
+    archive >> ode_solver->current_desired_time_for_output_solution_every_dt_time_intervals;
+    archive >> restart_time_step;
+    archive >> restart_unsteady_data_table;
+}
 #endif
 
 template <int dim, int nstate>
@@ -395,6 +464,7 @@ void FlowSolver<dim,nstate>::perform_steady_state_mesh_adaptation() const
 template <int dim, int nstate>
 int FlowSolver<dim,nstate>::run() const
 {
+    Profiling::ScopedTimer run_timer("flow_solver_run");
     pcout << "Running Flow Solver..." << std::endl;
     if(flow_solver_param.restart_computation_from_file == false) {
         if (ode_param.output_solution_every_x_steps > 0) {
@@ -451,9 +521,8 @@ int FlowSolver<dim,nstate>::run() const
         /* If restarting computation from file, it should give the same time step as written in file,
            a warning is thrown if this is not the case */
         if(flow_solver_param.restart_computation_from_file == true) {
-            const double restart_time_step = ode_param.initial_time_step;
             if(std::abs(time_step-restart_time_step) > 1E-13) {
-                pcout << "WARNING: Computed initial time step does not match value in restart parameter file within the tolerance. "
+                pcout << "WARNING: Computed initial time step does not match value in restart file within the tolerance. "
                       << "Diff is: " << std::abs(time_step-restart_time_step) << std::endl;
             }
         }
@@ -465,9 +534,7 @@ int FlowSolver<dim,nstate>::run() const
         std::shared_ptr<dealii::TableHandler> unsteady_data_table = std::make_shared<dealii::TableHandler>();
         if(flow_solver_param.restart_computation_from_file == true) {
             pcout << "Initializing data table from corresponding restart file... " << std::flush;
-            const std::string restart_filename_without_extension = get_restart_filename_without_extension(flow_solver_param.restart_file_index);
-            const std::string restart_unsteady_data_table_filename = flow_solver_param.unsteady_data_table_filename+std::string("-")+restart_filename_without_extension+std::string(".txt");
-            initialize_data_table_from_file(flow_solver_param.restart_files_directory_name + std::string("/") + restart_unsteady_data_table_filename,unsteady_data_table);
+            *unsteady_data_table = restart_unsteady_data_table;
             pcout << "done." << std::endl;
         } else {
             // no restart:
@@ -503,12 +570,28 @@ int FlowSolver<dim,nstate>::run() const
             flow_solver_case->set_time_step(time_step);
 
             // advance solution
-            ode_solver->step_in_time(time_step,false); // pseudotime==false
+            double error_controlled_time_step = 0.0;
+            {
+                Profiling::ScopedTimer time_step_timer("time_step");
+                if(ode_param.use_embedded_error_control) {
+                    // the step may be repeated with a smaller time step if the embedded error is too large
+                    error_controlled_time_step = ode_solver->step_in_time_with_error_control(time_step);
+                    flow_solver_case->set_time_step(ode_solver->get_modified_time_step());
+                } else {
+                    ode_solver->step_in_time(time_step,false); // pseudotime==false
+                }
+            }
 
             // Compute the unsteady quantities, write to the dealii table, and output to file
-            flow_solver_case->compute_unsteady_data_and_write_to_table(ode_solver->current_iteration, ode_solver->current_time, dg, unsteady_data_table);
+            {
+                Profiling::ScopedTimer unsteady_data_timer("unsteady_data");
+                flow_solver_case->compute_unsteady_data_and_write_to_table(ode_solver->current_iteration, ode_solver->current_time, dg, unsteady_data_table);
+            }
             // update next time step
-            if(flow_solver_param.adaptive_time_step == true) {
+            if(ode_param.use_embedded_error_control) {
+                // keep the step proposed before it was shortened to hit the final or an output time
+                next_time_step = (time_step < next_time_step) ? std::max(next_time_step, error_controlled_time_step) : error_controlled_time_step;
+            } else if(flow_solver_param.adaptive_time_step == true) {
                 next_time_step = flow_solver_case->get_adaptive_time_step(dg);
             } else {
                 next_time_step = flow_solver_case->get_constant_time_step(dg);
@@ -575,6 +658,8 @@ int FlowSolver<dim,nstate>::run() const
                 }
             }
         } // close while
+        // Complete the vtk files still being written in the background
+        dg->wait_for_pending_vtk_output();
         timer.stop();
         pcout << "Timer stopped. " << std::endl;
         const double max_wall_time = dealii::Utilities::MPI::max(timer.wall_time(), this->mpi_communicator);
@@ -589,7 +674,10 @@ int FlowSolver<dim,nstate>::run() const
             ode_solver->initialize_steady_polynomial_ramping(poly_degree);
         }
 
-        ode_solver->steady_state();
+        {
+            Profiling::ScopedTimer steady_state_timer("steady_state");
+            ode_solver->steady_state();
+        }
         flow_solver_case->steady_state_postprocessing(dg);
         
         const bool use_isotropic_mesh_adaptation = (all_param.mesh_adaptation_param.total_mesh_adaptation_cycles > 0) 
@@ -601,6 +689,7 @@ int FlowSolver<dim,nstate>::run() const
         }
     }
     pcout << "done." << std::endl;
+    Profiling::PerformanceProfiler::instance().write_summary(all_param.performance_profiling_filename_prefix, mpi_communicator);
     return 0;
 }
 
@@ -104,6 +104,11 @@ protected:
     const bool do_output_solution_at_fixed_times; ///< Flag for outputting solution at fixed times
     const unsigned int number_of_fixed_times_to_output_solution; ///< Number of fixed times to output the solution
     const bool output_solution_at_exact_fixed_times;///< Flag for outputting the solution at exact fixed times by decreasing the time step on the fly
+
+    /// Time step read from the restart file
+    double restart_time_step;
+    /// Unsteady data table read from the restart file
+    dealii::TableHandler restart_unsteady_data_table;
     
 public:
     /// Pointer to dg so it can be accessed externally.
@@ -130,6 +135,18 @@ private:
         const unsigned int current_restart_index,
         const double constant_time_step,
         const std::shared_ptr <dealii::TableHandler> unsteady_data_table) const;
+
+    /// Writes the ODE solver state and the unsteady data table to a binary restart file (.ode)
+    /** Only the time, iteration, output time and time step are needed since the Runge-Kutta
+     *  registers do not persist between steps.
+     */
+    void write_restart_ode_state(
+        const unsigned int restart_index_input,
+        const double time_step_input,
+        const dealii::TableHandler &unsteady_data_table) const;
+
+    /// Restores the ODE solver state and the unsteady data table from a binary restart file (.ode)
+    void read_restart_ode_state(const unsigned int restart_index_input);
 #endif
 
     /// Performs mesh adaptation.
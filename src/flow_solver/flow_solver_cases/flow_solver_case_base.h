@@ -24,7 +24,9 @@ class FlowSolverCaseBase
 {
 public:
     ///Constructor
-    explicit FlowSolverCaseBase(const Parameters::AllParameters *const parameters_input);
+    /** The grid of the flow case is distributed over mpi_communicator_input.
+     */
+    explicit FlowSolverCaseBase(const Parameters::AllParameters *const parameters_input, const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     std::shared_ptr<InitialConditionFunction<dim,nstate,double>> initial_condition_function; ///< Initial condition function
 
@@ -62,6 +64,9 @@ public:
     /// Setter for time step
     void set_time_step(const double time_step_input);
 
+    /// Communicator over which the grid of the flow case is distributed
+    MPI_Comm get_mpi_communicator() const;
+
 protected:
     const Parameters::AllParameters all_param; ///< All parameters
     const MPI_Comm mpi_communicator; ///< MPI communicator.
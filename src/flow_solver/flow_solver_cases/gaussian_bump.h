@@ -19,7 +19,7 @@ class GaussianBump : public FlowSolverCaseBase<dim, nstate>
 #endif
 public:
     /// Constructor
-    explicit GaussianBump(const Parameters::AllParameters *const parameters_input);
+    explicit GaussianBump(const Parameters::AllParameters *const parameters_input, const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     /// Function to generate the grid
     std::shared_ptr<Triangulation> generate_grid() const override;
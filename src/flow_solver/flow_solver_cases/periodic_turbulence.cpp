@@ -8,6 +8,8 @@
 #include <deal.II/numerics/vector_tools.h>
 #include <deal.II/fe/fe_values.h>
 #include "physics/physics_factory.h"
+#include "physics/initial_conditions/binary_flow_field_file.h"
+#include "dg/dg_base_state.hpp"
 #include <deal.II/base/table_handler.h>
 #include <deal.II/base/tensor.h>
 #include "math.h"
@@ -30,6 +32,7 @@ PeriodicTurbulence<dim, nstate>::PeriodicTurbulence(const PHiLiP::Parameters::Al
         , output_vorticity_magnitude_field_in_addition_to_velocity(this->all_param.flow_solver_param.output_vorticity_magnitude_field_in_addition_to_velocity)
         , output_flow_field_files_directory_name(this->all_param.flow_solver_param.output_flow_field_files_directory_name)
         , output_solution_at_exact_fixed_times(this->all_param.ode_solver_param.output_solution_at_exact_fixed_times)
+        , integrate_quantities_in_residual(this->all_param.flow_solver_param.integrate_quantities_in_residual)
 {
     // Get the flow case type
     using FlowCaseEnum = Parameters::FlowSolverParam::FlowCaseType;
@@ -40,6 +43,11 @@ PeriodicTurbulence<dim, nstate>::PeriodicTurbulence(const PHiLiP::Parameters::Al
     this->is_decaying_homogeneous_isotropic_turbulence = (flow_type == FlowCaseEnum::decaying_homogeneous_isotropic_turbulence);
     this->is_viscous_flow = (this->all_param.pde_type != Parameters::AllParameters::PartialDifferentialEquation::euler);
     this->do_calculate_numerical_entropy= this->all_param.flow_solver_param.do_calculate_numerical_entropy;
+    if(this->integrate_quantities_in_residual && this->do_calculate_numerical_entropy) {
+        this->pcout << "ERROR: The numerical entropy cannot be integrated in the residual. "
+                    << "Set integrate_quantities_in_residual to false. Aborting..." << std::endl;
+        std::abort();
+    }
 
     // Navier-Stokes object; create using dynamic_pointer_cast and the create_Physics factory
     PHiLiP::Parameters::AllParameters parameters_navier_stokes = this->all_param;
@@ -52,6 +60,9 @@ PeriodicTurbulence<dim, nstate>::PeriodicTurbulence(const PHiLiP::Parameters::Al
        before a member function of kind get_integrated_quantity() is called
      */
     std::fill(this->integrated_quantities.begin(), this->integrated_quantities.end(), NAN);
+    this->integrated_numerical_entropy = NAN;
+    this->iteration_of_requested_quantities = 0;
+    this->time_of_requested_quantities = NAN;
 
     /// For outputting velocity field
     if(output_velocity_field_at_fixed_times && (number_of_times_to_output_velocity_field > 0)) {
@@ -183,15 +194,33 @@ void PeriodicTurbulence<dim, nstate>::output_velocity_field(
 
     // (2) Write file
     //-------------------------------------------------------------
-    std::ofstream FILE (filename);
-    
-    // check that the file is open and write DOFs
-    if (!FILE.is_open()) {
-        this->pcout << "ERROR: Cannot open file " << filename << std::endl;
-        std::abort();
-    } else if(this->mpi_rank==0) {
-        const unsigned int number_of_degrees_of_freedom_per_state = dg->dof_handler.n_dofs()/nstate;
-        FILE << number_of_degrees_of_freedom_per_state << std::string("\n");
+    const unsigned int number_of_degrees_of_freedom_per_state = dg->dof_handler.n_dofs()/nstate;
+    const unsigned int n_values_per_point = 2*dim + (output_vorticity_magnitude_field_in_addition_to_velocity ? 1 : 0);
+    std::vector<double> point_values(n_values_per_point);
+
+    std::ofstream FILE;
+    std::unique_ptr<BinaryFlowFieldWriter> binary_writer;
+    using FlowFieldFileFormatEnum = Parameters::FlowSolverParam::FlowFieldFileFormat;
+    if (this->all_param.flow_solver_param.output_velocity_field_file_format == FlowFieldFileFormatEnum::binary) {
+        // The points of each process are announced in the header such that they can be streamed out as they are evaluated
+        uint64_t n_local_points = 0;
+        for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+            if (cell->is_locally_owned()) n_local_points += cell->get_fe().dofs_per_cell / nstate;
+        }
+        const std::string binary_filename = output_flow_field_files_directory_name + std::string("/") + filename_prefix + std::string(".bin");
+        binary_writer = std::make_unique<BinaryFlowFieldWriter>(
+            binary_filename, this->mpi_communicator, dim, n_values_per_point, n_local_points,
+            this->all_param.flow_solver_param.output_velocity_field_in_single_precision,
+            number_of_degrees_of_freedom_per_state, current_time);
+    } else {
+        FILE.open(filename);
+        // check that the file is open and write DOFs
+        if (!FILE.is_open()) {
+            this->pcout << "ERROR: Cannot open file " << filename << std::endl;
+            std::abort();
+        } else if(this->mpi_rank==0) {
+            FILE << number_of_degrees_of_freedom_per_state << std::string("\n");
+        }
     }
 
     // build a basis oneD on equidistant nodes in 1D
@@ -320,24 +349,31 @@ void PeriodicTurbulence<dim, nstate>::output_velocity_field(
         }
         // write out all values at equidistant nodes
         for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
-            dealii::Point<dim,double> vol_equid_node;
-            // write coordinates
+            // coordinates
             for(int idim=0; idim<dim; idim++) {
-                vol_equid_node[idim] = metric_oper_equid.flux_nodes_vol[idim][ishape];
-                FILE << std::setprecision(17) << vol_equid_node[idim] << std::string(" ");
+                point_values[idim] = metric_oper_equid.flux_nodes_vol[idim][ishape];
             }
-            // write velocity field
+            // velocity field
             for (int d=0; d<dim; ++d) {
-                FILE << std::setprecision(17) << velocity_at_q[d][ishape] << std::string(" ");
+                point_values[dim+d] = velocity_at_q[d][ishape];
             }
-            // write vorticity magnitude field if desired
+            // vorticity magnitude field if desired
             if(output_vorticity_magnitude_field_in_addition_to_velocity) {
-                FILE << std::setprecision(17) << vorticity_magnitude_at_q[ishape] << std::string(" ");
+                point_values[2*dim] = vorticity_magnitude_at_q[ishape];
+            }
+
+            if (binary_writer) {
+                binary_writer->write_point(point_values);
+            } else {
+                for (unsigned int ivalue=0; ivalue<n_values_per_point; ++ivalue) {
+                    FILE << std::setprecision(17) << point_values[ivalue] << std::string(" ");
+                }
+                FILE << std::string("\n"); // next line
             }
-            FILE << std::string("\n"); // next line
         }
     }
-    FILE.close();
+    if (binary_writer) binary_writer->close();
+    else FILE.close();
     this->pcout << "done." << std::endl;
 }
 
@@ -399,42 +435,82 @@ void PeriodicTurbulence<dim, nstate>::update_maximum_local_wave_speed(DGBase<dim
 }
 
 template<int dim, int nstate>
-void PeriodicTurbulence<dim, nstate>::compute_and_update_integrated_quantities(DGBase<dim, double> &dg)
+typename PeriodicTurbulence<dim, nstate>::IntegralValuesArray PeriodicTurbulence<dim, nstate>::integrate_quantities(
+        const DGBase<dim, double> &dg,
+        const bool do_integrate_quantities,
+        const bool do_integrate_numerical_entropy,
+        double &local_maximum_wave_speed) const
 {
-    std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> integral_values;
+    IntegralValuesArray integral_values;
     std::fill(integral_values.begin(), integral_values.end(), 0.0);
-    
+
+    const bool do_update_wave_speed = do_integrate_quantities && (this->all_param.flow_solver_param.adaptive_time_step == true);
     // Initialize the maximum local wave speed to zero; only used for adaptive time step
-    if(this->all_param.flow_solver_param.adaptive_time_step == true) this->maximum_local_wave_speed = 0.0;
+    if(do_update_wave_speed) local_maximum_wave_speed = 0.0;
+
+    // The solution coefficients and grid nodes of a cell are gathered once for both integrations
+    const unsigned int poly_degree = this->all_param.flow_solver_param.poly_degree;
+    const unsigned int grid_degree = dg.high_order_grid->fe_system.tensor_degree();
+    const dealii::FESystem<dim> &fe_metric = dg.high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_grid_nodes  = n_metric_dofs / dim;
+    const std::vector<unsigned int> index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
+    const unsigned int n_dofs = dg.fe_collection[poly_degree].n_dofs_per_cell();
+    const unsigned int n_shape_fns = n_dofs / nstate;
+    // If in the future we need the physical quadrature node location, turn these flags to true and the constructor will
+    // automatically compute it for you. Currently set to false as to not compute extra unused terms.
+    const bool store_vol_flux_nodes = false;//currently doesn't need the volume physical nodal position
+    const bool store_surf_flux_nodes = false;//currently doesn't need the surface physical nodal position
 
     // Overintegrate the error to make sure there is not integration error in the error estimate
-    int overintegrate = 10;
+    const int overintegrate = 10;
 
     // Set the quadrature of size dim and 1D for sum-factorization.
-    dealii::QGauss<dim> quad_extra(dg.max_degree+1+overintegrate);
-    dealii::QGauss<1> quad_extra_1D(dg.max_degree+1+overintegrate);
-
+    const dealii::QGauss<dim> quad_extra(poly_degree+1+overintegrate);
+    const dealii::QGauss<1> quad_extra_1D(poly_degree+1+overintegrate);
     const unsigned int n_quad_pts = quad_extra.size();
-    const unsigned int grid_degree = dg.high_order_grid->fe_system.tensor_degree();
-    const unsigned int poly_degree = dg.max_degree;
+    const std::vector<double> &quad_weights = quad_extra.get_weights();
     // Construct the basis functions and mapping shape functions.
     OPERATOR::basis_functions<dim,2*dim> soln_basis(1, poly_degree, grid_degree); 
     OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis(1, poly_degree, grid_degree);
-    // Build basis function volume operator and gradient operator from 1D finite element for 1 state.
-    soln_basis.build_1D_volume_operator(dg.oneD_fe_collection_1state[poly_degree], quad_extra_1D);
-    soln_basis.build_1D_gradient_operator(dg.oneD_fe_collection_1state[poly_degree], quad_extra_1D);
-    // Build mapping shape functions operators using the oneD high_ordeR_grid finite element
-    mapping_basis.build_1D_shape_functions_at_grid_nodes(dg.high_order_grid->oneD_fe_system, dg.high_order_grid->oneD_grid_nodes);
-    mapping_basis.build_1D_shape_functions_at_flux_nodes(dg.high_order_grid->oneD_fe_system, quad_extra_1D, dg.oneD_face_quadrature);
-    const std::vector<double> &quad_weights = quad_extra.get_weights();
-    // If in the future we need the physical quadrature node location, turn these flags to true and the constructor will
-    // automatically compute it for you. Currently set to false as to not compute extra unused terms.
-    const bool store_vol_flux_nodes = false;//currently doesn't need the volume physical nodal position
-    const bool store_surf_flux_nodes = false;//currently doesn't need the surface physical nodal position
+    if(do_integrate_quantities) {
+        // Build basis function volume operator and gradient operator from 1D finite element for 1 state.
+        soln_basis.build_1D_volume_operator(dg.oneD_fe_collection_1state[poly_degree], quad_extra_1D);
+        soln_basis.build_1D_gradient_operator(dg.oneD_fe_collection_1state[poly_degree], quad_extra_1D);
+        // Build mapping shape functions operators using the oneD high_ordeR_grid finite element
+        mapping_basis.build_1D_shape_functions_at_grid_nodes(dg.high_order_grid->oneD_fe_system, dg.high_order_grid->oneD_grid_nodes);
+        mapping_basis.build_1D_shape_functions_at_flux_nodes(dg.high_order_grid->oneD_fe_system, quad_extra_1D, dg.oneD_face_quadrature);
+    }
+
+    // The numerical entropy is integrated with the volume quadrature of the scheme.
+    const unsigned int n_entropy_quad_pts = dg.volume_quadrature_collection[poly_degree].size();
+    const std::vector<double> &entropy_quad_weights = dg.volume_quadrature_collection[poly_degree].get_weights();
+    OPERATOR::basis_functions<dim,2*dim> entropy_soln_basis(1, poly_degree, dg.max_grid_degree); 
+    OPERATOR::mapping_shape_functions<dim,2*dim> entropy_mapping_basis(1, poly_degree, dg.max_grid_degree);
+    if(do_integrate_numerical_entropy) {
+        entropy_soln_basis.build_1D_volume_operator(dg.oneD_fe_collection_1state[poly_degree], dg.oneD_quadrature_collection[poly_degree]);
+        entropy_mapping_basis.build_1D_shape_functions_at_grid_nodes(dg.high_order_grid->oneD_fe_system, dg.high_order_grid->oneD_grid_nodes);
+        entropy_mapping_basis.build_1D_shape_functions_at_flux_nodes(dg.high_order_grid->oneD_fe_system, dg.oneD_quadrature_collection[poly_degree], dg.oneD_face_quadrature);
+    }
+
+    // Component of each solution dof, used to separate the coefficients by state
+    std::vector<unsigned int> dof_state(n_dofs), dof_shape(n_dofs);
+    for (unsigned int idof = 0; idof < n_dofs; ++idof) {
+        dof_state[idof] = dg.fe_collection[poly_degree].system_to_component_index(idof).first;
+        dof_shape[idof] = dg.fe_collection[poly_degree].system_to_component_index(idof).second;
+    }
 
-    const unsigned int n_dofs = dg.fe_collection[poly_degree].n_dofs_per_cell();
-    const unsigned int n_shape_fns = n_dofs / nstate;
     std::vector<dealii::types::global_dof_index> dofs_indices (n_dofs);
+    std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
+    std::array<std::vector<double>,dim> mapping_support_points;
+    for(int idim=0; idim<dim; idim++){
+        mapping_support_points[idim].resize(n_grid_nodes);
+    }
+    std::array<std::vector<double>,nstate> soln_coeff;
+    for(int istate=0; istate<nstate; istate++){
+        soln_coeff[istate].resize(n_shape_fns);
+    }
+
     auto metric_cell = dg.high_order_grid->dof_handler_grid.begin_active();
     // Changed for loop to update metric_cell.
     for (auto cell = dg.dof_handler.begin_active(); cell!= dg.dof_handler.end(); ++cell, ++metric_cell) {
@@ -442,18 +518,9 @@ void PeriodicTurbulence<dim, nstate>::compute_and_update_integrated_quantities(D
         cell->get_dof_indices (dofs_indices);
 
         // We first need to extract the mapping support points (grid nodes) from high_order_grid.
-        const dealii::FESystem<dim> &fe_metric = dg.high_order_grid->fe_system;
-        const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
-        const unsigned int n_grid_nodes  = n_metric_dofs / dim;
-        std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
         metric_cell->get_dof_indices (metric_dof_indices);
-        std::array<std::vector<double>,dim> mapping_support_points;
-        for(int idim=0; idim<dim; idim++){
-            mapping_support_points[idim].resize(n_grid_nodes);
-        }
         // Get the mapping support points (physical grid nodes) from high_order_grid.
         // Store it in such a way we can use sum-factorization on it with the mapping basis functions.
-        const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
         for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
             const double val = (dg.high_order_grid->volume_nodes[metric_dof_indices[idof]]);
             const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
@@ -461,103 +528,186 @@ void PeriodicTurbulence<dim, nstate>::compute_and_update_integrated_quantities(D
             const unsigned int igrid_node = index_renumbering[ishape];
             mapping_support_points[istate][igrid_node] = val; 
         }
-        // Construct the metric operators.
-        OPERATOR::metric_operators<double, dim, 2*dim> metric_oper(nstate, poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes);
-        // Build the metric terms to compute the gradient and volume node positions.
-        // This functions will compute the determinant of the metric Jacobian and metric cofactor matrix. 
-        // If flags store_vol_flux_nodes and store_surf_flux_nodes set as true it will also compute the physical quadrature positions.
-        metric_oper.build_volume_metric_operators(
-            n_quad_pts, n_grid_nodes,
-            mapping_support_points,
-            mapping_basis,
-            dg.all_parameters->use_invariant_curl_form);
 
         // Fetch the modal soln coefficients
         // We immediately separate them by state as to be able to use sum-factorization
         // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
         // mult would sum the states at the quadrature point.
         // That is why the basis functions are based off the 1state oneD fe_collection.
-        std::array<std::vector<double>,nstate> soln_coeff;
         for (unsigned int idof = 0; idof < n_dofs; ++idof) {
-            const unsigned int istate = dg.fe_collection[poly_degree].system_to_component_index(idof).first;
-            const unsigned int ishape = dg.fe_collection[poly_degree].system_to_component_index(idof).second;
-            if(ishape == 0){
-                soln_coeff[istate].resize(n_shape_fns);
-            }
-         
-            soln_coeff[istate][ishape] = dg.solution(dofs_indices[idof]);
+            soln_coeff[dof_state[idof]][dof_shape[idof]] = dg.solution(dofs_indices[idof]);
         }
-        // Interpolate each state to the quadrature points using sum-factorization
-        // with the basis functions in each reference direction.
-        std::array<std::vector<double>,nstate> soln_at_q_vect;
-        std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> soln_grad_at_q_vect;
-        for(int istate=0; istate<nstate; istate++){
-            soln_at_q_vect[istate].resize(n_quad_pts);
-            // Interpolate soln coeff to volume cubature nodes.
-            soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q_vect[istate],
-                                             soln_basis.oneD_vol_operator);
-            // We need to first compute the reference gradient of the solution, then transform that to a physical gradient.
-            dealii::Tensor<1,dim,std::vector<double>> ref_gradient_basis_fns_times_soln;
-            for(int idim=0; idim<dim; idim++){
-                ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
-                soln_grad_at_q_vect[istate][idim].resize(n_quad_pts);
+
+        if(do_integrate_quantities) {
+            // Construct the metric operators.
+            OPERATOR::metric_operators<double, dim, 2*dim> metric_oper(nstate, poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes);
+            // Build the metric terms to compute the gradient and volume node positions.
+            // This functions will compute the determinant of the metric Jacobian and metric cofactor matrix. 
+            // If flags store_vol_flux_nodes and store_surf_flux_nodes set as true it will also compute the physical quadrature positions.
+            metric_oper.build_volume_metric_operators(
+                n_quad_pts, n_grid_nodes,
+                mapping_support_points,
+                mapping_basis,
+                dg.all_parameters->use_invariant_curl_form);
+
+            // Interpolate each state to the quadrature points using sum-factorization
+            // with the basis functions in each reference direction.
+            std::array<std::vector<double>,nstate> soln_at_q_vect;
+            std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> soln_grad_at_q_vect;
+            for(int istate=0; istate<nstate; istate++){
+                soln_at_q_vect[istate].resize(n_quad_pts);
+                // Interpolate soln coeff to volume cubature nodes.
+                soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q_vect[istate],
+                                                 soln_basis.oneD_vol_operator);
+                // We need to first compute the reference gradient of the solution, then transform that to a physical gradient.
+                dealii::Tensor<1,dim,std::vector<double>> ref_gradient_basis_fns_times_soln;
+                for(int idim=0; idim<dim; idim++){
+                    ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
+                    soln_grad_at_q_vect[istate][idim].resize(n_quad_pts);
+                }
+                // Apply gradient of reference basis functions on the solution at volume cubature nodes.}
+                soln_basis.gradient_matrix_vector_mult_1D(soln_coeff[istate], ref_gradient_basis_fns_times_soln,
+                                                          soln_basis.oneD_vol_operator,
+                                                          soln_basis.oneD_grad_operator);
+                // Transform the reference gradient into a physical gradient operator.
+                for(int idim=0; idim<dim; idim++){
+                    for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+                        for(int jdim=0; jdim<dim; jdim++){
+                            //transform into the physical gradient
+                            soln_grad_at_q_vect[istate][idim][iquad] += metric_oper.metric_cofactor_vol[idim][jdim][iquad]
+                                                                      * ref_gradient_basis_fns_times_soln[jdim][iquad]
+                                                                      / metric_oper.det_Jac_vol[iquad];
+                        }
+                    }
+                }
             }
-            // Apply gradient of reference basis functions on the solution at volume cubature nodes.}
-            soln_basis.gradient_matrix_vector_mult_1D(soln_coeff[istate], ref_gradient_basis_fns_times_soln,
-                                                      soln_basis.oneD_vol_operator,
-                                                      soln_basis.oneD_grad_operator);
-            // Transform the reference gradient into a physical gradient operator.
-            for(int idim=0; idim<dim; idim++){
-                for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                    for(int jdim=0; jdim<dim; jdim++){
-                        //transform into the physical gradient
-                        soln_grad_at_q_vect[istate][idim][iquad] += metric_oper.metric_cofactor_vol[idim][jdim][iquad]
-                                                                  * ref_gradient_basis_fns_times_soln[jdim][iquad]
-                                                                  / metric_oper.det_Jac_vol[iquad];
+
+            // Loop over quadrature nodes, compute quantities to be integrated, and integrate them.
+            for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+
+                std::array<double,nstate> soln_at_q;
+                std::array<dealii::Tensor<1,dim,double>,nstate> soln_grad_at_q;
+                // Extract solution and gradient in a way that the physics ca n use them.
+                for(int istate=0; istate<nstate; istate++){
+                    soln_at_q[istate] = soln_at_q_vect[istate][iquad];
+                    for(int idim=0; idim<dim; idim++){
+                        soln_grad_at_q[istate][idim] = soln_grad_at_q_vect[istate][idim][iquad];
                     }
                 }
+
+                const std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> integrand_values = evaluate_integrands(soln_at_q,soln_grad_at_q);
+
+                for(int i_quantity=0; i_quantity<NUMBER_OF_INTEGRATED_QUANTITIES; ++i_quantity) {
+                    integral_values[i_quantity] += integrand_values[i_quantity] * quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+                }
+
+                // Update the maximum local wave speed (i.e. convective eigenvalue) if using an adaptive time step
+                if(do_update_wave_speed) {
+                    const double local_wave_speed = this->navier_stokes_physics->max_convective_eigenvalue(soln_at_q);
+                    if(local_wave_speed > local_maximum_wave_speed) local_maximum_wave_speed = local_wave_speed;
+                }
             }
         }
 
-        // Loop over quadrature nodes, compute quantities to be integrated, and integrate them.
-        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+        if(do_integrate_numerical_entropy) {
+            // Only the determinant of the metric Jacobian is needed at the volume quadrature nodes.
+            OPERATOR::metric_operators<double, dim, 2*dim> metric_oper(nstate, poly_degree, dg.max_grid_degree, false, false);
+            metric_oper.build_volume_metric_operators(
+                n_entropy_quad_pts, n_grid_nodes,
+                mapping_support_points,
+                entropy_mapping_basis,
+                dg.all_parameters->use_invariant_curl_form);
 
-            std::array<double,nstate> soln_at_q;
-            std::array<dealii::Tensor<1,dim,double>,nstate> soln_grad_at_q;
-            // Extract solution and gradient in a way that the physics ca n use them.
+            std::array<std::vector<double>,nstate> soln_at_q;
             for(int istate=0; istate<nstate; istate++){
-                soln_at_q[istate] = soln_at_q_vect[istate][iquad];
-                for(int idim=0; idim<dim; idim++){
-                    soln_grad_at_q[istate][idim] = soln_grad_at_q_vect[istate][idim][iquad];
+                soln_at_q[istate].resize(n_entropy_quad_pts);
+                // Interpolate soln coeff to volume cubature nodes.
+                entropy_soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q[istate],
+                                                         entropy_soln_basis.oneD_vol_operator);
+            }
+            for (unsigned int iquad=0; iquad<n_entropy_quad_pts; ++iquad) {
+                std::array<double,nstate> soln_state;
+                for(int istate=0; istate<nstate; istate++){
+                    soln_state[istate] = soln_at_q[istate][iquad];
                 }
+                const double integrand_numerical_entropy_function = this->navier_stokes_physics->compute_numerical_entropy_function(soln_state);
+                integral_values[NUMBER_OF_INTEGRATED_QUANTITIES] += integrand_numerical_entropy_function * entropy_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
             }
+        }
+    }
 
-            std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> integrand_values;
-            std::fill(integrand_values.begin(), integrand_values.end(), 0.0);
-            integrand_values[IntegratedQuantitiesEnum::kinetic_energy] = this->navier_stokes_physics->compute_kinetic_energy_from_conservative_solution(soln_at_q);
-            integrand_values[IntegratedQuantitiesEnum::enstrophy] = this->navier_stokes_physics->compute_enstrophy(soln_at_q,soln_grad_at_q);
-            integrand_values[IntegratedQuantitiesEnum::pressure_dilatation] = this->navier_stokes_physics->compute_pressure_dilatation(soln_at_q,soln_grad_at_q);
-            integrand_values[IntegratedQuantitiesEnum::deviatoric_strain_rate_tensor_magnitude_sqr] = this->navier_stokes_physics->compute_deviatoric_strain_rate_tensor_magnitude_sqr(soln_at_q,soln_grad_at_q);
-            integrand_values[IntegratedQuantitiesEnum::strain_rate_tensor_magnitude_sqr] = this->navier_stokes_physics->compute_strain_rate_tensor_magnitude_sqr(soln_at_q,soln_grad_at_q);
+    // All the integrals are reduced at once
+    MPI_Allreduce(MPI_IN_PLACE, integral_values.data(), integral_values.size(), MPI_DOUBLE, MPI_SUM, this->mpi_communicator);
+    if(do_update_wave_speed) local_maximum_wave_speed = dealii::Utilities::MPI::max(local_maximum_wave_speed, this->mpi_communicator);
 
-            for(int i_quantity=0; i_quantity<NUMBER_OF_INTEGRATED_QUANTITIES; ++i_quantity) {
-                integral_values[i_quantity] += integrand_values[i_quantity] * quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
-            }
+    return integral_values;
+}
 
-            // Update the maximum local wave speed (i.e. convective eigenvalue) if using an adaptive time step
-            if(this->all_param.flow_solver_param.adaptive_time_step == true) {
-                const double local_wave_speed = this->navier_stokes_physics->max_convective_eigenvalue(soln_at_q);
-                if(local_wave_speed > this->maximum_local_wave_speed) this->maximum_local_wave_speed = local_wave_speed;
-            }
-        }
+template<int dim, int nstate>
+std::array<double,PeriodicTurbulence<dim, nstate>::NUMBER_OF_INTEGRATED_QUANTITIES> PeriodicTurbulence<dim, nstate>::evaluate_integrands(
+        const std::array<double,nstate> &soln_at_q,
+        const std::array<dealii::Tensor<1,dim,double>,nstate> &soln_grad_at_q) const
+{
+    std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> integrand_values;
+    std::fill(integrand_values.begin(), integrand_values.end(), 0.0);
+    integrand_values[IntegratedQuantitiesEnum::kinetic_energy] = this->navier_stokes_physics->compute_kinetic_energy_from_conservative_solution(soln_at_q);
+    integrand_values[IntegratedQuantitiesEnum::enstrophy] = this->navier_stokes_physics->compute_enstrophy(soln_at_q,soln_grad_at_q);
+    integrand_values[IntegratedQuantitiesEnum::pressure_dilatation] = this->navier_stokes_physics->compute_pressure_dilatation(soln_at_q,soln_grad_at_q);
+    integrand_values[IntegratedQuantitiesEnum::deviatoric_strain_rate_tensor_magnitude_sqr] = this->navier_stokes_physics->compute_deviatoric_strain_rate_tensor_magnitude_sqr(soln_at_q,soln_grad_at_q);
+    integrand_values[IntegratedQuantitiesEnum::strain_rate_tensor_magnitude_sqr] = this->navier_stokes_physics->compute_strain_rate_tensor_magnitude_sqr(soln_at_q,soln_grad_at_q);
+    return integrand_values;
+}
+
+template<int dim, int nstate>
+void PeriodicTurbulence<dim, nstate>::request_integrated_quantities_in_residual(DGBase<dim, double> &dg)
+{
+    // The gradient is only available through the auxiliary variables of the strong form
+    DGBaseState<dim,nstate,double> *dg_state = dynamic_cast<DGBaseState<dim,nstate,double> *>(&dg);
+    if(dg_state == nullptr || dg.all_parameters->use_weak_form || !dg.use_auxiliary_eq) {
+        this->pcout << "ERROR: integrate_quantities_in_residual requires the strong form with the auxiliary equation "
+                    << "of a viscous flow. Aborting..." << std::endl;
+        std::abort();
     }
-    this->maximum_local_wave_speed = dealii::Utilities::MPI::max(this->maximum_local_wave_speed, this->mpi_communicator);
+
+    const auto integrands = [this](
+            const std::array<double,nstate> &soln_at_q,
+            const std::array<dealii::Tensor<1,dim,double>,nstate> &soln_grad_at_q,
+            std::vector<double> &integrand_values)
+    {
+        const std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> values = this->evaluate_integrands(soln_at_q, soln_grad_at_q);
+        std::copy(values.begin(), values.end(), integrand_values.begin());
+    };
+    dg_state->request_volume_integrals(NUMBER_OF_INTEGRATED_QUANTITIES, integrands);
+}
+
+template<int dim, int nstate>
+bool PeriodicTurbulence<dim, nstate>::update_integrated_quantities_from_residual(const DGBase<dim, double> &dg)
+{
+    const DGBaseState<dim,nstate,double> *dg_state = dynamic_cast<const DGBaseState<dim,nstate,double> *>(&dg);
+    std::vector<double> integral_values;
+    const bool is_local_integral_available = (dg_state != nullptr) && dg_state->get_local_volume_integrals(integral_values);
+    // Every process must agree before reducing the integrals
+    const bool is_integral_available = (dealii::Utilities::MPI::min((is_local_integral_available ? 1 : 0), this->mpi_communicator) == 1);
+    if(!is_integral_available) return false;
+
+    MPI_Allreduce(MPI_IN_PLACE, integral_values.data(), integral_values.size(), MPI_DOUBLE, MPI_SUM, this->mpi_communicator);
+    for(int i_quantity=0; i_quantity<NUMBER_OF_INTEGRATED_QUANTITIES; ++i_quantity) {
+        this->integrated_quantities[i_quantity] = integral_values[i_quantity] / this->domain_size; // divide by total domain volume
+    }
+    return true;
+}
+
+template<int dim, int nstate>
+void PeriodicTurbulence<dim, nstate>::compute_and_update_integrated_quantities(DGBase<dim, double> &dg)
+{
+    const IntegralValuesArray integral_values = integrate_quantities(dg, true, do_calculate_numerical_entropy, this->maximum_local_wave_speed);
 
     // update integrated quantities
     for(int i_quantity=0; i_quantity<NUMBER_OF_INTEGRATED_QUANTITIES; ++i_quantity) {
-        this->integrated_quantities[i_quantity] = dealii::Utilities::MPI::sum(integral_values[i_quantity], this->mpi_communicator);
+        this->integrated_quantities[i_quantity] = integral_values[i_quantity];
         this->integrated_quantities[i_quantity] /= this->domain_size; // divide by total domain volume
     }
+    if(do_calculate_numerical_entropy) this->integrated_numerical_entropy = integral_values[NUMBER_OF_INTEGRATED_QUANTITIES];
 }
 
 template<int dim, int nstate>
@@ -626,115 +776,17 @@ double PeriodicTurbulence<dim, nstate>::get_numerical_entropy(
         const std::shared_ptr <DGBase<dim, double>> dg
         ) const
 {
-    const double poly_degree = this->all_param.flow_solver_param.poly_degree;
-
-    const unsigned int n_dofs_cell = dg->fe_collection[poly_degree].dofs_per_cell;
-    const unsigned int n_quad_pts = dg->volume_quadrature_collection[poly_degree].size();
-    const unsigned int n_shape_fns = n_dofs_cell / nstate;
-
-    OPERATOR::vol_projection_operator<dim,2*dim> vol_projection(1, poly_degree, dg->max_grid_degree);
-    vol_projection.build_1D_volume_operator(dg->oneD_fe_collection_1state[poly_degree], dg->oneD_quadrature_collection[poly_degree]);
-
-    // Construct the basis functions and mapping shape functions.
-    OPERATOR::basis_functions<dim,2*dim> soln_basis(1, poly_degree, dg->max_grid_degree); 
-    soln_basis.build_1D_volume_operator(dg->oneD_fe_collection_1state[poly_degree], dg->oneD_quadrature_collection[poly_degree]);
-
-    OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis(1, poly_degree, dg->max_grid_degree);
-    mapping_basis.build_1D_shape_functions_at_grid_nodes(dg->high_order_grid->oneD_fe_system, dg->high_order_grid->oneD_grid_nodes);
-    mapping_basis.build_1D_shape_functions_at_flux_nodes(dg->high_order_grid->oneD_fe_system, dg->oneD_quadrature_collection[poly_degree], dg->oneD_face_quadrature);
-
-    std::vector<dealii::types::global_dof_index> dofs_indices (n_dofs_cell);
-    
-    double integrand_numerical_entropy_function=0;
-    double integral_numerical_entropy_function=0;
-    const std::vector<double> &quad_weights = dg->volume_quadrature_collection[poly_degree].get_weights();
-
-    auto metric_cell = dg->high_order_grid->dof_handler_grid.begin_active();
-    // Changed for loop to update metric_cell.
-    for (auto cell = dg->dof_handler.begin_active(); cell!= dg->dof_handler.end(); ++cell, ++metric_cell) {
-        if (!cell->is_locally_owned()) continue;
-        cell->get_dof_indices (dofs_indices);
-        
-        // We first need to extract the mapping support points (grid nodes) from high_order_grid.
-        const dealii::FESystem<dim> &fe_metric = dg->high_order_grid->fe_system;
-        const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
-        const unsigned int n_grid_nodes  = n_metric_dofs / dim;
-        std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
-        metric_cell->get_dof_indices (metric_dof_indices);
-        std::array<std::vector<double>,dim> mapping_support_points;
-        for(int idim=0; idim<dim; idim++){
-            mapping_support_points[idim].resize(n_grid_nodes);
-        }
-        // Get the mapping support points (physical grid nodes) from high_order_grid.
-        // Store it in such a way we can use sum-factorization on it with the mapping basis functions.
-        const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(dg->max_grid_degree);
-        for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
-            const double val = (dg->high_order_grid->volume_nodes[metric_dof_indices[idof]]);
-            const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
-            const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
-            const unsigned int igrid_node = index_renumbering[ishape];
-            mapping_support_points[istate][igrid_node] = val; 
-        }
-        // Construct the metric operators.
-        OPERATOR::metric_operators<double, dim, 2*dim> metric_oper(nstate, poly_degree, dg->max_grid_degree, false, false);
-        // Build the metric terms to compute the gradient and volume node positions.
-        // This functions will compute the determinant of the metric Jacobian and metric cofactor matrix. 
-        // If flags store_vol_flux_nodes and store_surf_flux_nodes set as true it will also compute the physical quadrature positions.
-        metric_oper.build_volume_metric_operators(
-            n_quad_pts, n_grid_nodes,
-            mapping_support_points,
-            mapping_basis,
-            dg->all_parameters->use_invariant_curl_form);
-
-        // Fetch the modal soln coefficients
-        // We immediately separate them by state as to be able to use sum-factorization
-        // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
-        // mult would sum the states at the quadrature point.
-        // That is why the basis functions are based off the 1state oneD fe_collection.
-        std::array<std::vector<double>,nstate> soln_coeff;
-        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
-            const unsigned int istate = dg->fe_collection[poly_degree].system_to_component_index(idof).first;
-            const unsigned int ishape = dg->fe_collection[poly_degree].system_to_component_index(idof).second;
-            if(ishape == 0){
-                soln_coeff[istate].resize(n_shape_fns);
-            }
-            soln_coeff[istate][ishape] = dg->solution(dofs_indices[idof]);
-        }
-        // Interpolate each state to the quadrature points using sum-factorization
-        // with the basis functions in each reference direction.
-        std::array<std::vector<double>,nstate> soln_at_q;
-        for(int istate=0; istate<nstate; istate++){
-            soln_at_q[istate].resize(n_quad_pts);
-            // Interpolate soln coeff to volume cubature nodes.
-            soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q[istate],
-                                             soln_basis.oneD_vol_operator);
-        }
-
-        // Loop over quadrature nodes, compute quantities to be integrated, and integrate them.
-        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-
-            std::array<double,nstate> soln_state;
-            // Extract solution and gradient in a way that the physics ca n use them.
-            for(int istate=0; istate<nstate; istate++){
-                soln_state[istate] = soln_at_q[istate][iquad];
-            }
-            integrand_numerical_entropy_function = this->navier_stokes_physics->compute_numerical_entropy_function(soln_state);
-            integral_numerical_entropy_function += integrand_numerical_entropy_function * quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
-        }
-    }
-    // update integrated quantities and return
-    return dealii::Utilities::MPI::sum(integral_numerical_entropy_function, this->mpi_communicator);
+    double unused_wave_speed = 0.0;
+    const IntegralValuesArray integral_values = integrate_quantities(*dg, false, true, unused_wave_speed);
+    return integral_values[NUMBER_OF_INTEGRATED_QUANTITIES];
 }
 
 template <int dim, int nstate>
-void PeriodicTurbulence<dim, nstate>::compute_unsteady_data_and_write_to_table(
-        const unsigned int current_iteration,
-        const double current_time,
-        const std::shared_ptr <DGBase<dim, double>> dg,
-        const std::shared_ptr <dealii::TableHandler> unsteady_data_table)
+void PeriodicTurbulence<dim, nstate>::write_integrated_quantities_to_table(
+        const unsigned int iteration,
+        const double time,
+        const std::shared_ptr <dealii::TableHandler> unsteady_data_table) const
 {
-    // Compute and update integrated quantities
-    this->compute_and_update_integrated_quantities(*dg);
     // Get computed quantities
     const double integrated_kinetic_energy = this->get_integrated_kinetic_energy();
     const double integrated_enstrophy = this->get_integrated_enstrophy();
@@ -743,12 +795,12 @@ void PeriodicTurbulence<dim, nstate>::compute_unsteady_data_and_write_to_table(
     const double deviatoric_strain_rate_tensor_based_dissipation_rate = this->get_deviatoric_strain_rate_tensor_based_dissipation_rate();
     const double strain_rate_tensor_based_dissipation_rate = this->get_strain_rate_tensor_based_dissipation_rate();
     
-    double numerical_entropy = 0;
-    if (do_calculate_numerical_entropy) numerical_entropy = this->get_numerical_entropy(dg);
+    // The numerical entropy is integrated in the same pass as the other quantities
+    const double numerical_entropy = do_calculate_numerical_entropy ? this->integrated_numerical_entropy : 0.0;
 
     if(this->mpi_rank==0) {
         // Add values to data table
-        this->add_value_to_data_table(current_time,"time",unsteady_data_table);
+        this->add_value_to_data_table(time,"time",unsteady_data_table);
         if(do_calculate_numerical_entropy) this->add_value_to_data_table(numerical_entropy,"numerical_entropy",unsteady_data_table);
         this->add_value_to_data_table(integrated_kinetic_energy,"kinetic_energy",unsteady_data_table);
         this->add_value_to_data_table(integrated_enstrophy,"enstrophy",unsteady_data_table);
@@ -761,8 +813,8 @@ void PeriodicTurbulence<dim, nstate>::compute_unsteady_data_and_write_to_table(
         unsteady_data_table->write_text(unsteady_data_table_file);
     }
     // Print to console
-    this->pcout << "    Iter: " << current_iteration
-                << "    Time: " << current_time
+    this->pcout << "    Iter: " << iteration
+                << "    Time: " << time
                 << "    Energy: " << integrated_kinetic_energy
                 << "    Enstrophy: " << integrated_enstrophy;
     if(is_viscous_flow) {
@@ -776,10 +828,36 @@ void PeriodicTurbulence<dim, nstate>::compute_unsteady_data_and_write_to_table(
 
     // Abort if energy is nan
     if(std::isnan(integrated_kinetic_energy)) {
-        this->pcout << " ERROR: Kinetic energy at time " << current_time << " is nan." << std::endl;
+        this->pcout << " ERROR: Kinetic energy at time " << time << " is nan." << std::endl;
         this->pcout << "        Consider decreasing the time step / CFL number." << std::endl;
         std::abort();
     }
+}
+
+template <int dim, int nstate>
+void PeriodicTurbulence<dim, nstate>::compute_unsteady_data_and_write_to_table(
+        const unsigned int current_iteration,
+        const double current_time,
+        const std::shared_ptr <DGBase<dim, double>> dg,
+        const std::shared_ptr <dealii::TableHandler> unsteady_data_table)
+{
+    if(integrate_quantities_in_residual) {
+        // The quantities of the previous call have been accumulated by the first residual assembly at that solution,
+        // such that each row is written one call later, with the iteration and time it was requested at.
+        // The quantities of the final solution are never written.
+        const bool is_quantities_available = this->update_integrated_quantities_from_residual(*dg);
+        if(is_quantities_available) {
+            this->write_integrated_quantities_to_table(this->iteration_of_requested_quantities, this->time_of_requested_quantities, unsteady_data_table);
+        }
+        this->request_integrated_quantities_in_residual(*dg);
+        this->iteration_of_requested_quantities = current_iteration;
+        this->time_of_requested_quantities = current_time;
+        if(this->all_param.flow_solver_param.adaptive_time_step == true) this->update_maximum_local_wave_speed(*dg);
+    } else {
+        // Compute and update integrated quantities
+        this->compute_and_update_integrated_quantities(*dg);
+        this->write_integrated_quantities_to_table(current_iteration, current_time, unsteady_data_table);
+    }
 
     // Output velocity field for spectra obtaining kinetic energy spectra
     if(output_velocity_field_at_fixed_times) {
@@ -104,6 +104,7 @@ protected:
     bool is_decaying_homogeneous_isotropic_turbulence = false; ///< Identified if DHIT case; initialized as false.
     bool is_viscous_flow = true; ///< Identifies if viscous flow; initialized as true.
     bool do_calculate_numerical_entropy = false; ///< Identifies if numerical entropy should be calculated; initialized as false.
+    const bool integrate_quantities_in_residual; ///< Flag to accumulate the integrated quantities in the residual volume cell loop.
 
     /// Display additional more specific flow case parameters
     void display_additional_flow_case_specific_parameters() const override;
@@ -138,6 +139,54 @@ protected:
     /// Array for storing the integrated quantities; done for computational efficiency
     std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> integrated_quantities;
 
+    /// Numerical entropy integrated by compute_and_update_integrated_quantities() if do_calculate_numerical_entropy
+    double integrated_numerical_entropy;
+
+    /// Integrals over the domain of the IntegratedQuantitiesEnum quantities followed by the numerical entropy
+    using IntegralValuesArray = std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES+1>;
+
+    /// Integrates the quantities of IntegratedQuantitiesEnum and/or the numerical entropy in a single pass over the cells
+    /** The grid nodes and solution coefficients of a cell are gathered once for both integrations,
+     *  and the local integrals are summed over the processes with a single reduction.
+     *  The quantities are over-integrated, while the numerical entropy uses the volume quadrature of the scheme.
+     *  If the time step is adaptive, the maximum local wave speed is also evaluated with the quantities.
+     *
+     *  This pass is separate from the residual assembly. See integrate_quantities_in_residual for the quantities
+     *  accumulated at the volume quadrature nodes of the residual instead.
+     */
+    IntegralValuesArray integrate_quantities(
+            const DGBase<dim, double> &dg,
+            const bool do_integrate_quantities,
+            const bool do_integrate_numerical_entropy,
+            double &local_maximum_wave_speed) const;
+
+    /// Evaluates the integrand of each quantity of IntegratedQuantitiesEnum at a quadrature node.
+    std::array<double,NUMBER_OF_INTEGRATED_QUANTITIES> evaluate_integrands(
+            const std::array<double,nstate> &soln_at_q,
+            const std::array<dealii::Tensor<1,dim,double>,nstate> &soln_grad_at_q) const;
+
+    /// Requests the integrated quantities from the next residual assembly of the strong DG.
+    /** The quantities are then evaluated at the volume quadrature nodes of the residual, with the gradient
+     *  of the auxiliary variables, during the first stage of the next time step, i.e. at the current solution.
+     */
+    void request_integrated_quantities_in_residual(DGBase<dim, double> &dg);
+
+    /// Updates the integrated quantities with the ones accumulated during the residual assembly.
+    /** Returns false if the residual has not been assembled since the last request. */
+    bool update_integrated_quantities_from_residual(const DGBase<dim, double> &dg);
+
+    /// Writes the current integrated quantities to the data table and to the console.
+    void write_integrated_quantities_to_table(
+            const unsigned int iteration,
+            const double time,
+            const std::shared_ptr<dealii::TableHandler> unsteady_data_table) const;
+
+    /// Iteration at which the quantities have been requested from the residual.
+    unsigned int iteration_of_requested_quantities;
+
+    /// Time at which the quantities have been requested from the residual.
+    double time_of_requested_quantities;
+
     /// Maximum local wave speed (i.e. convective eigenvalue)
     double maximum_local_wave_speed;
 
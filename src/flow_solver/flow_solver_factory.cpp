@@ -23,11 +23,17 @@ template <int dim, int nstate>
 std::unique_ptr < FlowSolver<dim,nstate> >
 FlowSolverFactory<dim,nstate>
 ::select_flow_case(const Parameters::AllParameters *const parameters_input,
-                   const dealii::ParameterHandler &parameter_handler_input)
+                   const dealii::ParameterHandler &parameter_handler_input,
+                   const MPI_Comm mpi_communicator)
 {
     // Get the flow case type
     using FlowCaseEnum = Parameters::FlowSolverParam::FlowCaseType;
     const FlowCaseEnum flow_type = parameters_input->flow_solver_param.flow_case_type;
+    const bool flow_case_takes_communicator = (flow_type == FlowCaseEnum::naca0012 || flow_type == FlowCaseEnum::gaussian_bump);
+    if (mpi_communicator != MPI_COMM_WORLD && !flow_case_takes_communicator) {
+        std::cout << "This flow case can only be distributed over MPI_COMM_WORLD. Aborting..." << std::endl;
+        std::abort();
+    }
     if (flow_type == FlowCaseEnum::taylor_green_vortex){
         if constexpr (dim==3 && nstate==dim+2){
             std::shared_ptr<FlowSolverCaseBase<dim, nstate>> flow_solver_case = std::make_shared<PeriodicTurbulence<dim,nstate>>(parameters_input);
@@ -50,7 +56,7 @@ FlowSolverFactory<dim,nstate>
         }
     } else if (flow_type == FlowCaseEnum::naca0012){
         if constexpr (dim==2 && nstate==dim+2){
-            std::shared_ptr<FlowSolverCaseBase<dim, nstate>> flow_solver_case = std::make_shared<NACA0012<dim,nstate>>(parameters_input);
+            std::shared_ptr<FlowSolverCaseBase<dim, nstate>> flow_solver_case = std::make_shared<NACA0012<dim,nstate>>(parameters_input, mpi_communicator);
             return std::make_unique<FlowSolver<dim,nstate>>(parameters_input, flow_solver_case, parameter_handler_input);
         }
     } else if (flow_type == FlowCaseEnum::periodic_1D_unsteady){
@@ -60,7 +66,7 @@ FlowSolverFactory<dim,nstate>
         }
     } else if (flow_type == FlowCaseEnum::gaussian_bump){
         if constexpr (dim>1 && nstate==dim+2){
-            std::shared_ptr<FlowSolverCaseBase<dim, nstate>> flow_solver_case = std::make_shared<GaussianBump<dim, nstate>>(parameters_input);
+            std::shared_ptr<FlowSolverCaseBase<dim, nstate>> flow_solver_case = std::make_shared<GaussianBump<dim, nstate>>(parameters_input, mpi_communicator);
             return std::make_unique<FlowSolver<dim, nstate>>(parameters_input, flow_solver_case, parameter_handler_input);
         }
     } else if (flow_type == FlowCaseEnum::isentropic_vortex){
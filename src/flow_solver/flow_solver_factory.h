@@ -15,9 +15,12 @@ class FlowSolverFactory
 {
 public:
     /// Factory to return the correct flow solver given input file.
+    /** Only the naca0012 and gaussian_bump flow cases can be distributed over a communicator other than MPI_COMM_WORLD.
+     */
     static std::unique_ptr< FlowSolver<dim,nstate> >
         select_flow_case(const Parameters::AllParameters *const parameters_input,
-                         const dealii::ParameterHandler &parameter_handler_input);
+                         const dealii::ParameterHandler &parameter_handler_input,
+                         const MPI_Comm mpi_communicator = MPI_COMM_WORLD);
 
     /// Recursive factory that will create FlowSolverBase (i.e. FlowSolver<dim,nstate>)
     static std::unique_ptr< FlowSolverBase > 
@@ -328,7 +328,7 @@ Functional<dim,nstate,real,MeshType>::Functional(
     , d2IdXdX(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
     , uses_solution_values(_uses_solution_values)
     , uses_solution_gradient(_uses_solution_gradient)
-    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
+    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(_dg->get_mpi_communicator())==0)
 { 
     using FadType = Sacado::Fad::DFad<real>;
     using FadFadType = Sacado::Fad::DFad<FadType>;
@@ -382,6 +382,7 @@ template <int dim, int nstate, typename real, typename MeshType>
 void Functional<dim,nstate,real,MeshType>::set_geom(const dealii::LinearAlgebra::distributed::Vector<real> &volume_nodes_set)
 {
     dg->high_order_grid->volume_nodes = volume_nodes_set;
+    dg->high_order_grid->mark_volume_nodes_as_modified();
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
@@ -393,7 +394,7 @@ void Functional<dim,nstate,real,MeshType>::allocate_dIdX(dealii::LinearAlgebra::
     dealii::DoFTools::extract_locally_relevant_dofs(dg->high_order_grid->dof_handler_grid, locally_relevant_dofs);
     ghost_dofs = locally_relevant_dofs;
     ghost_dofs.subtract_set(locally_owned_dofs);
-    dIdX.reinit(locally_owned_dofs, ghost_dofs, MPI_COMM_WORLD);
+    dIdX.reinit(locally_owned_dofs, ghost_dofs, dg->get_mpi_communicator());
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
@@ -402,7 +403,7 @@ void Functional<dim,nstate,real,MeshType>::allocate_derivatives(const bool compu
     if (compute_dIdW) {
         // allocating the vector
         dealii::IndexSet locally_owned_dofs = dg->dof_handler.locally_owned_dofs();
-        dIdw.reinit(locally_owned_dofs, MPI_COMM_WORLD);
+        dIdw.reinit(locally_owned_dofs, dg->get_mpi_communicator());
     }
     if (compute_dIdX) {
         allocate_dIdX(dIdX);
@@ -412,21 +413,21 @@ void Functional<dim,nstate,real,MeshType>::allocate_derivatives(const bool compu
             dealii::SparsityPattern sparsity_pattern_d2IdWdX = dg->get_d2RdWdX_sparsity_pattern ();
             const dealii::IndexSet &row_parallel_partitioning_d2IdWdX = dg->locally_owned_dofs;
             const dealii::IndexSet &col_parallel_partitioning_d2IdWdX = dg->high_order_grid->locally_owned_dofs_grid;
-            d2IdWdX->reinit(row_parallel_partitioning_d2IdWdX, col_parallel_partitioning_d2IdWdX, sparsity_pattern_d2IdWdX, MPI_COMM_WORLD);
+            d2IdWdX->reinit(row_parallel_partitioning_d2IdWdX, col_parallel_partitioning_d2IdWdX, sparsity_pattern_d2IdWdX, dg->get_mpi_communicator());
         }
 
         {
             dealii::SparsityPattern sparsity_pattern_d2IdWdW = dg->get_d2RdWdW_sparsity_pattern ();
             const dealii::IndexSet &row_parallel_partitioning_d2IdWdW = dg->locally_owned_dofs;
             const dealii::IndexSet &col_parallel_partitioning_d2IdWdW = dg->locally_owned_dofs;
-            d2IdWdW->reinit(row_parallel_partitioning_d2IdWdW, col_parallel_partitioning_d2IdWdW, sparsity_pattern_d2IdWdW, MPI_COMM_WORLD);
+            d2IdWdW->reinit(row_parallel_partitioning_d2IdWdW, col_parallel_partitioning_d2IdWdW, sparsity_pattern_d2IdWdW, dg->get_mpi_communicator());
         }
 
         {
             dealii::SparsityPattern sparsity_pattern_d2IdXdX = dg->get_d2RdXdX_sparsity_pattern ();
             const dealii::IndexSet &row_parallel_partitioning_d2IdXdX = dg->high_order_grid->locally_owned_dofs_grid;
             const dealii::IndexSet &col_parallel_partitioning_d2IdXdX = dg->high_order_grid->locally_owned_dofs_grid;
-            d2IdXdX->reinit(row_parallel_partitioning_d2IdXdX, col_parallel_partitioning_d2IdXdX, sparsity_pattern_d2IdXdX, MPI_COMM_WORLD);
+            d2IdXdX->reinit(row_parallel_partitioning_d2IdXdX, col_parallel_partitioning_d2IdXdX, sparsity_pattern_d2IdXdX, dg->get_mpi_communicator());
         }
     }
 }
@@ -967,7 +968,7 @@ real Functional<dim, nstate, real, MeshType>::evaluate_functional(
         AssertDimension(i_derivative, n_total_indep);
     }
 
-    current_functional_value = dealii::Utilities::MPI::sum(local_functional, MPI_COMM_WORLD);
+    current_functional_value = dealii::Utilities::MPI::sum(local_functional, dg->get_mpi_communicator());
     // compress before the return
     if (actually_compute_dIdW) dIdw.compress(dealii::VectorOperation::add);
     if (actually_compute_dIdX) dIdX.compress(dealii::VectorOperation::add);
@@ -995,7 +996,7 @@ dealii::LinearAlgebra::distributed::Vector<real> Functional<dim,nstate,real,Mesh
 
     // allocating the vector
     dealii::IndexSet locally_owned_dofs = dg.dof_handler.locally_owned_dofs();
-    dIdw.reinit(locally_owned_dofs, MPI_COMM_WORLD);
+    dIdw.reinit(locally_owned_dofs, dg.get_mpi_communicator());
 
     // setup it mostly the same as evaluating the value (with exception that local solution is also AD)
     const unsigned int max_dofs_per_cell = dg.dof_handler.get_fe_collection().max_dofs_per_cell();
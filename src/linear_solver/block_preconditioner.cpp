@@ -0,0 +1,261 @@
+#include <algorithm>
+
+#include <deal.II/base/exceptions.h>
+
+#include <Teuchos_BLAS.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include "block_preconditioner.h"
+
+namespace PHiLiP {
+
+namespace {
+
+// The blocks are stored row-major, i.e. each block is stored as its column-major transpose.
+// The BLAS and LAPACK kernels are therefore applied to the transposed blocks.
+
+/// Dense block update C -= A B, with A of size m x k and B of size k x n, all stored row-major.
+/** Computes C^T -= B^T A^T with the BLAS3 GEMM. */
+void subtract_block_product(double *C, const double *A, const double *B, const unsigned int m, const unsigned int k, const unsigned int n)
+{
+    const Teuchos::BLAS<int,double> blas;
+    blas.GEMM(Teuchos::NO_TRANS, Teuchos::NO_TRANS, n, m, k, -1.0, B, n, A, k, 1.0, C, n);
+}
+
+/// Dense block matrix-vector update y -= A x, with A of size m x n stored row-major.
+void subtract_block_vmult(double *y, const double *A, const double *x, const unsigned int m, const unsigned int n)
+{
+    const Teuchos::BLAS<int,double> blas;
+    blas.GEMV(Teuchos::TRANS, n, m, -1.0, A, n, x, 1, 1.0, y, 1);
+}
+
+/// Replaces the n x n row-major block with its LU factorization with partial pivoting, from LAPACK GETRF.
+/** The factorization is the one of the transposed block, such that solve_block() applies its transpose.
+ *  Returns false if the block is singular.
+ */
+bool factorize_block(double *block, int *pivots, const unsigned int n)
+{
+    const Teuchos::LAPACK<int,double> lapack;
+    int info;
+    lapack.GETRF(n, n, block, n, pivots, &info);
+    return info == 0;
+}
+
+/// Solves D x = b in place for the n x n row-major block D factorized by factorize_block(), with LAPACK GETRS.
+void solve_block(const double *factorized_block, const int *pivots, double *x, const unsigned int n)
+{
+    const Teuchos::LAPACK<int,double> lapack;
+    int info;
+    lapack.GETRS('T', n, 1, factorized_block, n, pivots, x, n, &info);
+}
+
+/// Replaces the m x n row-major block A with A D^{-1}, for the n x n row-major block D factorized by factorize_block().
+/** Solves D^T (A D^{-1})^T = A^T for the m right-hand sides at once with LAPACK GETRS. */
+void right_solve_block(const double *factorized_block, const int *pivots, double *A, const unsigned int m, const unsigned int n)
+{
+    const Teuchos::LAPACK<int,double> lapack;
+    int info;
+    lapack.GETRS('N', n, m, factorized_block, n, pivots, A, n, &info);
+}
+
+} // anonymous namespace
+
+BlockPreconditioner::BlockPreconditioner(const PreconditionerEnum preconditioner_type)
+    : preconditioner_type(preconditioner_type)
+{
+    Assert(preconditioner_type != PreconditionerEnum::ilut,
+           dealii::ExcMessage("The block preconditioner must be block_jacobi, block_gauss_seidel or block_ilu0."));
+}
+
+unsigned int BlockPreconditioner::n_blocks() const
+{
+    return (block_start.size() > 0) ? block_start.size() - 1 : 0;
+}
+
+unsigned int BlockPreconditioner::block_size(const unsigned int i) const
+{
+    return block_start[i+1] - block_start[i];
+}
+
+double * BlockPreconditioner::block_pointer(const unsigned int p)
+{
+    return block_values.data() + block_values_start[p];
+}
+
+const double * BlockPreconditioner::block_pointer(const unsigned int p) const
+{
+    return block_values.data() + block_values_start[p];
+}
+
+unsigned int BlockPreconditioner::find_block(const unsigned int i, const unsigned int j) const
+{
+    const auto first = block_column.begin() + block_row_start[i];
+    const auto last  = block_column.begin() + block_row_start[i+1];
+    const auto position = std::lower_bound(first, last, j);
+    if (position == last || *position != j) return dealii::numbers::invalid_unsigned_int;
+    return position - block_column.begin();
+}
+
+void BlockPreconditioner::initialize(const dealii::TrilinosWrappers::SparseMatrix &matrix)
+{
+    using size_type = dealii::types::global_dof_index;
+    const std::pair<size_type, size_type> local_range = matrix.local_range();
+    const unsigned int n_local_rows = local_range.second - local_range.first;
+
+    // Consecutive rows of the same element share the same set of columns.
+    block_start.clear();
+    std::vector<size_type> previous_columns, columns;
+    for (unsigned int row=0; row<n_local_rows; ++row) {
+        columns.clear();
+        const size_type global_row = local_range.first + row;
+        for (auto entry = matrix.begin(global_row); entry != matrix.end(global_row); ++entry) {
+            columns.push_back(entry->column());
+        }
+        std::sort(columns.begin(), columns.end());
+        if (row == 0 || columns != previous_columns) block_start.push_back(row);
+        std::swap(previous_columns, columns);
+    }
+    block_start.push_back(n_local_rows);
+    const unsigned int n_element_blocks = this->n_blocks();
+
+    std::vector<unsigned int> row_to_block(n_local_rows);
+    for (unsigned int i=0; i<n_element_blocks; ++i) {
+        std::fill(row_to_block.begin() + block_start[i], row_to_block.begin() + block_start[i+1], i);
+    }
+    const auto is_locally_owned = [&](const size_type column) {
+        return local_range.first <= column && column < local_range.second;
+    };
+
+    // Block sparsity pattern, given by the columns of the first row of each block.
+    block_row_start.assign(1, 0);
+    block_column.clear();
+    diagonal_position.resize(n_element_blocks);
+    for (unsigned int i=0; i<n_element_blocks; ++i) {
+        const size_type global_row = local_range.first + block_start[i];
+        const unsigned int first = block_column.size();
+        for (auto entry = matrix.begin(global_row); entry != matrix.end(global_row); ++entry) {
+            if (!is_locally_owned(entry->column())) continue;
+            block_column.push_back(row_to_block[entry->column() - local_range.first]);
+        }
+        std::sort(block_column.begin() + first, block_column.end());
+        block_column.erase(std::unique(block_column.begin() + first, block_column.end()), block_column.end());
+        block_row_start.push_back(block_column.size());
+        diagonal_position[i] = find_block(i,i);
+        AssertThrow(diagonal_position[i] != dealii::numbers::invalid_unsigned_int,
+                    dealii::ExcMessage("The block preconditioner requires the diagonal entries of the matrix to be stored."));
+    }
+
+    // Contiguous dense storage of every block.
+    block_values_start.resize(block_column.size());
+    std::size_t n_values = 0;
+    for (unsigned int i=0; i<n_element_blocks; ++i) {
+        for (unsigned int p=block_row_start[i]; p<block_row_start[i+1]; ++p) {
+            block_values_start[p] = n_values;
+            n_values += block_size(i) * block_size(block_column[p]);
+        }
+    }
+    block_values.assign(n_values, 0.0);
+    for (unsigned int i=0; i<n_element_blocks; ++i) {
+        for (unsigned int row=block_start[i]; row<block_start[i+1]; ++row) {
+            const size_type global_row = local_range.first + row;
+            for (auto entry = matrix.begin(global_row); entry != matrix.end(global_row); ++entry) {
+                if (!is_locally_owned(entry->column())) continue;
+                const unsigned int column = entry->column() - local_range.first;
+                const unsigned int j = row_to_block[column];
+                const unsigned int p = find_block(i,j);
+                block_pointer(p)[(row - block_start[i]) * block_size(j) + (column - block_start[j])] = entry->value();
+            }
+        }
+    }
+
+    if (preconditioner_type == PreconditionerEnum::block_ilu0) {
+        factorize_ilu0();
+    } else {
+        factorize_diagonal_blocks();
+    }
+}
+
+void BlockPreconditioner::factorize_diagonal_blocks()
+{
+    diagonal_pivots.resize(block_start.back());
+    for (unsigned int i=0; i<n_blocks(); ++i) {
+        const bool is_invertible = factorize_block(block_pointer(diagonal_position[i]), diagonal_pivots.data() + block_start[i], block_size(i));
+        AssertThrow(is_invertible, dealii::ExcMessage("Singular element block in the block preconditioner."));
+    }
+}
+
+void BlockPreconditioner::factorize_ilu0()
+{
+    // IKJ variant, where block-row i is eliminated using the already factorized rows k < i.
+    diagonal_pivots.resize(block_start.back());
+    for (unsigned int i=0; i<n_blocks(); ++i) {
+        const unsigned int n_i = block_size(i);
+        for (unsigned int p=block_row_start[i]; p<diagonal_position[i]; ++p) {
+            const unsigned int k = block_column[p];
+            const unsigned int n_k = block_size(k);
+
+            // L_ik = A_ik D_k^{-1}
+            double *L_ik = block_pointer(p);
+            right_solve_block(block_pointer(diagonal_position[k]), diagonal_pivots.data() + block_start[k], L_ik, n_i, n_k);
+
+            // A_ij -= L_ik U_kj, only for the blocks (i,j) of the pattern.
+            for (unsigned int q=diagonal_position[k]+1; q<block_row_start[k+1]; ++q) {
+                const unsigned int j = block_column[q];
+                const unsigned int r = find_block(i,j);
+                if (r == dealii::numbers::invalid_unsigned_int) continue;
+                subtract_block_product(block_pointer(r), L_ik, block_pointer(q), n_i, n_k, block_size(j));
+            }
+        }
+        const bool is_invertible = factorize_block(block_pointer(diagonal_position[i]), diagonal_pivots.data() + block_start[i], n_i);
+        AssertThrow(is_invertible, dealii::ExcMessage("Singular pivot block in the block ILU(0) factorization."));
+    }
+}
+
+void BlockPreconditioner::vmult(VectorType &dst, const VectorType &src) const
+{
+    AssertDimension(src.locally_owned_elements().n_elements(), block_start.back());
+    AssertDimension(dst.locally_owned_elements().n_elements(), block_start.back());
+
+    const double *b = src.begin();
+    double *x = dst.begin();
+
+    if (preconditioner_type == PreconditionerEnum::block_jacobi) {
+        std::copy(b, b + block_start.back(), x);
+        for (unsigned int i=0; i<n_blocks(); ++i) {
+            solve_block(block_pointer(diagonal_position[i]), diagonal_pivots.data() + block_start[i], x + block_start[i], block_size(i));
+        }
+    } else if (preconditioner_type == PreconditionerEnum::block_gauss_seidel) {
+        for (unsigned int i=0; i<n_blocks(); ++i) {
+            const unsigned int n_i = block_size(i);
+            double *x_i = x + block_start[i];
+            std::copy(b + block_start[i], b + block_start[i+1], x_i);
+            for (unsigned int p=block_row_start[i]; p<diagonal_position[i]; ++p) {
+                const unsigned int k = block_column[p];
+                subtract_block_vmult(x_i, block_pointer(p), x + block_start[k], n_i, block_size(k));
+            }
+            solve_block(block_pointer(diagonal_position[i]), diagonal_pivots.data() + block_start[i], x_i, n_i);
+        }
+    } else if (preconditioner_type == PreconditionerEnum::block_ilu0) {
+        // Forward substitution with the unit block-lower factor.
+        for (unsigned int i=0; i<n_blocks(); ++i) {
+            double *y_i = x + block_start[i];
+            std::copy(b + block_start[i], b + block_start[i+1], y_i);
+            for (unsigned int p=block_row_start[i]; p<diagonal_position[i]; ++p) {
+                const unsigned int k = block_column[p];
+                subtract_block_vmult(y_i, block_pointer(p), x + block_start[k], block_size(i), block_size(k));
+            }
+        }
+        // Backward substitution with the block-upper factor.
+        for (unsigned int i=n_blocks(); i-- > 0; ) {
+            const unsigned int n_i = block_size(i);
+            double *x_i = x + block_start[i];
+            for (unsigned int p=diagonal_position[i]+1; p<block_row_start[i+1]; ++p) {
+                const unsigned int j = block_column[p];
+                subtract_block_vmult(x_i, block_pointer(p), x + block_start[j], n_i, block_size(j));
+            }
+            solve_block(block_pointer(diagonal_position[i]), diagonal_pivots.data() + block_start[i], x_i, n_i);
+        }
+    }
+}
+
+} // PHiLiP namespace
@@ -0,0 +1,100 @@
+#ifndef __BLOCK_PRECONDITIONER_H__
+#define __BLOCK_PRECONDITIONER_H__
+
+#include <vector>
+
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "parameters/parameters_linear_solver.h"
+
+namespace PHiLiP {
+
+/// Preconditioners exploiting the dense element blocks of DG Jacobians.
+/** The degrees of freedom of a DG cell are numbered contiguously and couple with all the
+ *  degrees of freedom of the cell and of its face neighbours (see get_dRdW_sparsity_pattern()).
+ *  The element blocks are recovered from the matrix sparsity pattern: a block is a maximal range of
+ *  consecutive locally owned rows sharing the same set of columns.
+ *
+ *  Every block of the locally owned rows is copied into a single contiguous array, stored
+ *  block-row by block-row in a CSR-like layout. The diagonal blocks are factorized in place with the
+ *  LAPACK LU with partial pivoting (GETRF) and solved with GETRS, while the off-diagonal block updates
+ *  use the BLAS GEMM and GEMV, such that applying the preconditioner only involves dense block kernels.
+ *
+ *  Couplings with rows owned by other processors are dropped, such that the preconditioner is
+ *  applied in parallel as a block-Jacobi method between the processors.
+ *
+ *  Available variants are
+ *  - block_jacobi:       x_i = D_i^{-1} b_i
+ *  - block_gauss_seidel: one forward sweep, x_i = D_i^{-1} (b_i - sum_{k<i} A_ik x_k)
+ *  - block_ilu0:         block incomplete LU without fill-in beyond the element adjacency.
+ */
+class BlockPreconditioner
+{
+public:
+    /// Distributed vector type on which the preconditioner is applied.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+    /// Available preconditioners.
+    using PreconditionerEnum = Parameters::LinearSolverParam::PreconditionerEnum;
+
+    /// Constructor.
+    explicit BlockPreconditioner(const PreconditionerEnum preconditioner_type);
+
+    /// Extracts the element blocks of the locally owned rows and factorizes them.
+    void initialize(const dealii::TrilinosWrappers::SparseMatrix &matrix);
+
+    /// Applies the preconditioner, dst = P^{-1} src.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+    /// Number of element blocks on this processor.
+    unsigned int n_blocks() const;
+
+protected:
+    /// Type of preconditioner applied.
+    const PreconditionerEnum preconditioner_type;
+
+    /// First local row of each block, with the number of local rows appended.
+    std::vector<unsigned int> block_start;
+
+    /// Position of the first stored block of each block-row in block_column, with the total appended.
+    std::vector<unsigned int> block_row_start;
+
+    /// Block-column of each stored block, sorted within each block-row.
+    std::vector<unsigned int> block_column;
+
+    /// Position of the diagonal block of each block-row in block_column.
+    std::vector<unsigned int> diagonal_position;
+
+    /// Offset of each stored block in block_values.
+    std::vector<std::size_t> block_values_start;
+
+    /// Row-major dense values of every stored block, contiguous in memory.
+    /** The diagonal blocks hold their LAPACK LU factorization once initialized.
+     *  For block_ilu0, the strictly lower blocks hold L and the strictly upper blocks hold U.
+     */
+    std::vector<double> block_values;
+
+    /// LAPACK pivots of the factorized diagonal blocks, stored from the first local row of each block.
+    std::vector<int> diagonal_pivots;
+
+    /// Size of the block i.
+    unsigned int block_size(const unsigned int i) const;
+
+    /// Pointer to the values of the stored block at position p in block_column.
+    double * block_pointer(const unsigned int p);
+    /// Pointer to the values of the stored block at position p in block_column.
+    const double * block_pointer(const unsigned int p) const;
+
+    /// Position of the block (i,j) in block_column, or dealii::numbers::invalid_unsigned_int if it is not stored.
+    unsigned int find_block(const unsigned int i, const unsigned int j) const;
+
+    /// Block incomplete LU factorization without fill-in.
+    void factorize_ilu0();
+
+    /// Replaces every diagonal block with its LU factorization.
+    void factorize_diagonal_blocks();
+};
+
+} // PHiLiP namespace
+
+#endif
@@ -10,8 +10,10 @@
 #include <deal.II/lac/solver_gmres.h>
 
 #include "linear_solver.h"
+#include "block_preconditioner.h"
 
 #include "global_counter.hpp"
+#include "profiling/performance_profiler.h"
 
 namespace PHiLiP {
 
@@ -163,6 +165,85 @@ solve_linear3 (
 
 }
 
+template <typename PreconditionerType>
+std::pair<unsigned int, double>
+solve_linear_preconditioned (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param,
+    const PreconditionerType &preconditioner)
+{
+    // Solver convergence settings
+    const double rhs_norm = right_hand_side.l2_norm();
+    const double linear_residual_tolerance = param.linear_residual * rhs_norm;
+    const int max_iterations = param.max_iterations;
+
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    pcout << " Solving linear system with max_iterations = " << max_iterations
+          << " and linear residual tolerance: " << linear_residual_tolerance << std::endl;
+
+    const bool log_history = (param.linear_solver_output == Parameters::OutputEnum::verbose);
+    const bool log_result = true;
+    dealii::SolverControl solver_control(max_iterations, linear_residual_tolerance, log_history, log_result);
+
+    const bool     right_preconditioning = false; // default: false
+    const bool     use_default_residual = true; // default: true
+    const bool     force_re_orthogonalization = false; // default: false
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+    typedef typename dealii::SolverGMRES<VectorType>::AdditionalData AddiData_GMRES;
+    AddiData_GMRES add_data_gmres( param.restart_number, right_preconditioning, use_default_residual, force_re_orthogonalization);
+    dealii::SolverGMRES<VectorType> solver_gmres(solver_control, add_data_gmres);
+
+    solution *= 0.0;
+    try {
+        solver_gmres.solve(system_matrix, solution, right_hand_side, preconditioner);
+    } catch (const dealii::SolverControl::NoConvergence &) {
+        // Same behaviour as AztecOO, which returns the last iterate when the tolerance is not reached.
+    }
+
+    pcout << " Linear solver took " << solver_control.last_step()
+          << " iterations resulting in a linear residual of " << solver_control.last_value() << std::endl
+          << " Current RHS norm: " << rhs_norm
+          << " Linear solution norm: " << solution.l2_norm() << std::endl;
+
+    n_vmult += solver_control.last_step();
+    dRdW_mult += solver_control.last_step();
+    Profiling::PerformanceProfiler::instance().add_to_counter("linear_solver_iterations", solver_control.last_step());
+
+    return {solver_control.last_step(), solver_control.last_value()};
+}
+
+template std::pair<unsigned int, double>
+solve_linear_preconditioned<dealii::TrilinosWrappers::PreconditionBase> (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param,
+    const dealii::TrilinosWrappers::PreconditionBase &preconditioner);
+
+template std::pair<unsigned int, double>
+solve_linear_preconditioned<BlockPreconditioner> (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param,
+    const BlockPreconditioner &preconditioner);
+
+/// Solves the linear system with deal.II's GMRES, preconditioned by one of the element-block preconditioners.
+std::pair<unsigned int, double>
+solve_linear_block_preconditioned (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param)
+{
+    BlockPreconditioner preconditioner(param.preconditioner);
+    preconditioner.initialize(system_matrix);
+
+    return solve_linear_preconditioned(system_matrix, right_hand_side, solution, param, preconditioner);
+}
+
 std::pair<unsigned int, double>
 solve_linear (
     const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
@@ -170,6 +251,7 @@ solve_linear (
     dealii::LinearAlgebra::distributed::Vector<double> &solution,
     const Parameters::LinearSolverParam &param)
 {
+    Profiling::ScopedTimer linear_solve_timer("linear_solve");
 
     // if (pcout.is_active()) system_matrix.print(pcout.get_stream(), true);
     // if (pcout.is_active()) solution.print(pcout.get_stream());
@@ -196,6 +278,9 @@ solve_linear (
         direct.solve(system_matrix, solution, right_hand_side);
         return {solver_control.last_step(), solver_control.last_value()};
     } else if (param.linear_solver_type == gmres_type) {
+        if (param.preconditioner != Parameters::LinearSolverParam::PreconditionerEnum::ilut) {
+            return solve_linear_block_preconditioned(system_matrix, right_hand_side, solution, param);
+        }
         //solution = right_hand_side;
         //solution *= 1e-3;
         solution *= 0.0;
@@ -280,6 +365,7 @@ solve_linear (
         //dRdW_mult += 3*solver.NumIters();
         n_vmult += 7*solver.NumIters();
         dRdW_mult += 7*solver.NumIters();
+        Profiling::PerformanceProfiler::instance().add_to_counter("linear_solver_iterations", solver.NumIters());
 
         //std::abort();
         return {solver.NumIters(), solver.TrueResidual()};
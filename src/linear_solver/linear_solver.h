@@ -18,6 +18,18 @@ namespace PHiLiP {
                        dealii::LinearAlgebra::distributed::Vector<double> &solution,
                        const Parameters::LinearSolverParam &param);
 
+    /// Solves the linear system with deal.II's GMRES and a preconditioner initialized beforehand.
+    /** Allows the implicit ODE solver to keep a factorized preconditioner over several linear solves.
+     *  Instantiated for dealii::TrilinosWrappers::PreconditionBase and BlockPreconditioner.
+     */
+    template <typename PreconditionerType>
+    std::pair<unsigned int, double>
+        solve_linear_preconditioned ( const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+                                      dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+                                      dealii::LinearAlgebra::distributed::Vector<double> &solution,
+                                      const Parameters::LinearSolverParam &param,
+                                      const PreconditionerType &preconditioner);
+
     std::pair<unsigned int, double>
     solve_linear_2 ( const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
                    const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
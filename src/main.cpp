@@ -1,4 +1,5 @@
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/multithread_info.h>
 
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/parameter_handler.h>
@@ -10,6 +11,7 @@
 #include "testing/tests.h"
 #include "flow_solver/flow_solver_factory.h"
 #include "parameters/all_parameters.h"
+#include "profiling/performance_profiler.h"
 
 #include "global_counter.hpp"
 
@@ -59,6 +61,15 @@ int main (int argc, char *argv[])
 
         AssertDimension(all_parameters.dimension, PHILIP_DIM);
 
+        PHiLiP::Profiling::PerformanceProfiler &profiler = PHiLiP::Profiling::PerformanceProfiler::instance();
+        profiler.set_enabled(all_parameters.enable_performance_profiling);
+
+        // MPI_InitFinalize limited the number of threads to 1.
+        dealii::MultithreadInfo::set_thread_limit(all_parameters.n_threads_per_process);
+        if (all_parameters.n_threads_per_process > 1) {
+            pcout << "Using " << dealii::MultithreadInfo::n_threads() << " threads per processor..." << std::endl;
+        }
+
         const int max_dim = PHILIP_DIM;
         const int max_nstate = 5;
 
@@ -72,6 +83,14 @@ int main (int argc, char *argv[])
             run_error = test->run_test();
             pcout << "Finished integration test with run error code: " << run_error << std::endl;
         }
+
+        // Overwrites the summary of the last flow solver run with the one of the whole program
+        profiler.set_counter("n_vmult", n_vmult);
+        profiler.set_counter("dRdW_form", dRdW_form);
+        profiler.set_counter("dRdW_mult", dRdW_mult);
+        profiler.set_counter("dRdX_mult", dRdX_mult);
+        profiler.set_counter("d2R_mult", d2R_mult);
+        profiler.write_summary(all_parameters.performance_profiling_filename_prefix, MPI_COMM_WORLD);
     }
     catch (std::exception &exc)
     {
@@ -347,11 +347,13 @@ void FreeFormDeformation<dim>
           high_order_grid.initial_mapping_fe_field,
           high_order_grid.dof_handler_grid,
           high_order_grid.surface_to_volume_indices,
-          surface_node_displacements);
+          surface_node_displacements,
+          mesh_mover_param);
     dealii::LinearAlgebra::distributed::Vector<double> volume_displacements = meshmover.get_volume_displacements();
     high_order_grid.volume_nodes = high_order_grid.initial_volume_nodes;
     high_order_grid.volume_nodes += volume_displacements;
     high_order_grid.volume_nodes.update_ghost_values();
+    high_order_grid.mark_volume_nodes_as_modified();
 }
 
 template<int dim>
@@ -568,7 +570,8 @@ FreeFormDeformation<dim>
           high_order_grid.initial_mapping_fe_field,
           high_order_grid.dof_handler_grid,
           high_order_grid.surface_to_volume_indices,
-          surface_node_displacements);
+          surface_node_displacements,
+          mesh_mover_param);
     //meshmover.evaluate_dXvdXs();
     meshmover.apply_dXvdXvs(dXvsdXp_vector, dXvdXp);
 }
@@ -632,6 +635,7 @@ FreeFormDeformation<dim>
         // Reset FFD
         control_pts[ictl] = old_ffd_point;
         high_order_grid.volume_nodes = old_volume_nodes;
+        high_order_grid.mark_volume_nodes_as_modified();
 
         // Perturb
         {
@@ -646,6 +650,7 @@ FreeFormDeformation<dim>
         // Reset FFD
         control_pts[ictl] = old_ffd_point;
         high_order_grid.volume_nodes = old_volume_nodes;
+        high_order_grid.mark_volume_nodes_as_modified();
 
         auto dXvdXp_i = nodes_p;
         dXvdXp_i -= nodes_m;
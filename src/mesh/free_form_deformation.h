@@ -116,6 +116,9 @@ public:
     /// Control points of the FFD box used to deform the geometry.
     std::vector<dealii::Point<dim>> control_pts;
 
+    /// Linear solver and preconditioner of the LinearElasticity mesh mover used to deform the volume mesh.
+    Parameters::MeshMoverParam mesh_mover_param;
+
     /// Given a control points' global index return its ijk coordinate.
     /** Opposite of grid_to_global
      */
@@ -57,7 +57,8 @@ namespace PHiLiP {
       * Can request to convert the input grid's order to the 
       * requested_grid_order, which will simply interpolate
       * the high-order nodes. Dealii's mesh smoothing can be set to none
-      * while using goal oriented mesh adaptation.
+      * while using goal oriented mesh adaptation. The grid is distributed
+      * over mpi_communicator.
       */
     template <int dim, int spacedim>
     std::shared_ptr< HighOrderGrid<dim, double> >
@@ -69,12 +70,13 @@ namespace PHiLiP {
               const bool mesh_reader_verbose_output,
               const bool do_renumber_dofs,
               int requested_grid_order=0,
-              const bool use_mesh_smoothing=true);
+              const bool use_mesh_smoothing=true,
+              const MPI_Comm mpi_communicator=MPI_COMM_WORLD);
 
     /// Reads Gmsh grid from file at a given requested_grid_order and use_mesh_smoothing input
     template <int dim, int spacedim>
     std::shared_ptr< HighOrderGrid<dim, double> >
-    read_gmsh(std::string filename, const bool do_renumber_dofs, int requested_grid_order=0, const bool use_mesh_smoothing=true);
+    read_gmsh(std::string filename, const bool do_renumber_dofs, int requested_grid_order=0, const bool use_mesh_smoothing=true, const MPI_Comm mpi_communicator=MPI_COMM_WORLD);
     
 } // namespace PHiLiP
 #endif
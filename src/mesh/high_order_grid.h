@@ -4,6 +4,7 @@
 #include <deal.II/base/conditional_ostream.h>
 
 #include <deal.II/grid/tria.h>
+#include <deal.II/distributed/tria_base.h>
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria.h>
 
@@ -31,6 +32,19 @@
 
 namespace PHiLiP {
 
+/// Communicator over which the triangulation is distributed.
+/** The serial triangulations used in 1D are not distributed: they are replicated on all the processes of MPI_COMM_WORLD.
+ */
+template <typename MeshType>
+MPI_Comm get_triangulation_mpi_communicator(const MeshType &triangulation)
+{
+    using ParallelTriangulation = dealii::parallel::TriangulationBase<MeshType::dimension, MeshType::space_dimension>;
+    if (const ParallelTriangulation *parallel_triangulation = dynamic_cast<const ParallelTriangulation *>(&triangulation)) {
+        return parallel_triangulation->get_communicator();
+    }
+    return MPI_COMM_WORLD;
+}
+
 // determines the associated typenames for HO grid from the meshType
 template <typename MeshType>
 class MeshTypeHelper{};
@@ -151,6 +165,18 @@ public:
     /// Ensures that hanging nodes are updated for a conforming mesh.
     void ensure_conforming_mesh();
 
+    /// Increments the volume_nodes version.
+    /** Must be called every time volume_nodes is modified outside of HighOrderGrid, such that
+     *  data depending on the node locations (e.g. the metric terms cache) is rebuilt.
+     */
+    void mark_volume_nodes_as_modified();
+
+    /// Returns the number of times volume_nodes has been modified.
+    /** Objects depending on the node locations store it and compare it with the current one
+     *  instead of comparing the nodes themselves.
+     */
+    unsigned int get_volume_nodes_version() const;
+
     /// Sets the volume_nodes to the interpolated position of the Manifold associated to the triangulation.
     void initialize_with_triangulation_manifold(const bool output_mesh = true);
 
@@ -429,6 +455,9 @@ protected:
     /// Used for the SolutionTransfer when performing grid adaptation.
     VectorType old_volume_nodes;
 
+    /// Incremented every time volume_nodes is modified. See mark_volume_nodes_as_modified().
+    unsigned int volume_nodes_version = 0;
+
     /** Transfers the coarse curved curve onto the fine curved grid.
      *  Used in prepare_for_coarsening_and_refinement() and execute_coarsening_and_refinement()
      */
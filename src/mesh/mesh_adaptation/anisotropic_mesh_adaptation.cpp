@@ -324,6 +324,7 @@ void AnisotropicMeshAdaptation<dim, nstate, real, MeshType> :: compute_goal_orie
     // Compute the adjoint ===================================================================
     VectorType adjoint(dg->solution); 
     dg->assemble_residual(true);
+    dg->update_system_matrix_transpose();
     functional->evaluate_functional(true);
     solve_linear(dg->system_matrix_transpose, functional->dIdw, adjoint, dg->all_parameters->linear_solver_param);
     adjoint *= -1.0;
@@ -292,6 +292,7 @@ dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim,
 
 
     this->dg->assemble_residual(true);
+    this->dg->update_system_matrix_transpose();
     
     AssertDimension(derivative_functional_wrt_solution.size(), adjoint_variable.size());
     AssertDimension(this->dg->system_matrix_transpose.n(), adjoint_variable.size());
@@ -16,6 +16,12 @@
 
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
+#include <Amesos.h>
+#include <ml_MultiLevelPreconditioner.h>
+#include <Teuchos_ParameterList.hpp>
+#include <Epetra_LinearProblem.h>
+#include <Epetra_MultiVector.h>
+
 #include "meshmover_linear_elasticity.hpp"
 
 namespace PHiLiP {
@@ -42,13 +48,15 @@ namespace MeshMover {
     template <int dim, typename real>
     LinearElasticity<dim,real>::LinearElasticity(
         const HighOrderGrid<dim,real> &high_order_grid,
-        const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector)
+        const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector,
+        const Parameters::MeshMoverParam &_mesh_mover_param)
       : LinearElasticity<dim,real> (
           *(high_order_grid.triangulation),
           high_order_grid.mapping_fe_field,
           high_order_grid.dof_handler_grid,
           high_order_grid.surface_to_volume_indices,
-          boundary_displacements_vector)
+          boundary_displacements_vector,
+          _mesh_mover_param)
     { }
 
     template <int dim, typename real>
@@ -57,7 +65,8 @@ namespace MeshMover {
         const std::shared_ptr<dealii::MappingFEField<dim,dim,VectorType,DoFHandlerType>> mapping_fe_field,
         const DoFHandlerType &_dof_handler,
         const dealii::LinearAlgebra::distributed::Vector<int> &_boundary_ids_vector,
-        const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector)
+        const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector,
+        const Parameters::MeshMoverParam &_mesh_mover_param)
       : triangulation(_triangulation)
       , mapping_fe_field(mapping_fe_field)
       , dof_handler(_dof_handler)
@@ -68,6 +77,7 @@ namespace MeshMover {
       , pcout(std::cout, this_mpi_process == 0)
       , boundary_ids_vector(_boundary_ids_vector)
       , boundary_displacements_vector(_boundary_displacements_vector)
+      , mesh_mover_param(_mesh_mover_param)
     { 
         AssertDimension(boundary_displacements_vector.size(), boundary_ids_vector.size());
 
@@ -356,87 +366,249 @@ namespace MeshMover {
     }
 
     template <int dim, typename real>
-    void
+    std::vector<double>
     LinearElasticity<dim,real>
-    ::apply_dXvdXvs(
-        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
-        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    ::evaluate_rigid_body_modes(unsigned int &n_modes) const
     {
-        pcout << "Applying [dXvdXs] onto a vector..." << std::endl;
-        assert(input_vector.size() == output_vector.size());
+        const unsigned int n_rotations = (dim == 3) ? 3 : dim-1;
+        n_modes = dim + n_rotations;
 
-        double input_vector_norm = input_vector.l2_norm();
-        if (input_vector_norm == 0.0) {
-            pcout << "Zero input vector. Zero output vector." << std::endl;
-            output_vector = 0.0;
-            return;
+        const unsigned int n_local_rows = locally_owned_dofs.n_elements();
+        std::vector<double> rigid_body_modes(n_modes * n_local_rows, 0.0);
+
+        const dealii::FESystem<dim> &fe_system = dof_handler.get_fe(0);
+        const dealii::Quadrature<dim> support_quadrature(fe_system.get_unit_support_points());
+        dealii::FEValues<dim> fe_values_support(*mapping_fe_field, fe_system, support_quadrature, dealii::update_quadrature_points);
+        std::vector<dealii::types::global_dof_index> local_dof_indices(fe_system.dofs_per_cell);
+
+        for (const auto &cell : dof_handler.active_cell_iterators()) {
+            if (!cell->is_locally_owned()) continue;
+
+            fe_values_support.reinit(cell);
+            cell->get_dof_indices(local_dof_indices);
+            for (unsigned int idof = 0; idof < fe_system.dofs_per_cell; ++idof) {
+                if (!locally_owned_dofs.is_element(local_dof_indices[idof])) continue;
+
+                const unsigned int irow = locally_owned_dofs.index_within_set(local_dof_indices[idof]);
+                const unsigned int component = fe_system.system_to_component_index(idof).first;
+                const dealii::Point<dim> &point = fe_values_support.quadrature_point(idof);
+
+                // Translations
+                rigid_body_modes[component*n_local_rows + irow] = 1.0;
+                // Rotations, where the rotation of the component c about the axis a is given by the
+                // cross product of e_a with the position
+                if constexpr (dim == 2) {
+                    const double rotation[2] = { -point[1], point[0] };
+                    rigid_body_modes[dim*n_local_rows + irow] = rotation[component];
+                }
+                if constexpr (dim == 3) {
+                    for (unsigned int axis = 0; axis < 3; ++axis) {
+                        const unsigned int i1 = (axis+1)%3, i2 = (axis+2)%3;
+                        double rotation = 0.0;
+                        if (component == i1) rotation = -point[i2];
+                        if (component == i2) rotation =  point[i1];
+                        rigid_body_modes[(dim+axis)*n_local_rows + irow] = rotation;
+                    }
+                }
+            }
         }
+        return rigid_body_modes;
+    }
 
-        assemble_system();
+    template <int dim, typename real>
+    std::unique_ptr<dealii::TrilinosWrappers::PreconditionBase>
+    LinearElasticity<dim,real>
+    ::build_preconditioner(const bool reused_for_multiple_vectors) const
+    {
+        if (mesh_mover_param.preconditioner == Parameters::MeshMoverParam::PreconditionerEnum::amg) {
+            unsigned int n_modes;
+            // Has to remain alive until the hierarchy is built.
+            std::vector<double> rigid_body_modes = evaluate_rigid_body_modes(n_modes);
+
+            Teuchos::ParameterList ml_parameters;
+            ML_Epetra::SetDefaults("SA", ml_parameters);
+            ml_parameters.set("ML output", 0);
+            ml_parameters.set("aggregation: threshold", mesh_mover_param.amg_aggregation_threshold);
+            ml_parameters.set("smoother: type", "Chebyshev");
+            ml_parameters.set("smoother: sweeps", static_cast<int>(mesh_mover_param.amg_smoother_sweeps));
+            ml_parameters.set("coarse: max size", 2000);
+            ml_parameters.set("PDE equations", dim);
+            ml_parameters.set("null space: type", "pre-computed");
+            ml_parameters.set("null space: dimension", static_cast<int>(n_modes));
+            ml_parameters.set("null space: vectors", rigid_body_modes.data());
+
+            auto precondition = std::make_unique<dealii::TrilinosWrappers::PreconditionAMG>();
+            precondition->initialize(system_matrix, ml_parameters);
+            return precondition;
+        }
 
+        auto precondition = std::make_unique<dealii::TrilinosWrappers::PreconditionILUT>();
+        const unsigned int ilut_fill=50;
+        const double ilut_drop = reused_for_multiple_vectors ? 0.0 : 1e-15;
+        const double ilut_atol = reused_for_multiple_vectors ? 0.0 : 1e-6;
+        const double ilut_rtol = reused_for_multiple_vectors ? 1.0 : 1.00001;
+        const unsigned int overlap=1;
+        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
+        precondition->initialize(system_matrix, precond_settings);
+        return precondition;
+    }
+
+    template <int dim, typename real>
+    unsigned int
+    LinearElasticity<dim,real>
+    ::solve_linear_system(
+        const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+        dealii::LinearAlgebra::distributed::Vector<double> &solution,
+        const dealii::TrilinosWrappers::PreconditionBase &preconditioner,
+        const bool transpose) const
+    {
         const bool log_history = (this_mpi_process == 0);
-        dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
-        //dealii::SolverControl solver_control(20000, 1e-14, log_history);
+        dealii::SolverControl solver_control(mesh_mover_param.max_iterations, mesh_mover_param.linear_residual * right_hand_side.l2_norm(), log_history);
         solver_control.log_frequency(100);
+
+        using trilinos_vector_type = VectorType;
+        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
+        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
+
+        const std::string solver_name = transpose ? "dXvdXvs_Transpose" : "dXvdXvs";
+        dealii::deallog.depth_console(2);
+        // The Dirichlet rows are cleared without eliminating the corresponding columns,
+        // such that neither the operator nor its transpose is symmetric and GMRES is used.
         const int max_n_tmp_vectors=200;
         const bool right_preconditioning=true;
         const bool use_default_residual=true;
         const bool force_re_orthogonalization=false;
         dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
         dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
+        if (transpose) {
+            const auto op_at = dealii::transpose_operator(op_a);
+            solver.solve(op_at, solution, right_hand_side, preconditioner);
+            pcout << solver_name << " Solver took " << solver_control.last_step() << " steps. "
+                  << "Residual: " << solver_control.last_value() << ". "
+                  << std::endl;
+            solver.solve(op_at, solution, right_hand_side, preconditioner);
+        } else {
+            solver.solve(op_a, solution, right_hand_side, preconditioner);
+            pcout << solver_name << " Solver took " << solver_control.last_step() << " steps. "
+                  << "Residual: " << solver_control.last_value() << ". "
+                  << std::endl;
+            solver.solve(op_a, solution, right_hand_side, preconditioner);
+        }
+        pcout << solver_name << " Solver took " << solver_control.last_step() << " steps. "
+              << "Residual: " << solver_control.last_value() << ". "
+              << std::endl;
 
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
-
-        //dealii::TrilinosWrappers::PreconditionILU  precondition;
-        //const int ilu_fill = 2;
-        //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        //precondition.initialize(system_matrix, precond_settings);
+        if (solver_control.last_check() != dealii::SolverControl::State::success) {
+            pcout << "Failed to converge." << std::endl;
+            std::abort();
+        }
+        return solver_control.last_step();
+    }
 
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=1e-15;
-        const double ilut_atol=1e-6;
-        const double ilut_rtol=1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::apply_dXvdXvs(
+        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    {
+        pcout << "Applying [dXvdXs] onto a vector..." << std::endl;
+        assert(input_vector.size() == output_vector.size());
 
+        double input_vector_norm = input_vector.l2_norm();
+        if (input_vector_norm == 0.0) {
+            pcout << "Zero input vector. Zero output vector." << std::endl;
+            output_vector = 0.0;
+            return;
+        }
 
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
+        assemble_system();
 
-        using trilinos_vector_type = dealii::LinearAlgebra::distributed::Vector<double>;
-        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
+        const std::unique_ptr<dealii::TrilinosWrappers::PreconditionBase> precondition = build_preconditioner();
 
-        const auto &rhs_vector = input_vector;
         output_vector = input_vector;
-        //output_vector = 0.0;//input_vector;
+        const bool transpose = false;
+        solve_linear_system(input_vector, output_vector, *precondition, transpose);
+    }
 
-        // Solve modified system.
-        dealii::deallog.depth_console(2);
-        solver.solve(op_a, output_vector, rhs_vector, precondition);
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::apply_dXvdXvs(
+        const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors,
+        dealii::FullMatrix<double> &output_block)
+    {
+        const unsigned int n_local_rows = locally_owned_dofs.n_elements();
+        const unsigned int n_cols = list_of_vectors.size();
+        output_block.reinit(n_local_rows, n_cols);
+        if (n_cols == 0) return;
 
-        pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
+        assemble_system();
 
-        solver.solve(op_a, output_vector, rhs_vector, precondition);
+        // The direct factorization does not scale to large 3D meshes, such that the AMG preconditioner always
+        // uses the Krylov solver. KLU gathers the whole system on a single process and has to be requested.
+        std::string solver_type;
+        Amesos amesos_factory;
+        if (mesh_mover_param.preconditioner != Parameters::MeshMoverParam::PreconditionerEnum::amg) {
+            if (amesos_factory.Query("Amesos_Mumps")) solver_type = "Amesos_Mumps";
+            else if (amesos_factory.Query("Amesos_Superludist")) solver_type = "Amesos_Superludist";
+            else if (mesh_mover_param.use_serial_direct_solver && amesos_factory.Query("Amesos_Klu")) solver_type = "Amesos_Klu";
+        }
 
-        pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
+        if (solver_type.empty()) {
+            // The preconditioner is built once and reused by every Krylov solve.
+            pcout << "Applying [dXvdXs] onto " << n_cols << " vectors with a single preconditioner..." << std::endl;
+            const bool reused_for_multiple_vectors = true;
+            const std::unique_ptr<dealii::TrilinosWrappers::PreconditionBase> precondition = build_preconditioner(reused_for_multiple_vectors);
+            dealii::LinearAlgebra::distributed::Vector<double> output_vector;
+            for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
+                const dealii::LinearAlgebra::distributed::Vector<double> &input_vector = list_of_vectors[i_col];
+                output_vector = input_vector;
+                if (input_vector.l2_norm() == 0.0) {
+                    output_vector = 0.0;
+                } else {
+                    const bool transpose = false;
+                    solve_linear_system(input_vector, output_vector, *precondition, transpose);
+                }
+                for (unsigned int i_row = 0; i_row < n_local_rows; ++i_row) {
+                    output_block(i_row, i_col) = output_vector.local_element(i_row);
+                }
+            }
+            return;
+        }
 
-        if (solver_control.last_check() != dealii::SolverControl::State::success) {
-            pcout << "Failed to converge." << std::endl;
+        pcout << "Applying [dXvdXs] onto " << n_cols << " vectors with a single " << solver_type << " factorization..." << std::endl;
+
+        // Every right-hand side shares the same operator, such that the sparse LU factorization
+        // is computed once and all the columns are solved together.
+        const Epetra_CrsMatrix &epetra_matrix = system_matrix.trilinos_matrix();
+        Epetra_MultiVector epetra_rhs(epetra_matrix.RangeMap(), n_cols);
+        Epetra_MultiVector epetra_solution(epetra_matrix.DomainMap(), n_cols);
+        for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
+            const dealii::LinearAlgebra::distributed::Vector<double> &input_vector = list_of_vectors[i_col];
+            for (unsigned int i_row = 0; i_row < n_local_rows; ++i_row) {
+                epetra_rhs[i_col][i_row] = input_vector.local_element(i_row);
+            }
+        }
+
+        Epetra_LinearProblem linear_problem(const_cast<Epetra_CrsMatrix *>(&epetra_matrix), &epetra_solution, &epetra_rhs);
+        std::unique_ptr<Amesos_BaseSolver> direct_solver(amesos_factory.Create(solver_type, linear_problem));
+
+        int ierr = direct_solver->SymbolicFactorization();
+        if (ierr == 0) ierr = direct_solver->NumericFactorization();
+        if (ierr == 0) ierr = direct_solver->Solve();
+        if (ierr != 0) {
+            pcout << "dXvdXvs " << solver_type << " solver failed with error code " << ierr << "." << std::endl;
             std::abort();
         }
+
+        for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
+            const double * const solution_column = epetra_solution[i_col];
+            for (unsigned int i_row = 0; i_row < n_local_rows; ++i_row) {
+                output_block(i_row, i_col) = solution_column[i_row];
+            }
+        }
+        pcout << "dXvdXvs " << solver_type << " solved " << n_cols << " right-hand sides." << std::endl;
     }
 
     template <int dim, typename real>
@@ -446,11 +618,11 @@ namespace MeshMover {
         std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors,
         dealii::TrilinosWrappers::SparseMatrix &output_matrix)
     {
-        assemble_system();
+        dealii::FullMatrix<double> output_block;
+        apply_dXvdXvs(list_of_vectors, output_block);
 
         const unsigned int n_rows = dof_handler.n_dofs();
         const unsigned int n_cols = list_of_vectors.size();
-        //const unsigned int max_per_row = n_cols;
 
         const dealii::IndexSet &row_part = dof_handler.locally_owned_dofs();
         dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
@@ -470,87 +642,14 @@ namespace MeshMover {
 
         output_matrix.reinit(row_part, col_part, full_sp, mpi_communicator);
 
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
-
-        //dealii::TrilinosWrappers::PreconditionILU  precondition;
-        //const int ilu_fill = 2;
-        //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        //precondition.initialize(system_matrix, precond_settings);
-
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=0.0;//1e-15;
-        const double ilut_atol=0.0;//1e-6;
-        const double ilut_rtol=1.0;//1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
-
-
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
-
-        using trilinos_vector_type = dealii::LinearAlgebra::distributed::Vector<double>;
-        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
-
-        dXvdXs.clear();
-        pcout << "Applying for [dXvdXs] onto " << list_of_vectors.size() << " vectors..." << std::endl;
-
-        unsigned int col = 0;
-        dealii::LinearAlgebra::distributed::Vector<double> output_vector;
-        output_vector.reinit(list_of_vectors[0]);
-        for (auto &input_vector: list_of_vectors) {
-
-            pcout << " Vector " << col << " out of " << list_of_vectors.size() << std::endl;
-
-            dealii::deallog.depth_console(0);
-
-            double input_vector_norm = input_vector.l2_norm();
-            if (input_vector_norm == 0.0) {
-                pcout << "Zero input vector. Zero output vector." << std::endl;
-                output_vector = 0.0;
-            } else {
-                const bool log_history = (this_mpi_process == 0);
-                dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
-                //dealii::SolverControl solver_control(20000, 1e-14, log_history);
-                solver_control.log_frequency(100);
-                const int max_n_tmp_vectors=200;
-                const bool right_preconditioning=true;
-                const bool use_default_residual=true;
-                const bool force_re_orthogonalization=false;
-                dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
-                dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
-
-                //dealii::SolverBicgstab<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control);
-
-                dealii::deallog.depth_console(2);
-                solver.solve(op_a, output_vector, input_vector, precondition);
-                pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-                      << "Residual: " << solver_control.last_value() << ". "
-                      << std::endl;
-
-                solver.solve(op_a, output_vector, input_vector, precondition);
-                pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-                      << "Residual: " << solver_control.last_value() << ". "
-                      << std::endl;
-            }
-
-            dXvdXs.push_back(output_vector);
-
-            for (const auto &row: dof_handler.locally_owned_dofs()) {
-                output_matrix.set(row, col, dXvdXs[col][row]);
-            }
-            col++;
+        // Rows of the dense block are contiguous and inserted at once.
+        std::vector<dealii::types::global_dof_index> col_indices(n_cols);
+        for (unsigned int i_col = 0; i_col < n_cols; ++i_col) col_indices[i_col] = i_col;
+        for (unsigned int i_row = 0; n_cols > 0 && i_row < output_block.m(); ++i_row) {
+            const dealii::types::global_dof_index row = row_part.nth_index_in_set(i_row);
+            output_matrix.set(row, n_cols, col_indices.data(), &output_block(i_row,0), false);
         }
         output_matrix.compress(dealii::VectorOperation::insert);
-
     }
 
     template <int dim, typename real>
@@ -571,64 +670,11 @@ namespace MeshMover {
 
         assemble_system();
 
-        const bool log_history = (this_mpi_process == 0);
-        dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
-        //dealii::SolverControl solver_control(20000, 1e-14, log_history);
-        solver_control.log_frequency(100);
-        const int max_n_tmp_vectors=200;
-        const bool right_preconditioning=true;
-        const bool use_default_residual=true;
-        const bool force_re_orthogonalization=false;
-        dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
-        dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
-
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
-
-        // dealii::TrilinosWrappers::PreconditionILU  precondition;
-        // const int ilu_fill = 2;
-        // dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        // precondition.initialize(system_matrix, precond_settings);
-
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=1e-15;
-        const double ilut_atol=1e-6;
-        const double ilut_rtol=1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
-
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
+        const std::unique_ptr<dealii::TrilinosWrappers::PreconditionBase> precondition = build_preconditioner();
 
-        using trilinos_vector_type = VectorType;
-        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
-        const auto op_at = dealii::transpose_operator(op_a);
-
-        // Solve system.
-        dealii::deallog.depth_console(2);
         output_vector = input_vector;
-        solver.solve(op_at, output_vector, input_vector, precondition);
-        pcout << "dXvdXvs_Transpose Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
-        solver.solve(op_at, output_vector, input_vector, precondition);
-        pcout << "dXvdXvs_Transpose Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
-        if (solver_control.last_check() != dealii::SolverControl::State::success) {
-            pcout << "Failed to converge." << std::endl;
-            std::abort();
-        }
-
-
+        const bool transpose = true;
+        solve_linear_system(input_vector, output_vector, *precondition, transpose);
     }
 
     // template <int dim, typename real>
@@ -902,8 +948,19 @@ namespace MeshMover {
 
             unit_rhs_vector.push_back(unit_rhs);
         }
-        dealii::TrilinosWrappers::SparseMatrix dXvdXs_matrix;
-        apply_dXvdXvs(unit_rhs_vector, dXvdXs_matrix);
+        dealii::FullMatrix<double> dXvdXs_block;
+        apply_dXvdXvs(unit_rhs_vector, dXvdXs_block);
+
+        const unsigned int n_local_rows = dXvdXs_block.m();
+        for (unsigned int iconstraint = 0; iconstraint < n_dirichlet_constraints; iconstraint++) {
+            dealii::LinearAlgebra::distributed::Vector<double> dXvdXs_i;
+            dXvdXs_i.reinit(system_rhs);
+            for (unsigned int i_row = 0; i_row < n_local_rows; ++i_row) {
+                dXvdXs_i.local_element(i_row) = dXvdXs_block(i_row, iconstraint);
+            }
+            dXvdXs_i.update_ghost_values();
+            dXvdXs.push_back(dXvdXs_i);
+        }
     }
 
     // template <int dim, typename real>
@@ -1,6 +1,8 @@
 #ifndef __MESHMOVER_LINEAR_ELASTICITY_H__
 #define __MESHMOVER_LINEAR_ELASTICITY_H__
 
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
 #include "parameters/all_parameters.h"
@@ -40,12 +42,14 @@ namespace MeshMover
             const std::shared_ptr<dealii::MappingFEField<dim,dim,VectorType,DoFHandlerType>> mapping_fe_field,
             const DoFHandlerType &_dof_handler,
             const dealii::LinearAlgebra::distributed::Vector<int> &_boundary_ids_vector,
-            const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector);
+            const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector,
+            const Parameters::MeshMoverParam &_mesh_mover_param = Parameters::MeshMoverParam());
 
         /// Constructor that uses information from HighOrderGrid and uses current volume_nodes from HighOrderGrid.
         LinearElasticity(
             const HighOrderGrid<dim,real> &high_order_grid,
-   const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector);
+   const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector,
+            const Parameters::MeshMoverParam &_mesh_mover_param = Parameters::MeshMoverParam());
 
         /** Evaluate and return volume displacements given boundary displacements.
          */
@@ -66,6 +70,18 @@ namespace MeshMover
         void
         apply_dXvdXvs(std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors, dealii::TrilinosWrappers::SparseMatrix &output_matrix);
 
+        /** Apply the analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a set of various right-hand sides.
+         *  If Trilinos provides a parallel direct solver (MUMPS or SuperLU_DIST), the system is assembled
+         *  and factored once, and all the right-hand sides are solved together as a single multi-vector.
+         *  The serial KLU factorization is only used if use_serial_direct_solver is set.
+         *  Otherwise, or with the AMG preconditioner, the preconditioner is built once and reused by each Krylov solve.
+         *  The result is stored as a dense block of size n_locally_owned_dofs x n_vectors,
+         *  where the i-th row corresponds to the i-th locally owned volume node DoF.
+         */
+        void
+        apply_dXvdXvs(const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors, dealii::FullMatrix<double> &output_block);
+
         /** Apply the analytical derivatives of volume displacements with respect
          *  to surface displacements onto a set of various right-hand sides.
          *  Note that the right-hand-side is of size n_volume_nodes.
@@ -126,6 +142,29 @@ namespace MeshMover
          */
         unsigned int solve_linear_problem();
 
+        /** Builds the preconditioner of the mesh mover parameters for the current system matrix.
+         *  The AMG hierarchy uses the rigid body modes of the volume nodes as near-null space.
+         *  The ILUT reused by the solves of several right-hand sides, in apply_dXvdXvs(), keeps its previous
+         *  settings without drop tolerance nor diagonal perturbation.
+         */
+        std::unique_ptr<dealii::TrilinosWrappers::PreconditionBase> build_preconditioner(const bool reused_for_multiple_vectors = false) const;
+
+        /** Evaluates the rigid body modes at the locally owned volume node DoFs.
+         *  The dim translations are followed by the rotations, and the modes are stored one
+         *  after the other, each of size n_locally_owned_dofs.
+         */
+        std::vector<double> evaluate_rigid_body_modes(unsigned int &n_modes) const;
+
+        /** Solves the system, or its transpose, with GMRES and the given preconditioner.
+         *  The solution is used as the initial guess.
+         *  Returns the number of iterations.
+         */
+        unsigned int solve_linear_system(
+            const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+            dealii::LinearAlgebra::distributed::Vector<double> &solution,
+            const dealii::TrilinosWrappers::PreconditionBase &preconditioner,
+            const bool transpose) const;
+
         const Triangulation &triangulation; ///< Triangulation on which this acts.
         /// MappingFEField corresponding to curved mesh.
         const std::shared_ptr<dealii::MappingFEField<dim,dim,VectorType,DoFHandlerType>> mapping_fe_field;
@@ -174,6 +213,9 @@ namespace MeshMover
          */
         const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector;
 
+        /// Linear solver and preconditioner settings.
+        const Parameters::MeshMoverParam mesh_mover_param;
+
         /** Transforms a std::vector<Tensor> into the corresponding distributed vector.
          */
         dealii::LinearAlgebra::distributed::Vector<double> tensor_to_vector(const std::vector<dealii::Tensor<1,dim,real>> &boundary_displacements_tensors) const;
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 #include "explicit_ode_solver.h"
+#include "profiling/performance_profiler.h"
 //#include "runge_kutta_ode_solve.h"
 
 namespace PHiLiP {
@@ -77,6 +82,7 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::step_in_time (real dt,
         if(this->all_parameters->use_inverse_mass_on_the_fly){
             this->dg->apply_inverse_global_mass_matrix(this->dg->right_hand_side, this->rk_stage[i]); //rk_stage[i] = IMM*RHS = F(u_n + dt*sum(a_ij*k_j))
         } else{
+            Profiling::ScopedTimer inverse_mass_timer("inverse_mass_application");
             this->dg->global_inverse_mass_matrix.vmult(this->rk_stage[i], this->dg->right_hand_side); //rk_stage[i] = IMM*RHS = F(u_n + dt*sum(a_ij*k_j))
         }
     }
@@ -85,13 +91,17 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::step_in_time (real dt,
     this->modified_time_step = dt;
 
     //assemble solution from stages
-    for (int i = 0; i < n_rk_stages; ++i){
-        if (pseudotime){
-            const double CFL = this->butcher_tableau->get_b(i) * dt;
-            this->dg->time_scale_solution_update(this->rk_stage[i], CFL);
-            this->solution_update.add(1.0, this->rk_stage[i]);
-        } else {
-            this->solution_update.add(dt* this->butcher_tableau->get_b(i),this->rk_stage[i]); 
+    if (!pseudotime && this->butcher_tableau->has_embedded_method()) {
+        assemble_solution_and_embedded_error(dt);
+    } else {
+        for (int i = 0; i < n_rk_stages; ++i){
+            if (pseudotime){
+                const double CFL = this->butcher_tableau->get_b(i) * dt;
+                this->dg->time_scale_solution_update(this->rk_stage[i], CFL);
+                this->solution_update.add(1.0, this->rk_stage[i]);
+            } else {
+                this->solution_update.add(dt* this->butcher_tableau->get_b(i),this->rk_stage[i]); 
+            }
         }
     }
     this->dg->solution = this->solution_update; // u_np1 = u_n + dt* sum(k_i * b_i)
@@ -100,6 +110,39 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::step_in_time (real dt,
     this->current_time += dt;
 }
 
+template <int dim, typename real, int n_rk_stages, typename MeshType> 
+void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::assemble_solution_and_embedded_error (const real dt)
+{
+    const double atol = this->ode_param.embedded_error_absolute_tolerance;
+    const double rtol = this->ode_param.embedded_error_relative_tolerance;
+
+    std::array<double,n_rk_stages> b, b_minus_b_hat;
+    std::array<const double *,n_rk_stages> stage;
+    for (int i = 0; i < n_rk_stages; ++i){
+        b[i] = dt * this->butcher_tableau->get_b(i);
+        b_minus_b_hat[i] = dt * (this->butcher_tableau->get_b(i) - this->butcher_tableau->get_b_hat(i));
+        stage[i] = this->rk_stage[i].begin();
+    }
+
+    // Single sweep computing u_np1 = u_n + dt * sum(b_i * k_i) and the scaled error dt * sum((b_i - b_hat_i) * k_i)
+    double * const solution = this->solution_update.begin();
+    const unsigned int n_local_dofs = this->solution_update.locally_owned_elements().n_elements();
+    double local_error_squared = 0.0;
+    for (unsigned int idof = 0; idof < n_local_dofs; ++idof){
+        double update = 0.0, error = 0.0;
+        for (int i = 0; i < n_rk_stages; ++i){
+            update += b[i] * stage[i][idof];
+            error += b_minus_b_hat[i] * stage[i][idof];
+        }
+        const double old_value = solution[idof];
+        solution[idof] = old_value + update;
+        const double scale = atol + rtol * std::max(std::abs(old_value), std::abs(solution[idof]));
+        local_error_squared += (error / scale) * (error / scale);
+    }
+    const double error_squared = dealii::Utilities::MPI::sum(local_error_squared, this->mpi_communicator);
+    this->embedded_error_norm = std::sqrt(error_squared / this->solution_update.size());
+}
+
 template <int dim, typename real, int n_rk_stages, typename MeshType> 
 void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::modify_time_step(real &/*dt*/)
 {
@@ -137,15 +180,18 @@ template class RungeKuttaODESolver<PHILIP_DIM, double,1, dealii::Triangulation<P
 template class RungeKuttaODESolver<PHILIP_DIM, double,2, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,3, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,4, dealii::Triangulation<PHILIP_DIM> >;
+template class RungeKuttaODESolver<PHILIP_DIM, double,7, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,1, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,2, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,3, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,4, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+template class RungeKuttaODESolver<PHILIP_DIM, double,7, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 #if PHILIP_DIM != 1
     template class RungeKuttaODESolver<PHILIP_DIM, double,1, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
     template class RungeKuttaODESolver<PHILIP_DIM, double,2, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
     template class RungeKuttaODESolver<PHILIP_DIM, double,3, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
     template class RungeKuttaODESolver<PHILIP_DIM, double,4, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+    template class RungeKuttaODESolver<PHILIP_DIM, double,7, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
 #endif
 
 } // ODESolver namespace
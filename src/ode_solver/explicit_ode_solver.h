@@ -40,6 +40,10 @@ protected:
     /// Storage for the derivative at each Runge-Kutta stage
     std::vector<dealii::LinearAlgebra::distributed::Vector<double>> rk_stage;
     
+    /// Assembles u_np1 from the stages and evaluates the embedded error norm in the same sweep
+    /** Only used in physical time by methods with embedded weights. */
+    void assemble_solution_and_embedded_error(const real dt);
+
     /// Modify timestep
     virtual void modify_time_step(real &dt); 
 
@@ -1,3 +1,7 @@
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/trilinos_precondition.h>
+
 #include "implicit_ode_solver.h"
 
 
@@ -7,11 +11,33 @@ namespace ODE {
 template <int dim, typename real, typename MeshType>
 ImplicitODESolver<dim,real,MeshType>::ImplicitODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
         : ODESolverBase<dim,real,MeshType>(dg_input)
+        , matrix_free_system(dg_input)
+        , n_steps_since_jacobian_update(0)
+        , n_dofs_at_jacobian_update(0)
+        , solution_changed_since_jacobian_update(true)
+        , residual_ratio_of_previous_step(-1.0)
+        , mass_scaling_in_system_matrix(0.0)
         {}
 
 template <int dim, typename real, typename MeshType>
 void ImplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
 {
+    if (this->all_parameters->linear_solver_param.matrix_free_jacobian) {
+        this->current_time += dt;
+        solve_matrix_free_linearized_system(dt, pseudotime);
+
+        linesearch();
+
+        this->update_norm = this->solution_update.l2_norm();
+        ++(this->current_iteration);
+        return;
+    }
+
+    if (this->ode_param.jacobian_update_frequency > 1) {
+        step_in_time_with_lagged_jacobian(dt, pseudotime);
+        return;
+    }
+
     const bool compute_dRdW = true;
     this->dg->assemble_residual(compute_dRdW);
     this->current_time += dt;
@@ -45,6 +71,150 @@ void ImplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pse
     ++(this->current_iteration);
 }
 
+template <int dim, typename real, typename MeshType>
+void ImplicitODESolver<dim,real,MeshType>::step_in_time_with_lagged_jacobian (real dt, const bool pseudotime)
+{
+    // The residual is assembled once, together with the Jacobian when it is updated.
+    const bool update_jacobian = jacobian_update_is_needed();
+    const bool compute_dRdW = update_jacobian;
+    this->dg->assemble_residual(compute_dRdW);
+    this->current_time += dt;
+
+    if (update_jacobian) {
+        this->dg->system_matrix *= -1.0;
+        n_dofs_at_jacobian_update = this->dg->solution.size();
+        solution_changed_since_jacobian_update = false;
+        n_steps_since_jacobian_update = 0;
+    } else {
+        // Only the mass matrix term of the lagged system changes with the time step.
+        if (pseudotime) {
+            this->dg->system_matrix.add(-1.0, this->dg->time_scaled_global_mass_matrix);
+        } else {
+            this->dg->system_matrix.add(-mass_scaling_in_system_matrix, this->dg->global_mass_matrix);
+        }
+        this->dg->mark_system_matrix_as_modified();
+    }
+    ++n_steps_since_jacobian_update;
+
+    // Solve (M/dt - dRdW) dw = R
+    if (pseudotime) {
+        const double CFL = dt;
+        this->dg->time_scaled_mass_matrices(CFL);
+        this->dg->add_time_scaled_mass_matrices();
+    } else {
+        mass_scaling_in_system_matrix = 1.0/dt;
+        this->dg->add_mass_matrices(mass_scaling_in_system_matrix);
+    }
+
+    const Parameters::LinearSolverParam &param = this->all_parameters->linear_solver_param;
+    using LinearSolverEnum = Parameters::LinearSolverParam::LinearSolverEnum;
+    using PreconditionerEnum = Parameters::LinearSolverParam::PreconditionerEnum;
+    if (param.linear_solver_type == LinearSolverEnum::gmres && update_jacobian) {
+        // The factorization is computed on the system of the current step and kept until the next update.
+        if (param.preconditioner == PreconditionerEnum::ilut) {
+            const unsigned int overlap = 1;
+            if (param.ilut_fill < 1) {
+                using AdditionalData = dealii::TrilinosWrappers::PreconditionILU::AdditionalData;
+                auto ilu_preconditioner = std::make_shared<dealii::TrilinosWrappers::PreconditionILU>();
+                ilu_preconditioner->initialize(this->dg->system_matrix, AdditionalData(std::abs(param.ilut_fill), param.ilut_atol, param.ilut_rtol, overlap));
+                trilinos_preconditioner = ilu_preconditioner;
+            } else {
+                using AdditionalData = dealii::TrilinosWrappers::PreconditionILUT::AdditionalData;
+                auto ilut_preconditioner = std::make_shared<dealii::TrilinosWrappers::PreconditionILUT>();
+                ilut_preconditioner->initialize(this->dg->system_matrix, AdditionalData(param.ilut_drop, param.ilut_fill, param.ilut_atol, param.ilut_rtol, overlap));
+                trilinos_preconditioner = ilut_preconditioner;
+            }
+        } else {
+            block_preconditioner = std::make_unique<BlockPreconditioner>(param.preconditioner);
+            block_preconditioner->initialize(this->dg->system_matrix);
+        }
+    }
+
+    if ((this->ode_param.ode_output) == Parameters::OutputEnum::verbose &&
+        (this->current_iteration%this->ode_param.print_iteration_modulo) == 0 ) {
+        this->pcout << " Evaluating system update with the Jacobian of " << n_steps_since_jacobian_update - 1 << " steps ago... " << std::endl;
+    }
+
+    if (param.linear_solver_type != LinearSolverEnum::gmres) {
+        solve_linear (this->dg->system_matrix, this->dg->right_hand_side, this->solution_update, param);
+    } else if (param.preconditioner == PreconditionerEnum::ilut) {
+        solve_linear_preconditioned (this->dg->system_matrix, this->dg->right_hand_side, this->solution_update, param, *trilinos_preconditioner);
+    } else {
+        solve_linear_preconditioned (this->dg->system_matrix, this->dg->right_hand_side, this->solution_update, param, *block_preconditioner);
+    }
+
+    linesearch();
+
+    this->update_norm = this->solution_update.l2_norm();
+    ++(this->current_iteration);
+}
+
+template <int dim, typename real, typename MeshType>
+bool ImplicitODESolver<dim,real,MeshType>::jacobian_update_is_needed () const
+{
+    // First step, or the DG system was reallocated since the last update.
+    if (n_dofs_at_jacobian_update != this->dg->solution.size()) return true;
+
+    // The lagged Jacobian is already the Jacobian at this solution, e.g. after a failed line search.
+    if (!solution_changed_since_jacobian_update) return false;
+
+    if (n_steps_since_jacobian_update >= this->ode_param.jacobian_update_frequency) return true;
+
+    if (residual_ratio_of_previous_step > this->ode_param.residual_ratio_for_jacobian_update) {
+        this->pcout << " Residual norm only decreased by a ratio of " << residual_ratio_of_previous_step << ". Updating the Jacobian..." << std::endl;
+        return true;
+    }
+    return false;
+}
+
+template <int dim, typename real, typename MeshType>
+void ImplicitODESolver<dim,real,MeshType>::solve_matrix_free_linearized_system (real dt, const bool pseudotime)
+{
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+    const Parameters::LinearSolverParam &param = this->all_parameters->linear_solver_param;
+
+    // The block preconditioner is lagged in the same way as the assembled Jacobian.
+    bool update_preconditioner = true;
+    if (this->ode_param.jacobian_update_frequency > 1) {
+        update_preconditioner = jacobian_update_is_needed();
+        if (update_preconditioner) {
+            n_dofs_at_jacobian_update = this->dg->solution.size();
+            solution_changed_since_jacobian_update = false;
+            n_steps_since_jacobian_update = 0;
+        } else {
+            this->dg->assemble_residual();
+        }
+        ++n_steps_since_jacobian_update;
+    }
+
+    // Assembling the preconditioner also evaluates the right_hand_side at the current solution.
+    matrix_free_system.reinit(dt, pseudotime, update_preconditioner);
+
+    if ((this->ode_param.ode_output) == Parameters::OutputEnum::verbose &&
+        (this->current_iteration%this->ode_param.print_iteration_modulo) == 0 ) {
+        this->pcout << " Evaluating matrix-free system update... " << std::endl;
+    }
+
+    // Solver convergence settings, as in solve_linear().
+    const double rhs_norm = this->dg->right_hand_side.l2_norm();
+    const double linear_residual_tolerance = param.linear_residual * rhs_norm;
+    const bool log_history = (param.linear_solver_output == Parameters::OutputEnum::verbose);
+    const bool log_result = true;
+    dealii::SolverControl solver_control(param.max_iterations, linear_residual_tolerance, log_history, log_result);
+
+    typename dealii::SolverGMRES<VectorType>::AdditionalData add_data_gmres(param.restart_number);
+    dealii::SolverGMRES<VectorType> solver_gmres(solver_control, add_data_gmres);
+
+    this->solution_update = 0.0;
+    try {
+        solver_gmres.solve(matrix_free_system, this->solution_update, this->dg->right_hand_side, matrix_free_system.get_preconditioner());
+    } catch (const dealii::SolverControl::NoConvergence &) {
+        // The line search handles inexact updates, as with the assembled Jacobian.
+        this->pcout << " Matrix-free GMRES did not converge in " << solver_control.last_step()
+                    << " iterations. Linear residual: " << solver_control.last_value() << std::endl;
+    }
+}
+
 template <int dim, typename real, typename MeshType>
 double ImplicitODESolver<dim,real,MeshType>::linesearch ()
 {
@@ -136,6 +306,10 @@ double ImplicitODESolver<dim,real,MeshType>::linesearch ()
         this->pcout << " Resetting solution and reducing CFL_factor by : " << this->CFL_factor << std::endl;
         this->dg->solution = old_solution;
         this->CFL_factor *= 0.5;
+    } else {
+        // Used by the lagged Jacobian to detect a stalled residual.
+        solution_changed_since_jacobian_update = true;
+        residual_ratio_of_previous_step = new_residual / initial_residual;
     }
 
     return step_length;
@@ -1,8 +1,12 @@
 #ifndef __IMPLICIT_ODESOLVER__
 #define __IMPLICIT_ODESOLVER__
 
+#include <deal.II/lac/trilinos_precondition.h>
+
 #include "dg/dg_base.hpp"
+#include "linear_solver/block_preconditioner.h"
 #include "linear_solver/linear_solver.h"
+#include "matrix_free_implicit_system.h"
 #include "ode_solver_base.h"
 
 namespace PHiLiP {
@@ -25,6 +29,13 @@ namespace ODE {
  *      \frac{\mathbf{u}^{n+1} - \mathbf{u}^{n}}{\Delta t} = \mathbf{R}(\mathbf{u}^{n}) +
  *      \left. \frac{\partial \mathbf{R}}{\partial \mathbf{u}} \right|_{\mathbf{u}^{n}} (\mathbf{u}^{n+1} - \mathbf{u}^{n})
  *  \f]
+ *
+ *  If matrix_free_jacobian is set in the linear solver parameters, the linearized system is solved
+ *  with GMRES through MatrixFreeImplicitSystem instead of assembling the Jacobian.
+ *
+ *  If jacobian_update_frequency is larger than one, the Jacobian and the preconditioner are only updated
+ *  every jacobian_update_frequency steps, or when the residual stalls. In between, the linear system uses
+ *  the lagged Jacobian with the mass matrix of the current time step.
  */
 #if PHILIP_DIM==1
 template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
@@ -46,6 +57,43 @@ public:
     /// Line search algorithm
     double linesearch ();
 
+protected:
+    /// Solves the linearized system for the solution_update without assembling the Jacobian.
+    void solve_matrix_free_linearized_system (real dt, const bool pseudotime);
+
+    /// Steps in time with a Jacobian and a preconditioner updated every jacobian_update_frequency steps.
+    void step_in_time_with_lagged_jacobian (real dt, const bool pseudotime);
+
+    /// Whether the lagged Jacobian must be updated at the current solution.
+    /** Only uses the step counters and the residual norms recorded by the previous line search,
+     *  such that the residual is not evaluated before the decision.
+     */
+    bool jacobian_update_is_needed () const;
+
+    /// Linearized system used when the Jacobian is not assembled.
+    MatrixFreeImplicitSystem<dim,real,MeshType> matrix_free_system;
+
+    /// Number of steps performed with the current Jacobian.
+    unsigned int n_steps_since_jacobian_update;
+
+    /// Number of degrees of freedom when the lagged Jacobian was assembled, zero if it never was.
+    dealii::types::global_dof_index n_dofs_at_jacobian_update;
+
+    /// Whether a line search has modified the solution since the lagged Jacobian was assembled.
+    bool solution_changed_since_jacobian_update;
+
+    /// Ratio of the residual norms after and before the last accepted line search.
+    double residual_ratio_of_previous_step;
+
+    /// Scaling of the mass matrix added to the lagged system_matrix, for physical time steps.
+    double mass_scaling_in_system_matrix;
+
+    /// Lagged ILU preconditioner.
+    std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> trilinos_preconditioner;
+
+    /// Lagged element-block preconditioner.
+    std::unique_ptr<BlockPreconditioner> block_preconditioner;
+
 };
 
 } // ODE namespace
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cmath>
+
+#include "low_storage_runge_kutta_ode_solver.h"
+#include "profiling/performance_profiler.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+LowStorageRungeKuttaODESolver<dim,real,MeshType>::LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+        std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> rk_tableau_input)
+        : ODESolverBase<dim,real,MeshType>(dg_input)
+        , low_storage_tableau(rk_tableau_input)
+        , use_storage_register(true)
+{}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
+{
+    this->original_time_step = dt;
+
+    using FormEnum = typename LowStorageRKTableauBase<dim,real,MeshType>::LowStorageFormEnum;
+    if (low_storage_tableau->low_storage_form == FormEnum::williamson_2N) {
+        step_in_time_2N(dt, pseudotime);
+    } else {
+        step_in_time_3Sstar(dt, pseudotime);
+    }
+    this->dg->solution.update_ghost_values();
+
+    this->modified_time_step = dt;
+    ++(this->current_iteration);
+    this->current_time += dt;
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::step_in_time_2N (const real dt, const bool pseudotime)
+{
+    // In pseudotime, the local time steps are already applied to the stage derivative
+    const double dt_scaling = pseudotime ? 1.0 : dt;
+    const unsigned int n_local_dofs = this->dg->solution.locally_owned_elements().n_elements();
+
+    for (int istage = 0; istage < low_storage_tableau->n_rk_stages; ++istage) {
+        evaluate_stage_derivative(istage, dt, pseudotime);
+
+        const double A = low_storage_tableau->get_A(istage);
+        const double B = low_storage_tableau->get_B(istage);
+        double * const solution = this->dg->solution.begin();
+        double * const S2 = storage_register.begin();
+        const double * const derivative = stage_derivative.begin();
+
+        if (A == 0.0) {
+            // First stage, the register is not read such that it does not need to be reset
+            for (unsigned int i = 0; i < n_local_dofs; ++i) {
+                S2[i] = dt_scaling * derivative[i];
+                solution[i] += B * S2[i];
+            }
+        } else {
+            for (unsigned int i = 0; i < n_local_dofs; ++i) {
+                S2[i] = A * S2[i] + dt_scaling * derivative[i];
+                solution[i] += B * S2[i];
+            }
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::step_in_time_3Sstar (const real dt, const bool pseudotime)
+{
+    const double dt_scaling = pseudotime ? 1.0 : dt;
+    const int n_rk_stages = low_storage_tableau->n_rk_stages;
+    const unsigned int n_local_dofs = this->dg->solution.locally_owned_elements().n_elements();
+
+    previous_solution.copy_locally_owned_data_from(this->dg->solution); // S3 = u_n
+    if (use_storage_register) storage_register = 0.0;
+
+    for (int istage = 0; istage < n_rk_stages; ++istage) {
+        evaluate_stage_derivative(istage, dt, pseudotime);
+
+        const double gamma0 = low_storage_tableau->get_gamma(istage,0);
+        const double gamma1 = low_storage_tableau->get_gamma(istage,1);
+        const double gamma2 = low_storage_tableau->get_gamma(istage,2);
+        const double beta_dt = low_storage_tableau->get_beta(istage) * dt_scaling;
+        const double delta = low_storage_tableau->get_delta(istage);
+        double * const solution = this->dg->solution.begin();
+        const double * const S3 = previous_solution.begin();
+        const double * const derivative = stage_derivative.begin();
+
+        if (use_storage_register) {
+            double * const S2 = storage_register.begin();
+            for (unsigned int i = 0; i < n_local_dofs; ++i) {
+                S2[i] += delta * solution[i];
+                solution[i] = gamma0 * solution[i] + gamma1 * S2[i] + gamma2 * S3[i] + beta_dt * derivative[i];
+            }
+        } else {
+            for (unsigned int i = 0; i < n_local_dofs; ++i) {
+                solution[i] = gamma0 * solution[i] + gamma2 * S3[i] + beta_dt * derivative[i];
+            }
+        }
+    }
+
+    if (low_storage_tableau->has_embedded_method) {
+        double delta_sum = 0.0;
+        for (int i = 0; i < n_rk_stages+2; ++i) delta_sum += low_storage_tableau->get_delta(i);
+        const double delta_solution = low_storage_tableau->get_delta(n_rk_stages);
+        const double delta_previous = low_storage_tableau->get_delta(n_rk_stages+1);
+        const double atol = this->ode_param.embedded_error_absolute_tolerance;
+        const double rtol = this->ode_param.embedded_error_relative_tolerance;
+
+        const double * const solution = this->dg->solution.begin();
+        const double * const S2 = storage_register.begin();
+        const double * const S3 = previous_solution.begin();
+        double local_error_squared = 0.0;
+        for (unsigned int i = 0; i < n_local_dofs; ++i) {
+            const double embedded_solution = (S2[i] + delta_solution * solution[i] + delta_previous * S3[i]) / delta_sum;
+            const double scale = atol + rtol * std::max(std::abs(S3[i]), std::abs(solution[i]));
+            const double error = (solution[i] - embedded_solution) / scale;
+            local_error_squared += error * error;
+        }
+        const double error_squared = dealii::Utilities::MPI::sum(local_error_squared, this->mpi_communicator);
+        this->embedded_error_norm = std::sqrt(error_squared / this->dg->solution.size());
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::evaluate_stage_derivative (const int istage, const real dt, const bool pseudotime)
+{
+    //set the DG current time for unsteady source terms
+    this->dg->set_current_time(this->current_time + low_storage_tableau->get_c(istage)*dt);
+
+    this->dg->assemble_residual();
+
+    if(this->all_parameters->use_inverse_mass_on_the_fly){
+        this->dg->apply_inverse_global_mass_matrix(this->dg->right_hand_side, stage_derivative);
+    } else{
+        Profiling::ScopedTimer inverse_mass_timer("inverse_mass_application");
+        this->dg->global_inverse_mass_matrix.vmult(stage_derivative, this->dg->right_hand_side);
+    }
+
+    if (pseudotime) {
+        const double CFL = dt;
+        this->dg->time_scale_solution_update(stage_derivative, CFL);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating ODE system..." << std::flush;
+    if(this->all_parameters->use_inverse_mass_on_the_fly == false) {
+        this->pcout << " evaluating inverse mass matrix..." << std::flush;
+        this->dg->evaluate_mass_matrices(true); // creates and stores global inverse mass matrix
+    }
+    this->pcout << std::endl;
+
+    low_storage_tableau->set_tableau();
+
+    using FormEnum = typename LowStorageRKTableauBase<dim,real,MeshType>::LowStorageFormEnum;
+    const bool is_3Sstar = (low_storage_tableau->low_storage_form == FormEnum::ketcheson_3Sstar);
+
+    // S2 is only needed by the 3S* form if it enters the stages or the embedded solution
+    use_storage_register = !is_3Sstar || low_storage_tableau->has_embedded_method;
+    for (int i = 0; is_3Sstar && i < low_storage_tableau->n_rk_stages; ++i) {
+        if (low_storage_tableau->get_gamma(i,1) != 0.0) use_storage_register = true;
+    }
+
+    stage_derivative.reinit(this->dg->solution);
+    if (use_storage_register) storage_register.reinit(this->dg->solution);
+    else storage_register.reinit(0);
+    if (is_3Sstar) previous_solution.reinit(this->dg->solution);
+    else previous_solution.reinit(0);
+}
+
+template class LowStorageRungeKuttaODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class LowStorageRungeKuttaODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class LowStorageRungeKuttaODESolver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
@@ -0,0 +1,73 @@
+#ifndef __LOW_STORAGE_RUNGE_KUTTA_ODESOLVER__
+#define __LOW_STORAGE_RUNGE_KUTTA_ODESOLVER__
+
+#include "dg/dg_base.hpp"
+#include "ode_solver_base.h"
+#include "runge_kutta_methods/low_storage_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Low-storage explicit Runge-Kutta ODE solver derived from ODESolver.
+/** The DG solution is used as the register S1 and the stages are never stored.
+ *  Besides the DG solution, the solver stores
+ *  - the derivative of the current stage, M^{-1} R(S1),
+ *  - the register S2, skipped by 3S* methods that neither use it in the stages nor have an embedded solution,
+ *  - the previous solution S3, only for the 3S* form.
+ *  The 2N form therefore uses at most three solution-sized vectors and the 3S* form four, independently of the number of stages.
+ *
+ *  The register updates of a stage are performed in a single sweep over the locally owned entries.
+ *  If the method has an embedded solution, the norm of its difference with the solution is evaluated
+ *  at the end of the step (see ODESolverBase::get_embedded_error_norm()).
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LowStorageRungeKuttaODESolver: public ODESolverBase <dim, real, MeshType>
+{
+public:
+    /// Vector type of the DG solution.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+            std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> rk_tableau_input); ///< Constructor.
+
+    /// Function to evaluate solution update
+    void step_in_time(real dt, const bool pseudotime);
+
+    /// Function to allocate the ODE system
+    void allocate_ode_system ();
+
+protected:
+    /// Stores the coefficients of the register updates
+    std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> low_storage_tableau;
+
+    /// Derivative of the current stage, M^{-1} R(S1), time-scaled in pseudotime
+    VectorType stage_derivative;
+
+    /// Register S2
+    VectorType storage_register;
+
+    /// Register S3, holding u^n for the 3S* form
+    VectorType previous_solution;
+
+    /// Flag indicating that the 3S* form needs the register S2
+    bool use_storage_register;
+
+    /// Steps in time with the 2N form
+    void step_in_time_2N(const real dt, const bool pseudotime);
+
+    /// Steps in time with the 3S* form
+    void step_in_time_3Sstar(const real dt, const bool pseudotime);
+
+    /// Evaluates M^{-1} R at the current DG solution into stage_derivative
+    /** In pseudotime, the derivative is also scaled by the local time steps using dt as the CFL number. */
+    void evaluate_stage_derivative(const int istage, const real dt, const bool pseudotime);
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,117 @@
+#include "matrix_free_implicit_system.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+MatrixFreeImplicitSystem<dim,real,MeshType>::MatrixFreeImplicitSystem(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
+    : dg(dg_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void MatrixFreeImplicitSystem<dim,real,MeshType>::reinit(const real dt, const bool pseudotime, const bool update_preconditioner)
+{
+    // Assembling the blocks also evaluates the residual and the local time steps at the current solution.
+    // The blocks of the Jacobian are then turned into the inverse blocks of the system in place.
+    if (update_preconditioner) dg->assemble_dRdW_diagonal_blocks(inverse_diagonal_blocks);
+
+    mass_scaling.reinit(dg->triangulation->n_active_cells());
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const unsigned int cell_index = cell->active_cell_index();
+        mass_scaling[cell_index] = pseudotime ? 1.0 / (dt * dg->max_dt_cell[cell_index]) : 1.0 / dt;
+        if (!update_preconditioner) continue;
+
+        const unsigned int n_dofs_cell = dg->fe_collection[cell->active_fe_index()].n_dofs_per_cell();
+        dofs_indices.resize(n_dofs_cell);
+        cell->get_dof_indices (dofs_indices);
+
+        // Block of M/dt - dRdW.
+        dealii::FullMatrix<real> &block = inverse_diagonal_blocks[cell_index];
+        block *= -1.0;
+        for (unsigned int itest=0; itest<n_dofs_cell; ++itest) {
+            for (unsigned int itrial=0; itrial<n_dofs_cell; ++itrial) {
+                block(itest,itrial) += mass_scaling[cell_index] * dg->global_mass_matrix.el(dofs_indices[itest], dofs_indices[itrial]);
+            }
+        }
+        block.gauss_jordan();
+    }
+    // The blocks of the ghost cells are incomplete and never used.
+    if (update_preconditioner) {
+        for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+            if (!cell->is_locally_owned()) inverse_diagonal_blocks[cell->active_cell_index()].reinit(0,0);
+        }
+    }
+
+    dRdW_times_src.reinit(dg->right_hand_side);
+    mass_times_src.reinit(dg->right_hand_side);
+}
+
+template <int dim, typename real, typename MeshType>
+void MatrixFreeImplicitSystem<dim,real,MeshType>::vmult(VectorType &dst, const VectorType &src) const
+{
+    dg->apply_dRdW(src, dRdW_times_src);
+    dg->global_mass_matrix.vmult(mass_times_src, src);
+
+    // The mass matrix is block diagonal, such that each cell's time step can scale its own rows.
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const real scaling = mass_scaling[cell->active_cell_index()];
+        dofs_indices.resize(dg->fe_collection[cell->active_fe_index()].n_dofs_per_cell());
+        cell->get_dof_indices (dofs_indices);
+        for (const auto dof : dofs_indices) {
+            dst[dof] = scaling * mass_times_src[dof] - dRdW_times_src[dof];
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+typename MatrixFreeImplicitSystem<dim,real,MeshType>::BlockJacobiPreconditioner
+MatrixFreeImplicitSystem<dim,real,MeshType>::get_preconditioner() const
+{
+    return BlockJacobiPreconditioner(*this);
+}
+
+template <int dim, typename real, typename MeshType>
+MatrixFreeImplicitSystem<dim,real,MeshType>::BlockJacobiPreconditioner::BlockJacobiPreconditioner(const MatrixFreeImplicitSystem &system_input)
+    : system(system_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void MatrixFreeImplicitSystem<dim,real,MeshType>::BlockJacobiPreconditioner::vmult(VectorType &dst, const VectorType &src) const
+{
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    dealii::Vector<real> src_cell;
+    dealii::Vector<real> dst_cell;
+    for (const auto &cell : system.dg->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const dealii::FullMatrix<real> &inverse_block = system.inverse_diagonal_blocks[cell->active_cell_index()];
+        const unsigned int n_dofs_cell = inverse_block.m();
+        dofs_indices.resize(n_dofs_cell);
+        cell->get_dof_indices (dofs_indices);
+
+        src_cell.reinit(n_dofs_cell);
+        dst_cell.reinit(n_dofs_cell);
+        for (unsigned int idof=0; idof<n_dofs_cell; ++idof) {
+            src_cell[idof] = src[dofs_indices[idof]];
+        }
+        inverse_block.vmult(dst_cell, src_cell);
+        for (unsigned int idof=0; idof<n_dofs_cell; ++idof) {
+            dst[dofs_indices[idof]] = dst_cell[idof];
+        }
+    }
+}
+
+template class MatrixFreeImplicitSystem<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class MatrixFreeImplicitSystem<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class MatrixFreeImplicitSystem<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
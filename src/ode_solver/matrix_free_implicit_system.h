@@ -0,0 +1,86 @@
+#ifndef __MATRIX_FREE_IMPLICIT_SYSTEM__
+#define __MATRIX_FREE_IMPLICIT_SYSTEM__
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include "dg/dg_base.hpp"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Linearized implicit system applied without assembling the Jacobian.
+/** Applies
+ *  \f[
+ *      \left( \frac{\mathbf{M}}{\Delta t} - \frac{\partial \mathbf{R}}{\partial \mathbf{u}} \right) \mathbf{v}
+ *  \f]
+ *  where the Jacobian-vector product is evaluated cell by cell by DGBase::apply_dRdW() with forward-mode AD.
+ *  For pseudo-time stepping, the mass matrix of each cell is scaled by its own time step,
+ *  as done by DGBase::time_scaled_mass_matrices().
+ *
+ *  The system is preconditioned with the inverse of its cell-diagonal blocks, which only requires
+ *  the diagonal blocks of the Jacobian from DGBase::assemble_dRdW_diagonal_blocks().
+ *  Therefore, neither the global Jacobian nor its transpose is ever stored.
+ */
+template <int dim, typename real, typename MeshType>
+class MatrixFreeImplicitSystem
+{
+public:
+    /// Vector type of the solution and residual.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Constructor.
+    explicit MatrixFreeImplicitSystem(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input);
+
+    /// Linearizes the system about the current solution.
+    /** Evaluates the right_hand_side of the DG object, the time step scaling of the mass matrix,
+     *  and factorizes the block-Jacobi preconditioner.
+     *  If pseudotime is true, dt is the CFL number used to scale the local time steps.
+     *
+     *  If update_preconditioner is false, the blocks of the previous linearization are kept and
+     *  only the mass matrix scaling is updated. The right_hand_side and the local time steps of the
+     *  DG object must then already be evaluated at the current solution.
+     */
+    void reinit(const real dt, const bool pseudotime, const bool update_preconditioner);
+
+    /// Applies the linearized system to src.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+    /// Cell block-Jacobi preconditioner of the linearized system.
+    class BlockJacobiPreconditioner
+    {
+    public:
+        /// Constructor.
+        explicit BlockJacobiPreconditioner(const MatrixFreeImplicitSystem &system_input);
+        /// Applies the inverse of the cell-diagonal blocks to src.
+        void vmult(VectorType &dst, const VectorType &src) const;
+    private:
+        /// Linearized system whose blocks are inverted.
+        const MatrixFreeImplicitSystem &system;
+    };
+
+    /// Returns the block-Jacobi preconditioner of the current linearization.
+    BlockJacobiPreconditioner get_preconditioner() const;
+
+protected:
+    /// Pointer to dg.
+    std::shared_ptr<DGBase<dim,real,MeshType>> dg;
+
+    /// Scaling of the mass matrix of each active cell, i.e. the inverse of its time step.
+    dealii::Vector<double> mass_scaling;
+
+    /// Inverse of the cell-diagonal blocks of the linearized system, indexed by active_cell_index.
+    std::vector<dealii::FullMatrix<real>> inverse_diagonal_blocks;
+
+    /// Jacobian-vector product, reused between the vmult() calls.
+    mutable VectorType dRdW_times_src;
+
+    /// Mass matrix-vector product, reused between the vmult() calls.
+    mutable VectorType mass_times_src;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
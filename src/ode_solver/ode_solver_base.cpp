@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <cmath>
+
 #include "ode_solver_base.h"
+#include "reduced_order/snapshot_file.h"
 
 namespace PHiLiP {
 namespace ODE{
@@ -13,8 +17,11 @@ ODESolverBase<dim,real,MeshType>::ODESolverBase(std::shared_ptr< DGBase<dim, rea
         , current_desired_time_for_output_solution_every_dt_time_intervals(ode_param.initial_desired_time_for_output_solution_every_dt_time_intervals)
         , original_time_step(0.0)
         , modified_time_step(0.0)
-        , mpi_communicator(MPI_COMM_WORLD)
-        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+        , embedded_error_norm(-1.0)
+        , previous_embedded_error_norm(1.0)
+        , n_rejected_steps(0)
+        , mpi_communicator(dg->get_mpi_communicator())
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
         , pcout(std::cout, mpi_rank==0)
         {}
 
@@ -30,6 +37,92 @@ double ODESolverBase<dim,real,MeshType>::get_modified_time_step() const
     return this->modified_time_step;
 }
 
+template <int dim, typename real, typename MeshType>
+double ODESolverBase<dim,real,MeshType>::get_embedded_error_norm() const
+{
+    return this->embedded_error_norm;
+}
+
+template <int dim, typename real, typename MeshType>
+unsigned int ODESolverBase<dim,real,MeshType>::get_n_rejected_steps() const
+{
+    return this->n_rejected_steps;
+}
+
+template <int dim, typename real, typename MeshType>
+Eigen::RowVectorXd ODESolverBase<dim,real,MeshType>::get_snapshot_parameters() const
+{
+    const std::vector<std::string> &parameter_names = this->all_parameters->reduced_order_param.parameter_names;
+    Eigen::RowVectorXd parameters(parameter_names.size());
+    for (unsigned int i = 0; i < parameter_names.size(); ++i) {
+        if (parameter_names[i] == "mach")             parameters(i) = this->all_parameters->euler_param.mach_inf;
+        else if (parameter_names[i] == "alpha")       parameters(i) = this->all_parameters->euler_param.angle_of_attack;
+        else if (parameter_names[i] == "rewienski_a") parameters(i) = this->all_parameters->burgers_param.rewienski_a;
+        else if (parameter_names[i] == "rewienski_b") parameters(i) = this->all_parameters->burgers_param.rewienski_b;
+        else {
+            pcout << "Error: unknown snapshot parameter " << parameter_names[i] << ". Aborting..." << std::endl;
+            std::abort();
+        }
+    }
+    return parameters;
+}
+
+template <int dim, typename real, typename MeshType>
+double ODESolverBase<dim,real,MeshType>::step_in_time_with_error_control (const real dt)
+{
+    const double time_before_step = this->current_time;
+    const unsigned int iteration_before_step = this->current_iteration;
+    solution_before_step.reinit(dg->solution);
+    solution_before_step = dg->solution;
+
+    const double exponent_order = ode_param.rk_embedded_order + 1.0;
+    const double integral_gain = 0.7 / exponent_order;
+    const double proportional_gain = 0.4 / exponent_order;
+    const double min_factor = ode_param.error_controller_minimum_step_factor;
+    const double max_factor = ode_param.error_controller_maximum_step_factor;
+    const double smallest_error = 1e-10; // avoids dividing by zero for exact steps
+
+    double time_step = dt;
+    while (true) {
+        const bool pseudotime = false;
+        step_in_time(time_step, pseudotime);
+
+        if (embedded_error_norm < 0.0) {
+            pcout << "ERROR: the ODE solver does not provide an embedded error estimate. "
+                  << "Use an RK method with embedded weights or turn off use_embedded_error_control. Aborting..." << std::endl;
+            std::abort();
+        }
+        const double error = std::max(embedded_error_norm, smallest_error);
+
+        if (error <= 1.0) {
+            double factor = ode_param.error_controller_safety_factor
+                            * std::pow(error, -integral_gain) * std::pow(previous_embedded_error_norm, proportional_gain);
+            factor = std::min(max_factor, std::max(min_factor, factor));
+            previous_embedded_error_norm = error;
+            // RRK may have modified the time step, the controller acts on the requested one
+            return this->original_time_step * factor;
+        }
+
+        // Reject the step and retry with the integral part of the controller only
+        dg->solution = solution_before_step;
+        dg->solution.update_ghost_values();
+        this->current_time = time_before_step;
+        this->current_iteration = iteration_before_step;
+        ++n_rejected_steps;
+
+        double factor = ode_param.error_controller_safety_factor * std::pow(error, -integral_gain);
+        factor = std::min(1.0, std::max(min_factor, factor));
+        time_step *= factor;
+        if ((ode_param.ode_output) == Parameters::OutputEnum::verbose) {
+            pcout << " Step rejected with an error norm of " << error << ", retrying with dt=" << time_step << std::endl;
+        }
+        if (time_step < 1e-14 * std::max(1.0, std::abs(time_before_step))) {
+            pcout << "ERROR: the time step chosen by the error controller vanished. Aborting..." << std::endl;
+            std::abort();
+        }
+    }
+}
+
 template <int dim, typename real, typename MeshType>
 void ODESolverBase<dim,real,MeshType>::initialize_steady_polynomial_ramping (const unsigned int global_final_poly_degree)
 {
@@ -210,7 +303,17 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
         if(CFL_factor <= 1e-2) this->dg->right_hand_side.add(1.0);
     }
 
-    if (ode_param.output_final_steady_state_solution_to_file) {
+    if (ode_param.output_final_steady_state_solution_to_file
+        && ode_param.steady_state_final_solution_file_format == Parameters::ODESolverParam::SolutionFileFormatEnum::binary) {
+        // Each process writes its locally owned rows, without gathering the solution
+        const dealii::IndexSet &locally_owned_dofs = this->dg->locally_owned_dofs;
+        Eigen::MatrixXd local_solution(locally_owned_dofs.n_elements(), 1);
+        for (unsigned int i = 0; i < locally_owned_dofs.n_elements(); ++i) {
+            local_solution(i, 0) = this->dg->solution[locally_owned_dofs.nth_index_in_set(i)];
+        }
+        ProperOrthogonalDecomposition::write_snapshot_file(ode_param.steady_state_final_solution_filename + ".snap",
+                                                           local_solution, locally_owned_dofs, get_snapshot_parameters(), mpi_communicator);
+    } else if (ode_param.output_final_steady_state_solution_to_file) {
         dealii::LinearAlgebra::ReadWriteVector<double> write_dg_solution(this->dg->solution.size());
         write_dg_solution.import(this->dg->solution, dealii::VectorOperation::values::insert);
         if(mpi_rank == 0){
@@ -263,7 +366,12 @@ int ODESolverBase<dim,real,MeshType>::advance_solution_time (double time_advance
         this->current_desired_time_for_output_solution_every_dt_time_intervals += ode_param.output_solution_every_dt_time_intervals;
     }
 
-    while (this->current_iteration < number_of_time_steps)
+    const bool use_error_control = ode_param.use_embedded_error_control;
+    const double final_time = this->current_time + time_advance;
+    double next_time_step = ode_param.initial_time_step;
+
+    while (use_error_control ? (final_time - this->current_time > 1e-12 * std::max(1.0, std::abs(final_time)))
+                             : (this->current_iteration < number_of_time_steps))
     {
         if ((ode_param.ode_output) == Parameters::OutputEnum::verbose &&
             (this->current_iteration%ode_param.print_iteration_modulo) == 0 ) {
@@ -279,8 +387,17 @@ int ODESolverBase<dim,real,MeshType>::advance_solution_time (double time_advance
             pcout << " Evaluating right-hand side and setting system_matrix to Jacobian... " << std::endl;
         }
 
-        const bool pseudotime = false;
-        step_in_time(constant_time_step, pseudotime);
+        double time_step = constant_time_step;
+        if (use_error_control) {
+            time_step = std::min(next_time_step, final_time - this->current_time);
+            const double proposed_time_step = step_in_time_with_error_control(time_step);
+            // Do not let the shortened last step shrink the next proposed time step
+            next_time_step = (time_step < next_time_step) ? std::max(next_time_step, proposed_time_step) : proposed_time_step;
+            time_step = this->modified_time_step;
+        } else {
+            const bool pseudotime = false;
+            step_in_time(time_step, pseudotime);
+        }
 
         if (ode_param.output_solution_every_x_steps > 0) {
             const bool is_output_iteration = (this->current_iteration % ode_param.output_solution_every_x_steps == 0);
@@ -290,7 +407,7 @@ int ODESolverBase<dim,real,MeshType>::advance_solution_time (double time_advance
             }
         } else if(ode_param.output_solution_every_dt_time_intervals > 0.0) {
             const bool is_output_time = ((this->current_time <= this->current_desired_time_for_output_solution_every_dt_time_intervals) && 
-                                         ((this->current_time + constant_time_step) > this->current_desired_time_for_output_solution_every_dt_time_intervals));
+                                         ((this->current_time + time_step) > this->current_desired_time_for_output_solution_every_dt_time_intervals));
             if (is_output_time) {
                 const int file_number = this->current_desired_time_for_output_solution_every_dt_time_intervals / ode_param.output_solution_every_dt_time_intervals;
                 this->dg->output_results_vtk(file_number);
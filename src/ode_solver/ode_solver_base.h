@@ -8,6 +8,8 @@
 #include <iostream>
 #include <stdexcept>
 
+#include <eigen/Eigen/Dense>
+
 #include "dg/dg_base.hpp"
 #include "parameters/all_parameters.h"
 
@@ -57,8 +59,30 @@ public:
     void valid_initial_conditions () const;
 
     /// Function to advance solution to time+dt
+    /** If use_embedded_error_control is set, the steps are taken with step_in_time_with_error_control()
+     *  starting from initial_time_step, and the last step is shortened to end exactly at time+dt.
+     */
     int advance_solution_time (double time_advance);
 
+    /// Takes one accepted time step of at most dt, controlled by the embedded error estimate.
+    /** The step is repeated with a smaller time step until the error norm is below one.
+     *  The next time step is then proposed by a PI controller (Gustafsson, 1991),
+     *  \f[
+     *      \Delta t_{n+1} = \Delta t_n\, \kappa\, e_n^{-0.7/k} e_{n-1}^{0.4/k},
+     *  \f]
+     *  where \f$ \kappa \f$ is the safety factor and k is the embedded order plus one.
+     *  The ratio between two consecutive time steps is bounded by the minimum and maximum step factors.
+     *
+     *  @return Time step proposed for the next step.
+     */
+    double step_in_time_with_error_control (const real dt);
+
+    /// Getter for embedded_error_norm
+    double get_embedded_error_norm() const;
+
+    /// Getter for n_rejected_steps
+    unsigned int get_n_rejected_steps() const;
+
     /// Virtual function to evaluate solution update
     virtual void step_in_time(real dt, const bool pseudotime) = 0;
 
@@ -117,6 +141,27 @@ protected:
     double original_time_step;///< Original time step before calling step_in_time
     double modified_time_step;///< Modified time step after calling step_in_time
 
+    /// Weighted RMS norm of the embedded error estimate of the last step
+    /** The error of each entry is divided by atol + rtol*max(|u^n|,|u^{n+1}|), such that the step
+     *  satisfies the tolerances if the norm is below one. Negative if the ODE solver has no error estimate.
+     */
+    double embedded_error_norm;
+
+    /// Error norm of the last accepted step, used by the PI controller
+    double previous_embedded_error_norm;
+
+    /// Number of steps rejected by step_in_time_with_error_control()
+    unsigned int n_rejected_steps;
+
+    /// Solution at the beginning of the step, used to repeat rejected steps
+    dealii::LinearAlgebra::distributed::Vector<double> solution_before_step;
+
+    /// Returns the values of the reduced-order parameter_names for the current flow case
+    /** Written with the final steady state in the binary snapshot files, such that the snapshots can be
+     *  located in the parameter space. The angle of attack is in radians, as in the Euler parameters.
+     */
+    Eigen::RowVectorXd get_snapshot_parameters() const;
+
 protected:
     const MPI_Comm mpi_communicator; ///< MPI communicator.
     const int mpi_rank; ///< MPI rank.
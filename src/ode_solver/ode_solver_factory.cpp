@@ -4,12 +4,15 @@
 //#include "runge_kutta_ode_solver.h"
 #include "explicit_ode_solver.h"
 #include "implicit_ode_solver.h"
+#include "low_storage_runge_kutta_ode_solver.h"
+#include "p_multigrid_ode_solver.h"
 #include "rrk_explicit_ode_solver.h"
 #include "pod_galerkin_ode_solver.h"
 #include "pod_petrov_galerkin_ode_solver.h"
 #include <deal.II/distributed/solution_transfer.h>
 #include "runge_kutta_methods/runge_kutta_methods.h"
 #include "runge_kutta_methods/rk_tableau_base.h"
+#include "runge_kutta_methods/low_storage_runge_kutta_methods.h"
 
 namespace PHiLiP {
 namespace ODE {
@@ -25,6 +28,10 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
         return create_RungeKuttaODESolver(dg_input);
     if(ode_solver_type == ODEEnum::implicit_solver)         
         return std::make_shared<ImplicitODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::p_multigrid_solver)
+        return std::make_shared<PMultigridODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::low_storage_runge_kutta_solver)
+        return create_LowStorageRungeKuttaODESolver(dg_input);
     else {
         display_error_ode_solver_factory(ode_solver_type, false);
         return nullptr;
@@ -58,6 +65,10 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
         return create_RungeKuttaODESolver(dg_input);
     if(ode_solver_type == ODEEnum::implicit_solver)         
         return std::make_shared<ImplicitODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::p_multigrid_solver)
+        return std::make_shared<PMultigridODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::low_storage_runge_kutta_solver)
+        return create_LowStorageRungeKuttaODESolver(dg_input);
     else {
         display_error_ode_solver_factory(ode_solver_type, false);
         return nullptr;
@@ -90,6 +101,8 @@ void ODESolverFactory<dim,real,MeshType>::display_error_ode_solver_factory(Param
     if (ode_solver_type == ODEEnum::runge_kutta_solver)            solver_string = "runge_kutta";
     if (ode_solver_type == ODEEnum::implicit_solver)               solver_string = "implicit";
     if (ode_solver_type == ODEEnum::rrk_explicit_solver)           solver_string = "rrk_explicit";
+    if (ode_solver_type == ODEEnum::p_multigrid_solver)            solver_string = "p_multigrid";
+    if (ode_solver_type == ODEEnum::low_storage_runge_kutta_solver) solver_string = "low_storage_runge_kutta";
     if (ode_solver_type == ODEEnum::pod_galerkin_solver)           solver_string = "pod_galerkin";
     if (ode_solver_type == ODEEnum::pod_petrov_galerkin_solver)    solver_string = "pod_petrov_galerkin";
     else solver_string = "undefined";
@@ -107,6 +120,8 @@ void ODESolverFactory<dim,real,MeshType>::display_error_ode_solver_factory(Param
         pcout <<  "runge_kutta" << std::endl;
         pcout <<  "implicit" << std::endl;
         pcout <<  "rrk_explicit" << std::endl;
+        pcout <<  "p_multigrid" << std::endl;
+        pcout <<  "low_storage_runge_kutta" << std::endl;
         pcout << "    With rrk_explicit only being valid for " <<std::endl;
         pcout << "    pde_type = burgers, flux_nodes_type = GLL, overintegration = 0, and dim = 1" <<std::endl;
     }
@@ -139,6 +154,9 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
         if (n_rk_stages == 4){
             return std::make_shared<RungeKuttaODESolver<dim,real,4,MeshType>>(dg_input,rk_tableau);
         }
+        if (n_rk_stages == 7){
+            return std::make_shared<RungeKuttaODESolver<dim,real,7,MeshType>>(dg_input,rk_tableau);
+        }
         else{
             pcout << "Error: invalid number of stages. Aborting..." << std::endl;
             std::abort();
@@ -166,6 +184,9 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
                 if (n_rk_stages == 4){
                     return std::make_shared<RRKExplicitODESolver<dim,real,4,MeshType>>(dg_input,rk_tableau);
                 }
+                if (n_rk_stages == 7){
+                    return std::make_shared<RRKExplicitODESolver<dim,real,7,MeshType>>(dg_input,rk_tableau);
+                }
                 else{
                     pcout << "Error: invalid number of stages. Aborting..." << std::endl;
                     std::abort();
@@ -197,6 +218,8 @@ std::shared_ptr<RKTableauBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
 
     if (rk_method == RKMethodEnum::ssprk3_ex)   return std::make_shared<SSPRK3Explicit<dim, real, MeshType>> (n_rk_stages, "3rd order SSP (explicit)");
     if (rk_method == RKMethodEnum::rk4_ex)      return std::make_shared<RK4Explicit<dim, real, MeshType>>    (n_rk_stages, "4th order classical RK (explicit)");
+    if (rk_method == RKMethodEnum::bs32_ex)     return std::make_shared<BogackiShampine32Explicit<dim, real, MeshType>> (n_rk_stages, "3rd order Bogacki-Shampine with embedded 2nd order (explicit)");
+    if (rk_method == RKMethodEnum::dp54_ex)     return std::make_shared<DormandPrince54Explicit<dim, real, MeshType>>   (n_rk_stages, "5th order Dormand-Prince with embedded 4th order (explicit)");
     if (rk_method == RKMethodEnum::euler_ex) {
         using ODEEnum = Parameters::ODESolverParam::ODESolverEnum;
         ODEEnum ode_solver_type = dg_input->all_parameters->ode_solver_param.ode_solver_type;
@@ -232,6 +255,28 @@ std::shared_ptr<RKTableauBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
     }
 }
 
+template <int dim, typename real, typename MeshType>
+std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,MeshType>::create_LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    using LowStorageRKMethodEnum = Parameters::ODESolverParam::LowStorageRKMethodEnum;
+    const LowStorageRKMethodEnum rk_method = dg_input->all_parameters->ode_solver_param.low_storage_runge_kutta_method;
+
+    std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> rk_tableau;
+    if (rk_method == LowStorageRKMethodEnum::lsrk3_2n)      rk_tableau = std::make_shared<LSRK3Williamson2N<dim, real, MeshType>>       ("3rd order Williamson 2N (explicit)");
+    if (rk_method == LowStorageRKMethodEnum::lsrk4_2n)      rk_tableau = std::make_shared<LSRK4CarpenterKennedy2N<dim, real, MeshType>> ("4th order Carpenter-Kennedy 2N (explicit)");
+    if (rk_method == LowStorageRKMethodEnum::ssprk3_3sstar) rk_tableau = std::make_shared<SSPRK3Embedded3Sstar<dim, real, MeshType>>    ("3rd order SSP 3S* with embedded 2nd order (explicit)");
+    if (rk_tableau == nullptr) {
+        pcout << "Error: invalid low-storage RK method. Aborting..." << std::endl;
+        std::abort();
+        return nullptr;
+    }
+
+    pcout << "Creating Low-Storage Runge Kutta ODE Solver with "
+          << rk_tableau->n_rk_stages << " stage(s)..." << std::endl;
+    return std::make_shared<LowStorageRungeKuttaODESolver<dim,real,MeshType>>(dg_input,rk_tableau);
+}
+
 template class ODESolverFactory<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
 template class ODESolverFactory<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
 #if PHILIP_DIM != 1
@@ -41,6 +41,9 @@ public:
     /// Creates an RKTableau object based on the specified RK method
     static std::shared_ptr<RKTableauBase<dim,real,MeshType>> create_RKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input);
 
+    /// Creates a low-storage RK ODE solver and its coefficients based on the specified low-storage RK method
+    static std::shared_ptr<ODESolverBase<dim,real,MeshType>> create_LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input);
+
 };
 
 } // ODE namespace
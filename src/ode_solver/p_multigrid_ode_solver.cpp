@@ -0,0 +1,299 @@
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/lac/vector.h>
+
+#include "dg/dg_factory.hpp"
+#include "mesh/high_order_grid.h"
+#include "p_multigrid_ode_solver.h"
+#include "profiling/performance_profiler.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+PMultigridODESolver<dim,real,MeshType>::PMultigridODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
+        : ODESolverBase<dim,real,MeshType>(dg_input)
+        {}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating ODE system and setting the p-multigrid levels..." << std::endl;
+    const unsigned int fine_degree = this->dg->get_max_fe_degree();
+    if (this->dg->get_min_fe_degree() != fine_degree) {
+        this->pcout << "ERROR: p-multigrid requires the same polynomial degree on every cell. Aborting..." << std::endl;
+        std::abort();
+    }
+    const unsigned int coarsest_degree = std::min(this->ode_param.p_multigrid_coarsest_poly_degree, fine_degree);
+
+    level_degrees.clear();
+    for (unsigned int poly_degree = fine_degree+1; poly_degree-- > coarsest_degree; ) {
+        level_degrees.push_back(poly_degree);
+    }
+    this->pcout << " Polynomial degree of the levels:";
+    for (const unsigned int poly_degree : level_degrees) this->pcout << " " << poly_degree;
+    this->pcout << std::endl;
+
+    // Creating a DG sets the degree of its cells through a refinement cycle of the shared triangulation,
+    // such that the degrees of freedom of every level are only distributed once all the levels exist.
+    const VectorType fine_solution = this->dg->solution;
+    level_dgs.assign(1, this->dg);
+    for (unsigned int level = 1; level < level_degrees.size(); ++level) {
+        std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = DGFactory<dim,real,MeshType>::create_discontinuous_galerkin(
+            this->all_parameters,
+            level_degrees[level],
+            this->dg->max_degree,
+            this->dg->max_grid_degree,
+            this->dg->triangulation);
+        level_dg->set_high_order_grid(this->dg->high_order_grid);
+        level_dgs.push_back(level_dg);
+    }
+    const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = false;
+    for (const auto &level_dg : level_dgs) {
+        level_dg->allocate_system(compute_dRdW, compute_dRdX, compute_d2R);
+        evaluate_level_mass_matrices(*level_dg);
+    }
+    this->dg->solution.copy_locally_owned_data_from(fine_solution);
+    this->dg->solution.update_ghost_values();
+
+    restriction_matrices.resize(level_degrees.size()-1);
+    prolongation_matrices.resize(level_degrees.size()-1);
+    for (unsigned int level = 0; level+1 < level_degrees.size(); ++level) {
+        const dealii::FiniteElement<dim> &fine_fe = this->dg->fe_collection[level_degrees[level]];
+        const dealii::FiniteElement<dim> &coarse_fe = this->dg->fe_collection[level_degrees[level+1]];
+        restriction_matrices[level].reinit(coarse_fe.n_dofs_per_cell(), fine_fe.n_dofs_per_cell());
+        prolongation_matrices[level].reinit(fine_fe.n_dofs_per_cell(), coarse_fe.n_dofs_per_cell());
+        dealii::FETools::get_interpolation_matrix(fine_fe, coarse_fe, restriction_matrices[level]);
+        dealii::FETools::get_interpolation_matrix(coarse_fe, fine_fe, prolongation_matrices[level]);
+    }
+
+    this->solution_update.reinit(this->dg->right_hand_side);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
+{
+    if (!pseudotime) {
+        this->pcout << "ERROR: p-multigrid is only available for steady state. Aborting..." << std::endl;
+        std::abort();
+    }
+    this->original_time_step = dt;
+
+    const VectorType old_solution = this->dg->solution;
+    const VectorType no_forcing;
+    const double CFL = dt;
+    v_cycle(0, no_forcing, CFL);
+
+    this->solution_update = this->dg->solution;
+    this->solution_update -= old_solution;
+    this->update_norm = this->solution_update.l2_norm();
+
+    this->modified_time_step = dt;
+    this->current_time += dt;
+    ++(this->current_iteration);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::v_cycle (const unsigned int level, const VectorType &forcing, const real CFL)
+{
+    const bool is_coarsest_level = (level+1 == level_degrees.size());
+    if (is_coarsest_level) {
+        smooth(level, this->ode_param.p_multigrid_n_coarsest_smoothing_steps, forcing, CFL);
+        return;
+    }
+
+    smooth(level, this->ode_param.p_multigrid_n_pre_smoothing_steps, forcing, CFL);
+
+    DGBase<dim,real,MeshType> &fine_dg = *level_dgs[level];
+    DGBase<dim,real,MeshType> &coarse_dg = *level_dgs[level+1];
+
+    // Restrict the solution and the level residual.
+    VectorType fine_residual;
+    evaluate_level_residual(level, forcing, fine_residual);
+
+    VectorType restricted_solution, restricted_residual;
+    transfer_between_levels(level, level+1, fine_dg.solution, restricted_solution);
+    transfer_between_levels(level, level+1, fine_residual, restricted_residual);
+    coarse_dg.solution = restricted_solution;
+    coarse_dg.solution.update_ghost_values();
+
+    // f_{p-1} = I(N_p(u_p) + f_p) - N_{p-1}(I u_p)
+    const VectorType no_forcing;
+    VectorType coarse_forcing;
+    evaluate_level_residual(level+1, no_forcing, coarse_forcing);
+    coarse_forcing.sadd(-1.0, 1.0, restricted_residual);
+
+    v_cycle(level+1, coarse_forcing, CFL);
+
+    // Prolongate the coarse correction.
+    VectorType coarse_correction = coarse_dg.solution;
+    coarse_correction -= restricted_solution;
+    VectorType fine_correction;
+    transfer_between_levels(level+1, level, coarse_correction, fine_correction);
+    fine_dg.solution += fine_correction;
+    fine_dg.solution.update_ghost_values();
+
+    smooth(level, this->ode_param.p_multigrid_n_post_smoothing_steps, forcing, CFL);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::smooth (const unsigned int level, const unsigned int n_steps, const VectorType &forcing, const real CFL)
+{
+    using SmootherEnum = Parameters::ODESolverParam::PMultigridSmootherEnum;
+    for (unsigned int istep = 0; istep < n_steps; ++istep) {
+        if (this->ode_param.p_multigrid_smoother == SmootherEnum::block_jacobi_smoother) {
+            block_jacobi_smoothing_step(level, forcing, CFL);
+        } else {
+            explicit_rk_smoothing_step(level, forcing, CFL);
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::explicit_rk_smoothing_step (const unsigned int level, const VectorType &forcing, const real CFL)
+{
+    DGBase<dim,real,MeshType> &dg = *level_dgs[level];
+    const VectorType initial_solution = dg.solution;
+    VectorType stage_update;
+
+    // u1 = u + dtau (N(u) + f)
+    evaluate_level_residual(level, forcing, stage_update);
+    dg.time_scale_solution_update(stage_update, CFL);
+    dg.solution.add(1.0, stage_update);
+    dg.solution.update_ghost_values();
+
+    // u2 = 3/4 u + 1/4 (u1 + dtau (N(u1) + f))
+    evaluate_level_residual(level, forcing, stage_update);
+    dg.time_scale_solution_update(stage_update, CFL);
+    dg.solution.add(1.0, stage_update);
+    dg.solution.sadd(0.25, 0.75, initial_solution);
+    dg.solution.update_ghost_values();
+
+    // u = 1/3 u + 2/3 (u2 + dtau (N(u2) + f))
+    evaluate_level_residual(level, forcing, stage_update);
+    dg.time_scale_solution_update(stage_update, CFL);
+    dg.solution.add(1.0, stage_update);
+    dg.solution.sadd(2.0/3.0, 1.0/3.0, initial_solution);
+    dg.solution.update_ghost_values();
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::block_jacobi_smoothing_step (const unsigned int level, const VectorType &forcing, const real CFL)
+{
+    DGBase<dim,real,MeshType> &dg = *level_dgs[level];
+
+    // Solve (M/dtau - dRdW) du = R + M f with the element-diagonal blocks only.
+    // Assembling the blocks also evaluates the residual and the local time steps at the current solution.
+    dg.assemble_dRdW_diagonal_blocks(diagonal_blocks);
+
+    VectorType right_hand_side = dg.right_hand_side;
+    if (forcing.size() > 0) {
+        VectorType mass_times_forcing(right_hand_side);
+        dg.global_mass_matrix.vmult(mass_times_forcing, forcing);
+        right_hand_side += mass_times_forcing;
+    }
+
+    VectorType update(right_hand_side);
+    dealii::Vector<real> local_right_hand_side, local_update;
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto &cell : dg.dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const unsigned int cell_index = cell->active_cell_index();
+        const unsigned int n_dofs_cell = dg.fe_collection[cell->active_fe_index()].n_dofs_per_cell();
+        dofs_indices.resize(n_dofs_cell);
+        cell->get_dof_indices (dofs_indices);
+
+        // Block of M/dtau - dRdW.
+        dealii::FullMatrix<real> &block = diagonal_blocks[cell_index];
+        block *= -1.0;
+        const real mass_scaling = 1.0 / (CFL * dg.max_dt_cell[cell_index]);
+        for (unsigned int itest=0; itest<n_dofs_cell; ++itest) {
+            for (unsigned int itrial=0; itrial<n_dofs_cell; ++itrial) {
+                block(itest,itrial) += mass_scaling * dg.global_mass_matrix.el(dofs_indices[itest], dofs_indices[itrial]);
+            }
+        }
+        block.gauss_jordan();
+
+        local_right_hand_side.reinit(n_dofs_cell);
+        local_update.reinit(n_dofs_cell);
+        for (unsigned int idof=0; idof<n_dofs_cell; ++idof) {
+            local_right_hand_side[idof] = right_hand_side[dofs_indices[idof]];
+        }
+        block.vmult(local_update, local_right_hand_side);
+        for (unsigned int idof=0; idof<n_dofs_cell; ++idof) {
+            update[dofs_indices[idof]] = local_update[idof];
+        }
+    }
+
+    dg.solution += update;
+    dg.solution.update_ghost_values();
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::evaluate_level_residual (const unsigned int level, const VectorType &forcing, VectorType &level_residual)
+{
+    DGBase<dim,real,MeshType> &dg = *level_dgs[level];
+    dg.assemble_residual();
+    level_residual.reinit(dg.solution);
+    if (this->all_parameters->use_inverse_mass_on_the_fly) {
+        dg.apply_inverse_global_mass_matrix(dg.right_hand_side, level_residual);
+    } else {
+        Profiling::ScopedTimer inverse_mass_timer("inverse_mass_application");
+        dg.global_inverse_mass_matrix.vmult(level_residual, dg.right_hand_side);
+    }
+    if (forcing.size() > 0) level_residual += forcing;
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::transfer_between_levels (
+    const unsigned int input_level,
+    const unsigned int output_level,
+    const VectorType &input,
+    VectorType &output) const
+{
+    Assert(input_level+1 == output_level || output_level+1 == input_level,
+           dealii::ExcMessage("Vectors are only transferred between adjacent levels."));
+    const DGBase<dim,real,MeshType> &input_dg = *level_dgs[input_level];
+    const DGBase<dim,real,MeshType> &output_dg = *level_dgs[output_level];
+    const dealii::FullMatrix<real> &interpolation_matrix = (output_level > input_level)
+                                                           ? restriction_matrices[input_level]
+                                                           : prolongation_matrices[output_level];
+
+    output.reinit(output_dg.solution);
+    dealii::Vector<real> input_values(interpolation_matrix.n());
+    dealii::Vector<real> output_values(interpolation_matrix.m());
+
+    // Both DoFHandlers are built on the same triangulation, such that their active cells are traversed in the same order.
+    auto input_cell = input_dg.dof_handler.begin_active();
+    auto output_cell = output_dg.dof_handler.begin_active();
+    for (; input_cell != input_dg.dof_handler.end(); ++input_cell, ++output_cell) {
+        if (!input_cell->is_locally_owned()) continue;
+        input_cell->get_dof_values(input, input_values);
+        interpolation_matrix.vmult(output_values, input_values);
+        output_cell->set_dof_values(output_values, output);
+    }
+    output.update_ghost_values();
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::evaluate_level_mass_matrices (DGBase<dim,real,MeshType> &level_dg)
+{
+    using SmootherEnum = Parameters::ODESolverParam::PMultigridSmootherEnum;
+    if (this->ode_param.p_multigrid_smoother == SmootherEnum::block_jacobi_smoother) {
+        const bool do_inverse_mass_matrix = false;
+        level_dg.evaluate_mass_matrices(do_inverse_mass_matrix);
+    }
+    if (!this->all_parameters->use_inverse_mass_on_the_fly) {
+        const bool do_inverse_mass_matrix = true;
+        level_dg.evaluate_mass_matrices(do_inverse_mass_matrix);
+    }
+}
+
+template class PMultigridODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class PMultigridODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class PMultigridODESolver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
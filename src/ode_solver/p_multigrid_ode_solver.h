@@ -0,0 +1,103 @@
+#ifndef __P_MULTIGRID_ODESOLVER__
+#define __P_MULTIGRID_ODESOLVER__
+
+#include <deal.II/lac/full_matrix.h>
+
+#include "dg/dg_base.hpp"
+#include "ode_solver_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Full approximation scheme (FAS) p-multigrid solver for steady state.
+/** Each call to step_in_time() performs one V-cycle over the polynomial degrees
+ *  p, p-1, ..., coarsest_poly_degree of the fe_collection, on the same triangulation.
+ *
+ *  The levels are solved in the residual form
+ *  \f[
+ *      \mathbf{N}_p(\mathbf{u}_p) + \mathbf{f}_p = \mathbf{M}_p^{-1}\mathbf{R}_p(\mathbf{u}_p) + \mathbf{f}_p = 0,
+ *  \f]
+ *  such that the residual is itself a DG function that can be interpolated between degrees.
+ *  The forcing of the finest level is zero, and the forcing of a coarser level is
+ *  \f[
+ *      \mathbf{f}_{p-1} = I_{p}^{p-1}\left(\mathbf{N}_p(\mathbf{u}_p) + \mathbf{f}_p\right) - \mathbf{N}_{p-1}(I_{p}^{p-1}\mathbf{u}_p).
+ *  \f]
+ *  The coarse correction \f$ \mathbf{u}_{p-1} - I_{p}^{p-1}\mathbf{u}_p \f$ is prolongated and added to the fine solution.
+ *
+ *  Every level has its own DG object, created once by allocate_ode_system() on the same triangulation and sharing
+ *  the HighOrderGrid of the finest level, with its own degrees of freedom and mass matrices. A level change only
+ *  interpolates the vectors cell by cell between the finite elements of the two degrees, such that nothing is
+ *  reallocated or re-evaluated during the cycles. The mass matrices are not updated if the grid moves.
+ *
+ *  The smoothers take the pseudotime step dt given to step_in_time() as the CFL number of local time steps.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class PMultigridODESolver: public ODESolverBase <dim, real, MeshType>
+{
+public:
+    /// Vector type of the DG solution.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Default constructor that will set the constants.
+    explicit PMultigridODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input); ///< Constructor.
+
+    /// Performs one FAS V-cycle, the DG is left at the finest degree.
+    void step_in_time(real dt, const bool pseudotime);
+
+    /// Sets the multigrid levels from the current polynomial degree and evaluates the mass matrices.
+    void allocate_ode_system ();
+
+protected:
+    /// Recursively performs the V-cycle starting on the given level.
+    /** The forcing is empty on the finest level. */
+    void v_cycle (const unsigned int level, const VectorType &forcing, const real CFL);
+
+    /// Performs n_steps smoothing steps on the given level.
+    void smooth (const unsigned int level, const unsigned int n_steps, const VectorType &forcing, const real CFL);
+
+    /// Three-stage SSP Runge-Kutta step in pseudotime.
+    void explicit_rk_smoothing_step (const unsigned int level, const VectorType &forcing, const real CFL);
+
+    /// Linearized backward Euler step in pseudotime, inverted with the element-diagonal blocks.
+    /** The blocks of dRdW are assembled by DGBase::assemble_dRdW_diagonal_blocks(), without the global Jacobian. */
+    void block_jacobi_smoothing_step (const unsigned int level, const VectorType &forcing, const real CFL);
+
+    /// Evaluates the level residual N(u) + f at the current solution of the level.
+    /** Also evaluates the DG right_hand_side and the maximum time step of each cell. */
+    void evaluate_level_residual (const unsigned int level, const VectorType &forcing, VectorType &level_residual);
+
+    /// Interpolates a vector of input_level onto the space of the adjacent output_level.
+    /** The output is reinitialized with the layout of the output level solution. */
+    void transfer_between_levels (
+        const unsigned int input_level,
+        const unsigned int output_level,
+        const VectorType &input,
+        VectorType &output) const;
+
+    /// Evaluates the mass matrices needed by the smoother and the level residual.
+    void evaluate_level_mass_matrices (DGBase<dim,real,MeshType> &level_dg);
+
+    /// Polynomial degree of each level, from the finest to the coarsest.
+    std::vector<unsigned int> level_degrees;
+
+    /// DG of each level, the finest one being the DG of the ODE solver.
+    std::vector<std::shared_ptr<DGBase<dim,real,MeshType>>> level_dgs;
+
+    /// Interpolation matrix of a cell from the degree of level i to the degree of level i+1.
+    std::vector<dealii::FullMatrix<real>> restriction_matrices;
+
+    /// Interpolation matrix of a cell from the degree of level i+1 to the degree of level i.
+    std::vector<dealii::FullMatrix<real>> prolongation_matrices;
+
+    /// Diagonal blocks of the block-Jacobi smoother, reused between the smoothing steps.
+    std::vector<dealii::FullMatrix<real>> diagonal_blocks;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
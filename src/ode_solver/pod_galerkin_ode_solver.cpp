@@ -26,6 +26,12 @@ std::shared_ptr<Epetra_CrsMatrix> PODGalerkinODESolver<dim,real,MeshType>::gener
     return std::make_shared<Epetra_CrsMatrix>(epetra_reduced_lhs);
 }
 
+template <int dim, typename real, typename MeshType>
+bool PODGalerkinODESolver<dim,real,MeshType>::test_basis_depends_on_jacobian() const
+{
+    return false;
+}
+
 
 template class PODGalerkinODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
 template class PODGalerkinODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
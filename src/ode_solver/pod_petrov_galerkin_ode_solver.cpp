@@ -28,6 +28,12 @@ std::shared_ptr<Epetra_CrsMatrix> PODPetrovGalerkinODESolver<dim,real,MeshType>:
     return std::make_shared<Epetra_CrsMatrix>(epetra_reduced_lhs);
 }
 
+template <int dim, typename real, typename MeshType>
+bool PODPetrovGalerkinODESolver<dim,real,MeshType>::test_basis_depends_on_jacobian() const
+{
+    return true;
+}
+
 
 template class PODPetrovGalerkinODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
 template class PODPetrovGalerkinODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
@@ -34,6 +34,9 @@ public:
 
     ///Generate reduced LHS
     std::shared_ptr<Epetra_CrsMatrix> generate_reduced_lhs(const Epetra_CrsMatrix &epetra_system_matrix, Epetra_CrsMatrix &test_basis) override;
+
+    /// Returns true, the test basis being the Jacobian times the POD basis
+    bool test_basis_depends_on_jacobian() const override;
 };
 
 } // ODE namespace
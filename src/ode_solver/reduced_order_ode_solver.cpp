@@ -10,6 +10,7 @@
 #include "dg/dg_base.hpp"
 #include "linear_solver/linear_solver.h"
 #include "ode_solver_base.h"
+#include "reduced_order/ecsw_hyper_reduction.h"
 #include "reduced_order/pod_basis_base.h"
 
 namespace PHiLiP {
@@ -262,17 +263,27 @@ void ReducedOrderODESolver<dim,real,MeshType>::step_in_time (real /*dt*/, const
 
 template <int dim, typename real, typename MeshType>
 void ReducedOrderODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating ODE system..." << std::endl;
+    project_onto_reduced_space(this->dg->solution);
+
+    if (this->all_parameters->reduced_order_param.use_hyper_reduction && !this->dg->use_hyper_reduction) {
+        this->dg->set_hyper_reduction_row_weights(compute_hyper_reduction_row_weights());
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void ReducedOrderODESolver<dim,real,MeshType>::project_onto_reduced_space (dealii::LinearAlgebra::distributed::Vector<double> &state)
 {
     /*Projection of initial conditions on reduced-order subspace, refer to Equation 19 in:
     Washabaugh, K. M., Zahr, M. J., & Farhat, C. (2016).
     On the use of discrete nonlinear reduced-order models for the prediction of steady-state flows past parametrically deformed complex geometries.
     In 54th AIAA Aerospace Sciences Meeting (p. 1814).
     */
-    this->pcout << "Allocating ODE system..." << std::endl;
-    dealii::LinearAlgebra::distributed::Vector<double> reference_solution(this->dg->solution);
+    dealii::LinearAlgebra::distributed::Vector<double> reference_solution(state);
     reference_solution.import(pod->getReferenceState(), dealii::VectorOperation::values::insert);
 
-    dealii::LinearAlgebra::distributed::Vector<double> initial_condition(this->dg->solution);
+    dealii::LinearAlgebra::distributed::Vector<double> initial_condition(state);
     initial_condition -= reference_solution;
 
     const Epetra_CrsMatrix epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
@@ -284,10 +295,43 @@ void ReducedOrderODESolver<dim,real,MeshType>::allocate_ode_system ()
     Epetra_Vector epetra_projection_tmp(epetra_pod_basis.RangeMap());
     epetra_pod_basis.Multiply(false, epetra_reduced_solution, epetra_projection_tmp);
 
-    Epetra_Vector epetra_solution(Epetra_DataAccess::View, epetra_pod_basis.RangeMap(), this->dg->solution.begin());
+    Epetra_Vector epetra_solution(Epetra_DataAccess::View, epetra_pod_basis.RangeMap(), state.begin());
 
     epetra_solution = epetra_projection_tmp;
-    this->dg->solution += reference_solution;
+    state += reference_solution;
+}
+
+template <int dim, typename real, typename MeshType>
+dealii::LinearAlgebra::distributed::Vector<double> ReducedOrderODESolver<dim,real,MeshType>::compute_hyper_reduction_row_weights ()
+{
+    this->pcout << "Sampling the cells for hyper-reduction..." << std::endl;
+    this->dg->clear_hyper_reduction();
+    const dealii::LinearAlgebra::distributed::Vector<double> old_solution(this->dg->solution);
+
+    // The snapshots are converged, such that their residual vanishes. Their projections onto the reduced-order subspace
+    // are used instead as training states, which are representative of the states reached by the reduced-order model.
+    const Eigen::MatrixXd snapshots = pod->getSnapshotMatrix();
+    const Epetra_CrsMatrix epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
+    const bool compute_dRdW = test_basis_depends_on_jacobian();
+    ProperOrthogonalDecomposition::ECSWHyperReduction<dim> ecsw(this->dg->dof_handler, this->mpi_communicator);
+    for (int isnapshot = 0; isnapshot < snapshots.cols(); ++isnapshot) {
+        for (unsigned int i = 0; i < this->dg->locally_owned_dofs.n_elements(); ++i) {
+            this->dg->solution[this->dg->locally_owned_dofs.nth_index_in_set(i)] = snapshots(i, isnapshot);
+        }
+        project_onto_reduced_space(this->dg->solution);
+        this->dg->solution.update_ghost_values();
+
+        this->dg->assemble_residual(compute_dRdW);
+        std::shared_ptr<Epetra_CrsMatrix> epetra_test_basis = generate_test_basis(this->dg->system_matrix.trilinos_matrix(), epetra_pod_basis);
+        ecsw.add_training_residual(*epetra_test_basis, this->dg->right_hand_side);
+    }
+    this->dg->solution = old_solution;
+
+    ecsw.compute_cell_weights(this->all_parameters->reduced_order_param.hyper_reduction_tolerance);
+    dealii::LinearAlgebra::distributed::Vector<double> row_weights(this->dg->solution);
+    const bool use_square_root = test_basis_depends_on_jacobian();
+    ecsw.get_row_weights(row_weights, use_square_root);
+    return row_weights;
 }
 
 template class ReducedOrderODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
@@ -34,8 +34,22 @@ public:
     void step_in_time(real dt, const bool pseudotime) override;
 
     /// Function to allocate the ODE system
+    /** Also hyper-reduces the DG residual if requested and the DG does not already have a sample of cells.
+     */
     void allocate_ode_system () override;
 
+    /// Replaces the state by its projection onto the affine reduced-order subspace, i.e. reference + V V^T (state - reference)
+    void project_onto_reduced_space (dealii::LinearAlgebra::distributed::Vector<double> &state);
+
+    /// Trains the ECSW sample of cells on the POD snapshots and returns the weights of the rows of the residual.
+    /** The weights can be reused with DGBase::set_hyper_reduction_row_weights() by any DG of same distribution of dofs
+     *  as long as the POD basis is unchanged.
+     */
+    dealii::LinearAlgebra::distributed::Vector<double> compute_hyper_reduction_row_weights ();
+
+    /// Returns true if the test basis is computed from the Jacobian, in which case the residual and the test basis are both weighted
+    virtual bool test_basis_depends_on_jacobian() const = 0;
+
     /// Generate test basis depending on which projection is used
     virtual std::shared_ptr<Epetra_CrsMatrix> generate_test_basis(const Epetra_CrsMatrix &epetra_system_matrix, const Epetra_CrsMatrix &pod_basis) = 0;
 
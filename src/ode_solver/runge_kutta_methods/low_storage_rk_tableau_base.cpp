@@ -0,0 +1,80 @@
+#include "low_storage_rk_tableau_base.h"
+
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+LowStorageRKTableauBase<dim,real, MeshType> :: LowStorageRKTableauBase (const int n_rk_stages_input,
+        const LowStorageFormEnum low_storage_form_input,
+        const bool has_embedded_method_input,
+        const std::string rk_method_string_input)
+    : n_rk_stages(n_rk_stages_input)
+    , low_storage_form(low_storage_form_input)
+    , has_embedded_method(has_embedded_method_input)
+    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
+    , rk_method_string(rk_method_string_input)
+{
+    if (low_storage_form == LowStorageFormEnum::williamson_2N) {
+        this->coefficients_A.reinit(n_rk_stages);
+        this->coefficients_B.reinit(n_rk_stages);
+    } else {
+        this->coefficients_gamma.reinit(n_rk_stages,3);
+        this->coefficients_beta.reinit(n_rk_stages);
+        this->coefficients_delta.reinit(n_rk_stages+2);
+    }
+    this->coefficients_c.reinit(n_rk_stages);
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRKTableauBase<dim,real, MeshType> :: set_tableau ()
+{
+    set_coefficients();
+    set_c();
+    pcout << "Assigned low-storage RK method: " << rk_method_string << std::endl;
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_A (const int i) const
+{
+    return coefficients_A[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_B (const int i) const
+{
+    return coefficients_B[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_gamma (const int i, const int j) const
+{
+    return coefficients_gamma[i][j];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_beta (const int i) const
+{
+    return coefficients_beta[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_delta (const int i) const
+{
+    return coefficients_delta[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_c (const int i) const
+{
+    return coefficients_c[i];
+}
+
+template class LowStorageRKTableauBase<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class LowStorageRKTableauBase<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class LowStorageRKTableauBase<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
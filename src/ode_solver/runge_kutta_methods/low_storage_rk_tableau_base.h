@@ -0,0 +1,119 @@
+#ifndef __LOW_STORAGE_RK_TABLEAU_BASE__
+#define __LOW_STORAGE_RK_TABLEAU_BASE__
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/table.h>
+
+#include <deal.II/grid/tria.h>
+#include <deal.II/distributed/shared_tria.h>
+#include <deal.II/distributed/tria.h>
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Base class for storing the coefficients of a low-storage explicit RK method
+/** Low-storage methods are not stored as a Butcher tableau, but with the coefficients of their register updates.
+ *
+ *  Williamson 2N form (Williamson, 1980), with the solution S1 and the register S2:
+ *  \f[
+ *      S_2 := A_i S_2 + \Delta t F(S_1), \qquad S_1 := S_1 + B_i S_2, \qquad i = 0, \dots, s-1,
+ *  \f]
+ *  where \f$ A_0 = 0 \f$.
+ *
+ *  Ketcheson 3S* form (Ketcheson, 2010), with the solution S1, the register S2 and the previous solution S3:
+ *  \f[
+ *      S_2 := S_2 + \delta_i S_1, \qquad
+ *      S_1 := \gamma_{i0} S_1 + \gamma_{i1} S_2 + \gamma_{i2} S_3 + \beta_i \Delta t F(S_1), \qquad i = 0, \dots, s-1,
+ *  \f]
+ *  starting from \f$ S_2 = 0 \f$ and \f$ S_3 = S_1 = u^n \f$. The embedded solution, if any, is
+ *  \f[
+ *      \hat{u}^{n+1} = \frac{S_2 + \delta_s S_1 + \delta_{s+1} S_3}{\sum_{j=0}^{s+1} \delta_j}.
+ *  \f]
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LowStorageRKTableauBase
+{
+public:
+    /// Register formulation of the low-storage method
+    enum LowStorageFormEnum {
+        williamson_2N, ///Two registers: the solution and the accumulated stage derivatives
+        ketcheson_3Sstar ///Three registers: the solution, the accumulated stages and the previous solution
+    };
+
+    /// Default constructor that will set the constants.
+    LowStorageRKTableauBase(const int n_rk_stages, const LowStorageFormEnum low_storage_form,
+                            const bool has_embedded_method, const std::string rk_method_string_input);
+
+    /// Destructor
+    virtual ~LowStorageRKTableauBase() = default;
+
+    /// Number of stages
+    const int n_rk_stages;
+
+    /// Register formulation
+    const LowStorageFormEnum low_storage_form;
+
+    /// Flag indicating that the delta coefficients define an embedded solution
+    const bool has_embedded_method;
+
+    /// Returns the 2N coefficient A at stage i
+    double get_A(const int i) const;
+
+    /// Returns the 2N coefficient B at stage i
+    double get_B(const int i) const;
+
+    /// Returns the 3S* coefficient gamma at stage i for the register j
+    double get_gamma(const int i, const int j) const;
+
+    /// Returns the 3S* coefficient beta at stage i
+    double get_beta(const int i) const;
+
+    /// Returns the 3S* coefficient delta at position i
+    double get_delta(const int i) const;
+
+    /// Returns the stage time fraction "c" at stage i
+    double get_c(const int i) const;
+
+    /// Calls the setters of the coefficients
+    void set_tableau();
+
+protected:
+
+    dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
+
+    /// String identifying the RK method
+    const std::string rk_method_string;
+
+    /// 2N coefficients A
+    dealii::Table<1,double> coefficients_A;
+
+    /// 2N coefficients B
+    dealii::Table<1,double> coefficients_B;
+
+    /// 3S* coefficients gamma, stored as [stage][register]
+    dealii::Table<2,double> coefficients_gamma;
+
+    /// 3S* coefficients beta
+    dealii::Table<1,double> coefficients_beta;
+
+    /// 3S* coefficients delta, of size n_rk_stages+2
+    dealii::Table<1,double> coefficients_delta;
+
+    /// Stage time fractions "c"
+    dealii::Table<1,double> coefficients_c;
+
+    /// Setter for the coefficients of the register updates
+    virtual void set_coefficients() = 0;
+
+    /// Setter for coefficients_c
+    virtual void set_c() = 0;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,99 @@
+#include "low_storage_runge_kutta_methods.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void LSRK3Williamson2N<dim,real,MeshType> :: set_coefficients()
+{
+    const double A_values[3] = {0.0, -5.0/9.0, -153.0/128.0};
+    this->coefficients_A.fill(A_values);
+    const double B_values[3] = {1.0/3.0, 15.0/16.0, 8.0/15.0};
+    this->coefficients_B.fill(B_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void LSRK3Williamson2N<dim,real,MeshType> :: set_c()
+{
+    const double c_values[3] = {0.0, 1.0/3.0, 3.0/4.0};
+    this->coefficients_c.fill(c_values);
+}
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void LSRK4CarpenterKennedy2N<dim,real,MeshType> :: set_coefficients()
+{
+    const double A_values[5] = {
+        0.0,
+        -567301805773.0/1357537059087.0,
+        -2404267990393.0/2016746695238.0,
+        -3550918686646.0/2091501179385.0,
+        -1275806237668.0/842570457699.0};
+    this->coefficients_A.fill(A_values);
+    const double B_values[5] = {
+        1432997174477.0/9575080441755.0,
+        5161836677717.0/13612068292357.0,
+        1720146321549.0/2090206949498.0,
+        3134564353537.0/4481467310338.0,
+        2277821191437.0/14882151754819.0};
+    this->coefficients_B.fill(B_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void LSRK4CarpenterKennedy2N<dim,real,MeshType> :: set_c()
+{
+    const double c_values[5] = {
+        0.0,
+        1432997174477.0/9575080441755.0,
+        2526269341429.0/6820363962896.0,
+        2006345519317.0/3224310063776.0,
+        2802321613138.0/2924317926251.0};
+    this->coefficients_c.fill(c_values);
+}
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void SSPRK3Embedded3Sstar<dim,real,MeshType> :: set_coefficients()
+{
+    // u1 = u + dt F(u); u2 = 3/4 u + 1/4 u1 + 1/4 dt F(u1); u^{n+1} = 1/3 u + 2/3 u2 + 2/3 dt F(u2)
+    const double gamma_values[9] = {1.0,     0.0, 0.0,
+                                    0.25,    0.0, 0.75,
+                                    2.0/3.0, 0.0, 1.0/3.0};
+    this->coefficients_gamma.fill(gamma_values);
+    const double beta_values[3] = {1.0, 0.25, 2.0/3.0};
+    this->coefficients_beta.fill(beta_values);
+    // Embedded solution 2 u2 - u^n
+    const double delta_values[5] = {0.0, 0.0, 2.0, 0.0, -1.0};
+    this->coefficients_delta.fill(delta_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void SSPRK3Embedded3Sstar<dim,real,MeshType> :: set_c()
+{
+    const double c_values[3] = {0.0, 1.0, 0.5};
+    this->coefficients_c.fill(c_values);
+}
+
+//##################################################################
+
+template class LSRK3Williamson2N<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class LSRK3Williamson2N<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class LSRK3Williamson2N<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+template class LSRK4CarpenterKennedy2N<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class LSRK4CarpenterKennedy2N<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class LSRK4CarpenterKennedy2N<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+template class SSPRK3Embedded3Sstar<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class SSPRK3Embedded3Sstar<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class SSPRK3Embedded3Sstar<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
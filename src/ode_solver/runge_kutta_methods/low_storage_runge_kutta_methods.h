@@ -0,0 +1,78 @@
+#ifndef __LOW_STORAGE_RUNGE_KUTTA_METHODS__
+#define __LOW_STORAGE_RUNGE_KUTTA_METHODS__
+
+#include "low_storage_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Three-stage third-order 2N method (Williamson, 1980)
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LSRK3Williamson2N: public LowStorageRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    explicit LSRK3Williamson2N(const std::string rk_method_string_input)
+        : LowStorageRKTableauBase<dim,real,MeshType>(3, LowStorageRKTableauBase<dim,real,MeshType>::williamson_2N, false, rk_method_string_input) { }
+
+protected:
+    /// Setter for the 2N coefficients
+    void set_coefficients() override;
+
+    /// Setter for coefficients_c
+    void set_c() override;
+};
+
+/// Five-stage fourth-order 2N method (Carpenter and Kennedy, 1994)
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LSRK4CarpenterKennedy2N: public LowStorageRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    explicit LSRK4CarpenterKennedy2N(const std::string rk_method_string_input)
+        : LowStorageRKTableauBase<dim,real,MeshType>(5, LowStorageRKTableauBase<dim,real,MeshType>::williamson_2N, false, rk_method_string_input) { }
+
+protected:
+    /// Setter for the 2N coefficients
+    void set_coefficients() override;
+
+    /// Setter for coefficients_c
+    void set_c() override;
+};
+
+/// Third-order strong stability preserving RK in 3S* form, with an embedded second-order solution
+/** The stages of the Shu-Osher form only involve the current stage and u^n, such that S2 is only used
+ *  to accumulate the embedded solution \f$ \hat{u}^{n+1} = 2 u^{(2)} - u^n \f$, which is Heun's method.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class SSPRK3Embedded3Sstar: public LowStorageRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    explicit SSPRK3Embedded3Sstar(const std::string rk_method_string_input)
+        : LowStorageRKTableauBase<dim,real,MeshType>(3, LowStorageRKTableauBase<dim,real,MeshType>::ketcheson_3Sstar, true, rk_method_string_input) { }
+
+protected:
+    /// Setter for the 3S* coefficients
+    void set_coefficients() override;
+
+    /// Setter for coefficients_c
+    void set_c() override;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
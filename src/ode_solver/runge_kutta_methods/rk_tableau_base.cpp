@@ -21,6 +21,7 @@ void RKTableauBase<dim,real, MeshType> :: set_tableau ()
     set_a();
     set_b();
     set_c();
+    set_b_hat();
     pcout << "Assigned RK method: " << rk_method_string << std::endl;
 }
 
@@ -42,6 +43,18 @@ double RKTableauBase<dim,real, MeshType> :: get_c (const int i) const
     return butcher_tableau_c[i];
 }
 
+template <int dim, typename real, typename MeshType> 
+double RKTableauBase<dim,real, MeshType> :: get_b_hat (const int i) const
+{
+    return butcher_tableau_b_hat[i];
+}
+
+template <int dim, typename real, typename MeshType> 
+bool RKTableauBase<dim,real, MeshType> :: has_embedded_method () const
+{
+    return butcher_tableau_b_hat.size(0) > 0;
+}
+
 template class RKTableauBase<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
 template class RKTableauBase<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
 #if PHILIP_DIM != 1
@@ -34,6 +34,12 @@ public:
     /// Returns Butcher tableau "c" coefficient at position [i]
     double get_c(const int i) const;
 
+    /// Returns the embedded "b hat" coefficient at position [i]
+    double get_b_hat(const int i) const;
+
+    /// Returns true if the method has embedded weights "b hat"
+    bool has_embedded_method() const;
+
     /// Calls setters for butcher tableau
     void set_tableau();
     
@@ -52,6 +58,9 @@ protected:
     
     /// Butcher tableau "c"
     dealii::Table<1,double> butcher_tableau_c;
+
+    /// Embedded weights "b hat" of the lower order solution; empty if the method has none
+    dealii::Table<1,double> butcher_tableau_b_hat;
     
     /// Setter for butcher_tableau_a
     virtual void set_a() = 0;
@@ -62,6 +71,9 @@ protected:
     /// Setter for butcher_tableau_c
     virtual void set_c() = 0;
 
+    /// Setter for butcher_tableau_b_hat; does nothing for methods without embedded weights
+    virtual void set_b_hat() {}
+
 
 };
 
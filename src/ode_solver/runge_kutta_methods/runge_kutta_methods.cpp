@@ -47,6 +47,76 @@ void RK4Explicit<dim,real,MeshType> :: set_c()
     this->butcher_tableau_c.fill(butcher_tableau_c_values);
 }
 
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void BogackiShampine32Explicit<dim,real,MeshType> :: set_a()
+{
+    const double butcher_tableau_a_values[16] = {0,0,0,0,
+                                                 0.5,0,0,0,
+                                                 0,0.75,0,0,
+                                                 2.0/9.0,1.0/3.0,4.0/9.0,0};
+    this->butcher_tableau_a.fill(butcher_tableau_a_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void BogackiShampine32Explicit<dim,real,MeshType> :: set_b()
+{
+    const double butcher_tableau_b_values[4] = {2.0/9.0, 1.0/3.0, 4.0/9.0, 0};
+    this->butcher_tableau_b.fill(butcher_tableau_b_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void BogackiShampine32Explicit<dim,real,MeshType> :: set_c()
+{
+    const double butcher_tableau_c_values[4] = {0, 0.5, 0.75, 1.0};
+    this->butcher_tableau_c.fill(butcher_tableau_c_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void BogackiShampine32Explicit<dim,real,MeshType> :: set_b_hat()
+{
+    const double butcher_tableau_b_hat_values[4] = {7.0/24.0, 0.25, 1.0/3.0, 0.125};
+    this->butcher_tableau_b_hat.reinit(4);
+    this->butcher_tableau_b_hat.fill(butcher_tableau_b_hat_values);
+}
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void DormandPrince54Explicit<dim,real,MeshType> :: set_a()
+{
+    const double butcher_tableau_a_values[49] = {
+        0,0,0,0,0,0,0,
+        1.0/5.0,0,0,0,0,0,0,
+        3.0/40.0,9.0/40.0,0,0,0,0,0,
+        44.0/45.0,-56.0/15.0,32.0/9.0,0,0,0,0,
+        19372.0/6561.0,-25360.0/2187.0,64448.0/6561.0,-212.0/729.0,0,0,0,
+        9017.0/3168.0,-355.0/33.0,46732.0/5247.0,49.0/176.0,-5103.0/18656.0,0,0,
+        35.0/384.0,0,500.0/1113.0,125.0/192.0,-2187.0/6784.0,11.0/84.0,0};
+    this->butcher_tableau_a.fill(butcher_tableau_a_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void DormandPrince54Explicit<dim,real,MeshType> :: set_b()
+{
+    const double butcher_tableau_b_values[7] = {35.0/384.0, 0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0, 0};
+    this->butcher_tableau_b.fill(butcher_tableau_b_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void DormandPrince54Explicit<dim,real,MeshType> :: set_c()
+{
+    const double butcher_tableau_c_values[7] = {0, 1.0/5.0, 3.0/10.0, 4.0/5.0, 8.0/9.0, 1.0, 1.0};
+    this->butcher_tableau_c.fill(butcher_tableau_c_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void DormandPrince54Explicit<dim,real,MeshType> :: set_b_hat()
+{
+    const double butcher_tableau_b_hat_values[7] = {5179.0/57600.0, 0, 7571.0/16695.0, 393.0/640.0, -92097.0/339200.0, 187.0/2100.0, 1.0/40.0};
+    this->butcher_tableau_b_hat.reinit(7);
+    this->butcher_tableau_b_hat.fill(butcher_tableau_b_hat_values);
+}
+
 //##################################################################
 template <int dim, typename real, typename MeshType>
 void EulerExplicit<dim,real,MeshType> :: set_a()
@@ -130,6 +200,18 @@ template class RK4Explicit<PHILIP_DIM, double, dealii::parallel::shared::Triangu
     template class RK4Explicit<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
 #endif
 
+template class BogackiShampine32Explicit<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class BogackiShampine32Explicit<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class BogackiShampine32Explicit<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+template class DormandPrince54Explicit<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class DormandPrince54Explicit<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class DormandPrince54Explicit<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
 template class EulerExplicit<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
 template class EulerExplicit<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 #if PHILIP_DIM != 1
@@ -54,6 +54,60 @@ protected:
     void set_c() override;
 };
 
+/// Bogacki-Shampine 3(2) explicit RK with an embedded second-order solution
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class BogackiShampine32Explicit: public RKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    BogackiShampine32Explicit(const int n_rk_stages, const std::string rk_method_string_input) 
+        : RKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for butcher_tableau_a
+    void set_a() override;
+
+    /// Setter for butcher_tableau_b
+    void set_b() override;
+
+    /// Setter for butcher_tableau_c
+    void set_c() override;
+
+    /// Setter for butcher_tableau_b_hat
+    void set_b_hat() override;
+};
+
+/// Dormand-Prince 5(4) explicit RK with an embedded fourth-order solution
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class DormandPrince54Explicit: public RKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    DormandPrince54Explicit(const int n_rk_stages, const std::string rk_method_string_input) 
+        : RKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for butcher_tableau_a
+    void set_a() override;
+
+    /// Setter for butcher_tableau_b
+    void set_b() override;
+
+    /// Setter for butcher_tableau_c
+    void set_c() override;
+
+    /// Setter for butcher_tableau_b_hat
+    void set_b_hat() override;
+};
+
 /// Forward Euler (explicit) 
 #if PHILIP_DIM==1
 template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
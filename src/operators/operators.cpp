@@ -33,10 +33,27 @@
 #include <CoDiPack/include/codi.hpp>
 
 #include "operators.h"
+#include "sum_factorization_kernels.hpp"
 
 namespace PHiLiP {
 namespace OPERATOR {
 
+/// Rank of this processor in MPI_COMM_WORLD.
+/** Only queried once, such that operators can be constructed within the threads
+ *  assembling the residual without calling MPI.
+ */
+static unsigned int mpi_rank_world()
+{
+    static const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    return mpi_rank;
+}
+
+/// Pointer to the row-major storage of a one-dimensional basis, nullptr if it is empty.
+static const double * basis_data(const dealii::FullMatrix<double> &basis)
+{
+    return (basis.m() == 0 || basis.n() == 0) ? nullptr : &basis(0,0);
+}
+
 //Constructor
 template <int dim, int n_faces>
 OperatorsBase<dim,n_faces>::OperatorsBase(
@@ -48,7 +65,7 @@ OperatorsBase<dim,n_faces>::OperatorsBase(
     , nstate(nstate_input)
     , max_grid_degree_check(grid_degree_input)
     , mpi_communicator(MPI_COMM_WORLD)
-    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
+    , pcout(std::cout, mpi_rank_world()==0)
 {}
 
 template <int dim, int n_faces>
@@ -201,6 +218,27 @@ void SumFactorizedOperators<dim,n_faces>::matrix_vector_mult(
     const dealii::FullMatrix<double> &basis_z,
     const bool adding,
     const double factor) 
+{
+    const unsigned int rows[3]    = {basis_x.m(), basis_y.m(), basis_z.m()};
+    const unsigned int columns[3] = {basis_x.n(), basis_y.n(), basis_z.n()};
+    const bool computed = SumFactorizationKernels::matrix_vector_mult_fixed_size<dim,false>(
+        rows, columns, input_vect.size(), output_vect.size(), input_vect.data(), output_vect.data(),
+        basis_data(basis_x), basis_data(basis_y), basis_data(basis_z),
+        adding, factor);
+    if (!computed) {
+        matrix_vector_mult_generic(input_vect, output_vect, basis_x, basis_y, basis_z, adding, factor);
+    }
+}
+
+template <int dim, int n_faces>  
+void SumFactorizedOperators<dim,n_faces>::matrix_vector_mult_generic(
+    const std::vector<double> &input_vect,
+    std::vector<double> &output_vect,
+    const dealii::FullMatrix<double> &basis_x,
+    const dealii::FullMatrix<double> &basis_y,
+    const dealii::FullMatrix<double> &basis_z,
+    const bool adding,
+    const double factor) 
 {
     //assert that each basis matrix is of size (rows x columns)
     const unsigned int rows_x    = basis_x.m();
@@ -490,6 +528,23 @@ void SumFactorizedOperators<dim,n_faces>::inner_product(
     }
     assert(weight_vect.size() == input_vect.size()); 
 
+    //the fixed-size kernels apply the transpose directly, without copying the basis
+    constexpr unsigned int max_n_1D = SumFactorizationKernels::max_n_rows_1D;
+    constexpr unsigned int max_n_quad = max_n_1D * ((dim>1) ? max_n_1D : 1) * ((dim>2) ? max_n_1D : 1);
+    if(input_vect.size() <= max_n_quad){
+        double weighted_input[max_n_quad];
+        for(unsigned int iquad=0; iquad<input_vect.size(); iquad++){
+            weighted_input[iquad] = input_vect[iquad] * weight_vect[iquad];
+        }
+        const unsigned int rows[3]    = {rows_x, rows_y, rows_z};
+        const unsigned int columns[3] = {columns_x, columns_y, columns_z};
+        const bool computed = SumFactorizationKernels::matrix_vector_mult_fixed_size<dim,true>(
+            rows, columns, input_vect.size(), output_vect.size(), weighted_input, output_vect.data(),
+            basis_data(basis_x), basis_data(basis_y), basis_data(basis_z),
+            adding, factor);
+        if(computed) return;
+    }
+
     dealii::FullMatrix<double> basis_x_trans(columns_x, rows_x);
     dealii::FullMatrix<double> basis_y_trans(columns_y, rows_y);
     dealii::FullMatrix<double> basis_z_trans(columns_z, rows_z);
@@ -532,6 +587,124 @@ void SumFactorizedOperators<dim,n_faces>::inner_product_1D(
     this->inner_product(input_vect, weight_vect, output_vect, basis_x, basis_x, basis_x, adding, factor);
 }
 
+template <int dim, int n_faces>  
+template <int n_lanes>
+void SumFactorizedOperators<dim,n_faces>::matrix_vector_mult_1D_interleaved(
+    const std::vector<std::array<double,n_lanes>> &input_vect,
+    std::vector<std::array<double,n_lanes>> &output_vect,
+    const dealii::FullMatrix<double> &basis_x,
+    const bool adding,
+    const double factor)
+{
+    const unsigned int rows[3]    = {basis_x.m(), basis_x.m(), basis_x.m()};
+    const unsigned int columns[3] = {basis_x.n(), basis_x.n(), basis_x.n()};
+    const bool computed = SumFactorizationKernels::matrix_vector_mult_fixed_size<dim,false,n_lanes>(
+        rows, columns, input_vect.size(), output_vect.size(), input_vect[0].data(), output_vect[0].data(),
+        basis_data(basis_x), basis_data(basis_x), basis_data(basis_x),
+        adding, factor);
+    if(computed) return;
+
+    //generic path, one lane at a time
+    std::vector<double> input_lane(input_vect.size());
+    std::vector<double> output_lane(output_vect.size());
+    for(int ilane=0; ilane<n_lanes; ilane++){
+        for(unsigned int i=0; i<input_vect.size(); i++){
+            input_lane[i] = input_vect[i][ilane];
+        }
+        for(unsigned int i=0; i<output_vect.size(); i++){
+            output_lane[i] = output_vect[i][ilane];
+        }
+        this->matrix_vector_mult_generic(input_lane, output_lane, basis_x, basis_x, basis_x, adding, factor);
+        for(unsigned int i=0; i<output_vect.size(); i++){
+            output_vect[i][ilane] = output_lane[i];
+        }
+    }
+}
+
+template <int dim, int n_faces>  
+template <int n_lanes>
+void SumFactorizedOperators<dim,n_faces>::inner_product_1D_interleaved(
+    const std::vector<std::array<double,n_lanes>> &input_vect,
+    const std::vector<double> &weight_vect,
+    std::vector<std::array<double,n_lanes>> &output_vect,
+    std::vector<std::array<double,n_lanes>> &weighted_input_vect,
+    const dealii::FullMatrix<double> &basis_x,
+    const bool adding,
+    const double factor)
+{
+    assert(weight_vect.size() == input_vect.size()); 
+    weighted_input_vect.resize(input_vect.size());
+    for(unsigned int iquad=0; iquad<input_vect.size(); iquad++){
+        for(int ilane=0; ilane<n_lanes; ilane++){
+            weighted_input_vect[iquad][ilane] = input_vect[iquad][ilane] * weight_vect[iquad];
+        }
+    }
+    const unsigned int rows[3]    = {basis_x.m(), basis_x.m(), basis_x.m()};
+    const unsigned int columns[3] = {basis_x.n(), basis_x.n(), basis_x.n()};
+    const bool computed = SumFactorizationKernels::matrix_vector_mult_fixed_size<dim,true,n_lanes>(
+        rows, columns, weighted_input_vect.size(), output_vect.size(), weighted_input_vect[0].data(), output_vect[0].data(),
+        basis_data(basis_x), basis_data(basis_x), basis_data(basis_x),
+        adding, factor);
+    if(computed) return;
+
+    //generic path, one lane at a time
+    std::vector<double> input_lane(input_vect.size());
+    std::vector<double> output_lane(output_vect.size());
+    for(int ilane=0; ilane<n_lanes; ilane++){
+        for(unsigned int i=0; i<input_vect.size(); i++){
+            input_lane[i] = input_vect[i][ilane];
+        }
+        for(unsigned int i=0; i<output_vect.size(); i++){
+            output_lane[i] = output_vect[i][ilane];
+        }
+        this->inner_product(input_lane, weight_vect, output_lane, basis_x, basis_x, basis_x, adding, factor);
+        for(unsigned int i=0; i<output_vect.size(); i++){
+            output_vect[i][ilane] = output_lane[i];
+        }
+    }
+}
+
+template <int dim, int n_faces>  
+template <int n_lanes>
+void SumFactorizedOperators<dim,n_faces>::divergence_matrix_vector_mult_1D_interleaved(
+    const std::array<std::vector<std::array<double,n_lanes>>,dim> &input_vect,
+    std::vector<std::array<double,n_lanes>> &output_vect,
+    const dealii::FullMatrix<double> &basis,
+    const dealii::FullMatrix<double> &gradient_basis)
+{
+    const unsigned int rows_vol[3]     = {basis.m(), basis.m(), basis.m()};
+    const unsigned int columns_vol[3]  = {basis.n(), basis.n(), basis.n()};
+    bool computed = (basis.m() == gradient_basis.m()) && (basis.n() == gradient_basis.n());
+    for(int idim=0; idim<dim && computed; idim++){
+        //first one doesn't add in the divergence
+        computed = SumFactorizationKernels::matrix_vector_mult_fixed_size<dim,false,n_lanes>(
+            rows_vol, columns_vol, input_vect[idim].size(), output_vect.size(), input_vect[idim][0].data(), output_vect[0].data(),
+            basis_data((idim==0) ? gradient_basis : basis),
+            basis_data((idim==1) ? gradient_basis : basis),
+            basis_data((idim==2) ? gradient_basis : basis),
+            (idim > 0), 1.0);
+    }
+    if(computed) return;
+
+    //generic path, one lane at a time
+    dealii::Tensor<1,dim,std::vector<double>> input_lane;
+    std::vector<double> output_lane(output_vect.size());
+    for(int idim=0; idim<dim; idim++){
+        input_lane[idim].resize(input_vect[idim].size());
+    }
+    for(int ilane=0; ilane<n_lanes; ilane++){
+        for(int idim=0; idim<dim; idim++){
+            for(unsigned int i=0; i<input_vect[idim].size(); i++){
+                input_lane[idim][i] = input_vect[idim][i][ilane];
+            }
+        }
+        this->divergence_matrix_vector_mult_1D(input_lane, output_lane, basis, gradient_basis);
+        for(unsigned int i=0; i<output_vect.size(); i++){
+            output_vect[i][ilane] = output_lane[i];
+        }
+    }
+}
+
 template <int dim, int n_faces>  
 void SumFactorizedOperators<dim,n_faces>::divergence_two_pt_flux_Hadamard_product(
     const dealii::Tensor<1,dim,dealii::FullMatrix<double>> &input_mat,
@@ -2943,6 +3116,73 @@ void local_flux_basis_stiffness<dim,nstate,n_faces>::build_1D_volume_state_opera
 template class OperatorsBase <PHILIP_DIM, 2*PHILIP_DIM>;
 
 template class SumFactorizedOperators <PHILIP_DIM, 2*PHILIP_DIM>;
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<1>(
+    const std::vector<std::array<double,1>> &, std::vector<std::array<double,1>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<1>(
+    const std::vector<std::array<double,1>> &, const std::vector<double> &, std::vector<std::array<double,1>> &, std::vector<std::array<double,1>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<1>(
+    const std::array<std::vector<std::array<double,1>>,PHILIP_DIM> &, std::vector<std::array<double,1>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<2>(
+    const std::vector<std::array<double,2>> &, std::vector<std::array<double,2>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<2>(
+    const std::vector<std::array<double,2>> &, const std::vector<double> &, std::vector<std::array<double,2>> &, std::vector<std::array<double,2>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<2>(
+    const std::array<std::vector<std::array<double,2>>,PHILIP_DIM> &, std::vector<std::array<double,2>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<3>(
+    const std::vector<std::array<double,3>> &, std::vector<std::array<double,3>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<3>(
+    const std::vector<std::array<double,3>> &, const std::vector<double> &, std::vector<std::array<double,3>> &, std::vector<std::array<double,3>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<3>(
+    const std::array<std::vector<std::array<double,3>>,PHILIP_DIM> &, std::vector<std::array<double,3>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<4>(
+    const std::vector<std::array<double,4>> &, std::vector<std::array<double,4>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<4>(
+    const std::vector<std::array<double,4>> &, const std::vector<double> &, std::vector<std::array<double,4>> &, std::vector<std::array<double,4>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<4>(
+    const std::array<std::vector<std::array<double,4>>,PHILIP_DIM> &, std::vector<std::array<double,4>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<5>(
+    const std::vector<std::array<double,5>> &, std::vector<std::array<double,5>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<5>(
+    const std::vector<std::array<double,5>> &, const std::vector<double> &, std::vector<std::array<double,5>> &, std::vector<std::array<double,5>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<5>(
+    const std::array<std::vector<std::array<double,5>>,PHILIP_DIM> &, std::vector<std::array<double,5>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<6>(
+    const std::vector<std::array<double,6>> &, std::vector<std::array<double,6>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<6>(
+    const std::vector<std::array<double,6>> &, const std::vector<double> &, std::vector<std::array<double,6>> &, std::vector<std::array<double,6>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<6>(
+    const std::array<std::vector<std::array<double,6>>,PHILIP_DIM> &, std::vector<std::array<double,6>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+// Lanes of the strong DG cell batches, DGStrong::n_cells_per_batch cells of 1 to 6 states.
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<8>(
+    const std::vector<std::array<double,8>> &, std::vector<std::array<double,8>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<8>(
+    const std::vector<std::array<double,8>> &, const std::vector<double> &, std::vector<std::array<double,8>> &, std::vector<std::array<double,8>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<8>(
+    const std::array<std::vector<std::array<double,8>>,PHILIP_DIM> &, std::vector<std::array<double,8>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<12>(
+    const std::vector<std::array<double,12>> &, std::vector<std::array<double,12>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<12>(
+    const std::vector<std::array<double,12>> &, const std::vector<double> &, std::vector<std::array<double,12>> &, std::vector<std::array<double,12>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<12>(
+    const std::array<std::vector<std::array<double,12>>,PHILIP_DIM> &, std::vector<std::array<double,12>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<16>(
+    const std::vector<std::array<double,16>> &, std::vector<std::array<double,16>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<16>(
+    const std::vector<std::array<double,16>> &, const std::vector<double> &, std::vector<std::array<double,16>> &, std::vector<std::array<double,16>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<16>(
+    const std::array<std::vector<std::array<double,16>>,PHILIP_DIM> &, std::vector<std::array<double,16>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<20>(
+    const std::vector<std::array<double,20>> &, std::vector<std::array<double,20>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<20>(
+    const std::vector<std::array<double,20>> &, const std::vector<double> &, std::vector<std::array<double,20>> &, std::vector<std::array<double,20>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<20>(
+    const std::array<std::vector<std::array<double,20>>,PHILIP_DIM> &, std::vector<std::array<double,20>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::matrix_vector_mult_1D_interleaved<24>(
+    const std::vector<std::array<double,24>> &, std::vector<std::array<double,24>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::inner_product_1D_interleaved<24>(
+    const std::vector<std::array<double,24>> &, const std::vector<double> &, std::vector<std::array<double,24>> &, std::vector<std::array<double,24>> &, const dealii::FullMatrix<double> &, const bool, const double);
+template void SumFactorizedOperators<PHILIP_DIM,2*PHILIP_DIM>::divergence_matrix_vector_mult_1D_interleaved<24>(
+    const std::array<std::vector<std::array<double,24>>,PHILIP_DIM> &, std::vector<std::array<double,24>> &, const dealii::FullMatrix<double> &, const dealii::FullMatrix<double> &);
 
 template class SumFactorizedOperatorsState <PHILIP_DIM, 1, 2*PHILIP_DIM>;
 template class SumFactorizedOperatorsState <PHILIP_DIM, 2, 2*PHILIP_DIM>;
@@ -152,6 +152,19 @@ public:
             const dealii::FullMatrix<double> &basis_z,
             const bool adding = false,
             const double factor = 1.0) override;
+
+    ///Computes the sum-factorized matrix-vector product with dynamically sized temporaries.
+    /** matrix_vector_mult() uses the fixed-size kernels of SumFactorizationKernels for one-dimensional
+    * sizes up to polynomial degree 8, and falls back to this implementation otherwise.
+    */
+    void matrix_vector_mult_generic(
+            const std::vector<double> &input_vect,
+            std::vector<double> &output_vect,
+            const dealii::FullMatrix<double> &basis_x,
+            const dealii::FullMatrix<double> &basis_y,
+            const dealii::FullMatrix<double> &basis_z,
+            const bool adding = false,
+            const double factor = 1.0);
     ///Computes the divergence using the sum factorization matrix-vector multiplication.
     /** Often, we compute a dot product in dim, where each matrix multiplictaion uses
     * sum factorization. Example, consider taking the reference divergence of the reference flux:
@@ -312,6 +325,42 @@ public:
             const bool adding  = false,
             const double factor = 1.0);
 
+    ///Computes the sum-factorized matrix-vector product of n_lanes vectors at once, using the same 1D operator in each direction.
+    /** The vectors are interleaved, such that input_vect[i][l] is the i-th entry of the l-th vector.
+    * Typically, the lanes are the states at a node, which is the layout used by the physics.
+    * The fixed-size kernels then apply each 1D basis entry to all the lanes in their innermost loop.
+    */
+    template <int n_lanes>
+    void matrix_vector_mult_1D_interleaved(
+            const std::vector<std::array<double,n_lanes>> &input_vect,
+            std::vector<std::array<double,n_lanes>> &output_vect,
+            const dealii::FullMatrix<double> &basis_x,
+            const bool adding = false,
+            const double factor = 1.0);
+
+    ///Computes the weighted inner product of n_lanes interleaved vectors, using the same 1D operator in each direction.
+    /** Same as inner_product_1D for each lane. The weights are shared by all the lanes.
+    * weighted_input_vect is a scratch vector provided by the caller, resized to the input size,
+    * such that the calls of a residual assembly do not allocate.
+    */
+    template <int n_lanes>
+    void inner_product_1D_interleaved(
+            const std::vector<std::array<double,n_lanes>> &input_vect,
+            const std::vector<double> &weight_vect,
+            std::vector<std::array<double,n_lanes>> &output_vect,
+            std::vector<std::array<double,n_lanes>> &weighted_input_vect,
+            const dealii::FullMatrix<double> &basis_x,
+            const bool adding = false,
+            const double factor = 1.0);
+
+    ///Computes the divergence of n_lanes interleaved vector fields, using the same 1D operators in each direction.
+    template <int n_lanes>
+    void divergence_matrix_vector_mult_1D_interleaved(
+            const std::array<std::vector<std::array<double,n_lanes>>,dim> &input_vect,
+            std::vector<std::array<double,n_lanes>> &output_vect,
+            const dealii::FullMatrix<double> &basis,
+            const dealii::FullMatrix<double> &gradient_basis);
+
     /// Apply sum-factorization matrix vector multiplication on a surface.
     /** Often times we have to interpolate to a surface, where in multiple dimensions,
     * that's the tensor product of a surface operator with volume operators. This simplifies
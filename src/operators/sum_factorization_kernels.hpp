@@ -0,0 +1,268 @@
+#ifndef __SUM_FACTORIZATION_KERNELS_H__
+#define __SUM_FACTORIZATION_KERNELS_H__
+
+#include <deal.II/base/exceptions.h>
+
+namespace PHiLiP {
+namespace OPERATOR {
+/// Fixed-size sum-factorization kernels.
+/** The number of one-dimensional nodes are template arguments, such that the loops are
+ *  fully unrolled by the compiler, the innermost loops run over contiguous entries (vectorizable),
+ *  and the temporaries live on the stack. No heap allocation is performed.
+ *
+ *  The one-dimensional basis are passed as pointers to their row-major storage (dealii::FullMatrix),
+ *  and the tensor-product vectors follow the PHiLiP convention where x runs the fastest, then y, and z runs the slowest.
+ */
+namespace SumFactorizationKernels {
+
+/// Largest number of one-dimensional dofs for which a fixed-size kernel is instantiated.
+/** Corresponds to polynomial degree 8. Larger sizes use the generic implementation.
+ */
+constexpr unsigned int max_n_points_1D = 9;
+
+/// Largest difference between the number of one-dimensional quadrature points and dofs with a fixed-size kernel.
+/** Covers over-integration by up to two points, whether the stored basis maps dofs to quadrature points or
+ *  quadrature points to dofs.
+ */
+constexpr unsigned int max_overintegration = 2;
+
+/// Largest number of rows of a one-dimensional basis with a fixed-size kernel.
+constexpr unsigned int max_n_rows_1D = max_n_points_1D + max_overintegration;
+
+/// Applies a one-dimensional operator in one direction of a tensor-product vector.
+/** The input is seen as an array of size [n_after][n_columns][n_before], and the output as [n_after][n_rows][n_before].
+ *  Interleaved lanes are handled by including them in n_before.
+ *  If transpose is false, the basis is stored as n_rows x n_columns, otherwise it is stored as n_columns x n_rows
+ *  and its transpose is applied.
+ */
+template <int n_rows, int n_columns, int n_before, int n_after, bool transpose>
+inline void apply_1D(
+    const double *basis,
+    const double *input,
+    double       *output)
+{
+    for (int iafter=0; iafter<n_after; ++iafter) {
+        const double *in = input + iafter * n_columns * n_before;
+        double *out = output + iafter * n_rows * n_before;
+        for (int irow=0; irow<n_rows; ++irow) {
+            double *out_row = out + irow * n_before;
+            for (int ibefore=0; ibefore<n_before; ++ibefore) {
+                out_row[ibefore] = 0.0;
+            }
+            for (int icol=0; icol<n_columns; ++icol) {
+                const double basis_val = transpose ? basis[icol * n_rows + irow] : basis[irow * n_columns + icol];
+                const double *in_col = in + icol * n_before;
+                for (int ibefore=0; ibefore<n_before; ++ibefore) {
+                    out_row[ibefore] += basis_val * in_col[ibefore];
+                }
+            }
+        }
+    }
+}
+
+/// Writes or adds the scaled result of a kernel into the output.
+template <int n_entries>
+inline void write_output(
+    const double *result,
+    double       *output,
+    const bool   adding,
+    const double factor)
+{
+    if (adding) {
+        for (int i=0; i<n_entries; ++i) output[i] += factor * result[i];
+    } else {
+        for (int i=0; i<n_entries; ++i) output[i] = factor * result[i];
+    }
+}
+
+/// Fixed-size tensor-product matrix-vector multiplication.
+/** The template sizes are the (rows, columns) of the stored one-dimensional basis in each direction.
+ *  If transpose is true, the transpose of each basis is applied, as in the inner product.
+ *
+ *  The operator is applied to n_lanes vectors at once, stored interleaved such that
+ *  the lane runs the fastest, i.e. entry i of lane l is stored at [i * n_lanes + l].
+ *  The lanes are the innermost loop of every direction.
+ */
+template <int dim, bool transpose, int n_lanes,
+          int m_x, int n_x, int m_y, int n_y, int m_z, int n_z>
+inline void matrix_vector_mult(
+    const double *input,
+    double       *output,
+    const double *basis_x,
+    const double *basis_y,
+    const double *basis_z,
+    const bool   adding,
+    const double factor)
+{
+    // Size of the applied operators.
+    constexpr int rows_x    = transpose ? n_x : m_x;
+    constexpr int columns_x = transpose ? m_x : n_x;
+    constexpr int rows_y    = transpose ? n_y : m_y;
+    constexpr int columns_y = transpose ? m_y : n_y;
+    constexpr int rows_z    = transpose ? n_z : m_z;
+    constexpr int columns_z = transpose ? m_z : n_z;
+
+    // Largest intermediate result, such that two buffers are enough for every direction.
+    constexpr int size_x = rows_x * ((dim>1) ? columns_y : 1) * ((dim>2) ? columns_z : 1);
+    constexpr int size_y = rows_x * ((dim>1) ? rows_y : 1) * ((dim>2) ? columns_z : 1);
+    constexpr int size_z = rows_x * ((dim>1) ? rows_y : 1) * ((dim>2) ? rows_z : 1);
+    constexpr int size_buffer = n_lanes * ((size_x > size_z) ? size_x : size_z);
+
+    double temp_x[size_buffer];
+    if constexpr (dim == 1) {
+        apply_1D<rows_x, columns_x, n_lanes, 1, transpose>(basis_x, input, temp_x);
+        write_output<n_lanes * size_x>(temp_x, output, adding, factor);
+    }
+    if constexpr (dim == 2) {
+        apply_1D<rows_x, columns_x, n_lanes, columns_y, transpose>(basis_x, input, temp_x);
+        double temp_y[n_lanes * size_y];
+        apply_1D<rows_y, columns_y, n_lanes * rows_x, 1, transpose>(basis_y, temp_x, temp_y);
+        write_output<n_lanes * size_y>(temp_y, output, adding, factor);
+    }
+    if constexpr (dim == 3) {
+        apply_1D<rows_x, columns_x, n_lanes, columns_y * columns_z, transpose>(basis_x, input, temp_x);
+        double temp_y[n_lanes * size_y];
+        apply_1D<rows_y, columns_y, n_lanes * rows_x, columns_z, transpose>(basis_y, temp_x, temp_y);
+        apply_1D<rows_z, columns_z, n_lanes * rows_x * rows_y, 1, transpose>(basis_z, temp_y, temp_x);
+        write_output<n_lanes * size_z>(temp_x, output, adding, factor);
+    }
+}
+
+/// Calls the fixed-size kernel of a volume basis (n_rows x n_columns in every direction),
+/// or of a facet basis (1 x n_columns in facet_direction, n_rows x n_columns in the others).
+template <int dim, bool transpose, int n_lanes, int n_rows, int n_columns>
+inline void call_matrix_vector_mult(
+    const int    facet_direction,
+    const double *input,
+    double       *output,
+    const double *basis_x,
+    const double *basis_y,
+    const double *basis_z,
+    const bool   adding,
+    const double factor)
+{
+    constexpr int m = n_rows;
+    constexpr int n = n_columns;
+    if (facet_direction == dim) {
+        matrix_vector_mult<dim, transpose, n_lanes, m, n, m, n, m, n>(input, output, basis_x, basis_y, basis_z, adding, factor);
+    } else if (facet_direction == 0) {
+        matrix_vector_mult<dim, transpose, n_lanes, 1, n, m, n, m, n>(input, output, basis_x, basis_y, basis_z, adding, factor);
+    } else if constexpr (dim > 1) {
+        if (facet_direction == 1) {
+            matrix_vector_mult<dim, transpose, n_lanes, m, n, 1, n, m, n>(input, output, basis_x, basis_y, basis_z, adding, factor);
+        } else if constexpr (dim > 2) {
+            matrix_vector_mult<dim, transpose, n_lanes, m, n, m, n, 1, n>(input, output, basis_x, basis_y, basis_z, adding, factor);
+        }
+    }
+}
+
+/// Selects the fixed-size kernel with n_rows rows, or tries the next number of rows.
+template <int dim, bool transpose, int n_lanes, int n_columns, int n_rows>
+inline bool dispatch_rows(
+    const unsigned int volume_rows,
+    const int    facet_direction,
+    const double *input,
+    double       *output,
+    const double *basis_x,
+    const double *basis_y,
+    const double *basis_z,
+    const bool   adding,
+    const double factor)
+{
+    if constexpr (n_rows > n_columns + static_cast<int>(max_overintegration) || n_rows > static_cast<int>(max_n_rows_1D)) {
+        return false;
+    } else {
+        if (volume_rows != static_cast<unsigned int>(n_rows)) {
+            return dispatch_rows<dim, transpose, n_lanes, n_columns, n_rows+1>(volume_rows, facet_direction, input, output, basis_x, basis_y, basis_z, adding, factor);
+        }
+        call_matrix_vector_mult<dim, transpose, n_lanes, n_rows, n_columns>(facet_direction, input, output, basis_x, basis_y, basis_z, adding, factor);
+        return true;
+    }
+}
+
+/// Selects the fixed-size kernels with n_columns columns, or tries the next number of columns.
+template <int dim, bool transpose, int n_lanes, int n_columns>
+inline bool dispatch_columns(
+    const unsigned int columns,
+    const unsigned int volume_rows,
+    const int    facet_direction,
+    const double *input,
+    double       *output,
+    const double *basis_x,
+    const double *basis_y,
+    const double *basis_z,
+    const bool   adding,
+    const double factor)
+{
+    if constexpr (n_columns > static_cast<int>(max_n_points_1D)) {
+        return false;
+    } else {
+        if (columns != static_cast<unsigned int>(n_columns)) {
+            return dispatch_columns<dim, transpose, n_lanes, n_columns+1>(columns, volume_rows, facet_direction, input, output, basis_x, basis_y, basis_z, adding, factor);
+        }
+        constexpr int first_rows = (n_columns - static_cast<int>(max_overintegration) > 2) ? n_columns - static_cast<int>(max_overintegration) : 2;
+        return dispatch_rows<dim, transpose, n_lanes, n_columns, first_rows>(volume_rows, facet_direction, input, output, basis_x, basis_y, basis_z, adding, factor);
+    }
+}
+
+/// Calls a fixed-size kernel if the basis sizes correspond to one of the instantiated cases.
+/** rows and columns are the sizes of the stored one-dimensional basis in each direction.
+ *  Only the first dim entries are used. The instantiated cases are
+ *  - volume operators, n_rows x n_columns in every direction,
+ *  - facet operators, 1 x n_columns in one direction and n_rows x n_columns in the others,
+ *  for 2 <= n_columns <= max_n_points_1D and |n_rows - n_columns| <= max_overintegration, with n_rows >= 2.
+ *  n_lanes vectors are stored interleaved in input and output, see matrix_vector_mult().
+ *  input_size and output_size are the number of entries of each lane, checked against the basis sizes.
+ *  Returns false if no fixed-size kernel exists for those sizes, in which case nothing is computed.
+ */
+template <int dim, bool transpose, int n_lanes = 1>
+inline bool matrix_vector_mult_fixed_size(
+    const unsigned int (&rows)[3],
+    const unsigned int (&columns)[3],
+    const unsigned int input_size,
+    const unsigned int output_size,
+    const double *input,
+    double       *output,
+    const double *basis_x,
+    const double *basis_y,
+    const double *basis_z,
+    const bool   adding,
+    const double factor)
+{
+    unsigned int n_rows = 1;
+    unsigned int n_columns = 1;
+    for (int idim=0; idim<dim; ++idim) {
+        n_rows *= rows[idim];
+        n_columns *= columns[idim];
+    }
+    //the transpose maps the rows of the stored basis to its columns
+    AssertDimension((transpose ? n_rows : n_columns), input_size);
+    AssertDimension((transpose ? n_columns : n_rows), output_size);
+    (void) input_size;
+    (void) output_size;
+
+    // Every direction has the same number of columns. At most one direction, the facet direction,
+    // has a single row, and the other directions have the same number of rows.
+    int facet_direction = dim;
+    unsigned int volume_rows = 0;
+    for (int idim=0; idim<dim; ++idim) {
+        if (columns[idim] != columns[0]) return false;
+        if (rows[idim] == 1 && facet_direction == dim) {
+            facet_direction = idim;
+        } else if (volume_rows == 0) {
+            volume_rows = rows[idim];
+        } else if (rows[idim] != volume_rows) {
+            return false;
+        }
+    }
+    // A single facet direction in 1D, any number of rows selects the kernel.
+    if (volume_rows == 0) volume_rows = columns[0];
+
+    return dispatch_columns<dim, transpose, n_lanes, 2>(columns[0], volume_rows, facet_direction, input, output, basis_x, basis_y, basis_z, adding, factor);
+}
+
+} // SumFactorizationKernels namespace
+} // OPERATOR namespace
+} // PHiLiP namespace
+
+#endif
@@ -63,6 +63,7 @@ bool FreeFormDeformationParameterization<dim> :: update_mesh_from_design_variabl
     this->high_order_grid->volume_nodes = this->high_order_grid->initial_volume_nodes;
     this->high_order_grid->volume_nodes += dXv;
     this->high_order_grid->volume_nodes.update_ghost_values();
+    this->high_order_grid->mark_volume_nodes_as_modified();
     mesh_updated = true;
     return mesh_updated;
 }
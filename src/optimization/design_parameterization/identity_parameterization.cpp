@@ -68,6 +68,7 @@ bool IdentityParameterization<dim> ::update_mesh_from_design_variables(
     current_volume_nodes = design_var;
     dXv_dXp.vmult(this->high_order_grid->volume_nodes, design_var);
     this->high_order_grid->volume_nodes.update_ghost_values();
+    this->high_order_grid->mark_volume_nodes_as_modified();
     mesh_updated = true;
     return mesh_updated;
 }
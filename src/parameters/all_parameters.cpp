@@ -23,6 +23,7 @@ AllParameters::AllParameters ()
     , artificial_dissipation_param(ArtificialDissipationParam())
     , flow_solver_param(FlowSolverParam())
     , mesh_adaptation_param(MeshAdaptationParam())
+    , mesh_mover_param(MeshMoverParam())
     , functional_param(FunctionalParam())
     , time_refinement_study_param(TimeRefinementStudyParam())
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
@@ -143,6 +144,18 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       dealii::Patterns::Bool(),
                       "Check validty of metric Jacobian when high-order grid is constructed by default. Do not check if false. Not checking is useful if the metric terms are built on the fly with operators, it reduces the memory cost for high polynomial grids. The metric Jacobian is never checked for strong form, regardless of the user input.");
 
+    prm.declare_entry("use_metric_terms_cache", "false",
+                      dealii::Patterns::Bool(),
+                      "Build the metric terms on the fly at every residual evaluation by default. If true, store the strong form metric terms of each cell and only rebuild them when the volume nodes change. Useful for explicit time stepping on fixed curvilinear grids, at the cost of storing the metric cofactor on every volume and facet cubature node.");
+
+    prm.declare_entry("use_cell_batches_in_volume_terms", "false",
+                      dealii::Patterns::Bool(),
+                      "Assemble the volume terms one cell at a time by default. If true, the strong form assembles the volume terms of 4 cells of the same polynomial degree together, with the states of the 4 cells interleaved in the sum-factorization and the convective fluxes of the 4 cells evaluated in one call. Only for the conservative strong form, i.e. without split form. Best combined with use_metric_terms_cache, since the volume metric terms are otherwise built both for the batch and for the face terms of the cell loop.");
+
+    prm.declare_entry("n_threads_per_process", "1",
+                      dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                      "Number of threads used by each MPI process to assemble the residual. 1 by default, i.e. pure MPI. If larger than 1, the locally owned cells are colored and the cells of the same color are assembled concurrently. The derivatives (dRdW, dRdX, d2R) are differentiated by the same threads, and their matrix rows are added by one thread at a time.");
+
     prm.declare_entry("energy_file", "energy_file",
                       dealii::Patterns::FileName(dealii::Patterns::FileName::FileType::input),
                       "Input file for energy test.");
@@ -168,6 +181,7 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       " shock_1d | "
                       " euler_naca0012 | "
                       " reduced_order | "
+                      " hyper_reduced_order | "
                       " convection_diffusion_periodicity |"
                       " POD_adaptation | "
                       " POD_adaptive_sampling | "
@@ -181,6 +195,7 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       " homogeneous_isotropic_turbulence_initialization_check | "
                       " time_refinement_study | "
                       " time_refinement_study_reference | "
+                      " embedded_error_control_check | "
                       " burgers_energy_conservation_rrk | "
                       " euler_entropy_conserving_split_forms_check | "
                       " h_refinement_study_isentropic_vortex | "
@@ -207,6 +222,7 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       "  euler_naca0012 | "
                       "  convection_diffusion_periodicity |"
                       "  reduced_order | "
+                      "  hyper_reduced_order | "
                       "  POD_adaptation | "
                       "  POD_adaptive_sampling | "
                       "  adaptive_sampling_testing | "
@@ -219,6 +235,7 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       "  homogeneous_isotropic_turbulence_initialization_check | "
                       "  time_refinement_study | "
                       "  time_refinement_study_reference | "
+                      "  embedded_error_control_check | "
                       "  burgers_energy_conservation_rrk | "
                       "  euler_entropy_conserving_split_forms_check | "
                       "  h_refinement_study_isentropic_vortex | "
@@ -311,6 +328,21 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       dealii::Patterns::Bool(),
                       "Outputs the surface solution vtk files. False by default");
 
+    prm.declare_entry("enable_asynchronous_vtk_output", "false",
+                      dealii::Patterns::Bool(),
+                      "Compresses and writes the vtk files on a background thread such that time stepping continues "
+                      "once the output patches are built. Holds a copy of the patches until the files are written. False by default.");
+
+    prm.declare_entry("enable_performance_profiling", "false",
+                      dealii::Patterns::Bool(),
+                      "Records wall-clock timers of the residual, solver and output phases and event counters. "
+                      "Their min/max/avg over the processes and load imbalance are written at the end of the flow solver "
+                      "run and of the test. False by default.");
+
+    prm.declare_entry("performance_profiling_filename_prefix", "performance_summary",
+                      dealii::Patterns::FileName(dealii::Patterns::FileName::FileType::output),
+                      "Prefix of the performance summary files <prefix>.json and <prefix>.csv.");
+
     prm.declare_entry("do_renumber_dofs", "true",
                       dealii::Patterns::Bool(),
                       "Flag for renumbering DOFs using Cuthill-McKee renumbering. True by default. Set to false if doing 3D unsteady flow simulations.");
@@ -336,6 +368,7 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
     Parameters::GridRefinementStudyParam::declare_parameters (prm);
     Parameters::ArtificialDissipationParam::declare_parameters (prm);
     Parameters::MeshAdaptationParam::declare_parameters (prm);
+    Parameters::MeshMoverParam::declare_parameters (prm);
     Parameters::FlowSolverParam::declare_parameters (prm);
     Parameters::FunctionalParam::declare_parameters (prm);
     Parameters::TimeRefinementStudyParam::declare_parameters (prm);
@@ -379,6 +412,7 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
     else if (test_string == "euler_naca_optimization")                  { test_type = euler_naca_optimization; }
     else if (test_string == "shock_1d")                                 { test_type = shock_1d; }
     else if (test_string == "reduced_order")                            { test_type = reduced_order; }
+    else if (test_string == "hyper_reduced_order")                      { test_type = hyper_reduced_order; }
     else if (test_string == "POD_adaptation")                           { test_type = POD_adaptation; }
     else if (test_string == "POD_adaptive_sampling")                    { test_type = POD_adaptive_sampling; }
     else if (test_string == "adaptive_sampling_testing")                { test_type = adaptive_sampling_testing; }
@@ -393,6 +427,7 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
                                                                         { test_type = homogeneous_isotropic_turbulence_initialization_check; }
     else if (test_string == "time_refinement_study")                    { test_type = time_refinement_study; }
     else if (test_string == "time_refinement_study_reference")          { test_type = time_refinement_study_reference; }
+    else if (test_string == "embedded_error_control_check")             { test_type = embedded_error_control_check; }
     else if (test_string == "burgers_energy_conservation_rrk")          { test_type = burgers_energy_conservation_rrk; }
     else if (test_string == "euler_entropy_conserving_split_forms_check") 
                                                                         { test_type = euler_entropy_conserving_split_forms_check; }
@@ -432,6 +467,9 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
     if(!use_weak_form){
         check_valid_metric_Jacobian = false;
     }
+    use_metric_terms_cache = prm.get_bool("use_metric_terms_cache");
+    use_cell_batches_in_volume_terms = prm.get_bool("use_cell_batches_in_volume_terms");
+    n_threads_per_process = prm.get_integer("n_threads_per_process");
 
     energy_file = prm.get("energy_file");
 
@@ -488,6 +526,9 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
     output_high_order_grid = prm.get_bool("output_high_order_grid");
     enable_higher_order_vtk_output = prm.get_bool("enable_higher_order_vtk_output");
     output_face_results_vtk = prm.get_bool("output_face_results_vtk");
+    enable_asynchronous_vtk_output = prm.get_bool("enable_asynchronous_vtk_output");
+    enable_performance_profiling = prm.get_bool("enable_performance_profiling");
+    performance_profiling_filename_prefix = prm.get("performance_profiling_filename_prefix");
     do_renumber_dofs = prm.get_bool("do_renumber_dofs");
 
     const std::string renumber_dofs_type_string = prm.get("renumber_dofs_type");
@@ -497,6 +538,11 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
 
     pcout << "Parsing linear solver subsection..." << std::endl;
     linear_solver_param.parse_parameters (prm);
+    if (linear_solver_param.matrix_free_jacobian && !use_weak_form) {
+        pcout << "Error: matrix_free_jacobian is only available for the weak form. "
+              << "Set use_weak_form to true or disable matrix_free_jacobian. Aborting..." << std::endl;
+        std::abort();
+    }
 
     pcout << "Parsing ODE solver subsection..." << std::endl;
     ode_solver_param.parse_parameters (prm);
@@ -530,6 +576,9 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
 
     pcout << "Parsing mesh adaptation subsection..." << std::endl;
     mesh_adaptation_param.parse_parameters (prm);
+
+    pcout << "Parsing mesh mover subsection..." << std::endl;
+    mesh_mover_param.parse_parameters (prm);
     
     pcout << "Parsing functional subsection..." << std::endl;
     functional_param.parse_parameters (prm);
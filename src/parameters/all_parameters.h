@@ -20,6 +20,7 @@
 #include "parameters/parameters_artificial_dissipation.h"
 #include "parameters/parameters_flow_solver.h"
 #include "parameters/parameters_mesh_adaptation.h"
+#include "parameters/parameters_mesh_mover.h"
 #include "parameters/parameters_functional.h"
 #include "parameters/parameters_time_refinement_study.h"
 
@@ -57,6 +58,8 @@ public:
     FlowSolverParam flow_solver_param;
     /// Constains parameters for mesh adaptation
     MeshAdaptationParam mesh_adaptation_param;
+    /// Contains parameters for the linear elasticity mesh mover
+    MeshMoverParam mesh_mover_param;
     /// Contains parameters for functional
     FunctionalParam functional_param;
     /// Contains the parameters for time refinement study
@@ -148,6 +151,15 @@ public:
     /// Flag to check if the metric Jacobian is valid when high-order grid is constructed.
     bool check_valid_metric_Jacobian;
 
+    /// Flag to store the metric terms of each cell between residual evaluations.
+    bool use_metric_terms_cache;
+
+    /// Flag to assemble the strong form volume terms of several cells of the same degree together.
+    bool use_cell_batches_in_volume_terms;
+
+    /// Number of threads used by each MPI process to assemble the residual.
+    unsigned int n_threads_per_process;
+
     /// Energy file.
     std::string energy_file;
 
@@ -176,6 +188,7 @@ public:
         shock_1d,
         euler_naca0012,
         reduced_order,
+        hyper_reduced_order,
         convection_diffusion_periodicity,
         POD_adaptation,
         POD_adaptive_sampling,
@@ -188,6 +201,7 @@ public:
         taylor_green_vortex_restart_check,
         time_refinement_study,
         time_refinement_study_reference,
+        embedded_error_control_check,
         burgers_energy_conservation_rrk,
         euler_entropy_conserving_split_forms_check,
         h_refinement_study_isentropic_vortex,
@@ -281,6 +295,15 @@ public:
     /// Flag for outputting the surface solution vtk files
     bool output_face_results_vtk;
 
+    /// Flag for compressing and writing the vtk files on a background thread while time stepping continues
+    bool enable_asynchronous_vtk_output;
+
+    /// Flag to record the hierarchical wall-clock timers and counters of Profiling::PerformanceProfiler.
+    bool enable_performance_profiling;
+
+    /// Prefix of the json and csv performance summary files.
+    std::string performance_profiling_filename_prefix;
+
     /// Flag for renumbering DOFs
     bool do_renumber_dofs;
 
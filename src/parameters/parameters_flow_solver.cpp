@@ -241,6 +241,11 @@ void FlowSolverParam::declare_parameters(dealii::ParameterHandler &prm)
             prm.declare_entry("do_calculate_numerical_entropy", "false",
                               dealii::Patterns::Bool(),
                               "Flag to calculate numerical entropy and write to file. By default, do not calculate.");
+            prm.declare_entry("integrate_quantities_in_residual", "false",
+                              dealii::Patterns::Bool(),
+                              "By default, the integrated quantities are over-integrated in a separate pass over the cells. "
+                              "If true, they are accumulated at the volume quadrature nodes of the strong DG residual, "
+                              "during its first evaluation of each time step, and each row of the data table is written one step later.");
         }
         prm.leave_subsection();
 
@@ -271,6 +276,13 @@ void FlowSolverParam::declare_parameters(dealii::ParameterHandler &prm)
                           "For initializing the flow with values from a file. "
                           "To be set when apply_initial_condition_method is read_values_from_file_and_project.");
 
+        prm.declare_entry("input_flow_setup_file_format", "ascii",
+                          dealii::Patterns::Selection(" ascii | binary "),
+                          "Format of the input flow setup file(s). "
+                          "ascii reads one file per MPI rank, e.g. setup-0000i.dat; "
+                          "binary reads the single file setup.bin, written with the same number of MPI ranks. "
+                          "Choices are <ascii | binary>.");
+
         prm.enter_subsection("output_velocity_field");
         {
             prm.declare_entry("output_velocity_field_at_fixed_times", "false",
@@ -289,6 +301,17 @@ void FlowSolverParam::declare_parameters(dealii::ParameterHandler &prm)
             prm.declare_entry("output_flow_field_files_directory_name", ".",
                               dealii::Patterns::FileName(dealii::Patterns::FileName::FileType::input),
                               "Name of directory for writing flow field files. Current directory by default.");
+
+            prm.declare_entry("output_velocity_field_file_format", "ascii",
+                              dealii::Patterns::Selection(" ascii | binary "),
+                              "Format of the velocity field files. "
+                              "ascii writes one text file per MPI rank; "
+                              "binary streams all ranks into a single self-describing file. "
+                              "Choices are <ascii | binary>.");
+
+            prm.declare_entry("output_velocity_field_in_single_precision", "false",
+                              dealii::Patterns::Bool(),
+                              "Write the binary velocity field files in single precision (float32). False by default.");
         }
         prm.leave_subsection();
 
@@ -399,6 +422,7 @@ void FlowSolverParam::parse_parameters(dealii::ParameterHandler &prm)
             if      (density_initial_condition_type_string == "uniform")    {density_initial_condition_type = uniform;}
             else if (density_initial_condition_type_string == "isothermal") {density_initial_condition_type = isothermal;}
             do_calculate_numerical_entropy = prm.get_bool("do_calculate_numerical_entropy");
+            integrate_quantities_in_residual = prm.get_bool("integrate_quantities_in_residual");
         }
         prm.leave_subsection();
 
@@ -415,6 +439,10 @@ void FlowSolverParam::parse_parameters(dealii::ParameterHandler &prm)
         
         input_flow_setup_filename_prefix = prm.get("input_flow_setup_filename_prefix");
 
+        const std::string input_flow_setup_file_format_string = prm.get("input_flow_setup_file_format");
+        if      (input_flow_setup_file_format_string == "ascii")  {input_flow_setup_file_format = ascii;}
+        else if (input_flow_setup_file_format_string == "binary") {input_flow_setup_file_format = binary;}
+
         prm.enter_subsection("output_velocity_field");
         {
           output_velocity_field_at_fixed_times = prm.get_bool("output_velocity_field_at_fixed_times");
@@ -429,6 +457,10 @@ void FlowSolverParam::parse_parameters(dealii::ParameterHandler &prm)
                           << "Please create the directory and restart. Aborting..." << std::endl;
                 std::abort();
             }
+          const std::string output_velocity_field_file_format_string = prm.get("output_velocity_field_file_format");
+          if      (output_velocity_field_file_format_string == "ascii")  {output_velocity_field_file_format = ascii;}
+          else if (output_velocity_field_file_format_string == "binary") {output_velocity_field_file_format = binary;}
+          output_velocity_field_in_single_precision = prm.get_bool("output_velocity_field_in_single_precision");
         }
         prm.leave_subsection();
 
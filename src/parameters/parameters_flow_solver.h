@@ -114,6 +114,8 @@ public:
     DensityInitialConditionType density_initial_condition_type;
     /// For TGV, flag to calculate and write numerical entropy
     bool do_calculate_numerical_entropy;
+    /// For periodic turbulence, flag to accumulate the integrated quantities in the residual volume cell loop
+    bool integrate_quantities_in_residual;
 
     /// For KHI, the atwood number
     double atwood_number;
@@ -132,11 +134,23 @@ public:
      * To be set when apply_initial_condition_method is read_values_from_file_and_project. */
     std::string input_flow_setup_filename_prefix;
 
+    /// Selects the format of the flow field files
+    enum FlowFieldFileFormat{
+        ascii,
+        binary
+        };
+    /// Selected FlowFieldFileFormat of the input flow setup file(s)
+    /** ascii reads one setup-0000i.dat file per MPI rank,
+     *  binary reads the single file setup.bin (see BinaryFlowFieldFileHeader). */
+    FlowFieldFileFormat input_flow_setup_file_format;
+
     bool output_velocity_field_at_fixed_times; ///< Flag for outputting velocity field at fixed times
     std::string output_velocity_field_times_string; ///< String of velocity field output times
     unsigned int number_of_times_to_output_velocity_field; ///< Number of fixed times to output the velocity field
     bool output_vorticity_magnitude_field_in_addition_to_velocity; ///< Flag for outputting vorticity magnitude field in addition to velocity field
     std::string output_flow_field_files_directory_name; ///< Name of directory for writing flow field files
+    FlowFieldFileFormat output_velocity_field_file_format; ///< Selected FlowFieldFileFormat of the velocity field files
+    bool output_velocity_field_in_single_precision; ///< Flag for writing the binary velocity field files in float32
 
     bool end_exactly_at_final_time; ///< Flag to adjust the last timestep such that the simulation ends exactly at final_time
 
@@ -28,6 +28,18 @@ void LinearSolverParam::declare_parameters (dealii::ParameterHandler &prm)
             prm.declare_entry("restart_number", "30",
                               dealii::Patterns::Integer(),
                               "Number of iterations before restarting GMRES");
+            prm.declare_entry("matrix_free_jacobian", "false",
+                              dealii::Patterns::Bool(),
+                              "Applies the Jacobian in the implicit ODE solver through forward-mode automatic "
+                              "differentiation of each cell residual instead of assembling and storing it. "
+                              "GMRES is preconditioned with the inverse of the cell-diagonal blocks of the Jacobian. "
+                              "Only available with the weak form.");
+            prm.declare_entry("preconditioner", "ilut",
+                              dealii::Patterns::Selection("ilut|block_jacobi|block_gauss_seidel|block_ilu0"),
+                              "Preconditioner used by GMRES. "
+                              "ilut uses the Trilinos incomplete factorization controlled by the ilut parameters. "
+                              "The block preconditioners are built on the dense element blocks of the DG Jacobian. "
+                              "Choices are <ilut|block_jacobi|block_gauss_seidel|block_ilu0>.");
 
             // ILU with threshold parameters
             prm.declare_entry("ilut_fill", "1",
@@ -88,6 +100,9 @@ void LinearSolverParam ::parse_parameters (dealii::ParameterHandler &prm)
         const std::string solver_string = prm.get("linear_solver_type");
         if (solver_string == "direct") linear_solver_type = LinearSolverEnum::direct;
 
+        matrix_free_jacobian = false;
+        preconditioner = PreconditionerEnum::ilut;
+
         if (solver_string == "gmres")
         {
             linear_solver_type = LinearSolverEnum::gmres;
@@ -96,6 +111,13 @@ void LinearSolverParam ::parse_parameters (dealii::ParameterHandler &prm)
                 max_iterations  = prm.get_integer("max_iterations");
                 restart_number  = prm.get_integer("restart_number");
                 linear_residual = prm.get_double("linear_residual_tolerance");
+                matrix_free_jacobian = prm.get_bool("matrix_free_jacobian");
+
+                const std::string preconditioner_string = prm.get("preconditioner");
+                if (preconditioner_string == "ilut")               preconditioner = PreconditionerEnum::ilut;
+                if (preconditioner_string == "block_jacobi")       preconditioner = PreconditionerEnum::block_jacobi;
+                if (preconditioner_string == "block_gauss_seidel") preconditioner = PreconditionerEnum::block_gauss_seidel;
+                if (preconditioner_string == "block_ilu0")         preconditioner = PreconditionerEnum::block_ilu0;
 
                 ilut_fill = prm.get_integer("ilut_fill");
                 ilut_drop = prm.get_double("ilut_drop");
@@ -19,6 +19,14 @@ public:
         gmres   /// GMRES.
     };
 
+    /// Types of preconditioners available for GMRES.
+    enum PreconditionerEnum {
+        ilut,               ///< Trilinos ILU(k) or ILUT, depending on ilut_fill.
+        block_jacobi,       ///< Inverse of the element-diagonal blocks.
+        block_gauss_seidel, ///< Forward block Gauss-Seidel sweep on the element blocks.
+        block_ilu0          ///< Block incomplete LU on the element blocks, without fill-in.
+    };
+
     /// Can either be verbose or quiet.
     /** Verbose will print the full dense matrix. Will not work for large matrices
      */
@@ -26,6 +34,8 @@ public:
     LinearSolverEnum linear_solver_type; ///< direct or gmres.
 
     // GMRES options
+    PreconditionerEnum preconditioner; ///< Preconditioner used by GMRES.
+
     double ilut_drop; ///< Threshold to drop terms close to zero.
     double ilut_rtol; ///< Multiplies diagonal by ilut_rtol for more diagonal dominance.
     double ilut_atol; ///< Add ilu_rtol to diagonal for more diagonal dominance.
@@ -36,6 +46,11 @@ public:
     int max_iterations; ///< Maximum number of linear iteration.
     int restart_number; ///< Number of iterations before restarting GMRES
 
+    /// Applies dRdW through forward-mode AD in the implicit ODE solver instead of assembling it.
+    /** GMRES is then preconditioned with the inverse of the cell-diagonal blocks of the Jacobian.
+     */
+    bool matrix_free_jacobian;
+
     double newton_residual; ///< Tolerance for Newton iteration residual (for Jacobian-free Newton-Krylov)
     int newton_max_iterations; ///< Maximum number of Newton iterations (for Jacobian-free Newton-Krylov)
     double perturbation_magnitude; ///<Small perturbation magnitude for Jacobian-free methods
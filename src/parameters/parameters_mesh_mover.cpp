@@ -0,0 +1,77 @@
+#include "parameters/parameters_mesh_mover.h"
+
+namespace PHiLiP {
+namespace Parameters {
+
+MeshMoverParam::MeshMoverParam ()
+    : preconditioner(ilut)
+    , linear_residual(1e-14)
+    , max_iterations(20000)
+    , use_serial_direct_solver(false)
+    , amg_aggregation_threshold(1e-4)
+    , amg_smoother_sweeps(2)
+{ }
+
+void MeshMoverParam::declare_parameters (dealii::ParameterHandler &prm)
+{
+    prm.enter_subsection("mesh mover");
+    {
+        prm.declare_entry("preconditioner", "ilut",
+                          dealii::Patterns::Selection("ilut | amg"),
+                          "Preconditioner of the linear elasticity mesh motion. "
+                          "Choices are <ilut | amg>. "
+                          "amg uses smoothed aggregation with the rigid body modes as near-null space.");
+
+        prm.declare_entry("linear_residual_tolerance", "1e-14",
+                          dealii::Patterns::Double(0.0, 1.0),
+                          "Linear residual tolerance, relative to the right-hand side norm.");
+
+        prm.declare_entry("max_iterations", "20000",
+                          dealii::Patterns::Integer(1),
+                          "Maximum number of linear iterations.");
+
+        prm.declare_entry("use_serial_direct_solver", "false",
+                          dealii::Patterns::Bool(),
+                          "With the ilut preconditioner, dXvdXvs applied to several vectors factors the system once "
+                          "with MUMPS or SuperLU_DIST if Trilinos provides them. Otherwise, the preconditioned Krylov solver is used, "
+                          "unless this is true, in which case the whole system is gathered and factored on a single process with KLU.");
+
+        prm.enter_subsection("amg options");
+        {
+            prm.declare_entry("aggregation_threshold", "1e-4",
+                              dealii::Patterns::Double(0.0, 1.0),
+                              "Threshold below which the matrix entries are ignored when building the aggregates.");
+
+            prm.declare_entry("smoother_sweeps", "2",
+                              dealii::Patterns::Integer(1),
+                              "Number of Chebyshev smoother sweeps on each level.");
+        }
+        prm.leave_subsection();
+    }
+    prm.leave_subsection();
+}
+
+void MeshMoverParam::parse_parameters (dealii::ParameterHandler &prm)
+{
+    prm.enter_subsection("mesh mover");
+    {
+        const std::string preconditioner_string = prm.get("preconditioner");
+        if (preconditioner_string == "ilut") preconditioner = ilut;
+        else if (preconditioner_string == "amg") preconditioner = amg;
+
+        linear_residual = prm.get_double("linear_residual_tolerance");
+        max_iterations = prm.get_integer("max_iterations");
+        use_serial_direct_solver = prm.get_bool("use_serial_direct_solver");
+
+        prm.enter_subsection("amg options");
+        {
+            amg_aggregation_threshold = prm.get_double("aggregation_threshold");
+            amg_smoother_sweeps = prm.get_integer("smoother_sweeps");
+        }
+        prm.leave_subsection();
+    }
+    prm.leave_subsection();
+}
+
+} // Parameters namespace
+} // PHiLiP namespace
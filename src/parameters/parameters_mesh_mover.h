@@ -0,0 +1,41 @@
+#ifndef __PARAMETERS_MESH_MOVER_H__
+#define __PARAMETERS_MESH_MOVER_H__
+
+#include <deal.II/base/parameter_handler.h>
+
+namespace PHiLiP {
+namespace Parameters {
+
+/// Parameters related to the linear elasticity mesh mover
+class MeshMoverParam
+{
+public:
+    /// Preconditioners available for the mesh motion system.
+    enum PreconditionerEnum {
+        ilut, ///< Trilinos ILUT with a fill of 50.
+        amg   ///< Trilinos ML smoothed-aggregation AMG using the rigid body modes as near-null space.
+    };
+
+    /// Constructor setting the defaults, such that the mesh mover can be used without an input file.
+    MeshMoverParam ();
+
+    PreconditionerEnum preconditioner; ///< ilut or amg.
+
+    double linear_residual; ///< Tolerance of the linear residual, relative to the right-hand side norm.
+    unsigned int max_iterations; ///< Maximum number of linear iterations.
+
+    /// Whether dXvdXvs may factor the system with the serial Amesos_Klu when no parallel direct solver is available.
+    bool use_serial_direct_solver;
+
+    double amg_aggregation_threshold; ///< Threshold below which the matrix entries are dropped during aggregation.
+    unsigned int amg_smoother_sweeps; ///< Number of Chebyshev smoother sweeps on each level.
+
+    /// Declares the possible variables and sets the defaults.
+    static void declare_parameters (dealii::ParameterHandler &prm);
+    /// Parses input file and sets the variables.
+    void parse_parameters (dealii::ParameterHandler &prm);
+};
+
+} // Parameters namespace
+} // PHiLiP namespace
+#endif
@@ -40,14 +40,18 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
                           " implicit | "
                           " rrk_explicit | "
                           " pod_galerkin | "
-                          " pod_petrov_galerkin"),
+                          " pod_petrov_galerkin | "
+                          " p_multigrid | "
+                          " low_storage_runge_kutta"),
                           "Type of ODE solver to use."
                           "Choices are "
                           " <runge_kutta | "
                           " implicit | "
                           " rrk_explicit | "
                           " pod_galerkin | "
-                          " pod_petrov_galerkin>.");
+                          " pod_petrov_galerkin | "
+                          " p_multigrid | "
+                          " low_storage_runge_kutta>.");
 
         prm.declare_entry("nonlinear_max_iterations", "500000",
                           dealii::Patterns::Integer(0,dealii::Patterns::Integer::max_int_value),
@@ -76,6 +80,11 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("steady_state_final_solution_filename", "solution_snapshot",
                           dealii::Patterns::Anything(),
                           "Filename to use when outputting solution to a file.");
+        prm.declare_entry("steady_state_final_solution_file_format", "text",
+                          dealii::Patterns::Selection("text | binary"),
+                          "Format of the final steady state solution file. "
+                          "Choices are <text | binary>. "
+                          "The binary format is written with the .snap extension and is read faster by the offline POD.");
         prm.declare_entry("output_ode_solver_steady_state_convergence_table","false",
                           dealii::Patterns::Bool(),
                           "Set as false by default. If true, writes the linear solver convergence data "
@@ -100,15 +109,96 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
                           " ssprk3_ex | "
                           " euler_ex | "
                           " euler_im | "
-                          " dirk_2_im"),
+                          " dirk_2_im | "
+                          " bs32_ex | "
+                          " dp54_ex"),
                           "Runge-kutta method to use. Methods with _ex are explicit, and with _im are implicit."
                           "Choices are "
                           " <rk4_ex | "
                           " ssprk3_ex | "
                           " euler_ex | "
                           " euler_im | "
-                          " dirk_2_im>.");
+                          " dirk_2_im | "
+                          " bs32_ex | "
+                          " dp54_ex>.");
 
+        prm.declare_entry("low_storage_runge_kutta_method", "lsrk4_2n",
+                          dealii::Patterns::Selection(
+                          " lsrk3_2n | "
+                          " lsrk4_2n | "
+                          " ssprk3_3sstar"),
+                          "Low-storage Runge-kutta method to use with ode_solver_type = low_storage_runge_kutta. "
+                          "Methods with _2n store two registers and methods with _3sstar store three. "
+                          "Choices are "
+                          " <lsrk3_2n | "
+                          " lsrk4_2n | "
+                          " ssprk3_3sstar>.");
+
+        prm.enter_subsection("embedded error control");
+        {
+            prm.declare_entry("use_embedded_error_control", "false",
+                              dealii::Patterns::Bool(),
+                              "Choose the time step with a PI controller on the embedded error estimate of the RK method. "
+                              "Steps whose estimate exceeds the tolerances are rejected and repeated with a smaller step. "
+                              "Only available for RK methods with embedded weights (bs32_ex, dp54_ex, ssprk3_3sstar). False by default.");
+            prm.declare_entry("absolute_tolerance", "1e-8",
+                              dealii::Patterns::Double(0, dealii::Patterns::Double::max_double_value),
+                              "Absolute tolerance on the local error estimate.");
+            prm.declare_entry("relative_tolerance", "1e-6",
+                              dealii::Patterns::Double(0, dealii::Patterns::Double::max_double_value),
+                              "Relative tolerance on the local error estimate.");
+            prm.declare_entry("safety_factor", "0.9",
+                              dealii::Patterns::Double(0, 1),
+                              "Safety factor multiplying the time step proposed by the controller.");
+            prm.declare_entry("minimum_step_factor", "0.2",
+                              dealii::Patterns::Double(0, 1),
+                              "Minimum ratio between two consecutive time steps.");
+            prm.declare_entry("maximum_step_factor", "5.0",
+                              dealii::Patterns::Double(1, dealii::Patterns::Double::max_double_value),
+                              "Maximum ratio between two consecutive time steps.");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("jacobian lagging");
+        {
+            prm.declare_entry("jacobian_update_frequency", "1",
+                              dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                              "Number of implicit steps between two assemblies of the Jacobian and of its preconditioner. "
+                              "In between, the linear system uses the last assembled Jacobian with the mass matrix of the current time step, "
+                              "and GMRES reuses the last factorized preconditioner. "
+                              "With the matrix-free Jacobian, only the block preconditioner is lagged. "
+                              "1 by default, which updates them at every step.");
+            prm.declare_entry("residual_ratio_for_jacobian_update", "0.9",
+                              dealii::Patterns::Double(0, dealii::Patterns::Double::max_double_value),
+                              "The Jacobian is updated before jacobian_update_frequency steps if the residual norm "
+                              "was not reduced below this ratio of its value at the previous step.");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("p-multigrid");
+        {
+            prm.declare_entry("smoother", "explicit_rk",
+                              dealii::Patterns::Selection("explicit_rk | block_jacobi"),
+                              "Smoother used on every p-multigrid level. "
+                              "explicit_rk performs three-stage SSP Runge-Kutta steps in pseudotime with local time steps. "
+                              "block_jacobi performs linearized backward Euler steps in pseudotime, inverted with "
+                              "the element-diagonal blocks of the Jacobian, and is only available with the weak form. "
+                              "Choices are <explicit_rk | block_jacobi>.");
+            prm.declare_entry("coarsest_poly_degree", "1",
+                              dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
+                              "Polynomial degree of the coarsest level. The levels are the degrees from the "
+                              "solution degree down to this one.");
+            prm.declare_entry("n_pre_smoothing_steps", "1",
+                              dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
+                              "Number of smoothing steps before restricting to the coarser level.");
+            prm.declare_entry("n_post_smoothing_steps", "1",
+                              dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
+                              "Number of smoothing steps after adding the coarse correction.");
+            prm.declare_entry("n_coarsest_smoothing_steps", "4",
+                              dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                              "Number of smoothing steps on the coarsest level.");
+        }
+        prm.leave_subsection();
     }
     prm.leave_subsection();
 }
@@ -140,6 +230,10 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
                                                            allocate_matrix_dRdW = true; }
         else if (solver_string == "pod_petrov_galerkin") { ode_solver_type = ODESolverEnum::pod_petrov_galerkin_solver;
                                                            allocate_matrix_dRdW = true; }
+        else if (solver_string == "p_multigrid")         { ode_solver_type = ODESolverEnum::p_multigrid_solver;
+                                                           allocate_matrix_dRdW = false; } // allocated on each level by the smoother if needed
+        else if (solver_string == "low_storage_runge_kutta") { ode_solver_type = ODESolverEnum::low_storage_runge_kutta_solver;
+                                                               allocate_matrix_dRdW = false; }
 
         nonlinear_steady_residual_tolerance  = prm.get_double("nonlinear_steady_residual_tolerance");
         nonlinear_max_iterations = prm.get_integer("nonlinear_max_iterations");
@@ -150,6 +244,9 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
         print_iteration_modulo = prm.get_integer("print_iteration_modulo");
         output_final_steady_state_solution_to_file = prm.get_bool("output_final_steady_state_solution_to_file");
         steady_state_final_solution_filename = prm.get("steady_state_final_solution_filename");
+        const std::string file_format_string = prm.get("steady_state_final_solution_file_format");
+        if (file_format_string == "text")        steady_state_final_solution_file_format = SolutionFileFormatEnum::text;
+        else if (file_format_string == "binary") steady_state_final_solution_file_format = SolutionFileFormatEnum::binary;
         output_ode_solver_steady_state_convergence_table = prm.get_bool("output_ode_solver_steady_state_convergence_table");
 
         initial_time = prm.get_double("initial_time");
@@ -182,7 +279,60 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
             n_rk_stages  = 2;
             rk_order = 2;
         }
+        else if (rk_method_string == "bs32_ex"){
+            runge_kutta_method = RKMethodEnum::bs32_ex;
+            n_rk_stages  = 4;
+            rk_order = 3;
+        }
+        else if (rk_method_string == "dp54_ex"){
+            runge_kutta_method = RKMethodEnum::dp54_ex;
+            n_rk_stages  = 7;
+            rk_order = 5;
+        }
+        rk_embedded_order = 0;
+        if (runge_kutta_method == RKMethodEnum::bs32_ex) rk_embedded_order = 2;
+        if (runge_kutta_method == RKMethodEnum::dp54_ex) rk_embedded_order = 4;
+
+        const std::string low_storage_rk_method_string = prm.get("low_storage_runge_kutta_method");
+        if (low_storage_rk_method_string == "lsrk3_2n")           low_storage_runge_kutta_method = LowStorageRKMethodEnum::lsrk3_2n;
+        else if (low_storage_rk_method_string == "lsrk4_2n")      low_storage_runge_kutta_method = LowStorageRKMethodEnum::lsrk4_2n;
+        else if (low_storage_rk_method_string == "ssprk3_3sstar") low_storage_runge_kutta_method = LowStorageRKMethodEnum::ssprk3_3sstar;
+        if (ode_solver_type == ODESolverEnum::low_storage_runge_kutta_solver) {
+            if (low_storage_runge_kutta_method == LowStorageRKMethodEnum::lsrk3_2n)      { n_rk_stages = 3; rk_order = 3; rk_embedded_order = 0; }
+            if (low_storage_runge_kutta_method == LowStorageRKMethodEnum::lsrk4_2n)      { n_rk_stages = 5; rk_order = 4; rk_embedded_order = 0; }
+            if (low_storage_runge_kutta_method == LowStorageRKMethodEnum::ssprk3_3sstar) { n_rk_stages = 3; rk_order = 3; rk_embedded_order = 2; }
+        }
+
+        prm.enter_subsection("embedded error control");
+        {
+            use_embedded_error_control = prm.get_bool("use_embedded_error_control");
+            embedded_error_absolute_tolerance = prm.get_double("absolute_tolerance");
+            embedded_error_relative_tolerance = prm.get_double("relative_tolerance");
+            error_controller_safety_factor = prm.get_double("safety_factor");
+            error_controller_minimum_step_factor = prm.get_double("minimum_step_factor");
+            error_controller_maximum_step_factor = prm.get_double("maximum_step_factor");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("jacobian lagging");
+        {
+            jacobian_update_frequency = prm.get_integer("jacobian_update_frequency");
+            residual_ratio_for_jacobian_update = prm.get_double("residual_ratio_for_jacobian_update");
+        }
+        prm.leave_subsection();
 
+        prm.enter_subsection("p-multigrid");
+        {
+            const std::string smoother_string = prm.get("smoother");
+            if (smoother_string == "explicit_rk")       p_multigrid_smoother = PMultigridSmootherEnum::explicit_rk_smoother;
+            else if (smoother_string == "block_jacobi") p_multigrid_smoother = PMultigridSmootherEnum::block_jacobi_smoother;
+
+            p_multigrid_coarsest_poly_degree = prm.get_integer("coarsest_poly_degree");
+            p_multigrid_n_pre_smoothing_steps = prm.get_integer("n_pre_smoothing_steps");
+            p_multigrid_n_post_smoothing_steps = prm.get_integer("n_post_smoothing_steps");
+            p_multigrid_n_coarsest_smoothing_steps = prm.get_integer("n_coarsest_smoothing_steps");
+        }
+        prm.leave_subsection();
     }
     prm.leave_subsection();
 }
@@ -17,7 +17,9 @@ public:
         implicit_solver,  /// Backward-Euler
         rrk_explicit_solver, /// Explicit RK using the relaxation Runge-Kutta method (Ketcheson, 2019)
         pod_galerkin_solver, ///Proper Orthogonal Decomposition with Galerkin projection
-        pod_petrov_galerkin_solver ///Proper Orthogonal Decomposition with Petrov-Galerkin projection (LSPG)
+        pod_petrov_galerkin_solver, ///Proper Orthogonal Decomposition with Petrov-Galerkin projection (LSPG)
+        p_multigrid_solver, ///Full approximation scheme p-multigrid cycles for steady state
+        low_storage_runge_kutta_solver ///Low-storage explicit RK with two or three registers
     };
 
     OutputEnum ode_output; ///< verbose or quiet.
@@ -35,6 +37,13 @@ public:
     bool output_final_steady_state_solution_to_file; ///< Output final steady state solution to file
     std::string steady_state_final_solution_filename; ///< Filename to write final steady state solution
 
+    /// Formats of the final steady state solution file
+    enum SolutionFileFormatEnum {
+        text, ///One value per line, written by the first process
+        binary ///Binary snapshot file, written in parallel and read through a memory mapping by the offline POD
+    };
+    SolutionFileFormatEnum steady_state_final_solution_file_format; ///< Format of the final steady state solution file
+
     double nonlinear_steady_residual_tolerance; ///< Tolerance to determine steady-state convergence.
 
     double initial_time_step; ///< Time step used in ODE solver.
@@ -59,12 +68,46 @@ public:
         ssprk3_ex, ///Third-order strong-stability preserving
         euler_ex, ///Forward Euler
         euler_im, ///Implicit Euler
-        dirk_2_im ///Second-order diagonally-implicit RK
+        dirk_2_im, ///Second-order diagonally-implicit RK
+        bs32_ex, ///Bogacki-Shampine third-order with embedded second-order
+        dp54_ex ///Dormand-Prince fifth-order with embedded fourth-order
     };
 
     RKMethodEnum runge_kutta_method; ///< Runge-kutta method.
-    int n_rk_stages; ///< Number of stages for an RK method; assigned based on runge_kutta_method
-    int rk_order; ///< Order of the RK method; assigned based on runge_kutta_method
+    int n_rk_stages; ///< Number of stages for an RK method; assigned based on runge_kutta_method, or low_storage_runge_kutta_method
+    int rk_order; ///< Order of the RK method; assigned based on runge_kutta_method, or low_storage_runge_kutta_method
+    int rk_embedded_order; ///< Order of the embedded solution of the RK method, 0 if it has none; assigned with rk_order
+
+    /// Types of low-storage RK method
+    enum LowStorageRKMethodEnum {
+        lsrk3_2n, ///Three-stage third-order 2N method of Williamson
+        lsrk4_2n, ///Five-stage fourth-order 2N method of Carpenter and Kennedy
+        ssprk3_3sstar ///Third-order strong-stability preserving in 3S* form, with an embedded second-order solution
+    };
+
+    LowStorageRKMethodEnum low_storage_runge_kutta_method; ///< Low-storage Runge-Kutta method.
+
+    /// Types of smoothers for the p-multigrid solver
+    enum PMultigridSmootherEnum {
+        explicit_rk_smoother, ///Three-stage SSP Runge-Kutta in pseudotime with local time steps
+        block_jacobi_smoother ///Linearized backward Euler in pseudotime, inverted with the element-diagonal blocks
+    };
+
+    PMultigridSmootherEnum p_multigrid_smoother; ///< Smoother used on every p-multigrid level.
+    unsigned int p_multigrid_coarsest_poly_degree; ///< Polynomial degree of the coarsest p-multigrid level.
+    unsigned int p_multigrid_n_pre_smoothing_steps; ///< Number of smoothing steps before restricting to the coarser level.
+    unsigned int p_multigrid_n_post_smoothing_steps; ///< Number of smoothing steps after the coarse correction.
+    unsigned int p_multigrid_n_coarsest_smoothing_steps; ///< Number of smoothing steps on the coarsest level.
+
+    bool use_embedded_error_control; ///< Flag for choosing the time step from the embedded error estimate of the RK method
+    double embedded_error_absolute_tolerance; ///< Absolute tolerance on the local error estimate
+    double embedded_error_relative_tolerance; ///< Relative tolerance on the local error estimate
+    double error_controller_safety_factor; ///< Safety factor multiplying the time step proposed by the controller
+    double error_controller_minimum_step_factor; ///< Minimum ratio between two consecutive time steps
+    double error_controller_maximum_step_factor; ///< Maximum ratio between two consecutive time steps
+
+    unsigned int jacobian_update_frequency; ///< Number of implicit steps between two assemblies of the Jacobian and its preconditioner
+    double residual_ratio_for_jacobian_update; ///< Updates the Jacobian early if the residual norm decreased by less than this ratio over a step
 
     /// Flag to signal that automatic differentiation (AD) matrix dRdW must be allocated
     bool allocate_matrix_dRdW;
@@ -21,6 +21,18 @@ void ReducedOrderModelParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("recomputation_coefficient", "5",
                           dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
                           "Number of Halton sequence points to add to initial snapshot set");
+        prm.declare_entry("pod_truncation_tolerance", "0",
+                          dealii::Patterns::Double(0, 1),
+                          "Fraction of the snapshot energy (sum of the squared singular values) that may be discarded by truncating the POD basis. 0 keeps all the nonzero modes.");
+        prm.declare_entry("use_hyper_reduction", "false",
+                          dealii::Patterns::Bool(),
+                          "Hyper-reduce the reduced-order residual and Jacobian by assembling them on a sample of the cells (ECSW).");
+        prm.declare_entry("hyper_reduction_tolerance", "1E-4",
+                          dealii::Patterns::Double(0, dealii::Patterns::Double::max_double_value),
+                          "Relative tolerance on the reduced residuals of the snapshots when sampling the cells for hyper-reduction.");
+        prm.declare_entry("n_concurrent_solves", "1",
+                          dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                          "Number of groups of processes solving the snapshots and reduced-order models of different parameters concurrently during adaptive sampling. 1 solves each one on all the processes.");
         prm.declare_entry("parameter_names", "mach, alpha",
                           dealii::Patterns::List(dealii::Patterns::Anything(), 0, 10, ","),
                           "Names of parameters for adaptive sampling");
@@ -43,6 +55,10 @@ void ReducedOrderModelParam::parse_parameters (dealii::ParameterHandler &prm)
         num_halton = prm.get_integer("num_halton");
         recomputation_coefficient = prm.get_integer("recomputation_coefficient");
         path_to_search = prm.get("path_to_search");
+        pod_truncation_tolerance = prm.get_double("pod_truncation_tolerance");
+        use_hyper_reduction = prm.get_bool("use_hyper_reduction");
+        hyper_reduction_tolerance = prm.get_double("hyper_reduction_tolerance");
+        n_concurrent_solves = prm.get_integer("n_concurrent_solves");
 
         std::string parameter_names_string = prm.get("parameter_names");
         std::unique_ptr<dealii::Patterns::PatternBase> ListPatternNames(new dealii::Patterns::List(dealii::Patterns::Anything(), 0, 10, ",")); //Note, in a future version of dealii, this may change from a unique_ptr to simply the object. Will need to use std::move(ListPattern) in next line.
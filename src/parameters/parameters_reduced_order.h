@@ -25,6 +25,18 @@ public:
     /// Recomputation parameter for adaptive sampling algorithm
     int recomputation_coefficient;
 
+    /// Fraction of the snapshot energy that may be discarded by truncating the POD basis
+    double pod_truncation_tolerance;
+
+    /// Flag to hyper-reduce the residual and Jacobian of the POD reduced-order models with ECSW
+    bool use_hyper_reduction;
+
+    /// Relative tolerance on the reduced residuals of the training states when sampling the cells for hyper-reduction
+    double hyper_reduction_tolerance;
+
+    /// Number of groups of processes solving the snapshots and reduced-order models of different parameters concurrently
+    int n_concurrent_solves;
+
     /// Names of parameters
     std::vector<std::string> parameter_names;
 
@@ -1,5 +1,6 @@
 #include <cmath>
 #include <vector>
+#include <algorithm>
 
 #include "ADTypes.hpp"
 
@@ -511,6 +512,35 @@ real Euler<dim, nstate, real>
     return log_mean_val;
 }
 
+template <int dim, int nstate, typename real>
+void Euler<dim, nstate, real>
+::compute_ismail_roe_logarithmic_mean_batch(
+    const real val1,
+    const real *val2,
+    real *log_mean,
+    const unsigned int n_pairs) const
+{
+    if constexpr(std::is_same<real,double>::value) {
+        // Same algorithm as compute_ismail_roe_logarithmic_mean(), where both branches are evaluated
+        // and selected, such that the loop has no branch. The logarithm branch is evaluated with
+        // f=1 when the series is used, as to avoid dividing by zero.
+        for(unsigned int i=0; i<n_pairs; ++i){
+            const real zeta = val1/val2[i];
+            const real f = (zeta-1.0)/(zeta+1.0);
+            const real u = f*f;
+            const bool use_series = (u<1.0e-2);
+            const real F_series = 1.0 + u/3.0 + u*u/5.0 + u*u*u/7.0;
+            const real F_log = std::log(use_series ? 1.0 : zeta)/2.0/(use_series ? 1.0 : f);
+            const real F = use_series ? F_series : F_log;
+            log_mean[i] = (val1+val2[i])/(2.0*F);
+        }
+    } else {
+        for(unsigned int i=0; i<n_pairs; ++i){
+            log_mean[i] = compute_ismail_roe_logarithmic_mean(val1, val2[i]);
+        }
+    }
+}
+
 template <int dim, int nstate, typename real>
 std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
 ::convective_numerical_split_flux_ismail_roe(const std::array<real,nstate> &conservative_soln1,
@@ -522,27 +552,37 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
     const std::array<real,nstate> parameter_vector2 = compute_ismail_roe_parameter_vector_from_primitive(
                                                         convert_conservative_to_primitive<real>(conservative_soln2));
 
+    // Compute logarithmic mean of the parameter vector entries used by the flux
+    const real log_mean_parameter_first = compute_ismail_roe_logarithmic_mean(parameter_vector1[0], parameter_vector2[0]);
+    const real log_mean_parameter_last = compute_ismail_roe_logarithmic_mean(parameter_vector1[nstate-1], parameter_vector2[nstate-1]);
+
+    return convective_numerical_split_flux_ismail_roe_from_log_means(parameter_vector1, parameter_vector2,
+                                                                     log_mean_parameter_first, log_mean_parameter_last);
+}
+
+template <int dim, int nstate, typename real>
+std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
+::convective_numerical_split_flux_ismail_roe_from_log_means(
+    const std::array<real,nstate> &parameter_vector1,
+    const std::array<real,nstate> &parameter_vector2,
+    const real log_mean_parameter_first,
+    const real log_mean_parameter_last) const
+{
     // Compute mean (average) parameter vector
     std::array<real,nstate> avg_parameter_vector;
     for(int s=0; s<nstate; ++s){
         avg_parameter_vector[s] = 0.5*(parameter_vector1[s] + parameter_vector2[s]);
     }
 
-    // Compute logarithmic mean parameter vector
-    std::array<real,nstate> log_mean_parameter_vector;
-    for(int s=0; s<nstate; ++s){
-        log_mean_parameter_vector[s] = compute_ismail_roe_logarithmic_mean(parameter_vector1[s], parameter_vector2[s]);
-    }
-
     // Compute Ismail Roe mean primitive variables; Eq (3.15) [Gassner, Winters, and Kopriva, 2016, SBP]
     std::array<real,dim> mean_velocities;
-    const real mean_density = avg_parameter_vector[0]*log_mean_parameter_vector[nstate-1];
+    const real mean_density = avg_parameter_vector[0]*log_mean_parameter_last;
     for(int d=0; d<dim; ++d){
         mean_velocities[d] = avg_parameter_vector[1+d]/avg_parameter_vector[0];
     }
     const real mean_pressure = avg_parameter_vector[nstate-1]/avg_parameter_vector[0];
     // -- enthalpy
-    real mean_enthalpy = (gam+1.0)*(log_mean_parameter_vector[nstate-1]/log_mean_parameter_vector[0]) + gamm1*mean_pressure;
+    real mean_enthalpy = (gam+1.0)*(log_mean_parameter_last/log_mean_parameter_first) + gamm1*mean_pressure;
     mean_enthalpy /= 2.0*gam;
     mean_enthalpy *= gam/(mean_density*gamm1);
     // -- get sum of mean velocities squared
@@ -576,8 +616,6 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
 ::convective_numerical_split_flux_chandrashekar(const std::array<real,nstate> &conservative_soln1,
                                                 const std::array<real,nstate> &conservative_soln2) const
 {
-
-    std::array<dealii::Tensor<1,dim,real>,nstate> conv_num_split_flux;
     const real rho_log = compute_ismail_roe_logarithmic_mean(conservative_soln1[0], conservative_soln2[0]);
     const real pressure1 = compute_pressure<real>(conservative_soln1);
     const real pressure2 = compute_pressure<real>(conservative_soln2);
@@ -586,6 +624,26 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
     const real beta2 = conservative_soln2[0]/(2.0*pressure2);
 
     const real beta_log = compute_ismail_roe_logarithmic_mean(beta1, beta2);
+
+    return convective_numerical_split_flux_chandrashekar_from_log_means(conservative_soln1, conservative_soln2,
+                                                                        pressure1, pressure2, rho_log, beta_log);
+}
+
+template <int dim, int nstate, typename real>
+std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
+::convective_numerical_split_flux_chandrashekar_from_log_means(
+    const std::array<real,nstate> &conservative_soln1,
+    const std::array<real,nstate> &conservative_soln2,
+    const real pressure1,
+    const real pressure2,
+    const real rho_log,
+    const real beta_log) const
+{
+
+    std::array<dealii::Tensor<1,dim,real>,nstate> conv_num_split_flux;
+    const real beta1 = conservative_soln1[0]/(2.0*pressure1);
+    const real beta2 = conservative_soln2[0]/(2.0*pressure2);
+
     const dealii::Tensor<1,dim,real> vel1 = compute_velocities<real>(conservative_soln1);
     const dealii::Tensor<1,dim,real> vel2 = compute_velocities<real>(conservative_soln2);
 
@@ -625,8 +683,6 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
 ::convective_numerical_split_flux_ranocha(const std::array<real,nstate> &conservative_soln1,
                                                 const std::array<real,nstate> &conservative_soln2) const
 {
-
-    std::array<dealii::Tensor<1,dim,real>,nstate> conv_num_split_flux;
     const real rho_log = compute_ismail_roe_logarithmic_mean(conservative_soln1[0], conservative_soln2[0]);
     const real pressure1 = compute_pressure<real>(conservative_soln1);
     const real pressure2 = compute_pressure<real>(conservative_soln2);
@@ -635,6 +691,23 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
     const real beta2 = conservative_soln2[0]/(pressure2);
 
     const real beta_log = compute_ismail_roe_logarithmic_mean(beta1, beta2);
+
+    return convective_numerical_split_flux_ranocha_from_log_means(conservative_soln1, conservative_soln2,
+                                                                  pressure1, pressure2, rho_log, beta_log);
+}
+
+template <int dim, int nstate, typename real>
+std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
+::convective_numerical_split_flux_ranocha_from_log_means(
+    const std::array<real,nstate> &conservative_soln1,
+    const std::array<real,nstate> &conservative_soln2,
+    const real pressure1,
+    const real pressure2,
+    const real rho_log,
+    const real beta_log) const
+{
+
+    std::array<dealii::Tensor<1,dim,real>,nstate> conv_num_split_flux;
     const dealii::Tensor<1,dim,real> vel1 = compute_velocities<real>(conservative_soln1);
     const dealii::Tensor<1,dim,real> vel2 = compute_velocities<real>(conservative_soln2);
 
@@ -671,6 +744,82 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
 
 }
 
+template <int dim, int nstate, typename real>
+void Euler<dim, nstate, real>
+::convective_numerical_split_flux_batch(const std::array<real,nstate> &conservative_soln1,
+                                        const std::vector<std::array<real,nstate>> &conservative_soln2,
+                                        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_num_split_flux) const
+{
+    const unsigned int n_pairs = conservative_soln2.size();
+    conv_num_split_flux.resize(n_pairs);
+
+    if(two_point_num_flux_type == two_point_num_flux_enum::KG) {
+        for(unsigned int i=0; i<n_pairs; ++i){
+            conv_num_split_flux[i] = convective_numerical_split_flux_kennedy_gruber(conservative_soln1, conservative_soln2[i]);
+        }
+        return;
+    }
+
+    // Quantities of the first solution are shared by all the pairs.
+    std::array<real,nstate> parameter_vector1;
+    real pressure1 = 0.0;
+    real beta1 = 0.0;
+    if(two_point_num_flux_type == two_point_num_flux_enum::IR) {
+        parameter_vector1 = compute_ismail_roe_parameter_vector_from_primitive(
+                                convert_conservative_to_primitive<real>(conservative_soln1));
+    } else {
+        pressure1 = compute_pressure<real>(conservative_soln1);
+        beta1 = (two_point_num_flux_type == two_point_num_flux_enum::CH) ? conservative_soln1[0]/(2.0*pressure1)
+                                                                         : conservative_soln1[0]/(pressure1);
+    }
+
+    // The pairs are processed in batches, such that the arguments of the logarithmic means are contiguous.
+    std::array<std::array<real,nstate>,split_flux_batch_size> parameter_vector2;
+    std::array<real,split_flux_batch_size> pressure2;
+    std::array<real,split_flux_batch_size> mean_arg_first;
+    std::array<real,split_flux_batch_size> mean_arg_last;
+    std::array<real,split_flux_batch_size> log_mean_first;
+    std::array<real,split_flux_batch_size> log_mean_last;
+    for(unsigned int first_pair=0; first_pair<n_pairs; first_pair+=split_flux_batch_size){
+        const unsigned int n_batch = std::min(split_flux_batch_size, n_pairs-first_pair);
+
+        if(two_point_num_flux_type == two_point_num_flux_enum::IR) {
+            for(unsigned int i=0; i<n_batch; ++i){
+                parameter_vector2[i] = compute_ismail_roe_parameter_vector_from_primitive(
+                                           convert_conservative_to_primitive<real>(conservative_soln2[first_pair+i]));
+                mean_arg_first[i] = parameter_vector2[i][0];
+                mean_arg_last[i] = parameter_vector2[i][nstate-1];
+            }
+            compute_ismail_roe_logarithmic_mean_batch(parameter_vector1[0], mean_arg_first.data(), log_mean_first.data(), n_batch);
+            compute_ismail_roe_logarithmic_mean_batch(parameter_vector1[nstate-1], mean_arg_last.data(), log_mean_last.data(), n_batch);
+            for(unsigned int i=0; i<n_batch; ++i){
+                conv_num_split_flux[first_pair+i] = convective_numerical_split_flux_ismail_roe_from_log_means(
+                    parameter_vector1, parameter_vector2[i], log_mean_first[i], log_mean_last[i]);
+            }
+        } else {
+            // Logarithmic means of the density and of beta.
+            for(unsigned int i=0; i<n_batch; ++i){
+                const std::array<real,nstate> &soln2 = conservative_soln2[first_pair+i];
+                pressure2[i] = compute_pressure<real>(soln2);
+                mean_arg_first[i] = soln2[0];
+                mean_arg_last[i] = (two_point_num_flux_type == two_point_num_flux_enum::CH) ? soln2[0]/(2.0*pressure2[i])
+                                                                                            : soln2[0]/(pressure2[i]);
+            }
+            compute_ismail_roe_logarithmic_mean_batch(conservative_soln1[0], mean_arg_first.data(), log_mean_first.data(), n_batch);
+            compute_ismail_roe_logarithmic_mean_batch(beta1, mean_arg_last.data(), log_mean_last.data(), n_batch);
+            for(unsigned int i=0; i<n_batch; ++i){
+                if(two_point_num_flux_type == two_point_num_flux_enum::CH) {
+                    conv_num_split_flux[first_pair+i] = convective_numerical_split_flux_chandrashekar_from_log_means(
+                        conservative_soln1, conservative_soln2[first_pair+i], pressure1, pressure2[i], log_mean_first[i], log_mean_last[i]);
+                } else {
+                    conv_num_split_flux[first_pair+i] = convective_numerical_split_flux_ranocha_from_log_means(
+                        conservative_soln1, conservative_soln2[first_pair+i], pressure1, pressure2[i], log_mean_first[i], log_mean_last[i]);
+                }
+            }
+        }
+    }
+}
+
 template <int dim, int nstate, typename real>
 std::array<real,nstate> Euler<dim, nstate, real>
 ::compute_entropy_variables (
@@ -801,6 +950,52 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nstate,real>
     return conv_flux;
 }
 
+template <int dim, int nstate, typename real>
+void Euler<dim,nstate,real>
+::convective_flux_batch (const std::vector<std::array<real,nstate>> &conservative_soln,
+                         std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_flux) const
+{
+    const unsigned int n_solutions = conservative_soln.size();
+    conv_flux.resize(n_solutions);
+
+    std::array<real,convective_flux_batch_size> pressure;
+    for(unsigned int first_soln=0; first_soln<n_solutions; first_soln+=convective_flux_batch_size){
+        const unsigned int n_batch = std::min(convective_flux_batch_size, n_solutions-first_soln);
+
+        // Same operations as compute_pressure(), without the check of every pressure.
+        for(unsigned int i=0; i<n_batch; ++i){
+            const std::array<real,nstate> &soln = conservative_soln[first_soln+i];
+            real vel2 = 0.0;
+            for (int d=0; d<dim; ++d) {
+                const real vel = soln[1+d]/soln[0];
+                vel2 += vel*vel;
+            }
+            pressure[i] = gamm1*(soln[nstate-1] - 0.5*soln[0]*vel2);
+        }
+        for(unsigned int i=0; i<n_batch; ++i){
+            if(pressure[i] < 0.0) check_positive_quantity<real>(pressure[i], "pressure");
+        }
+
+        for(unsigned int i=0; i<n_batch; ++i){
+            const std::array<real,nstate> &soln = conservative_soln[first_soln+i];
+            std::array<dealii::Tensor<1,dim,real>,nstate> &flux = conv_flux[first_soln+i];
+            const real density = soln[0];
+            dealii::Tensor<1,dim,real> vel;
+            for (int d=0; d<dim; ++d) { vel[d] = soln[1+d]/density; }
+            const real specific_total_enthalpy = soln[nstate-1]/density + pressure[i]/density;
+
+            for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+                flux[0][flux_dim] = soln[1+flux_dim];
+                for (int velocity_dim=0; velocity_dim<dim; ++velocity_dim){
+                    flux[1+velocity_dim][flux_dim] = density*vel[flux_dim]*vel[velocity_dim];
+                }
+                flux[1+flux_dim][flux_dim] += pressure[i];
+                flux[nstate-1][flux_dim] = density*vel[flux_dim]*specific_total_enthalpy;
+            }
+        }
+    }
+}
+
 template <int dim, int nstate, typename real>
 std::array<real,nstate> Euler<dim,nstate,real>
 ::convective_normal_flux (const std::array<real,nstate> &conservative_soln, const dealii::Tensor<1,dim,real> &normal) const
@@ -144,6 +144,14 @@ public:
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_flux (
         const std::array<real,nstate> &conservative_soln) const override;
 
+    /// Convective fluxes of a batch of solutions.
+    /** The pressures of convective_flux_batch_size solutions are computed in a loop without branches,
+     *  and only the negative pressures are handled by check_positive_quantity().
+     */
+    void convective_flux_batch (
+        const std::vector<std::array<real,nstate>> &conservative_soln,
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_flux) const override;
+
     /// Convective normal flux: \f$ \mathbf{F}_{conv} \cdot \hat{n} \f$
     std::array<real,nstate> convective_normal_flux (const std::array<real,nstate> &conservative_soln, const dealii::Tensor<1,dim,real> &normal) const;
 
@@ -298,6 +306,15 @@ public:
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const override;
 
+    ///  Evaluates the convective split fluxes between one solution and a line of solutions.
+    /** The two-point flux type is selected once for the whole line, and the logarithmic means
+     *  of the entropy conserving fluxes are evaluated for all the pairs in a single loop.
+     */
+    void convective_numerical_split_flux_batch (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::vector<std::array<real,nstate>> &conservative_soln2,
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_num_split_flux) const override;
+
     /// Computes the entropy variables.
     /// Given conservative variables [density, [momentum], total energy],
     /// Computes entropy variables according to Chan 2018, eq. 119
@@ -448,21 +465,62 @@ protected:
     /// Compute Ismail-Roe logarithmic mean
     real compute_ismail_roe_logarithmic_mean(const real val1, const real val2) const;
 
+    /// Compute Ismail-Roe logarithmic means of val1 with each of the n_pairs entries of val2.
+    /** For double, the branch between the series and the logarithm is replaced by a select,
+     *  such that the loop over the pairs can be vectorized.
+     */
+    void compute_ismail_roe_logarithmic_mean_batch(
+        const real val1,
+        const real *val2,
+        real *log_mean,
+        const unsigned int n_pairs) const;
+
     /** Entropy conserving split form flux of Ismail & Roe.
      *  Refer to Gassner's paper (2016) Eq. 3.17  */
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_ismail_roe (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Ismail & Roe flux from the parameter vectors and the logarithmic means of their first and last entries.
+    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_ismail_roe_from_log_means (
+        const std::array<real,nstate> &parameter_vector1,
+        const std::array<real,nstate> &parameter_vector2,
+        const real log_mean_parameter_first,
+        const real log_mean_parameter_last) const;
+
     /// Chandrashekar entropy conserving flux.
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_chandrashekar (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Chandrashekar flux from the pressures and the logarithmic means of the density and of beta.
+    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_chandrashekar_from_log_means (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<real,nstate> &conservative_soln2,
+        const real pressure1,
+        const real pressure2,
+        const real rho_log,
+        const real beta_log) const;
+
     /// Ranocha pressure equilibrium preserving, entropy and energy conserving flux.
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_ranocha (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
+
+    /// Ranocha flux from the pressures and the logarithmic means of the density and of beta.
+    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_ranocha_from_log_means (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<real,nstate> &conservative_soln2,
+        const real pressure1,
+        const real pressure2,
+        const real rho_log,
+        const real beta_log) const;
+
+    /// Number of pairs evaluated at once by convective_numerical_split_flux_batch(), such that the temporaries live on the stack.
+    static constexpr unsigned int split_flux_batch_size = 16;
+
+    /// Number of solutions evaluated at once by convective_flux_batch(), such that the pressures live on the stack.
+    static constexpr unsigned int convective_flux_batch_size = 16;
 };
 
 } // Physics namespace
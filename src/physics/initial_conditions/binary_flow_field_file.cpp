@@ -0,0 +1,246 @@
+#include "binary_flow_field_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+
+namespace PHiLiP {
+
+namespace {
+/// Appends the bytes of value to the buffer
+template <typename T>
+void append_bytes(std::vector<char> &buffer, const T value)
+{
+    const std::size_t position = buffer.size();
+    buffer.resize(position + sizeof(T));
+    std::memcpy(buffer.data() + position, &value, sizeof(T));
+}
+
+/// Extracts a value from the buffer and advances the position
+template <typename T>
+T extract_bytes(const std::vector<char> &buffer, std::size_t &position)
+{
+    T value;
+    std::memcpy(&value, buffer.data() + position, sizeof(T));
+    position += sizeof(T);
+    return value;
+}
+
+/// Size of the header entries preceding the point offsets
+constexpr std::size_t fixed_header_size_in_bytes = 8 + 4*sizeof(uint32_t) + sizeof(uint64_t) + sizeof(double) + sizeof(uint32_t);
+} // anonymous namespace
+
+uint64_t BinaryFlowFieldFileHeader::size_in_bytes() const
+{
+    return fixed_header_size_in_bytes + point_offsets.size()*sizeof(uint64_t);
+}
+
+std::vector<char> BinaryFlowFieldFileHeader::pack() const
+{
+    std::vector<char> buffer(magic_string, magic_string+8);
+    append_bytes(buffer, format_version);
+    append_bytes(buffer, dim);
+    append_bytes(buffer, n_values_per_point);
+    append_bytes(buffer, bytes_per_value);
+    append_bytes(buffer, n_dofs_per_state);
+    append_bytes(buffer, time);
+    append_bytes(buffer, static_cast<uint32_t>(point_offsets.size()-1));
+    for (const uint64_t offset : point_offsets) append_bytes(buffer, offset);
+    return buffer;
+}
+
+BinaryFlowFieldWriter::BinaryFlowFieldWriter(
+    const std::string &filename_input,
+    const MPI_Comm mpi_communicator,
+    const unsigned int dim,
+    const unsigned int n_values_per_point_input,
+    const uint64_t n_local_points_input,
+    const bool use_single_precision,
+    const uint64_t n_dofs_per_state,
+    const double time)
+    : filename(filename_input)
+    , n_values_per_point(n_values_per_point_input)
+    , bytes_per_value(use_single_precision ? sizeof(float) : sizeof(double))
+    , n_local_points(n_local_points_input)
+    , n_points_written(0)
+    , write_request(MPI_REQUEST_NULL)
+    , is_open(false)
+    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
+{
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const unsigned int n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    BinaryFlowFieldFileHeader header;
+    header.dim = dim;
+    header.n_values_per_point = n_values_per_point;
+    header.bytes_per_value = bytes_per_value;
+    header.n_dofs_per_state = n_dofs_per_state;
+    header.time = time;
+    std::vector<uint64_t> n_points_per_process(n_mpi_processes);
+    MPI_Allgather(&n_local_points, 1, MPI_UINT64_T, n_points_per_process.data(), 1, MPI_UINT64_T, mpi_communicator);
+    header.point_offsets.assign(n_mpi_processes+1, 0);
+    for (unsigned int iproc = 0; iproc < n_mpi_processes; ++iproc) {
+        header.point_offsets[iproc+1] = header.point_offsets[iproc] + n_points_per_process[iproc];
+    }
+    next_write_offset = header.size_in_bytes() + header.point_offsets[mpi_rank] * n_values_per_point * bytes_per_value;
+
+    // Remove any previous file, since MPI_MODE_CREATE does not truncate it
+    if (mpi_rank == 0) MPI_File_delete(filename.c_str(), MPI_INFO_NULL);
+    MPI_Barrier(mpi_communicator);
+    const int ierr = MPI_File_open(mpi_communicator, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+    if (ierr != MPI_SUCCESS) {
+        pcout << "ERROR: Cannot open file " << filename << std::endl;
+        std::abort();
+    }
+    is_open = true;
+
+    if (mpi_rank == 0) {
+        const std::vector<char> packed_header = header.pack();
+        MPI_File_write_at(file, 0, packed_header.data(), packed_header.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+
+    filling_buffer.reserve(chunk_size_in_bytes + n_values_per_point*bytes_per_value);
+    writing_buffer.reserve(chunk_size_in_bytes + n_values_per_point*bytes_per_value);
+}
+
+BinaryFlowFieldWriter::~BinaryFlowFieldWriter()
+{
+    if (is_open) close();
+}
+
+void BinaryFlowFieldWriter::write_point(const std::vector<double> &point_values)
+{
+    if (bytes_per_value == sizeof(float)) {
+        for (unsigned int i = 0; i < n_values_per_point; ++i) append_bytes(filling_buffer, static_cast<float>(point_values[i]));
+    } else {
+        for (unsigned int i = 0; i < n_values_per_point; ++i) append_bytes(filling_buffer, point_values[i]);
+    }
+    ++n_points_written;
+
+    if (filling_buffer.size() >= chunk_size_in_bytes) flush_buffer();
+}
+
+void BinaryFlowFieldWriter::flush_buffer()
+{
+    // The previous chunk must be written before its buffer is reused
+    MPI_Wait(&write_request, MPI_STATUS_IGNORE);
+    std::swap(filling_buffer, writing_buffer);
+    filling_buffer.clear();
+    if (writing_buffer.empty()) return;
+
+    MPI_File_iwrite_at(file, next_write_offset, writing_buffer.data(), writing_buffer.size(), MPI_BYTE, &write_request);
+    next_write_offset += writing_buffer.size();
+}
+
+void BinaryFlowFieldWriter::close()
+{
+    if (n_points_written != n_local_points) {
+        std::cout << "ERROR: Wrote " << n_points_written << " points instead of the " << n_local_points
+                  << " points announced in the header of " << filename << ". Aborting..." << std::endl;
+        std::abort();
+    }
+    flush_buffer();
+    MPI_Wait(&write_request, MPI_STATUS_IGNORE);
+    MPI_File_close(&file);
+    is_open = false;
+}
+
+BinaryFlowFieldReader::BinaryFlowFieldReader(const std::string &filename_input, const MPI_Comm mpi_communicator)
+    : filename(filename_input)
+    , n_points_read(0)
+    , is_open(false)
+    , buffer_position(0)
+    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
+{
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const unsigned int n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    const int ierr = MPI_File_open(mpi_communicator, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+    if (ierr != MPI_SUCCESS) {
+        pcout << "ERROR: Cannot open file " << filename << std::endl;
+        std::abort();
+    }
+    is_open = true;
+
+    std::vector<char> header_buffer(fixed_header_size_in_bytes);
+    MPI_File_read_at(file, 0, header_buffer.data(), header_buffer.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    if (std::memcmp(header_buffer.data(), BinaryFlowFieldFileHeader::magic_string, 8) != 0) {
+        pcout << "ERROR: " << filename << " is not a binary flow field file. Aborting..." << std::endl;
+        std::abort();
+    }
+    std::size_t position = 8;
+    const uint32_t format_version = extract_bytes<uint32_t>(header_buffer, position);
+    if (format_version != BinaryFlowFieldFileHeader::format_version) {
+        pcout << "ERROR: Unsupported version " << format_version << " of binary flow field file " << filename << ". Aborting..." << std::endl;
+        std::abort();
+    }
+    header.dim = extract_bytes<uint32_t>(header_buffer, position);
+    header.n_values_per_point = extract_bytes<uint32_t>(header_buffer, position);
+    header.bytes_per_value = extract_bytes<uint32_t>(header_buffer, position);
+    header.n_dofs_per_state = extract_bytes<uint64_t>(header_buffer, position);
+    header.time = extract_bytes<double>(header_buffer, position);
+    const uint32_t n_writing_processes = extract_bytes<uint32_t>(header_buffer, position);
+    if (n_writing_processes != n_mpi_processes) {
+        pcout << "ERROR: " << filename << " was written by " << n_writing_processes << " processes and cannot be read by "
+              << n_mpi_processes << " processes. Aborting..." << std::endl;
+        std::abort();
+    }
+    if (header.bytes_per_value != sizeof(float) && header.bytes_per_value != sizeof(double)) {
+        pcout << "ERROR: Invalid number of bytes per value in " << filename << ". Aborting..." << std::endl;
+        std::abort();
+    }
+
+    header.point_offsets.resize(n_writing_processes+1);
+    MPI_File_read_at(file, fixed_header_size_in_bytes, header.point_offsets.data(), header.point_offsets.size(), MPI_UINT64_T, MPI_STATUS_IGNORE);
+
+    const uint64_t bytes_per_point = header.n_values_per_point * header.bytes_per_value;
+    n_local_points = header.point_offsets[mpi_rank+1] - header.point_offsets[mpi_rank];
+    next_read_offset = header.size_in_bytes() + header.point_offsets[mpi_rank] * bytes_per_point;
+    n_bytes_left = n_local_points * bytes_per_point;
+}
+
+BinaryFlowFieldReader::~BinaryFlowFieldReader()
+{
+    if (is_open) close();
+}
+
+void BinaryFlowFieldReader::read_chunk()
+{
+    // Read whole points only
+    const uint64_t bytes_per_point = header.n_values_per_point * header.bytes_per_value;
+    const uint64_t chunk_size = std::max<uint64_t>(bytes_per_point, chunk_size_in_bytes - chunk_size_in_bytes % bytes_per_point);
+    const uint64_t n_bytes_to_read = std::min(n_bytes_left, chunk_size);
+    buffer.resize(n_bytes_to_read);
+    MPI_File_read_at(file, next_read_offset, buffer.data(), n_bytes_to_read, MPI_BYTE, MPI_STATUS_IGNORE);
+    next_read_offset += n_bytes_to_read;
+    n_bytes_left -= n_bytes_to_read;
+    buffer_position = 0;
+}
+
+void BinaryFlowFieldReader::read_point(std::vector<double> &point_values)
+{
+    if (n_points_read == n_local_points) {
+        std::cout << "ERROR: Trying to read more than the " << n_local_points << " points of this process in "
+                  << filename << ". Aborting..." << std::endl;
+        std::abort();
+    }
+    if (buffer_position == buffer.size()) read_chunk();
+
+    point_values.resize(header.n_values_per_point);
+    if (header.bytes_per_value == sizeof(float)) {
+        for (unsigned int i = 0; i < header.n_values_per_point; ++i) point_values[i] = extract_bytes<float>(buffer, buffer_position);
+    } else {
+        for (unsigned int i = 0; i < header.n_values_per_point; ++i) point_values[i] = extract_bytes<double>(buffer, buffer_position);
+    }
+    ++n_points_read;
+}
+
+void BinaryFlowFieldReader::close()
+{
+    MPI_File_close(&file);
+    is_open = false;
+}
+
+} // PHiLiP namespace
@@ -0,0 +1,144 @@
+#ifndef __BINARY_FLOW_FIELD_FILE_H__
+#define __BINARY_FLOW_FIELD_FILE_H__
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+
+namespace PHiLiP {
+
+/// Layout of the self-describing binary flow field files, shared by BinaryFlowFieldWriter and BinaryFlowFieldReader.
+/** A single file is written collectively by all the processes. In the native byte order, it holds
+ *  - char[8]  the magic string "PHLPFLOW",
+ *  - uint32   the format version,
+ *  - uint32   the number of dimensions,
+ *  - uint32   the number of values per point, the first dim values being the coordinates,
+ *  - uint32   the number of bytes per value, 4 (float32) or 8 (float64),
+ *  - uint64   the number of degrees of freedom per state of the sampled DG solution,
+ *  - float64  the time of the flow field,
+ *  - uint32   the number of processes that wrote the file,
+ *  - uint64   the point offsets of the processes, i.e. n_processes+1 values,
+ *  - the payload, one row of values per point, where the points of a process are contiguous.
+ */
+struct BinaryFlowFieldFileHeader
+{
+    static constexpr char magic_string[9] = "PHLPFLOW"; ///< Identifies the file format
+    static constexpr uint32_t format_version = 1; ///< Version of the layout above
+
+    uint32_t dim; ///< Number of dimensions
+    uint32_t n_values_per_point; ///< Number of values per point, including the coordinates
+    uint32_t bytes_per_value; ///< 4 for float32 and 8 for float64 payloads
+    uint64_t n_dofs_per_state; ///< Number of degrees of freedom per state of the sampled DG solution
+    double time; ///< Time of the flow field
+    std::vector<uint64_t> point_offsets; ///< First point of each process, followed by the total number of points
+
+    /// Size in bytes of the header, which is also the offset of the payload
+    uint64_t size_in_bytes() const;
+
+    /// Serializes the header
+    std::vector<char> pack() const;
+};
+
+/// Streams point values of a flow field into a BinaryFlowFieldFileHeader formatted file.
+/** The points are buffered in chunks which are written with non-blocking MPI-IO, such that
+ *  the evaluation of the next points overlaps with the writing of the previous chunk.
+ *  The constructor and close() are collective over the communicator.
+ */
+class BinaryFlowFieldWriter
+{
+public:
+    /// Constructor. Opens the file and writes the header.
+    BinaryFlowFieldWriter(
+        const std::string &filename,
+        const MPI_Comm mpi_communicator,
+        const unsigned int dim,
+        const unsigned int n_values_per_point,
+        const uint64_t n_local_points,
+        const bool use_single_precision,
+        const uint64_t n_dofs_per_state,
+        const double time);
+
+    /// Destructor. Closes the file if close() was not called.
+    ~BinaryFlowFieldWriter();
+
+    /// Appends the n_values_per_point values of the next locally owned point
+    void write_point(const std::vector<double> &point_values);
+
+    /// Writes the remaining buffered points and closes the file
+    void close();
+
+private:
+    /// Starts writing the filled buffer and waits for the previous chunk to complete
+    void flush_buffer();
+
+    /// Size of the chunks handed to MPI-IO
+    static constexpr std::size_t chunk_size_in_bytes = 1 << 22;
+
+    const std::string filename; ///< Name of the file being written
+    const unsigned int n_values_per_point; ///< Number of values per point, including the coordinates
+    const unsigned int bytes_per_value; ///< 4 or 8
+    const uint64_t n_local_points; ///< Number of points to be written by this process
+    uint64_t n_points_written; ///< Number of points appended so far
+    uint64_t next_write_offset; ///< Offset in bytes of the next chunk of this process
+
+    MPI_File file; ///< MPI-IO file handle
+    MPI_Request write_request; ///< Request of the chunk being written
+    bool is_open; ///< Flag indicating that close() has not been called
+    std::vector<char> filling_buffer; ///< Buffer being filled by write_point()
+    std::vector<char> writing_buffer; ///< Buffer being written by MPI-IO
+
+    dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
+};
+
+/// Streams point values of a flow field out of a BinaryFlowFieldFileHeader formatted file.
+/** Each process reads the block of points written by the process of same rank, such that the file
+ *  must be read with the number of processes and the partitioning it was written with.
+ *  The constructor and close() are collective over the communicator.
+ */
+class BinaryFlowFieldReader
+{
+public:
+    /// Constructor. Opens the file and reads the header.
+    BinaryFlowFieldReader(const std::string &filename, const MPI_Comm mpi_communicator);
+
+    /// Destructor. Closes the file if close() was not called.
+    ~BinaryFlowFieldReader();
+
+    /// Reads the n_values_per_point values of the next point of this process
+    void read_point(std::vector<double> &point_values);
+
+    /// Closes the file
+    void close();
+
+    /// Header of the file
+    BinaryFlowFieldFileHeader header;
+
+    /// Number of points to be read by this process
+    uint64_t n_local_points;
+
+private:
+    /// Reads the next chunk of points of this process
+    void read_chunk();
+
+    /// Size of the chunks read with MPI-IO
+    static constexpr std::size_t chunk_size_in_bytes = 1 << 22;
+
+    const std::string filename; ///< Name of the file being read
+    uint64_t n_points_read; ///< Number of points returned so far
+    uint64_t next_read_offset; ///< Offset in bytes of the next chunk of this process
+    uint64_t n_bytes_left; ///< Number of bytes of this process not yet read from the file
+
+    MPI_File file; ///< MPI-IO file handle
+    bool is_open; ///< Flag indicating that close() has not been called
+    std::vector<char> buffer; ///< Chunk being consumed by read_point()
+    std::size_t buffer_position; ///< Position of the next point in the buffer
+
+    dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
+};
+
+} // PHiLiP namespace
+#endif
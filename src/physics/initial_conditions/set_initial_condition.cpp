@@ -1,4 +1,5 @@
 #include "set_initial_condition.h"
+#include "binary_flow_field_file.h"
 #include "parameters/parameters_flow_solver.h"
 #include <deal.II/numerics/vector_tools.h>
 #include <string>
@@ -16,7 +17,7 @@ void SetInitialCondition<dim,nstate,real>::set_initial_condition(
         std::shared_ptr< PHiLiP::DGBase<dim, real> > dg_input,
         const Parameters::AllParameters *const parameters_input)
 {
-    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(dg_input->get_mpi_communicator())==0);
 
     // Set initial condition depending on the method
     using ApplyInitialConditionMethodEnum = Parameters::FlowSolverParam::ApplyInitialConditionMethod;
@@ -34,7 +35,12 @@ void SetInitialCondition<dim,nstate,real>::set_initial_condition(
     } else if(apply_initial_condition_method == ApplyInitialConditionMethodEnum::read_values_from_file_and_project) {
         const std::string input_filename_prefix = parameters_input->flow_solver_param.input_flow_setup_filename_prefix;
         pcout << "reading values from file prefix  " << input_filename_prefix << " and projecting... " << std::flush;
-        SetInitialCondition<dim,nstate,real>::read_values_from_file_and_project(dg_input,input_filename_prefix);
+        using FlowFieldFileFormatEnum = Parameters::FlowSolverParam::FlowFieldFileFormat;
+        if(parameters_input->flow_solver_param.input_flow_setup_file_format == FlowFieldFileFormatEnum::binary) {
+            SetInitialCondition<dim,nstate,real>::read_values_from_binary_file_and_project(dg_input,input_filename_prefix);
+        } else {
+            SetInitialCondition<dim,nstate,real>::read_values_from_file_and_project(dg_input,input_filename_prefix);
+        }
     }
     pcout << "done." << std::endl;
 }
@@ -45,7 +51,7 @@ void SetInitialCondition<dim,nstate,real>::interpolate_initial_condition(
         std::shared_ptr < PHiLiP::DGBase<dim,real> > &dg) 
 {
     dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
-    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    solution_no_ghost.reinit(dg->locally_owned_dofs, dg->get_mpi_communicator());
     dealii::VectorTools::interpolate(dg->dof_handler,*initial_condition_function,solution_no_ghost);
     dg->solution = solution_no_ghost;
 }
@@ -116,11 +122,11 @@ void SetInitialCondition<dim,nstate,real>::read_values_from_file_and_project(
         std::shared_ptr < PHiLiP::DGBase<dim,real> > &dg,
         const std::string input_filename_prefix) 
 {
-    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(dg->get_mpi_communicator())==0);
     
     // (1) Get filename based on MPI rank
     //-------------------------------------------------------------
-    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(dg->get_mpi_communicator());
     // -- Get padded mpi rank string
     const std::string mpi_rank_string = get_padded_mpi_rank_string(mpi_rank);
     // -- Assemble filename string
@@ -239,6 +245,87 @@ void SetInitialCondition<dim,nstate,real>::read_values_from_file_and_project(
     }
 }
 
+template<int dim, int nstate, typename real>
+void SetInitialCondition<dim,nstate,real>::read_values_from_binary_file_and_project(
+        std::shared_ptr < PHiLiP::DGBase<dim,real> > &dg,
+        const std::string input_filename_prefix)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(dg->get_mpi_communicator())==0);
+
+    BinaryFlowFieldReader reader(input_filename_prefix + std::string(".bin"), dg->get_mpi_communicator());
+
+    // check that the file matches the DG discretization
+    const unsigned int number_of_degrees_of_freedom_per_state_DG = dg->dof_handler.n_dofs()/nstate;
+    uint64_t n_local_quad_pts = 0;
+    for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+        if (cell->is_locally_owned()) n_local_quad_pts += dg->volume_quadrature_collection[cell->active_fe_index()].size();
+    }
+    if (reader.header.dim != static_cast<unsigned int>(dim) || reader.header.n_values_per_point != static_cast<unsigned int>(dim+nstate)
+        || reader.header.n_dofs_per_state != number_of_degrees_of_freedom_per_state_DG) {
+        pcout << "ERROR: Cannot read initial condition. "
+              << "Dimension, number of states or number of degrees of freedom per state do not match expected by DG in file: "
+              << input_filename_prefix << ".bin\n Aborting..." << std::endl;
+        std::abort();
+    }
+    if (reader.n_local_points != n_local_quad_pts) {
+        std::cout << "ERROR: Cannot read initial condition. The partitioning of the cells differs from the one of file: "
+                  << input_filename_prefix << ".bin\n Aborting..." << std::endl;
+        std::abort();
+    }
+    // single precision coordinates are only accurate up to the float32 machine epsilon
+    const double tolerance = (reader.header.bytes_per_value == sizeof(float)) ? 1.0e-5 : 1.0e-14;
+
+    const auto mapping = (*(dg->high_order_grid->mapping_fe_field));
+    dealii::hp::MappingCollection<dim> mapping_collection(mapping);
+    dealii::hp::FEValues<dim,dim> fe_values_collection(mapping_collection, dg->fe_collection, dg->volume_quadrature_collection, 
+                                dealii::update_quadrature_points);
+    const unsigned int max_dofs_per_cell = dg->dof_handler.get_fe_collection().max_dofs_per_cell();
+    std::vector<dealii::types::global_dof_index> current_dofs_indices(max_dofs_per_cell);
+    OPERATOR::vol_projection_operator<dim,2*dim> vol_projection(1, dg->max_degree, dg->max_grid_degree);
+    vol_projection.build_1D_volume_operator(dg->oneD_fe_collection_1state[dg->max_degree], dg->oneD_quadrature_collection[dg->max_degree]);
+    std::vector<double> point_values(dim+nstate);
+    for (auto current_cell = dg->dof_handler.begin_active(); current_cell!=dg->dof_handler.end(); ++current_cell) {
+        if (!current_cell->is_locally_owned()) continue;
+    
+        const int i_fele = current_cell->active_fe_index();
+        const int i_quad = i_fele;
+        const int i_mapp = 0;
+        fe_values_collection.reinit (current_cell, i_quad, i_mapp, i_fele);
+        const dealii::FEValues<dim,dim> &fe_values = fe_values_collection.get_present_fe_values();
+        const unsigned int poly_degree = i_fele;
+        const unsigned int n_quad_pts = dg->volume_quadrature_collection[poly_degree].size();
+        const unsigned int n_dofs_cell = dg->fe_collection[poly_degree].dofs_per_cell;
+        const unsigned int n_shape_fns = n_dofs_cell/nstate;
+        current_dofs_indices.resize(n_dofs_cell);
+        current_cell->get_dof_indices (current_dofs_indices);
+
+        // all the states of a point are stored contiguously
+        std::array<std::vector<double>,nstate> exact_value;
+        for(int istate=0; istate<nstate; istate++) exact_value[istate].resize(n_quad_pts);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            reader.read_point(point_values);
+
+            const dealii::Point<dim> qpoint = (fe_values.quadrature_point(iquad));
+            dealii::Point<dim> current_point_read_from_file;
+            for(int i=0; i<dim; ++i) current_point_read_from_file[i] = point_values[i];
+            if(qpoint.distance(current_point_read_from_file) > tolerance) {
+                std::cout << "ERROR: Distance between points is " << qpoint.distance(current_point_read_from_file)
+                          << ".\n Aborting..." << std::endl;
+                std::abort();
+            }
+            for(int istate=0; istate<nstate; istate++) exact_value[istate][iquad] = point_values[dim+istate];
+        }
+        for(int istate=0; istate<nstate; istate++){
+            std::vector<double> sol(n_shape_fns);
+            vol_projection.matrix_vector_mult_1D(exact_value[istate], sol, vol_projection.oneD_vol_operator);
+            for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
+                dg->solution[current_dofs_indices[ishape+istate*n_shape_fns]] = sol[ishape];
+            }
+        }
+    }
+    reader.close();
+}
+
 template class SetInitialCondition<PHILIP_DIM, 1, double>;
 template class SetInitialCondition<PHILIP_DIM, 2, double>;
 template class SetInitialCondition<PHILIP_DIM, 3, double>;
@@ -43,6 +43,15 @@ private:
     static void read_values_from_file_and_project(
         std::shared_ptr < PHiLiP::DGBase<dim,real> > &dg,
         const std::string input_filename_prefix);
+
+    /// Reads values from a binary flow field file and projects
+    /** The file holds, for each volume quadrature point of the locally owned cells, the coordinates followed by
+     *  the nstate values, in the same order as the text files read by read_values_from_file_and_project().
+     *  See BinaryFlowFieldFileHeader for the layout.
+     */
+    static void read_values_from_binary_file_and_project(
+        std::shared_ptr < PHiLiP::DGBase<dim,real> > &dg,
+        const std::string input_filename_prefix);
 };
 
 }//end PHiLiP namespace
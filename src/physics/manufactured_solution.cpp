@@ -4,6 +4,8 @@
 #include <deal.II/base/function.templates.h> // Needed to instantiate dealii::Function<PHILIP_DIM,Sacado::Fad::DFad<double>>
 #include <deal.II/base/function_time.templates.h> // Needed to instantiate dealii::Function<PHILIP_DIM,Sacado::Fad::DFad<double>>
 
+#include "ADTypes.hpp"
+
 #include "manufactured_solution.h"
 
 template class dealii::FunctionTime<Sacado::Fad::DFad<double>>; // Needed by Function
@@ -1253,24 +1255,6 @@ ManufacturedSolutionFactory<dim,real>::create_ManufacturedSolution(
     return nullptr;
 }
 
-using FadType = Sacado::Fad::DFad<double>; ///< Sacado AD type for first derivatives.
-using FadFadType = Sacado::Fad::DFad<FadType>; ///< Sacado AD type that allows 2nd derivatives.
-
-static constexpr int dimForwardAD = 1; ///< Size of the forward vector mode for CoDiPack.
-static constexpr int dimReverseAD = 1; ///< Size of the reverse vector mode for CoDiPack.
-
-using codi_FadType = codi::RealForwardGen<double, codi::Direction<double,dimForwardAD>>; ///< Tapeless forward mode.
-//using codi_FadType = codi::RealForwardGen<double, codi::DirectionVar<double>>;
-
-using codi_JacobianComputationType = codi::RealReverseIndexVec<dimReverseAD>; ///< Reverse mode type for Jacobian computation using TapeHelper.
-using codi_HessianComputationType = codi::RealReversePrimalIndexGen< codi::RealForwardVec<dimForwardAD>,
-                                                  codi::Direction< codi::RealForwardVec<dimForwardAD>, dimReverseAD>
-                                                >; ///< Nested reverse-forward mode type for Jacobian and Hessian computation using TapeHelper.
-//using RadFadType = Sacado::Rad::ADvar<FadType>; ///< Sacado AD type that allows 2nd derivatives.
-//using RadFadType = codi_JacobianComputationType; ///< Reverse only mode that only allows Jacobian computation.
-using RadType = codi_JacobianComputationType; ///< CoDiPaco reverse-AD type for first derivatives.
-using RadFadType = codi_HessianComputationType; ///< Nested reverse-forward mode type for Jacobian and Hessian computation using TapeHelper.
-
 template class ManufacturedSolutionFunction<PHILIP_DIM,double>;
 template class ManufacturedSolutionFunction<PHILIP_DIM,FadType>;
 template class ManufacturedSolutionFunction<PHILIP_DIM,RadType>;
@@ -72,6 +72,29 @@ std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsBase<dim,nstate,real>::conv
     return dummy;
 }
 
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::convective_flux_batch (
+    const std::vector<std::array<real,nstate>> &conservative_soln,
+    std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_flux) const
+{
+    conv_flux.resize(conservative_soln.size());
+    for (unsigned int i=0; i<conservative_soln.size(); ++i) {
+        conv_flux[i] = convective_flux(conservative_soln[i]);
+    }
+}
+
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::convective_numerical_split_flux_batch (
+    const std::array<real,nstate> &conservative_soln1,
+    const std::vector<std::array<real,nstate>> &conservative_soln2,
+    std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_num_split_flux) const
+{
+    conv_num_split_flux.resize(conservative_soln2.size());
+    for (unsigned int i=0; i<conservative_soln2.size(); ++i) {
+        conv_num_split_flux[i] = convective_numerical_split_flux(conservative_soln1, conservative_soln2[i]);
+    }
+}
+
 template <int dim, int nstate, typename real>
 real PhysicsBase<dim,nstate,real>
 ::max_convective_normal_eigenvalue (
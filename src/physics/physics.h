@@ -74,11 +74,28 @@ public:
     virtual std::array<dealii::Tensor<1,dim,real>,nstate> convective_flux (
         const std::array<real,nstate> &solution) const = 0;
 
+    /// Convective fluxes of a batch of solutions.
+    /** Evaluates convective_flux(conservative_soln[i]) for every i, such that a physics can evaluate
+     *  the fluxes of several nodes, or of several cells, in a single loop. The default calls convective_flux().
+     */
+    virtual void convective_flux_batch (
+        const std::vector<std::array<real,nstate>> &conservative_soln,
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_flux) const;
+
     /// Convective Numerical Split Flux for split form
     virtual std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Convective Numerical Split Fluxes between one solution and a line of solutions.
+    /** Evaluates convective_numerical_split_flux(conservative_soln1, conservative_soln2[i]) for every i,
+     *  such that a physics can evaluate all the pairs at once. The default calls the pairwise function.
+     */
+    virtual void convective_numerical_split_flux_batch (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::vector<std::array<real,nstate>> &conservative_soln2,
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_num_split_flux) const;
+
     /// Computes the entropy variables.
     virtual std::array<real,nstate> compute_entropy_variables (
                 const std::array<real,nstate> &conservative_soln) const = 0;
@@ -59,6 +59,25 @@ std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsModel<dim,nstate,real,nstat
     return conv_flux;
 }
 
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::convective_flux_batch (const std::vector<std::array<real,nstate>> &conservative_soln,
+                         std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_flux) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        physics_baseline->convective_flux_batch(conservative_soln,conv_flux);
+        // Add the model convective flux
+        for (unsigned int i=0; i<conservative_soln.size(); ++i) {
+            const std::array<dealii::Tensor<1,dim,real>,nstate> model_conv_flux = model->convective_flux(conservative_soln[i]);
+            for(int s=0; s<nstate; ++s){
+                conv_flux[i][s] += model_conv_flux[s];
+            }
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::convective_flux_batch(conservative_soln,conv_flux);
+    }
+}
+
 template <int dim, int nstate, typename real, int nstate_baseline_physics>
 std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsModel<dim,nstate,real,nstate_baseline_physics>
 ::dissipative_flux (
@@ -184,6 +203,21 @@ std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsModel<dim,nstate,real,nstat
     return conv_num_split_flux;
 }
 
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::convective_numerical_split_flux_batch(const std::array<real,nstate> &conservative_soln1,
+                                        const std::vector<std::array<real,nstate>> &conservative_soln2,
+                                        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_num_split_flux) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        physics_baseline->convective_numerical_split_flux_batch(conservative_soln1,conservative_soln2,conv_num_split_flux);
+    } else {
+        pcout << "Error: convective_numerical_split_flux_batch() not implemented for nstate!=nstate_baseline_physics." << std::endl;
+        pcout << "Aborting..." << std::endl;
+        std::abort();
+    }
+}
+
 template <int dim, int nstate, typename real, int nstate_baseline_physics>
 std::array<real,nstate> PhysicsModel<dim, nstate, real, nstate_baseline_physics>
 ::compute_entropy_variables (
@@ -36,6 +36,11 @@ public:
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_flux (
         const std::array<real,nstate> &conservative_soln) const;
 
+    /// Convective fluxes of a batch of solutions, with the baseline fluxes evaluated by the baseline physics in one call.
+    void convective_flux_batch (
+        const std::vector<std::array<real,nstate>> &conservative_soln,
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_flux) const;
+
     /// Dissipative (i.e. viscous) flux: \f$ \mathbf{F}_{diss} \f$ 
     std::array<dealii::Tensor<1,dim,real>,nstate> dissipative_flux (
         const std::array<real,nstate> &conservative_soln,
@@ -64,6 +69,12 @@ public:
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Convective Numerical Split Fluxes between one solution and a line of solutions
+    void convective_numerical_split_flux_batch (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::vector<std::array<real,nstate>> &conservative_soln2,
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> &conv_num_split_flux) const;
+
     /// Computes the entropy variables.
     std::array<real,nstate> compute_entropy_variables (
                 const std::array<real,nstate> &conservative_soln) const;
@@ -0,0 +1,194 @@
+#include "performance_profiler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace PHiLiP {
+namespace Profiling {
+
+PerformanceProfiler &PerformanceProfiler::instance()
+{
+    static PerformanceProfiler profiler;
+    return profiler;
+}
+
+PerformanceProfiler::PerformanceProfiler()
+    : enabled(false)
+    , suspended(false)
+    , running_node(0)
+{
+    set_enabled(false);
+}
+
+void PerformanceProfiler::set_enabled(const bool enabled_input)
+{
+    enabled = enabled_input;
+    suspended = false;
+    recording_thread = std::this_thread::get_id();
+    timer_nodes.clear();
+    timer_nodes.push_back(TimerNode{"", -1, {}, 0.0, 0, std::chrono::steady_clock::now()});
+    running_node = 0;
+    counters.clear();
+}
+
+void PerformanceProfiler::start_timer(const char *name)
+{
+    if (!is_recording()) return;
+
+    // The names are usually string literals, such that the address comparison avoids the string comparison
+    int child = -1;
+    for (const int candidate : timer_nodes[running_node].children) {
+        const char *candidate_name = timer_nodes[candidate].name;
+        if (candidate_name == name || std::strcmp(candidate_name, name) == 0) {
+            child = candidate;
+            break;
+        }
+    }
+    if (child < 0) {
+        child = timer_nodes.size();
+        timer_nodes.push_back(TimerNode{name, running_node, {}, 0.0, 0, std::chrono::steady_clock::time_point()});
+        timer_nodes[running_node].children.push_back(child);
+    }
+    running_node = child;
+    timer_nodes[child].start_time = std::chrono::steady_clock::now();
+}
+
+void PerformanceProfiler::stop_timer()
+{
+    if (!is_recording() || running_node == 0) return;
+
+    TimerNode &node = timer_nodes[running_node];
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - node.start_time;
+    node.total_seconds += elapsed.count();
+    ++node.n_calls;
+    running_node = node.parent;
+}
+
+void PerformanceProfiler::add_to_counter(const std::string &name, const uint64_t increment)
+{
+    if (!is_recording()) return;
+    counters[name] += increment;
+}
+
+void PerformanceProfiler::set_counter(const std::string &name, const uint64_t value)
+{
+    if (!is_recording()) return;
+    counters[name] = value;
+}
+
+std::string PerformanceProfiler::get_path(const int node) const
+{
+    std::string path = timer_nodes[node].name;
+    for (int parent = timer_nodes[node].parent; parent > 0; parent = timer_nodes[parent].parent) {
+        path = std::string(timer_nodes[parent].name) + "/" + path;
+    }
+    return path;
+}
+
+void PerformanceProfiler::write_summary(const std::string &filename_prefix, const MPI_Comm mpi_communicator) const
+{
+    if (!enabled) return;
+
+    int mpi_rank, n_mpi;
+    MPI_Comm_rank(mpi_communicator, &mpi_rank);
+    MPI_Comm_size(mpi_communicator, &n_mpi);
+
+    // Running timers contribute their time elapsed so far
+    std::vector<double> timer_seconds(timer_nodes.size());
+    for (unsigned int node = 0; node < timer_nodes.size(); ++node) timer_seconds[node] = timer_nodes[node].total_seconds;
+    const auto now = std::chrono::steady_clock::now();
+    for (int node = running_node; node > 0; node = timer_nodes[node].parent) {
+        const std::chrono::duration<double> elapsed = now - timer_nodes[node].start_time;
+        timer_seconds[node] += elapsed.count();
+    }
+
+    // Each process serializes its entries as lines "<kind> <value> <calls> <name>"
+    std::ostringstream local_entries;
+    local_entries << std::setprecision(17);
+    for (unsigned int node = 1; node < timer_nodes.size(); ++node) {
+        local_entries << "timer " << timer_seconds[node] << " " << timer_nodes[node].n_calls << " " << get_path(node) << "\n";
+    }
+    for (const auto &counter : counters) {
+        local_entries << "counter " << counter.second << " 0 " << counter.first << "\n";
+    }
+    const std::string local_string = local_entries.str();
+
+    int local_length = local_string.size();
+    std::vector<int> lengths(n_mpi);
+    MPI_Gather(&local_length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, mpi_communicator);
+    std::vector<int> displacements(n_mpi, 0);
+    for (int iproc = 1; iproc < n_mpi; ++iproc) displacements[iproc] = displacements[iproc-1] + lengths[iproc-1];
+    std::vector<char> gathered_entries(mpi_rank == 0 ? displacements[n_mpi-1] + lengths[n_mpi-1] : 0);
+    MPI_Gatherv(local_string.data(), local_length, MPI_CHAR,
+                gathered_entries.data(), lengths.data(), displacements.data(), MPI_CHAR, 0, mpi_communicator);
+
+    if (mpi_rank != 0) return;
+
+    /// Values of a timer or counter on every process
+    struct SummaryEntry
+    {
+        std::string kind; ///< "timer" or "counter"
+        std::string name; ///< Timer path or counter name
+        std::vector<double> values; ///< Seconds or count of every process
+        uint64_t max_calls; ///< Maximum number of calls over the processes
+    };
+    std::vector<SummaryEntry> entries;
+    std::map<std::string, unsigned int> entry_index;
+    for (int iproc = 0; iproc < n_mpi; ++iproc) {
+        std::istringstream process_entries(std::string(gathered_entries.data() + displacements[iproc], lengths[iproc]));
+        std::string kind, name;
+        double value;
+        uint64_t n_calls;
+        while (process_entries >> kind >> value >> n_calls >> name) {
+            const std::string key = kind + " " + name;
+            if (entry_index.find(key) == entry_index.end()) {
+                entry_index[key] = entries.size();
+                entries.push_back(SummaryEntry{kind, name, std::vector<double>(n_mpi, 0.0), 0});
+            }
+            SummaryEntry &entry = entries[entry_index[key]];
+            entry.values[iproc] = value;
+            entry.max_calls = std::max(entry.max_calls, n_calls);
+        }
+    }
+    // Timers first, the children of a timer directly following it
+    std::sort(entries.begin(), entries.end(), [](const SummaryEntry &a, const SummaryEntry &b) {
+        return (a.kind != b.kind) ? (a.kind == "timer") : (a.name < b.name);
+    });
+
+    std::ofstream json_file(filename_prefix + ".json");
+    std::ofstream csv_file(filename_prefix + ".csv");
+    json_file << std::setprecision(9);
+    csv_file << std::setprecision(9);
+    json_file << "{\n  \"n_processes\": " << n_mpi << ",\n  \"entries\": [";
+    csv_file << "type,name,calls,min,max,avg,total,imbalance\n";
+    for (unsigned int i = 0; i < entries.size(); ++i) {
+        const SummaryEntry &entry = entries[i];
+        const double min = *std::min_element(entry.values.begin(), entry.values.end());
+        const double max = *std::max_element(entry.values.begin(), entry.values.end());
+        double total = 0.0;
+        for (const double value : entry.values) total += value;
+        const double avg = total / n_mpi;
+        // Ratio of the slowest process to the average, 1 for a balanced load
+        const double imbalance = (avg > 0.0) ? max / avg : 1.0;
+
+        json_file << ((i == 0) ? "\n" : ",\n")
+                  << "    {\"type\": \"" << entry.kind << "\", \"name\": \"" << entry.name << "\", ";
+        if (entry.kind == "timer") json_file << "\"calls\": " << entry.max_calls << ", ";
+        json_file << "\"min\": " << min << ", \"max\": " << max << ", \"avg\": " << avg
+                  << ", \"total\": " << total << ", \"imbalance\": " << imbalance << "}";
+
+        csv_file << entry.kind << "," << entry.name << ",";
+        if (entry.kind == "timer") csv_file << entry.max_calls;
+        csv_file << "," << min << "," << max << "," << avg << "," << total << "," << imbalance << "\n";
+    }
+    json_file << "\n  ]\n}\n";
+
+    std::cout << "Wrote performance summary to " << filename_prefix << ".json and " << filename_prefix << ".csv" << std::endl;
+}
+
+} // Profiling namespace
+} // PHiLiP namespace
@@ -0,0 +1,158 @@
+#ifndef __PERFORMANCE_PROFILER_H__
+#define __PERFORMANCE_PROFILER_H__
+
+#include <mpi.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace PHiLiP {
+namespace Profiling {
+
+/// Process-wide registry of hierarchical wall-clock timers and event counters.
+/** Timers are nested: a timer started while another one is running becomes its child, such that a phase
+ *  is reported separately for each of its callers, e.g. "assemble_residual/volume_term/metric_construction"
+ *  and "assemble_residual/face_term/metric_construction". Timer names are expected to be string literals,
+ *  which are first compared by address when looking up the running timer's children.
+ *
+ *  The registry is disabled by default, in which case starting and stopping a timer only checks a flag.
+ *  Only the thread that enabled the registry records. The recording thread may itself execute part of the
+ *  work of a threaded loop, e.g. the threaded residual assembly, such that the timers inside the loop would
+ *  only measure an arbitrary subset of it. These loops suspend the recording with ScopedSuspension: the
+ *  inner timers, e.g. volume_term and face_term, are then absent from the summary and only the enclosing
+ *  timers are reported.
+ *
+ *  write_summary() reduces the timers and counters over the processes and reports, for each of them,
+ *  the minimum, maximum and average over the processes and the load imbalance max/avg.
+ */
+class PerformanceProfiler
+{
+public:
+    /// Returns the registry of this process
+    static PerformanceProfiler &instance();
+
+    /// Enables or disables the recording. Also discards everything recorded so far.
+    void set_enabled(const bool enabled);
+
+    /// Returns true if the calling thread records timers and counters
+    bool is_recording() const
+    {
+        return enabled && !suspended && std::this_thread::get_id() == recording_thread;
+    }
+
+    /// Suspends or resumes the recording, without discarding what was recorded. See ScopedSuspension.
+    void set_suspended(const bool suspended_input) { suspended = suspended_input; }
+
+    /// Returns true if the recording is suspended
+    bool is_suspended() const { return suspended; }
+
+    /// Starts the timer of given name as a child of the running timer
+    void start_timer(const char *name);
+
+    /// Stops the running timer
+    void stop_timer();
+
+    /// Adds increment to the counter of given name
+    void add_to_counter(const std::string &name, const uint64_t increment = 1);
+
+    /// Sets the counter of given name, e.g. to report a counter maintained elsewhere
+    void set_counter(const std::string &name, const uint64_t value);
+
+    /// Writes the summary over all processes into filename_prefix.json and filename_prefix.csv.
+    /** Collective over the communicator, does nothing if the registry is disabled.
+     *  Running timers contribute their time elapsed so far.
+     *  A timer or counter that was not reached by a process counts as zero on that process.
+     */
+    void write_summary(const std::string &filename_prefix, const MPI_Comm mpi_communicator) const;
+
+private:
+    /// Constructor. Disabled registry.
+    PerformanceProfiler();
+
+    /// Node of the timer tree
+    struct TimerNode
+    {
+        const char *name; ///< Name of the timer, as passed to start_timer()
+        int parent; ///< Index of the parent node, -1 for the root
+        std::vector<int> children; ///< Indices of the child nodes
+        double total_seconds; ///< Accumulated wall-clock time
+        uint64_t n_calls; ///< Number of times the timer was stopped
+        std::chrono::steady_clock::time_point start_time; ///< Time at which the timer was last started
+    };
+
+    /// Returns the path of the node, i.e. the names from the root joined by '/'
+    std::string get_path(const int node) const;
+
+    bool enabled; ///< Flag indicating that the registry records
+    bool suspended; ///< Flag indicating that the recording is suspended, e.g. during a threaded loop
+    std::thread::id recording_thread; ///< Thread that enabled the registry
+    std::vector<TimerNode> timer_nodes; ///< Timer tree, the first node being the root
+    int running_node; ///< Index of the innermost running timer, 0 if none is running
+    std::map<std::string, uint64_t> counters; ///< Event counters
+};
+
+/// Times the enclosing scope with the PerformanceProfiler.
+/** Whether the timer records is decided at construction, such that enabling the profiler
+ *  while the scope is active does not stop a timer that was never started.
+ */
+class ScopedTimer
+{
+public:
+    /// Constructor. Starts the timer of given name.
+    explicit ScopedTimer(const char *name)
+        : profiler(PerformanceProfiler::instance())
+        , is_recording(profiler.is_recording())
+    {
+        if (is_recording) profiler.start_timer(name);
+    }
+
+    /// Destructor. Stops the timer.
+    ~ScopedTimer()
+    {
+        if (is_recording) profiler.stop_timer();
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete; ///< Not copyable
+    ScopedTimer &operator=(const ScopedTimer &) = delete; ///< Not copyable
+
+private:
+    PerformanceProfiler &profiler; ///< Registry of this process
+    const bool is_recording; ///< Flag indicating that the timer was started
+};
+
+/// Suspends the recording of the PerformanceProfiler in the enclosing scope.
+/** Used around threaded loops, in which the recording thread only executes a subset of the work.
+ *  Must be nested inside the timers running when it is constructed, which are stopped after it is destroyed.
+ */
+class ScopedSuspension
+{
+public:
+    /// Constructor. Suspends the recording.
+    ScopedSuspension()
+        : profiler(PerformanceProfiler::instance())
+        , was_suspended(profiler.is_suspended())
+    {
+        profiler.set_suspended(true);
+    }
+
+    /// Destructor. Restores the previous state of the recording.
+    ~ScopedSuspension()
+    {
+        profiler.set_suspended(was_suspended);
+    }
+
+    ScopedSuspension(const ScopedSuspension &) = delete; ///< Not copyable
+    ScopedSuspension &operator=(const ScopedSuspension &) = delete; ///< Not copyable
+
+private:
+    PerformanceProfiler &profiler; ///< Registry of this process
+    const bool was_suspended; ///< Whether the recording was already suspended
+};
+
+} // Profiling namespace
+} // PHiLiP namespace
+#endif
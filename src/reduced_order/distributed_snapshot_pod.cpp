@@ -0,0 +1,138 @@
+#include "distributed_snapshot_pod.h"
+
+#include <eigen/Eigen/Cholesky>
+#include <eigen/Eigen/Eigenvalues>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+
+DistributedSnapshotPOD::DistributedSnapshotPOD(const MPI_Comm mpi_communicator_input)
+        : mpi_communicator(mpi_communicator_input)
+{}
+
+void DistributedSnapshotPOD::add_snapshot(const VectorXd &local_snapshot)
+{
+    const int n_previous_snapshots = n_snapshots();
+    if (n_previous_snapshots == 0) local_snapshots.resize(local_snapshot.size(), 0);
+    local_snapshots.conservativeResize(Eigen::NoChange, n_previous_snapshots+1);
+    local_snapshots.col(n_previous_snapshots) = local_snapshot;
+
+    // Border the Gram matrix with the inner products of the new snapshot
+    const VectorXd local_inner_products = local_snapshots.transpose() * local_snapshot;
+    VectorXd inner_products(n_previous_snapshots+1);
+    MPI_Allreduce(local_inner_products.data(), inner_products.data(), n_previous_snapshots+1, MPI_DOUBLE, MPI_SUM, mpi_communicator);
+    gram_matrix.conservativeResize(n_previous_snapshots+1, n_previous_snapshots+1);
+    gram_matrix.row(n_previous_snapshots) = inner_products.transpose();
+    gram_matrix.col(n_previous_snapshots) = inner_products;
+}
+
+void DistributedSnapshotPOD::compute_basis(const double truncation_tolerance)
+{
+    int mpi_rank;
+    MPI_Comm_rank(mpi_communicator, &mpi_rank);
+    const int n = n_snapshots();
+
+    local_mean = local_snapshots.rowwise().mean();
+
+    // Gram matrix of the mean-centered snapshots, P X^T X P with the centering P = I - 1 1^T / n
+    const MatrixXd centering = MatrixXd::Identity(n, n) - MatrixXd::Constant(n, n, 1.0/n);
+    const MatrixXd centered_gram_matrix = centering * gram_matrix * centering;
+    const Eigen::SelfAdjointEigenSolver<MatrixXd> eigen_solver(centered_gram_matrix);
+    const VectorXd eigenvalues = eigen_solver.eigenvalues().reverse();
+    const MatrixXd eigenvectors = eigen_solver.eigenvectors().rowwise().reverse();
+
+    // The eigenvalues are the squared singular values, known to within the round-off of the largest one,
+    // such that the modes of relatively small eigenvalue are discarded
+    const double relative_cutoff = std::max(relative_eigenvalue_cutoff, n * std::numeric_limits<double>::epsilon());
+    const double min_eigenvalue = relative_cutoff * std::max(eigenvalues(0), 0.0);
+    double discarded_energy = 0.0;
+    for (int i = 0; i < n; ++i) discarded_energy += std::max(eigenvalues(i), 0.0);
+    const double max_discarded_energy = truncation_tolerance * discarded_energy;
+    int n_modes = 0;
+    while (n_modes < n && eigenvalues(n_modes) > min_eigenvalue && discarded_energy > max_discarded_energy) {
+        discarded_energy -= eigenvalues(n_modes);
+        ++n_modes;
+    }
+    if (n_modes == 0) {
+        if (mpi_rank == 0) std::cout << "ERROR: The " << n << " snapshots do not span any POD mode. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    singular_values = eigenvalues.head(n_modes).cwiseSqrt();
+    local_basis = (local_snapshots.colwise() - local_mean) * eigenvectors.leftCols(n_modes) * singular_values.cwiseInverse().asDiagonal();
+
+    // Orthonormalize with the Cholesky factor R of U^T U = R^T R, i.e. U := U R^-1
+    const MatrixXd local_overlap = local_basis.transpose() * local_basis;
+    MatrixXd overlap(n_modes, n_modes);
+    MPI_Allreduce(local_overlap.data(), overlap.data(), n_modes*n_modes, MPI_DOUBLE, MPI_SUM, mpi_communicator);
+    const Eigen::LLT<MatrixXd> cholesky(overlap);
+    local_basis = cholesky.matrixU().solve<Eigen::OnTheRight>(local_basis);
+}
+
+int DistributedSnapshotPOD::n_snapshots() const
+{
+    return local_snapshots.cols();
+}
+
+const MatrixXd &DistributedSnapshotPOD::get_local_snapshots() const
+{
+    return local_snapshots;
+}
+
+const VectorXd &DistributedSnapshotPOD::get_local_mean() const
+{
+    return local_mean;
+}
+
+const MatrixXd &DistributedSnapshotPOD::get_local_basis() const
+{
+    return local_basis;
+}
+
+const VectorXd &DistributedSnapshotPOD::get_singular_values() const
+{
+    return singular_values;
+}
+
+void write_distributed_rows(const std::string &filename, const MatrixXd &local_rows, const MPI_Comm mpi_communicator)
+{
+    int mpi_rank, n_mpi;
+    MPI_Comm_rank(mpi_communicator, &mpi_rank);
+    MPI_Comm_size(mpi_communicator, &n_mpi);
+    const int n_columns = local_rows.cols();
+
+    if (mpi_rank != 0) {
+        const int n_local_rows = local_rows.rows();
+        MPI_Send(&n_local_rows, 1, MPI_INT, 0, 0, mpi_communicator);
+        MPI_Send(local_rows.data(), n_local_rows*n_columns, MPI_DOUBLE, 0, 1, mpi_communicator);
+        return;
+    }
+
+    std::ofstream out_file(filename);
+    out_file << std::scientific << std::setprecision(16);
+    const auto write_rows = [&](const MatrixXd &rows) {
+        for (int i = 0; i < rows.rows(); ++i) {
+            for (int j = 0; j < n_columns; ++j) out_file << rows(i,j) << " ";
+            out_file << "\n";
+        }
+    };
+    write_rows(local_rows);
+    // Receive one process at a time, such that only the rows of one other process are held at once
+    for (int iproc = 1; iproc < n_mpi; ++iproc) {
+        int n_process_rows;
+        MPI_Recv(&n_process_rows, 1, MPI_INT, iproc, 0, mpi_communicator, MPI_STATUS_IGNORE);
+        MatrixXd process_rows(n_process_rows, n_columns);
+        MPI_Recv(process_rows.data(), n_process_rows*n_columns, MPI_DOUBLE, iproc, 1, mpi_communicator, MPI_STATUS_IGNORE);
+        write_rows(process_rows);
+    }
+}
+
+}
+}
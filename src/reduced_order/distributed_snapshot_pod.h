@@ -0,0 +1,98 @@
+#ifndef __DISTRIBUTED_SNAPSHOT_POD__
+#define __DISTRIBUTED_SNAPSHOT_POD__
+
+#include <mpi.h>
+
+#include <string>
+
+#include <eigen/Eigen/Dense>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/// Proper orthogonal decomposition of snapshots whose rows are distributed over the processes like the solution.
+/** Each process only stores its locally owned rows of the snapshots. The POD is computed with the method of snapshots:
+ *  the Gram matrix X^T X of the snapshots, whose size is the number of snapshots, is reduced over the processes and
+ *  its eigendecomposition gives the right singular vectors W and singular values S of the mean-centered snapshots,
+ *  from which the locally owned rows of the basis U = X W S^-1 are computed. The basis is then orthonormalized
+ *  once more by a Cholesky factorization of U^T U, which recovers the orthogonality lost in forming the Gram matrix.
+ *
+ *  Forming the Gram matrix squares the condition number: the eigenvalues are only known to within about
+ *  machine epsilon times the largest one, such that a singular value below about sqrt(eps) times the largest
+ *  one, and its mode, are inaccurate. Modes below relative_eigenvalue_cutoff are therefore discarded.
+ *
+ *  Adding a snapshot only borders the Gram matrix with its inner products with the previous snapshots, at a cost
+ *  proportional to the number of rows N times the number of snapshots n. compute_basis() is not incremental:
+ *  every call solves the n x n eigenproblem, O(n^3), and forms and orthonormalizes the basis, O(N n^2),
+ *  which avoids the O(N n^2) decomposition of the snapshots themselves but not the product with them.
+ *
+ *  Refer to "Turbulence and the dynamics of coherent structures. Part I: Coherent structures",
+ *  L. Sirovich, Quarterly of Applied Mathematics, 1987.
+ */
+class DistributedSnapshotPOD
+{
+public:
+    /// Constructor
+    explicit DistributedSnapshotPOD(const MPI_Comm mpi_communicator);
+
+    /// Appends a snapshot given by its locally owned rows
+    void add_snapshot(const VectorXd &local_snapshot);
+
+    /// Squared singular values, relative to the largest one, below which the modes are discarded as inaccurate.
+    /** Corresponds to singular values below 1e-5 times the largest one, whose relative error
+     *  from the round-off of the Gram matrix could reach eps/1e-10, about 1e-6.
+     */
+    static constexpr double relative_eigenvalue_cutoff = 1e-10;
+
+    /// Computes the POD basis of the mean-centered snapshots.
+    /** The modes below relative_eigenvalue_cutoff are always discarded. The trailing modes holding at most
+     *  the fraction truncation_tolerance of the energy, i.e. of the sum of the squared singular values, are also discarded.
+     */
+    void compute_basis(const double truncation_tolerance);
+
+    /// Number of snapshots
+    int n_snapshots() const;
+
+    /// Locally owned rows of the snapshots, one column per snapshot
+    const MatrixXd &get_local_snapshots() const;
+
+    /// Locally owned rows of the mean of the snapshots, i.e. the reference state of the basis
+    const VectorXd &get_local_mean() const;
+
+    /// Locally owned rows of the POD basis, one column per mode
+    const MatrixXd &get_local_basis() const;
+
+    /// Singular values of the mean-centered snapshots of the retained modes, in decreasing order
+    const VectorXd &get_singular_values() const;
+
+private:
+    const MPI_Comm mpi_communicator; ///< MPI communicator.
+
+    /// Locally owned rows of the snapshots
+    MatrixXd local_snapshots;
+
+    /// Inner products of the snapshots over all the rows
+    MatrixXd gram_matrix;
+
+    /// Locally owned rows of the mean of the snapshots
+    VectorXd local_mean;
+
+    /// Locally owned rows of the POD basis
+    MatrixXd local_basis;
+
+    /// Singular values of the retained modes
+    VectorXd singular_values;
+};
+
+/// Writes a matrix whose rows are distributed over the processes into a text file, one row per line.
+/** Collective over the communicator. The first process writes the rows of each process in turn, such that
+ *  the locally owned rows must be contiguous ranges ordered by process, as are the dofs of a DoFHandler.
+ */
+void write_distributed_rows(const std::string &filename, const MatrixXd &local_rows, const MPI_Comm mpi_communicator);
+
+}
+}
+
+#endif
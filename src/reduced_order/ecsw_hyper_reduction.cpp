@@ -0,0 +1,192 @@
+#include "ecsw_hyper_reduction.h"
+
+#include <deal.II/base/mpi.h>
+
+#include <Epetra_Map.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+
+VectorXd solve_non_negative_least_squares(const MatrixXd &A, const VectorXd &b, const double tolerance)
+{
+    const int n_columns = A.cols();
+    VectorXd x = VectorXd::Zero(n_columns);
+    std::vector<bool> is_passive(n_columns, false);
+    VectorXd residual = b;
+    const double target_norm = tolerance * b.norm();
+
+    // Each outer iteration frees one column, such that the iterations are bounded by a multiple of the number of columns
+    const int max_iterations = 3 * n_columns;
+    for (int iteration = 0; iteration < max_iterations && residual.norm() > target_norm; ++iteration) {
+        // Free the constrained column of largest descent direction
+        const VectorXd gradient = A.transpose() * residual;
+        int new_column = -1;
+        double max_gradient = 0.0;
+        for (int j = 0; j < n_columns; ++j) {
+            if (!is_passive[j] && gradient(j) > max_gradient) {
+                max_gradient = gradient(j);
+                new_column = j;
+            }
+        }
+        if (new_column < 0) break; // Karush-Kuhn-Tucker conditions satisfied
+        is_passive[new_column] = true;
+
+        while (true) {
+            // Unconstrained least-squares on the passive columns
+            std::vector<int> passive_columns;
+            for (int j = 0; j < n_columns; ++j) if (is_passive[j]) passive_columns.push_back(j);
+            MatrixXd A_passive(A.rows(), passive_columns.size());
+            for (unsigned int k = 0; k < passive_columns.size(); ++k) A_passive.col(k) = A.col(passive_columns[k]);
+            const VectorXd z = A_passive.colPivHouseholderQr().solve(b);
+
+            if (z.minCoeff() > 0.0) {
+                for (unsigned int k = 0; k < passive_columns.size(); ++k) x(passive_columns[k]) = z(k);
+                break;
+            }
+
+            // Step from x towards z until the first passive value reaches zero, and constrain the zero values
+            double step = 1.0;
+            for (unsigned int k = 0; k < passive_columns.size(); ++k) {
+                const double x_k = x(passive_columns[k]);
+                if (z(k) <= 0.0) step = std::min(step, x_k / (x_k - z(k)));
+            }
+            for (unsigned int k = 0; k < passive_columns.size(); ++k) {
+                const int j = passive_columns[k];
+                x(j) += step * (z(k) - x(j));
+                if (x(j) <= 1e-14 * std::max(1.0, z.cwiseAbs().maxCoeff())) {
+                    x(j) = 0.0;
+                    is_passive[j] = false;
+                }
+            }
+            if (std::none_of(is_passive.begin(), is_passive.end(), [](const bool passive) { return passive; })) break;
+        }
+        residual = b - A * x;
+    }
+    return x;
+}
+
+template <int dim>
+ECSWHyperReduction<dim>::ECSWHyperReduction(const dealii::DoFHandler<dim> &dof_handler_input, const MPI_Comm mpi_communicator_input)
+        : dof_handler(dof_handler_input)
+        , mpi_communicator(mpi_communicator_input)
+        , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
+{
+    int n_local_cells = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (cell->is_locally_owned()) ++n_local_cells;
+    }
+    local_cell_contributions.resize(0, n_local_cells);
+}
+
+template <int dim>
+void ECSWHyperReduction<dim>::add_training_residual(
+    const Epetra_CrsMatrix &test_basis,
+    const dealii::LinearAlgebra::distributed::Vector<double> &residual)
+{
+    const Epetra_Map &row_map = test_basis.RowMap();
+    const Epetra_Map &column_map = test_basis.ColMap();
+    const int n_basis = test_basis.DomainMap().NumGlobalElements();
+    MatrixXd cell_contributions = MatrixXd::Zero(n_basis, local_cell_contributions.cols());
+
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    int cell_index = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        for (const dealii::types::global_dof_index idof : dofs_indices) {
+            int n_entries;
+            double *values;
+            int *indices;
+            test_basis.ExtractMyRowView(row_map.LID(static_cast<int>(idof)), n_entries, values, indices);
+            const double residual_value = residual[idof];
+            for (int i = 0; i < n_entries; ++i) {
+                cell_contributions(column_map.GID(indices[i]), cell_index) += values[i] * residual_value;
+            }
+        }
+        ++cell_index;
+    }
+
+    // Normalize by the reduced residual of the training state, such that all the states are recovered to the same relative tolerance
+    const VectorXd local_reduced_residual = cell_contributions.rowwise().sum();
+    VectorXd reduced_residual(n_basis);
+    MPI_Allreduce(local_reduced_residual.data(), reduced_residual.data(), n_basis, MPI_DOUBLE, MPI_SUM, mpi_communicator);
+    const double reduced_residual_norm = reduced_residual.norm();
+    if (reduced_residual_norm > 0.0) cell_contributions /= reduced_residual_norm;
+
+    local_cell_contributions.conservativeResize(local_cell_contributions.rows() + n_basis, Eigen::NoChange);
+    local_cell_contributions.bottomRows(n_basis) = cell_contributions;
+}
+
+template <int dim>
+void ECSWHyperReduction<dim>::compute_cell_weights(const double tolerance)
+{
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    const int n_rows = local_cell_contributions.rows();
+    const int n_local_cells = local_cell_contributions.cols();
+
+    std::vector<int> n_cells(n_mpi);
+    MPI_Allgather(&n_local_cells, 1, MPI_INT, n_cells.data(), 1, MPI_INT, mpi_communicator);
+    std::vector<int> cell_offsets(n_mpi, 0);
+    for (int iproc = 1; iproc < n_mpi; ++iproc) cell_offsets[iproc] = cell_offsets[iproc-1] + n_cells[iproc-1];
+    const int n_global_cells = cell_offsets[n_mpi-1] + n_cells[n_mpi-1];
+
+    // The matrices are column-major, such that the columns of each process are contiguous
+    std::vector<int> n_values(n_mpi), value_offsets(n_mpi);
+    for (int iproc = 0; iproc < n_mpi; ++iproc) {
+        n_values[iproc] = n_rows * n_cells[iproc];
+        value_offsets[iproc] = n_rows * cell_offsets[iproc];
+    }
+    MatrixXd cell_contributions(n_rows, (mpi_rank == 0) ? n_global_cells : 0);
+    MPI_Gatherv(local_cell_contributions.data(), n_rows * n_local_cells, MPI_DOUBLE,
+                cell_contributions.data(), n_values.data(), value_offsets.data(), MPI_DOUBLE, 0, mpi_communicator);
+
+    // Unit weights recover the reduced residuals exactly
+    VectorXd cell_weights;
+    if (mpi_rank == 0) {
+        const VectorXd reduced_residuals = cell_contributions.rowwise().sum();
+        cell_weights = solve_non_negative_least_squares(cell_contributions, reduced_residuals, tolerance);
+    }
+    local_cell_weights.resize(n_local_cells);
+    MPI_Scatterv(cell_weights.data(), n_cells.data(), cell_offsets.data(), MPI_DOUBLE,
+                 local_cell_weights.data(), n_local_cells, MPI_DOUBLE, 0, mpi_communicator);
+
+    pcout << "ECSW sampled " << n_sampled_cells() << " of the " << n_global_cells << " cells with "
+          << n_rows << " training equations." << std::endl;
+}
+
+template <int dim>
+void ECSWHyperReduction<dim>::get_row_weights(dealii::LinearAlgebra::distributed::Vector<double> &row_weights, const bool use_square_root) const
+{
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    int cell_index = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const double weight = use_square_root ? std::sqrt(local_cell_weights(cell_index)) : local_cell_weights(cell_index);
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        for (const dealii::types::global_dof_index idof : dofs_indices) {
+            row_weights[idof] = weight;
+        }
+        ++cell_index;
+    }
+}
+
+template <int dim>
+unsigned int ECSWHyperReduction<dim>::n_sampled_cells() const
+{
+    const unsigned int n_local_sampled_cells = (local_cell_weights.array() > 0.0).count();
+    return dealii::Utilities::MPI::sum(n_local_sampled_cells, mpi_communicator);
+}
+
+template class ECSWHyperReduction <PHILIP_DIM>;
+
+}
+}
@@ -0,0 +1,83 @@
+#ifndef __ECSW_HYPER_REDUCTION__
+#define __ECSW_HYPER_REDUCTION__
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <Epetra_CrsMatrix.h>
+
+#include <eigen/Eigen/Dense>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/// Solves min ||A x - b|| subject to x >= 0 with the active set method of Lawson and Hanson.
+/** The iterations stop once ||A x - b|| <= tolerance ||b||, such that a loose tolerance returns a sparse x.
+ *  Refer to Chapter 23 of "Solving Least Squares Problems", C. L. Lawson and R. J. Hanson, SIAM, 1995.
+ */
+VectorXd solve_non_negative_least_squares(const MatrixXd &A, const VectorXd &b, const double tolerance);
+
+/// Energy-conserving sampling and weighting (ECSW) of the cells for hyper-reduced POD models.
+/** The reduced residual is the sum over the cells of the test basis rows of the cell times the residual rows of the cell,
+ *  V^T R = sum_e V_e^T R_e. ECSW approximates the sum by a sparse set of non-negative cell weights xi_e,
+ *  V^T R ~ sum_e xi_e V_e^T R_e, trained such that the reduced residuals of the training states are
+ *  recovered within the tolerance. The hyper-reduced model then only assembles the cells of nonzero weight.
+ *
+ *  Refer to "Mesh sampling and weighting for the hyperreduction of nonlinear Petrov-Galerkin reduced-order models
+ *  with local reduced-order bases", S. Grimberg, C. Farhat, R. Tezaur and C. Bou-Mosleh,
+ *  International Journal for Numerical Methods in Engineering, 2021.
+ *
+ *  The cells are ordered as the locally owned active cells of the DoFHandler, by increasing process rank.
+ *  The training contributions are gathered on the first process, where the weights are computed.
+ */
+template <int dim>
+class ECSWHyperReduction
+{
+public:
+    /// Constructor
+    ECSWHyperReduction(const dealii::DoFHandler<dim> &dof_handler, const MPI_Comm mpi_communicator);
+
+    /// Adds the reduced residual contributions of the cells for one training state.
+    /** The test basis has the same row distribution as the residual, e.g. V for a Galerkin projection
+     *  or the Jacobian times V for a Petrov-Galerkin projection.
+     */
+    void add_training_residual(
+        const Epetra_CrsMatrix &test_basis,
+        const dealii::LinearAlgebra::distributed::Vector<double> &residual);
+
+    /// Computes the cell weights such that the reduced residuals of the training states are recovered within the tolerance
+    void compute_cell_weights(const double tolerance);
+
+    /// Returns the weights of the rows of the residual, i.e. the weight of the cell on each of its degrees of freedom.
+    /** A Petrov-Galerkin model scales both its residual and its test basis, such that it uses the square root of the weights.
+     */
+    void get_row_weights(dealii::LinearAlgebra::distributed::Vector<double> &row_weights, const bool use_square_root) const;
+
+    /// Returns the number of cells of nonzero weight
+    unsigned int n_sampled_cells() const;
+
+private:
+    /// DoFHandler of the residual
+    const dealii::DoFHandler<dim> &dof_handler;
+
+    const MPI_Comm mpi_communicator; ///< MPI communicator.
+
+    /// Reduced residual contributions, one column per locally owned cell and one row per training state and basis function
+    MatrixXd local_cell_contributions;
+
+    /// Weights of the locally owned cells
+    VectorXd local_cell_weights;
+
+    /// ConditionalOStream.
+    /** Used as std::cout, but only prints if mpi_rank == 0
+     */
+    dealii::ConditionalOStream pcout;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,96 @@
+#include "kd_tree.h"
+#include <algorithm>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+
+KDTree::KDTree()
+        : points()
+        , nodes()
+        , root(-1)
+{}
+
+KDTree::KDTree(const MatrixXd& points)
+        : points(points)
+        , nodes()
+        , root(-1)
+{
+    std::vector<int> indices(points.rows());
+    for(unsigned int i = 0 ; i < indices.size() ; i++){
+        indices[i] = i;
+    }
+    nodes.reserve(points.rows());
+    root = build(indices.begin(), indices.end());
+}
+
+int KDTree::build(std::vector<int>::iterator begin, std::vector<int>::iterator end){
+    if(begin == end){
+        return -1;
+    }
+
+    //Split along the coordinate of largest spread
+    RowVectorXd min = points.row(*begin);
+    RowVectorXd max = points.row(*begin);
+    for(auto it = begin ; it != end ; ++it){
+        min = min.cwiseMin(points.row(*it));
+        max = max.cwiseMax(points.row(*it));
+    }
+    int axis;
+    (max - min).maxCoeff(&axis);
+
+    std::vector<int>::iterator median = begin + (end - begin)/2;
+    std::nth_element(begin, median, end,
+                     [&](const int& a, const int& b) {
+                         return points(a, axis) < points(b, axis);
+                     });
+
+    const int node = nodes.size();
+    nodes.push_back(Node{*median, axis, -1, -1});
+    const int left = build(begin, median);
+    const int right = build(median + 1, end);
+    nodes[node].left = left;
+    nodes[node].right = right;
+    return node;
+}
+
+std::vector<int> KDTree::kNearestNeighbors(const RowVectorXd& point, const int k) const{
+    std::priority_queue<DistanceIndex> nearest;
+    if(k > 0){
+        search(root, point, k, nearest);
+    }
+
+    std::vector<int> index(nearest.size());
+    for(int i = nearest.size() - 1 ; i >= 0 ; i--){
+        index[i] = nearest.top().second;
+        nearest.pop();
+    }
+    return index;
+}
+
+void KDTree::search(const int node, const RowVectorXd& point, const unsigned int k, std::priority_queue<DistanceIndex>& nearest) const{
+    if(node < 0){
+        return;
+    }
+
+    const Node& current = nodes[node];
+    const DistanceIndex candidate((points.row(current.point) - point).squaredNorm(), current.point);
+    if(nearest.size() < k){
+        nearest.push(candidate);
+    }
+    else if(candidate < nearest.top()){
+        nearest.pop();
+        nearest.push(candidate);
+    }
+
+    //Search the side of the point first, and the other side only if it may hold nearer points
+    const double offset = point(current.axis) - points(current.point, current.axis);
+    const int near_child = (offset < 0) ? current.left : current.right;
+    const int far_child = (offset < 0) ? current.right : current.left;
+    search(near_child, point, k, nearest);
+    if(nearest.size() < k || offset*offset <= nearest.top().first){
+        search(far_child, point, k, nearest);
+    }
+}
+
+}
+}
@@ -0,0 +1,62 @@
+#ifndef __KD_TREE__
+#define __KD_TREE__
+
+#include <eigen/Eigen/Dense>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+using Eigen::MatrixXd;
+using Eigen::RowVectorXd;
+
+/// k-d tree of points for nearest neighbor queries
+/** The points are split at the median of the coordinate of largest spread, such that the tree is balanced and
+ *  a query of the k nearest points visits O(log(n) + k) nodes on average instead of computing all the n distances.
+ */
+class KDTree
+{
+public:
+    /// Constructor of an empty tree
+    KDTree();
+
+    /// Constructor. Builds the tree of the points, one per row.
+    explicit KDTree(const MatrixXd& points);
+
+    /// Returns the indices of the k nearest points, sorted by increasing distance, and by index for equal distances
+    std::vector<int> kNearestNeighbors(const RowVectorXd& point, const int k) const;
+
+    /// Points, one per row
+    MatrixXd points;
+
+private:
+    /// Node of the tree, holding a point and splitting the space along an axis
+    struct Node
+    {
+        int point; ///< Row of the point of the node
+        int axis; ///< Coordinate along which the children are split
+        int left; ///< Child of the points below the node along the axis, -1 if none
+        int right; ///< Child of the points above the node along the axis, -1 if none
+    };
+
+    /// Nodes of the tree
+    std::vector<Node> nodes;
+
+    /// Index of the root node, -1 if the tree is empty
+    int root;
+
+    /// Builds the subtree of the given points and returns the index of its root node
+    int build(std::vector<int>::iterator begin, std::vector<int>::iterator end);
+
+    /// Squared distance and point index, ordered such that the farthest point is on top of the heap
+    using DistanceIndex = std::pair<double, int>;
+
+    /// Adds the points of the subtree nearer than the current k nearest points to the heap
+    void search(const int node, const RowVectorXd& point, const unsigned int k, std::priority_queue<DistanceIndex>& nearest) const;
+};
+
+}
+}
+
+#endif
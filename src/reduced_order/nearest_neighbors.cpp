@@ -9,6 +9,7 @@ namespace ProperOrthogonalDecomposition {
 NearestNeighbors::NearestNeighbors()
         : snapshot_params()
         , scaler()
+        , tree()
         , snapshots()
 {}
 
@@ -17,6 +18,7 @@ void NearestNeighbors::updateSnapshots(const MatrixXd &snapshot_parameters, deal
     snapshots.emplace_back(snapshot);
     if(snapshots.size() > 1){
         scaled_snapshot_params = scaler.fit_transform(snapshot_params);
+        tree = KDTree(scaled_snapshot_params);
     }
 }
 
@@ -26,15 +28,7 @@ MatrixXd NearestNeighbors::kPairwiseNearestNeighborsMidpoint(){
 
     for(auto snapshot : scaled_snapshot_params.rowwise()){
 
-        VectorXd distances = (scaled_snapshot_params.rowwise() - snapshot).rowwise().squaredNorm();
-
-        std::vector<int> index(distances.size());
-        std::iota(index.begin(), index.end(), 0);
-
-        std::sort(index.begin(), index.end(),
-                  [&](const int& a, const int& b) {
-                      return distances[a] < distances[b];
-                  });
+        std::vector<int> index = tree.kNearestNeighbors(snapshot, snapshot.cols() + 2);
 
         for (int i = 1 ; i < snapshot.cols() + 2 ; i++) { //Ignore zeroth index as this would be the same point
             midpoints.conservativeResize(midpoints.rows()+1, midpoints.cols());
@@ -47,16 +41,7 @@ MatrixXd NearestNeighbors::kPairwiseNearestNeighborsMidpoint(){
 
 MatrixXd NearestNeighbors::kNearestNeighborsMidpoint(const RowVectorXd& point){
     RowVectorXd scaled_point = scaler.transform(point);
-    VectorXd distances = (scaled_snapshot_params.rowwise() - scaled_point).rowwise().squaredNorm();
-
-    std::vector<int> index(distances.size());
-    std::iota(index.begin(), index.end(), 0);
-
-    std::sort(index.begin(), index.end(),
-              [&](const int& a, const int& b) {
-                  return distances[a] < distances[b];
-              });
-
+    std::vector<int> index = tree.kNearestNeighbors(scaled_point, point.cols() + 2);
 
     MatrixXd midpoints(point.cols()+1, point.cols());
     for (int i = 0 ; i < point.cols()+1 ; i++) {
@@ -68,15 +53,7 @@ MatrixXd NearestNeighbors::kNearestNeighborsMidpoint(const RowVectorXd& point){
 
 dealii::LinearAlgebra::distributed::Vector<double> NearestNeighbors::nearestNeighborMidpointSolution(const RowVectorXd& point){
     RowVectorXd scaled_point = scaler.transform(point);
-    VectorXd distances = (scaled_snapshot_params.rowwise() - scaled_point).rowwise().squaredNorm();
-
-    std::vector<int> index(distances.size());
-    std::iota(index.begin(), index.end(), 0);
-
-    std::sort(index.begin(), index.end(),
-              [&](const int& a, const int& b) {
-                  return distances[a] < distances[b];
-              });
+    std::vector<int> index = tree.kNearestNeighbors(scaled_point, 2);
 
     dealii::LinearAlgebra::distributed::Vector<double> interpolated_solution = snapshots[index[0]];
     interpolated_solution += snapshots[index[1]];
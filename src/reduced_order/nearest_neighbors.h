@@ -4,6 +4,7 @@
 #include <eigen/Eigen/Dense>
 #include <deal.II/lac/la_parallel_vector.h>
 #include "min_max_scaler.h"
+#include "kd_tree.h"
 
 namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
@@ -39,6 +40,9 @@ public:
     /// Scaler
     MinMaxScaler scaler;
 
+    /// Tree of the scaled snapshot parameters
+    KDTree tree;
+
     /// Vector containing all snapshots
     std::vector<dealii::LinearAlgebra::distributed::Vector<double>> snapshots;
 
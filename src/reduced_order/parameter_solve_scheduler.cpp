@@ -0,0 +1,281 @@
+#include "parameter_solve_scheduler.h"
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/cell_id.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+
+namespace {
+
+using CellKey = dealii::CellId::binary_type;
+
+/// Number of unsigned integers of a CellKey
+constexpr unsigned int cell_key_size = std::tuple_size<CellKey>::value;
+static_assert(sizeof(CellKey) == cell_key_size*sizeof(unsigned int), "CellKeys are communicated as arrays of unsigned integers");
+
+/// Gets the CellIds of the locally owned cells and the locally owned rows of their dofs
+template <int dim>
+void get_locally_owned_cells(const dealii::DoFHandler<dim> &dof_handler, std::vector<CellKey> &keys, std::vector<std::vector<unsigned int>> &cell_rows)
+{
+    const dealii::IndexSet &locally_owned_dofs = dof_handler.locally_owned_dofs();
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        keys.push_back(cell->id().template to_binary<dim>());
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        std::vector<unsigned int> rows(dofs_indices.size());
+        for (unsigned int idof = 0; idof < dofs_indices.size(); ++idof) {
+            rows[idof] = locally_owned_dofs.index_within_set(dofs_indices[idof]);
+        }
+        cell_rows.push_back(rows);
+    }
+}
+
+/// Gathers the CellKeys of all the processes, along with the rank of the process of each one
+std::vector<CellKey> all_gather_keys(const std::vector<CellKey> &local_keys, std::vector<int> &ranks, const MPI_Comm mpi_communicator)
+{
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    const int n_local_values = local_keys.size() * cell_key_size;
+    std::vector<int> n_values(n_mpi);
+    MPI_Allgather(&n_local_values, 1, MPI_INT, n_values.data(), 1, MPI_INT, mpi_communicator);
+    std::vector<int> displacements(n_mpi, 0);
+    for (int iproc = 1; iproc < n_mpi; ++iproc) displacements[iproc] = displacements[iproc-1] + n_values[iproc-1];
+
+    std::vector<CellKey> keys((displacements.back() + n_values.back()) / cell_key_size);
+    MPI_Allgatherv(local_keys.data(), n_local_values, MPI_UNSIGNED, keys.data(), n_values.data(), displacements.data(), MPI_UNSIGNED, mpi_communicator);
+
+    ranks.resize(keys.size());
+    for (int iproc = 0; iproc < n_mpi; ++iproc) {
+        const int first_key = displacements[iproc] / cell_key_size;
+        std::fill(ranks.begin() + first_key, ranks.begin() + first_key + n_values[iproc] / cell_key_size, iproc);
+    }
+    return keys;
+}
+
+/// Sorts the locally owned cells by their index, along with the rows of their dofs
+void sort_local_cells(std::vector<unsigned int> &cells, std::vector<std::vector<unsigned int>> &cell_rows)
+{
+    std::vector<unsigned int> order(cells.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const unsigned int a, const unsigned int b) { return cells[a] < cells[b]; });
+    std::vector<unsigned int> sorted_cells(cells.size());
+    std::vector<std::vector<unsigned int>> sorted_cell_rows(cells.size());
+    for (unsigned int i = 0; i < order.size(); ++i) {
+        sorted_cells[i] = cells[order[i]];
+        sorted_cell_rows[i] = std::move(cell_rows[order[i]]);
+    }
+    cells = std::move(sorted_cells);
+    cell_rows = std::move(sorted_cell_rows);
+}
+
+}
+
+template <int dim>
+ParameterSolveScheduler<dim>::ParameterSolveScheduler(const unsigned int n_groups_input, const MPI_Comm mpi_communicator_input)
+        : n_groups(n_groups_input)
+        , mpi_communicator(mpi_communicator_input)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
+        , n_mpi(dealii::Utilities::MPI::n_mpi_processes(mpi_communicator))
+        , group(group_of_rank(mpi_rank))
+        , n_local_rows(0)
+        , n_group_local_rows(0)
+{
+    if (n_groups < 1 || n_groups > static_cast<unsigned int>(n_mpi)) {
+        if (mpi_rank == 0) std::cout << "ERROR: Cannot split " << n_mpi << " processes into " << n_groups << " groups. Aborting..." << std::endl;
+        std::abort();
+    }
+    MPI_Comm_split(mpi_communicator, group, mpi_rank, &group_communicator);
+}
+
+template <int dim>
+ParameterSolveScheduler<dim>::~ParameterSolveScheduler()
+{
+    MPI_Comm_free(&group_communicator);
+}
+
+template <int dim>
+MPI_Comm ParameterSolveScheduler<dim>::get_group_communicator() const
+{
+    return group_communicator;
+}
+
+template <int dim>
+unsigned int ParameterSolveScheduler<dim>::group_of_task(const unsigned int task) const
+{
+    return task % n_groups;
+}
+
+template <int dim>
+bool ParameterSolveScheduler<dim>::is_task_of_this_group(const unsigned int task) const
+{
+    return group_of_task(task) == group;
+}
+
+template <int dim>
+int ParameterSolveScheduler<dim>::group_root(const unsigned int root_group) const
+{
+    int rank = 0;
+    while (group_of_rank(rank) != root_group) ++rank;
+    return rank;
+}
+
+template <int dim>
+unsigned int ParameterSolveScheduler<dim>::group_of_rank(const int rank) const
+{
+    return (rank * n_groups) / n_mpi;
+}
+
+template <int dim>
+void ParameterSolveScheduler<dim>::set_dof_distributions(const dealii::DoFHandler<dim> &dof_handler, const dealii::DoFHandler<dim> &group_dof_handler)
+{
+    std::vector<CellKey> local_keys, group_local_keys;
+    local_cell_rows.clear();
+    group_local_cell_rows.clear();
+    get_locally_owned_cells(dof_handler, local_keys, local_cell_rows);
+    get_locally_owned_cells(group_dof_handler, group_local_keys, group_local_cell_rows);
+    n_local_rows = dof_handler.locally_owned_dofs().n_elements();
+    n_group_local_rows = group_dof_handler.locally_owned_dofs().n_elements();
+
+    std::vector<int> key_ranks, group_key_ranks;
+    const std::vector<CellKey> keys = all_gather_keys(local_keys, key_ranks, mpi_communicator);
+    const std::vector<CellKey> group_keys = all_gather_keys(group_local_keys, group_key_ranks, mpi_communicator);
+
+    // The cells are numbered in the order of their CellIds, which does not depend on the distribution
+    const unsigned int n_cells = keys.size();
+    std::vector<unsigned int> order(n_cells);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const unsigned int a, const unsigned int b) { return keys[a] < keys[b]; });
+    std::vector<CellKey> sorted_keys(n_cells);
+    cell_owners.resize(n_cells);
+    for (unsigned int icell = 0; icell < n_cells; ++icell) {
+        sorted_keys[icell] = keys[order[icell]];
+        cell_owners[icell] = key_ranks[order[icell]];
+    }
+    const auto cell_index = [&](const CellKey &key) {
+        const auto it = std::lower_bound(sorted_keys.begin(), sorted_keys.end(), key);
+        if (it == sorted_keys.end() || *it != key) {
+            if (mpi_rank == 0) std::cout << "ERROR: The grids distributed over the full and the group communicators have different cells. Aborting..." << std::endl;
+            std::abort();
+        }
+        return static_cast<unsigned int>(it - sorted_keys.begin());
+    };
+
+    group_cell_owners.assign(n_groups, std::vector<int>(n_cells, -1));
+    for (unsigned int ikey = 0; ikey < group_keys.size(); ++ikey) {
+        group_cell_owners[group_of_rank(group_key_ranks[ikey])][cell_index(group_keys[ikey])] = group_key_ranks[ikey];
+    }
+    for (const std::vector<int> &owners : group_cell_owners) {
+        if (std::find(owners.begin(), owners.end(), -1) != owners.end()) {
+            if (mpi_rank == 0) std::cout << "ERROR: The grids distributed over the full and the group communicators have different cells. Aborting..." << std::endl;
+            std::abort();
+        }
+    }
+
+    local_cells.resize(local_keys.size());
+    for (unsigned int icell = 0; icell < local_keys.size(); ++icell) local_cells[icell] = cell_index(local_keys[icell]);
+    sort_local_cells(local_cells, local_cell_rows);
+    group_local_cells.resize(group_local_keys.size());
+    for (unsigned int icell = 0; icell < group_local_keys.size(); ++icell) group_local_cells[icell] = cell_index(group_local_keys[icell]);
+    sort_local_cells(group_local_cells, group_local_cell_rows);
+}
+
+template <int dim>
+MatrixXd ParameterSolveScheduler<dim>::group_rows_to_rows(const MatrixXd &group_local_rows, const unsigned int source_group) const
+{
+    int n_columns = group_local_rows.cols();
+    MPI_Allreduce(MPI_IN_PLACE, &n_columns, 1, MPI_INT, MPI_MAX, mpi_communicator);
+
+    std::vector<const std::vector<unsigned int> *> send_cell_rows;
+    std::vector<int> send_ranks;
+    if (group == source_group) {
+        AssertDimension(static_cast<unsigned int>(group_local_rows.rows()), n_group_local_rows);
+        for (unsigned int icell = 0; icell < group_local_cells.size(); ++icell) {
+            send_cell_rows.push_back(&group_local_cell_rows[icell]);
+            send_ranks.push_back(cell_owners[group_local_cells[icell]]);
+        }
+    }
+    std::vector<int> receive_ranks(local_cells.size());
+    for (unsigned int icell = 0; icell < local_cells.size(); ++icell) {
+        receive_ranks[icell] = group_cell_owners[source_group][local_cells[icell]];
+    }
+    return exchange_rows(group_local_rows, send_cell_rows, send_ranks, local_cell_rows, receive_ranks, n_local_rows, n_columns);
+}
+
+template <int dim>
+MatrixXd ParameterSolveScheduler<dim>::rows_to_group_rows(const MatrixXd &local_rows) const
+{
+    AssertDimension(static_cast<unsigned int>(local_rows.rows()), n_local_rows);
+    int n_columns = local_rows.cols();
+    MPI_Allreduce(MPI_IN_PLACE, &n_columns, 1, MPI_INT, MPI_MAX, mpi_communicator);
+
+    // Each cell is sent to its owner in every group
+    std::vector<const std::vector<unsigned int> *> send_cell_rows;
+    std::vector<int> send_ranks;
+    for (unsigned int icell = 0; icell < local_cells.size(); ++icell) {
+        for (unsigned int igroup = 0; igroup < n_groups; ++igroup) {
+            send_cell_rows.push_back(&local_cell_rows[icell]);
+            send_ranks.push_back(group_cell_owners[igroup][local_cells[icell]]);
+        }
+    }
+    std::vector<int> receive_ranks(group_local_cells.size());
+    for (unsigned int icell = 0; icell < group_local_cells.size(); ++icell) {
+        receive_ranks[icell] = cell_owners[group_local_cells[icell]];
+    }
+    return exchange_rows(local_rows, send_cell_rows, send_ranks, group_local_cell_rows, receive_ranks, n_group_local_rows, n_columns);
+}
+
+template <int dim>
+MatrixXd ParameterSolveScheduler<dim>::exchange_rows(
+    const MatrixXd &send_rows,
+    const std::vector<const std::vector<unsigned int> *> &send_cell_rows,
+    const std::vector<int> &send_ranks,
+    const std::vector<std::vector<unsigned int>> &receive_cell_rows,
+    const std::vector<int> &receive_ranks,
+    const unsigned int n_receive_rows,
+    const int n_columns) const
+{
+    std::vector<int> send_counts(n_mpi, 0), receive_counts(n_mpi, 0);
+    for (unsigned int icell = 0; icell < send_ranks.size(); ++icell) send_counts[send_ranks[icell]] += send_cell_rows[icell]->size() * n_columns;
+    for (unsigned int icell = 0; icell < receive_ranks.size(); ++icell) receive_counts[receive_ranks[icell]] += receive_cell_rows[icell].size() * n_columns;
+    std::vector<int> send_displacements(n_mpi, 0), receive_displacements(n_mpi, 0);
+    for (int iproc = 1; iproc < n_mpi; ++iproc) {
+        send_displacements[iproc] = send_displacements[iproc-1] + send_counts[iproc-1];
+        receive_displacements[iproc] = receive_displacements[iproc-1] + receive_counts[iproc-1];
+    }
+
+    // The rows of a cell are contiguous, and the cells of a process are in the order of the lists
+    std::vector<double> send_buffer(send_displacements.back() + send_counts.back());
+    std::vector<int> position = send_displacements;
+    for (unsigned int icell = 0; icell < send_ranks.size(); ++icell) {
+        for (const unsigned int row : *send_cell_rows[icell]) {
+            for (int column = 0; column < n_columns; ++column) send_buffer[position[send_ranks[icell]]++] = send_rows(row, column);
+        }
+    }
+
+    std::vector<double> receive_buffer(receive_displacements.back() + receive_counts.back());
+    MPI_Alltoallv(send_buffer.data(), send_counts.data(), send_displacements.data(), MPI_DOUBLE,
+                  receive_buffer.data(), receive_counts.data(), receive_displacements.data(), MPI_DOUBLE, mpi_communicator);
+
+    MatrixXd rows(n_receive_rows, n_columns);
+    position = receive_displacements;
+    for (unsigned int icell = 0; icell < receive_ranks.size(); ++icell) {
+        for (const unsigned int row : receive_cell_rows[icell]) {
+            for (int column = 0; column < n_columns; ++column) rows(row, column) = receive_buffer[position[receive_ranks[icell]]++];
+        }
+    }
+    return rows;
+}
+
+template class ParameterSolveScheduler <PHILIP_DIM>;
+
+}
+}
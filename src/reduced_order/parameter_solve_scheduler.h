@@ -0,0 +1,128 @@
+#ifndef __PARAMETER_SOLVE_SCHEDULER__
+#define __PARAMETER_SOLVE_SCHEDULER__
+
+#include <mpi.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <vector>
+
+#include <eigen/Eigen/Dense>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+using Eigen::MatrixXd;
+
+/// Splits the processes into groups which solve the flow at different parameters concurrently.
+/** The communicator is split into n_groups group communicators of contiguous ranks, and the solves, numbered as tasks,
+ *  are assigned to the groups in turn. A flow solver distributed over a group communicator numbers its dofs differently
+ *  from one distributed over the full communicator, such that the vectors are transferred between the two cell by cell:
+ *  the active cells are matched by their CellId. The rows transferred are the locally owned dofs in increasing order,
+ *  i.e. the local elements of a distributed vector or the local rows of an OnlinePOD.
+ *
+ *  Both DoFHandlers must be built on the same grid, with the same finite element on each cell, and each dof must
+ *  belong to a single cell, as the dofs of the discontinuous Galerkin solution.
+ *
+ *  The group communicator is freed by the destructor, such that the objects distributed over it must be destroyed first.
+ */
+template <int dim>
+class ParameterSolveScheduler
+{
+public:
+    /// Constructor. Collective over mpi_communicator.
+    ParameterSolveScheduler(const unsigned int n_groups, const MPI_Comm mpi_communicator);
+
+    /// The group communicator is owned by a single scheduler
+    ParameterSolveScheduler(const ParameterSolveScheduler &) = delete;
+
+    /// The group communicator is owned by a single scheduler
+    ParameterSolveScheduler &operator=(const ParameterSolveScheduler &) = delete;
+
+    /// Destructor. Frees the group communicator.
+    ~ParameterSolveScheduler();
+
+    /// Communicator of the group of this process
+    MPI_Comm get_group_communicator() const;
+
+    /// Group solving the task
+    unsigned int group_of_task(const unsigned int task) const;
+
+    /// Whether the task is solved by the group of this process
+    bool is_task_of_this_group(const unsigned int task) const;
+
+    /// Rank, within the full communicator, of the first process of the group
+    int group_root(const unsigned int group) const;
+
+    /// Matches the cells of the distributions over the full communicator and over the groups. Collective over the full communicator.
+    /** group_dof_handler is distributed over the group communicator of this process.
+     */
+    void set_dof_distributions(const dealii::DoFHandler<dim> &dof_handler, const dealii::DoFHandler<dim> &group_dof_handler);
+
+    /// Transfers rows distributed over the group source_group to the full communicator. Collective over the full communicator.
+    /** Returns the locally owned rows of the full distribution. The processes outside of source_group pass an empty matrix.
+     */
+    MatrixXd group_rows_to_rows(const MatrixXd &group_local_rows, const unsigned int source_group) const;
+
+    /// Copies rows distributed over the full communicator to every group. Collective over the full communicator.
+    /** Returns the locally owned rows of the distribution over the group of this process.
+     */
+    MatrixXd rows_to_group_rows(const MatrixXd &local_rows) const;
+
+    /// Number of groups
+    const unsigned int n_groups;
+
+private:
+    /// Group of the process of the given rank within the full communicator
+    unsigned int group_of_rank(const int rank) const;
+
+    /// Sends the rows of each cell to a process and receives the rows of each cell from a process. Collective.
+    /** The cells sent and received between two processes are in the same order on both sides.
+     */
+    MatrixXd exchange_rows(
+        const MatrixXd &send_rows,
+        const std::vector<const std::vector<unsigned int> *> &send_cell_rows,
+        const std::vector<int> &send_ranks,
+        const std::vector<std::vector<unsigned int>> &receive_cell_rows,
+        const std::vector<int> &receive_ranks,
+        const unsigned int n_receive_rows,
+        const int n_columns) const;
+
+    const MPI_Comm mpi_communicator; ///< Full MPI communicator.
+    const int mpi_rank; ///< MPI rank within the full communicator.
+    const int n_mpi; ///< Number of MPI processes of the full communicator.
+
+    /// Group of this process
+    const unsigned int group;
+
+    /// Communicator of the group of this process
+    MPI_Comm group_communicator;
+
+    /// Rank owning each cell in the full distribution, the cells being sorted by CellId
+    std::vector<int> cell_owners;
+
+    /// Rank, within the full communicator, owning each cell in the distribution over each group
+    std::vector<std::vector<int>> group_cell_owners;
+
+    /// Locally owned cells of the full distribution, in increasing order
+    std::vector<unsigned int> local_cells;
+
+    /// Locally owned rows of the dofs of each of the local_cells
+    std::vector<std::vector<unsigned int>> local_cell_rows;
+
+    /// Number of locally owned rows of the full distribution
+    unsigned int n_local_rows;
+
+    /// Locally owned cells of the distribution over the group of this process, in increasing order
+    std::vector<unsigned int> group_local_cells;
+
+    /// Locally owned rows of the dofs of each of the group_local_cells
+    std::vector<std::vector<unsigned int>> group_local_cell_rows;
+
+    /// Number of locally owned rows of the distribution over the group of this process
+    unsigned int n_group_local_rows;
+};
+
+}
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
+#include <eigen/Eigen/Dense>
+
 namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
 
@@ -21,6 +23,9 @@ public:
 
     /// Function to return reference state
     virtual dealii::LinearAlgebra::ReadWriteVector<double> getReferenceState() = 0;
+
+    /// Function to return the locally owned rows of the snapshots the basis is computed from, one column per snapshot
+    virtual Eigen::MatrixXd getSnapshotMatrix() = 0;
 };
 
 }
@@ -8,12 +8,13 @@
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
-#include <eigen/Eigen/SVD>
 #include <filesystem>
 #include <iostream>
+#include <numeric>
 
 #include "dg/dg_base.hpp"
 #include "pod_basis_base.h"
+#include "snapshot_file.h"
 
 namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
@@ -37,62 +38,32 @@ OfflinePOD<dim>::OfflinePOD(std::shared_ptr<DGBase<dim,double>> &dg_input)
 template <int dim>
 bool OfflinePOD<dim>::getPODBasisFromSnapshots() {
     bool file_found = false;
-    MatrixXd snapshotMatrix(0,0);
     std::string path = dg->all_parameters->reduced_order_param.path_to_search; //Search specified directory for files containing "solutions_table"
 
     std::vector<std::filesystem::path> files_in_directory;
     std::copy(std::filesystem::directory_iterator(path), std::filesystem::directory_iterator(), std::back_inserter(files_in_directory));
     std::sort(files_in_directory.begin(), files_in_directory.end()); //Sort files so that the order is the same as for the sensitivity basis
 
+    // Only the locally owned rows of the snapshots are kept
+    const dealii::IndexSet &locally_owned_rows = dg->locally_owned_dofs;
+    snapshot_pod = std::make_unique<DistributedSnapshotPOD>(mpi_communicator);
+
     for (const auto & entry : files_in_directory){
         if(std::string(entry.filename()).std::string::find("solution_snapshot") != std::string::npos){
             pcout << "Processing " << entry << std::endl;
             file_found = true;
-            std::ifstream myfile(entry);
-            if(!myfile)
-            {
-                pcout << "Error opening file." << std::endl;
-                std::abort();
-            }
-            std::string line;
-            int rows = 0;
-            int cols = 0;
-            //First loop set to count rows and columns
-            while(std::getline(myfile, line)){ //for each line
-                std::istringstream stream(line);
-                std::string field;
-                cols = 0;
-                while (getline(stream, field,' ')){ //parse data values on each line
-                    if (field.empty()){ //due to whitespace
-                        continue;
-                    } else {
-                        cols++;
-                    }
-                }
-                rows++;
-            }
 
-            snapshotMatrix.conservativeResize(rows, snapshotMatrix.cols()+cols);
-
-            int row = 0;
-            myfile.clear();
-            myfile.seekg(0); //Bring back to beginning of file
-            //Second loop set to build solutions matrix
-            while(std::getline(myfile, line)){ //for each line
-                std::istringstream stream(line);
-                std::string field;
-                int col = 0;
-                while (getline(stream, field,' ')) { //parse data values on each line
-                    if (field.empty()) {
-                        continue;
-                    } else {
-                        snapshotMatrix(row, snapshotMatrix.cols()-cols+col) = std::stod(field); //This will work for however many solutions in each file
-                        col++;
-                    }
-                }
-                row++;
+            MatrixXd local_file_snapshots;
+            if (is_snapshot_file(entry)) {
+                // Binary snapshot files are mapped into memory, and each process only reads its locally owned rows
+                const SnapshotFileReader snapshot_file(entry);
+                local_file_snapshots = snapshot_file.get_rows(locally_owned_rows);
+            } else {
+                local_file_snapshots = readLocalRowsFromTextFile(entry, locally_owned_rows);
+            }
+            for (int isnapshot = 0; isnapshot < local_file_snapshots.cols(); isnapshot++) {
+                snapshot_pod->add_snapshot(local_file_snapshots.col(isnapshot));
             }
-            myfile.close();
         }
     }
 
@@ -107,45 +78,38 @@ bool OfflinePOD<dim>::getPODBasisFromSnapshots() {
 
     pcout << "Computing POD basis..." << std::endl;
 
-    VectorXd reference_state = snapshotMatrix.rowwise().mean();
+    snapshot_pod->compute_basis(dg->all_parameters->reduced_order_param.pod_truncation_tolerance);
 
-    referenceState.reinit(reference_state.size());
-    for(unsigned int i = 0 ; i < reference_state.size() ; i++){
-        referenceState(i) = reference_state(i);
+    const VectorXd &local_reference_state = snapshot_pod->get_local_mean();
+    referenceState.reinit(locally_owned_rows);
+    for(unsigned int i = 0 ; i < locally_owned_rows.n_elements() ; i++){
+        referenceState(locally_owned_rows.nth_index_in_set(i)) = local_reference_state(i);
     }
 
-    MatrixXd snapshotMatrixCentered = snapshotMatrix.colwise() - reference_state;
-
-    Eigen::BDCSVD<MatrixXd, Eigen::DecompositionOptions::ComputeThinU> svd(snapshotMatrixCentered);
-    MatrixXd pod_basis = svd.matrixU();
-
-    fullBasis.reinit(pod_basis.rows(), pod_basis.cols());
-
-    for (unsigned int m = 0; m < pod_basis.rows(); m++) {
-        for (unsigned int n = 0; n < pod_basis.cols(); n++) {
-            fullBasis.set(m, n, pod_basis(m, n));
-        }
-    }
-
-    std::ofstream out_file("POD_basis.txt");
-    unsigned int precision = 16;
-    fullBasis.print_formatted(out_file, precision);
+    const MatrixXd &local_pod_basis = snapshot_pod->get_local_basis();
+    const int n_modes = local_pod_basis.cols();
+    write_distributed_rows("POD_basis.txt", local_pod_basis, mpi_communicator);
 
     const Epetra_CrsMatrix epetra_system_matrix  = this->dg->system_matrix.trilinos_matrix();
     Epetra_Map system_matrix_map = epetra_system_matrix.RowMap();
-    Epetra_CrsMatrix epetra_basis(Epetra_DataAccess::Copy, system_matrix_map, pod_basis.cols());
+    Epetra_CrsMatrix epetra_basis(Epetra_DataAccess::Copy, system_matrix_map, n_modes);
 
     const int numMyElements = system_matrix_map.NumMyElements(); //Number of elements on the calling processor
 
+    std::vector<int> columns(n_modes);
+    std::iota(columns.begin(), columns.end(), 0);
+    std::vector<double> row_values(n_modes);
     for (int localRow = 0; localRow < numMyElements; ++localRow){
         const int globalRow = system_matrix_map.GID(localRow);
-        for(int n = 0 ; n < pod_basis.cols() ; n++){
-            epetra_basis.InsertGlobalValues(globalRow, 1, &pod_basis(globalRow, n), &n);
+        const unsigned int row = locally_owned_rows.index_within_set(globalRow);
+        for(int n = 0 ; n < n_modes ; n++){
+            row_values[n] = local_pod_basis(row, n);
         }
+        epetra_basis.InsertGlobalValues(globalRow, n_modes, row_values.data(), columns.data());
     }
 
     Epetra_MpiComm epetra_comm(MPI_COMM_WORLD);
-    Epetra_Map domain_map((int)pod_basis.cols(), 0, epetra_comm);
+    Epetra_Map domain_map(n_modes, 0, epetra_comm);
 
     epetra_basis.FillComplete(domain_map, system_matrix_map);
 
@@ -154,6 +118,61 @@ bool OfflinePOD<dim>::getPODBasisFromSnapshots() {
     return file_found;
 }
 
+template <int dim>
+MatrixXd OfflinePOD<dim>::readLocalRowsFromTextFile(const std::filesystem::path &filename, const dealii::IndexSet &locally_owned_rows) {
+    std::ifstream myfile(filename);
+    if(!myfile)
+    {
+        pcout << "Error opening file." << std::endl;
+        std::abort();
+    }
+    std::string line;
+    int rows = 0;
+    int cols = 0;
+    //First loop set to count rows and columns
+    while(std::getline(myfile, line)){ //for each line
+        std::istringstream stream(line);
+        std::string field;
+        cols = 0;
+        while (getline(stream, field,' ')){ //parse data values on each line
+            if (field.empty()){ //due to whitespace
+                continue;
+            } else {
+                cols++;
+            }
+        }
+        rows++;
+    }
+
+    MatrixXd snapshotMatrix(rows, cols);
+
+    int row = 0;
+    myfile.clear();
+    myfile.seekg(0); //Bring back to beginning of file
+    //Second loop set to build solutions matrix
+    while(std::getline(myfile, line)){ //for each line
+        std::istringstream stream(line);
+        std::string field;
+        int col = 0;
+        while (getline(stream, field,' ')) { //parse data values on each line
+            if (field.empty()) {
+                continue;
+            } else {
+                snapshotMatrix(row, col) = std::stod(field); //This will work for however many solutions in each file
+                col++;
+            }
+        }
+        row++;
+    }
+    myfile.close();
+
+    MatrixXd local_snapshots(locally_owned_rows.n_elements(), cols);
+    for(unsigned int i = 0 ; i < locally_owned_rows.n_elements() ; i++){
+        local_snapshots.row(i) = snapshotMatrix.row(locally_owned_rows.nth_index_in_set(i));
+    }
+    return local_snapshots;
+}
+
 template <int dim>
 std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> OfflinePOD<dim>::getPODBasis() {
     return basis;
@@ -164,6 +183,11 @@ dealii::LinearAlgebra::ReadWriteVector<double> OfflinePOD<dim>::getReferenceStat
     return referenceState;
 }
 
+template <int dim>
+MatrixXd OfflinePOD<dim>::getSnapshotMatrix() {
+    return snapshot_pod->get_local_snapshots();
+}
+
 template class OfflinePOD <PHILIP_DIM>;
 
 }
@@ -9,7 +9,10 @@
 
 #include <eigen/Eigen/Dense>
 
+#include <filesystem>
+
 #include "dg/dg_base.hpp"
+#include "distributed_snapshot_pod.h"
 #include "parameters/all_parameters.h"
 #include "pod_basis_base.h"
 
@@ -32,9 +35,18 @@ public:
     ///Function to get POD reference state
     dealii::LinearAlgebra::ReadWriteVector<double> getReferenceState() override;
 
+    ///Function to get the snapshots
+    MatrixXd getSnapshotMatrix() override;
+
     /// Read snapshots to build POD basis
+    /** The files of path_to_search whose name contains "solution_snapshot" are read, either as binary snapshot files
+     *  (see SnapshotFileHeader) or as text files holding one row per degree of freedom and one column per snapshot.
+     */
     bool getPODBasisFromSnapshots();
 
+    /// Read the locally owned rows of the snapshots of a text file
+    MatrixXd readLocalRowsFromTextFile(const std::filesystem::path &filename, const dealii::IndexSet &locally_owned_rows);
+
     /// POD basis
     std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> basis;
 
@@ -44,8 +56,8 @@ public:
     /// dg needed for sparsity pattern of system matrix
     std::shared_ptr<DGBase<dim,double>> dg;
 
-    /// LAPACKFullMatrix for nice printing
-    dealii::LAPACKFullMatrix<double> fullBasis;
+    /// Locally owned rows of the snapshots and their decomposition
+    std::unique_ptr<DistributedSnapshotPOD> snapshot_pod;
 
     const MPI_Comm mpi_communicator; ///< MPI communicator.
     const int mpi_rank; ///< MPI rank.
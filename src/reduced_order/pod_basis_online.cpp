@@ -1,4 +1,5 @@
 #include "pod_basis_online.h"
+#include "snapshot_file.h"
 #include <iostream>
 #include <filesystem>
 #include <deal.II/numerics/vector_tools.h>
@@ -9,17 +10,20 @@
 #include <Teuchos_DefaultMpiComm.hpp>
 #include <Epetra_CrsMatrix.h>
 #include <Epetra_Map.h>
-#include <eigen/Eigen/SVD>
+#include <numeric>
 
 namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
 
 template<int dim>
-OnlinePOD<dim>::OnlinePOD(std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> _system_matrix)
+OnlinePOD<dim>::OnlinePOD(std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> _system_matrix, const double truncation_tolerance_input)
         : basis(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
         , system_matrix(_system_matrix)
-        , mpi_communicator(MPI_COMM_WORLD)
-        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+        , locally_owned_rows(_system_matrix->locally_owned_range_indices())
+        , truncation_tolerance(truncation_tolerance_input)
+        , snapshot_pod(_system_matrix->get_mpi_communicator())
+        , mpi_communicator(_system_matrix->get_mpi_communicator())
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
         , pcout(std::cout, mpi_rank==0)
 {
 }
@@ -27,61 +31,60 @@ OnlinePOD<dim>::OnlinePOD(std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix
 template <int dim>
 void OnlinePOD<dim>::addSnapshot(dealii::LinearAlgebra::distributed::Vector<double> snapshot) {
     pcout << "Adding new snapshot to snapshot matrix..." << std::endl;
-    dealii::LinearAlgebra::ReadWriteVector<double> read_snapshot(snapshot.size());
-    read_snapshot.import(snapshot, dealii::VectorOperation::values::insert);
-    VectorXd eigen_snapshot(snapshot.size());
-    for(unsigned int i = 0 ; i < snapshot.size() ; i++){
-        eigen_snapshot(i) = read_snapshot(i);
-    }
-    snapshotMatrix.conservativeResize(snapshot.size(), snapshotMatrix.cols()+1);
-    snapshotMatrix.col(snapshotMatrix.cols()-1) = eigen_snapshot;
-
-    //Copy snapshot matrix to dealii Lapack matrix for easy printing to file
-    dealiiSnapshotMatrix.reinit(snapshotMatrix.rows(), snapshotMatrix.cols());
-    for (unsigned int m = 0; m < snapshotMatrix.rows(); m++) {
-        for (unsigned int n = 0; n < snapshotMatrix.cols(); n++) {
-            dealiiSnapshotMatrix.set(m, n, snapshotMatrix(m, n));
-        }
+    VectorXd local_snapshot(locally_owned_rows.n_elements());
+    for(unsigned int i = 0 ; i < locally_owned_rows.n_elements() ; i++){
+        local_snapshot(i) = snapshot(locally_owned_rows.nth_index_in_set(i));
     }
+    snapshot_pod.add_snapshot(local_snapshot);
 }
 
 template <int dim>
 void OnlinePOD<dim>::computeBasis() {
     pcout << "Computing POD basis..." << std::endl;
 
-    VectorXd reference_state = snapshotMatrix.rowwise().mean();
+    snapshot_pod.compute_basis(truncation_tolerance);
+    setBasis(snapshot_pod.get_local_mean(), snapshot_pod.get_local_basis());
 
-    referenceState.reinit(reference_state.size());
-    for(unsigned int i = 0 ; i < reference_state.size() ; i++){
-        referenceState(i) = reference_state(i);
-    }
+    pcout << "Done computing POD basis. Basis now has " << basis->n() << " columns." << std::endl;
+}
 
-    MatrixXd snapshotMatrixCentered = snapshotMatrix.colwise() - reference_state;
+template <int dim>
+void OnlinePOD<dim>::setBasis(const VectorXd &local_reference_state, const MatrixXd &local_pod_basis) {
+    referenceState.reinit(locally_owned_rows);
+    for(unsigned int i = 0 ; i < locally_owned_rows.n_elements() ; i++){
+        referenceState(locally_owned_rows.nth_index_in_set(i)) = local_reference_state(i);
+    }
 
-    Eigen::BDCSVD<MatrixXd, Eigen::DecompositionOptions::ComputeThinU> svd(snapshotMatrixCentered);
-    MatrixXd pod_basis = svd.matrixU();
+    const int n_modes = local_pod_basis.cols();
 
     const Epetra_CrsMatrix epetra_system_matrix = system_matrix->trilinos_matrix();
     Epetra_Map system_matrix_map = epetra_system_matrix.RowMap();
-    Epetra_CrsMatrix epetra_basis(Epetra_DataAccess::Copy, system_matrix_map, pod_basis.cols());
+    Epetra_CrsMatrix epetra_basis(Epetra_DataAccess::Copy, system_matrix_map, n_modes);
 
     const int numMyElements = system_matrix_map.NumMyElements(); //Number of elements on the calling processor
 
+    std::vector<int> columns(n_modes);
+    std::iota(columns.begin(), columns.end(), 0);
+    std::vector<double> row_values(n_modes);
     for (int localRow = 0; localRow < numMyElements; ++localRow){
         const int globalRow = system_matrix_map.GID(localRow);
-        for(int n = 0 ; n < pod_basis.cols() ; n++){
-            epetra_basis.InsertGlobalValues(globalRow, 1, &pod_basis(globalRow, n), &n);
+        const unsigned int row = locally_owned_rows.index_within_set(globalRow);
+        for(int n = 0 ; n < n_modes ; n++){
+            row_values[n] = local_pod_basis(row, n);
         }
+        epetra_basis.InsertGlobalValues(globalRow, n_modes, row_values.data(), columns.data());
     }
 
-    Epetra_MpiComm epetra_comm(MPI_COMM_WORLD);
-    Epetra_Map domain_map((int)pod_basis.cols(), 0, epetra_comm);
+    Epetra_Map domain_map(n_modes, 0, system_matrix_map.Comm());
 
     epetra_basis.FillComplete(domain_map, system_matrix_map);
 
     basis->reinit(epetra_basis);
+}
 
-    pcout << "Done computing POD basis. Basis now has " << basis->n() << " columns." << std::endl;
+template <int dim>
+void OnlinePOD<dim>::writeSnapshots(const std::string &filename, const MatrixXd &snapshot_parameters) const {
+    write_snapshot_file(filename, snapshot_pod.get_local_snapshots(), locally_owned_rows, snapshot_parameters, mpi_communicator);
 }
 
 template <int dim>
@@ -94,6 +97,11 @@ dealii::LinearAlgebra::ReadWriteVector<double> OnlinePOD<dim>::getReferenceState
     return referenceState;
 }
 
+template <int dim>
+MatrixXd OnlinePOD<dim>::getSnapshotMatrix() {
+    return snapshot_pod.get_local_snapshots();
+}
+
 template class OnlinePOD <PHILIP_DIM>;
 
 }
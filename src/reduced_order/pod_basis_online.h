@@ -11,6 +11,7 @@
 #include <eigen/Eigen/Dense>
 
 #include "dg/dg_base.hpp"
+#include "distributed_snapshot_pod.h"
 #include "parameters/all_parameters.h"
 #include "pod_basis_base.h"
 
@@ -20,12 +21,17 @@ using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 /// Class for Online Proper Orthogonal Decomposition basis. This class takes snapshots on the fly and computes a POD basis for use in adaptive sampling.
+/** The snapshots are stored distributed like the rows of the system matrix, and adding a snapshot only updates
+ *  the Gram matrix of the DistributedSnapshotPOD instead of recomputing the decomposition of all the snapshots.
+ */
 template <int dim>
 class OnlinePOD: public PODBase<dim>
 {
 public:
     /// Constructor
-    explicit OnlinePOD(std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> _system_matrix);
+    /** The trailing modes holding at most the fraction truncation_tolerance of the snapshot energy are discarded.
+     */
+    explicit OnlinePOD(std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> _system_matrix, const double truncation_tolerance = 0.0);
 
     ///Function to get POD basis for all derived classes
     std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> getPODBasis() override;
@@ -33,12 +39,24 @@ public:
     ///Function to get POD reference state
     dealii::LinearAlgebra::ReadWriteVector<double> getReferenceState() override;
 
+    ///Function to get the snapshots
+    MatrixXd getSnapshotMatrix() override;
+
     /// Add snapshot
     void addSnapshot(dealii::LinearAlgebra::distributed::Vector<double> snapshot);
 
     /// Compute new POD basis from snapshots
     void computeBasis();
 
+    /// Set the POD basis and reference state from their locally owned rows, ordered like locally_owned_rows.
+    /** Used by computeBasis(), and to hold a copy of a basis computed by another OnlinePOD whose system matrix
+     *  is distributed differently, in which case the snapshots of this OnlinePOD are left untouched.
+     */
+    void setBasis(const VectorXd &local_reference_state, const MatrixXd &local_pod_basis);
+
+    /// Write the snapshots and their parameters, one row per snapshot, into a binary snapshot file. Collective.
+    void writeSnapshots(const std::string &filename, const MatrixXd &snapshot_parameters) const;
+
     /// POD basis
     std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> basis;
 
@@ -48,11 +66,14 @@ public:
     /// For sparsity pattern of system matrix
     std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> system_matrix;
 
-    /// LAPACK matrix of snapshots for nice printing
-    dealii::LAPACKFullMatrix<double> dealiiSnapshotMatrix;
+    /// Rows of the system matrix owned by this process
+    const dealii::IndexSet locally_owned_rows;
+
+    /// Fraction of the snapshot energy that may be discarded by truncating the basis
+    const double truncation_tolerance;
 
-    /// Matrix containing snapshots
-    MatrixXd snapshotMatrix;
+    /// Locally owned rows of the snapshots and their decomposition
+    DistributedSnapshotPOD snapshot_pod;
 
     const MPI_Comm mpi_communicator; ///< MPI communicator.
     const int mpi_rank; ///< MPI rank.
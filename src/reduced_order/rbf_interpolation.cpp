@@ -2,11 +2,21 @@
 #include <eigen/Eigen/Dense>
 #include <eigen/Eigen/LU>
 #include <iostream>
+#include <map>
+#include <numeric>
 #include "ROL_StdVector.hpp"
 
 namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
 
+namespace {
+/// Largest growth of the entries of the inverse kernel matrix accepted in an update before refactorizing the points
+const double max_update_growth = 1e8;
+
+/// Largest relative residual of the updated weights accepted before refactorizing the points
+const double max_relative_residual = 1e-8;
+}
+
 RBFInterpolation::RBFInterpolation(const MatrixXd& data_coordinates, const VectorXd& data_values, std::string kernel)
         : data_coordinates(data_coordinates)
         , data_values(data_values)
@@ -30,7 +40,143 @@ void RBFInterpolation::computeWeights() {
         }
     }
 
-    weights = A.lu().solve(data_values);
+    const Eigen::PartialPivLU<MatrixXd> lu(A);
+    weights = lu.solve(data_values);
+
+    //Keep the factorization for updateData()
+    inverse_kernel_matrix = lu.inverse();
+    kernel_matrix = A;
+    factorized_coordinates = data_coordinates;
+    factorized_to_data.resize(N);
+    std::iota(factorized_to_data.begin(), factorized_to_data.end(), 0);
+}
+
+void RBFInterpolation::updateData(const MatrixXd& new_data_coordinates, const VectorXd& new_data_values) {
+    data_coordinates = new_data_coordinates;
+    data_values = new_data_values;
+
+    //Match the data points to the factorized points of equal coordinates, each factorized point at most once
+    std::map<std::vector<double>, int> factorized_index;
+    for(int i = 0 ; i < factorized_coordinates.rows() ; i++){
+        const RowVectorXd coordinate = factorized_coordinates.row(i);
+        factorized_index.emplace(std::vector<double>(coordinate.data(), coordinate.data() + coordinate.size()), i);
+    }
+    std::vector<int> data_index(factorized_coordinates.rows(), -1);
+    std::vector<int> added_points;
+    for(int i = 0 ; i < data_coordinates.rows() ; i++){
+        const RowVectorXd coordinate = data_coordinates.row(i);
+        auto match = factorized_index.find(std::vector<double>(coordinate.data(), coordinate.data() + coordinate.size()));
+        if(match != factorized_index.end()){
+            data_index[match->second] = i;
+            factorized_index.erase(match);
+        }
+        else{
+            added_points.push_back(i);
+        }
+    }
+    const int n_removed = factorized_index.size();
+    const int n_added = added_points.size();
+    const int n_kept = factorized_coordinates.rows() - n_removed;
+    factorized_to_data = data_index;
+
+    //Each update costs O(N^2), such that refactorizing is cheaper once the changes are a fraction of the points
+    bool is_updated = 3*(n_removed + n_added) < n_kept;
+    for(int i = factorized_to_data.size() - 1 ; is_updated && i >= 0 ; i--){
+        if(factorized_to_data[i] < 0){
+            is_updated = removeFactorizedPoint(i);
+        }
+    }
+    for(int i = 0 ; is_updated && i < n_added ; i++){
+        is_updated = appendFactorizedPoint(added_points[i]);
+    }
+    if(is_updated){
+        is_updated = solveFactorizedWeights();
+    }
+    if(!is_updated){
+        computeWeights();
+    }
+}
+
+bool RBFInterpolation::removeFactorizedPoint(const int index) {
+    //Move the point last, such that the matrices only lose their last row and column
+    const int last = factorized_to_data.size() - 1;
+    if(index != last){
+        inverse_kernel_matrix.row(index).swap(inverse_kernel_matrix.row(last));
+        inverse_kernel_matrix.col(index).swap(inverse_kernel_matrix.col(last));
+        kernel_matrix.row(index).swap(kernel_matrix.row(last));
+        kernel_matrix.col(index).swap(kernel_matrix.col(last));
+        factorized_coordinates.row(index).swap(factorized_coordinates.row(last));
+        std::swap(factorized_to_data[index], factorized_to_data[last]);
+    }
+
+    //The inverse of the remaining points is E - f f^T / g, given the inverse [E f; f^T g]
+    const double g = inverse_kernel_matrix(last, last);
+    const VectorXd f = inverse_kernel_matrix.col(last).head(last);
+    if(!(std::abs(g) * max_update_growth * inverse_kernel_matrix.cwiseAbs().maxCoeff() > f.squaredNorm())){
+        return false;
+    }
+    inverse_kernel_matrix.topLeftCorner(last, last) -= f * f.transpose() / g;
+
+    inverse_kernel_matrix.conservativeResize(last, last);
+    kernel_matrix.conservativeResize(last, last);
+    factorized_coordinates.conservativeResize(last, Eigen::NoChange);
+    factorized_to_data.pop_back();
+    return true;
+}
+
+bool RBFInterpolation::appendFactorizedPoint(const int data_index) {
+    const int n = factorized_to_data.size();
+    const RowVectorXd coordinate = data_coordinates.row(data_index);
+    VectorXd b(n);
+    for(int i = 0 ; i < n ; i++){
+        b(i) = radialBasisFunction((factorized_coordinates.row(i) - coordinate).norm());
+    }
+    const double c = radialBasisFunction(0.0);
+
+    //Bordering the kernel matrix A with [b; c] borders its inverse with the Schur complement s = c - b^T A^-1 b
+    const VectorXd u = inverse_kernel_matrix * b;
+    const double s = c - b.dot(u);
+    if(!(std::abs(s) * max_update_growth * inverse_kernel_matrix.cwiseAbs().maxCoeff() > u.squaredNorm())){
+        return false;
+    }
+    inverse_kernel_matrix.conservativeResize(n+1, n+1);
+    inverse_kernel_matrix.topLeftCorner(n, n) += u * u.transpose() / s;
+    inverse_kernel_matrix.col(n).head(n) = -u / s;
+    inverse_kernel_matrix.row(n).head(n) = -u.transpose() / s;
+    inverse_kernel_matrix(n, n) = 1.0 / s;
+
+    kernel_matrix.conservativeResize(n+1, n+1);
+    kernel_matrix.col(n).head(n) = b;
+    kernel_matrix.row(n).head(n) = b.transpose();
+    kernel_matrix(n, n) = c;
+
+    factorized_coordinates.conservativeResize(n+1, Eigen::NoChange);
+    factorized_coordinates.row(n) = coordinate;
+    factorized_to_data.push_back(data_index);
+    return true;
+}
+
+bool RBFInterpolation::solveFactorizedWeights() {
+    const int n = factorized_to_data.size();
+    VectorXd values(n);
+    for(int i = 0 ; i < n ; i++){
+        values(i) = data_values(factorized_to_data[i]);
+    }
+
+    //One step of iterative refinement recovers the accuracy lost in the updates of the inverse
+    VectorXd factorized_weights = inverse_kernel_matrix * values;
+    VectorXd residual = values - kernel_matrix * factorized_weights;
+    factorized_weights += inverse_kernel_matrix * residual;
+    residual = values - kernel_matrix * factorized_weights;
+    if(!(residual.norm() <= max_relative_residual * values.norm())){
+        return false;
+    }
+
+    weights.resize(n);
+    for(int i = 0 ; i < n ; i++){
+        weights(factorized_to_data[i]) = factorized_weights(i);
+    }
+    return true;
 }
 
 double RBFInterpolation::radialBasisFunction(double r) const{
@@ -68,11 +214,24 @@ double RBFInterpolation::evaluate(const RowVectorXd& evaluate_coordinate) const
     return s*weights;
 }
 
+VectorXd RBFInterpolation::evaluatePoints(const MatrixXd& evaluate_coordinates) const {
+    MatrixXd s(evaluate_coordinates.rows(), data_coordinates.rows());
+
+    for(int j = 0 ; j < data_coordinates.rows() ; j++){
+        for(int i = 0 ; i < evaluate_coordinates.rows() ; i++){
+            s(i,j) = radialBasisFunction((evaluate_coordinates.row(i) - data_coordinates.row(j)).norm());
+        }
+    }
+
+    return s*weights;
+}
+
 double RBFInterpolation::value(const ROL::Vector<double> &x, double &/*tol*/ ) {
     ROL::Ptr<const vector> xp = getVector<ROL::StdVector<double>>(x);
-    RowVectorXd evaluate_coordinate(2);
-    evaluate_coordinate(0) = (*xp)[0];
-    evaluate_coordinate(1) = (*xp)[1];
+    RowVectorXd evaluate_coordinate(xp->size());
+    for(unsigned int i = 0 ; i < xp->size() ; i++){
+        evaluate_coordinate(i) = (*xp)[i];
+    }
     double val = evaluate(evaluate_coordinate);
 
     //For optimization, return -abs(val) to consider only magnitude of error, not sign
@@ -80,4 +239,4 @@ double RBFInterpolation::value(const ROL::Vector<double> &x, double &/*tol*/ ) {
 }
 
 }
-}
\ No newline at end of file
+}
@@ -2,6 +2,8 @@
 #define __RBF_INTERPOLATION__
 
 #include <eigen/Eigen/Dense>
+#include <string>
+#include <vector>
 #include "ROL_OptimizationProblem.hpp"
 #include "ROL_StdVector.hpp"
 
@@ -12,6 +14,9 @@ using Eigen::VectorXd;
 using Eigen::RowVectorXd;
 
 /// Radial basis function interpolation
+/** The inverse of the kernel matrix is kept, such that updateData() only downdates the inverse for the removed points
+ *  and borders it for the added points, at a cost of O(N^2) per point instead of the O(N^3) refactorization.
+ */
 class RBFInterpolation: public ROL::Objective<double>
 {
 public:
@@ -21,20 +26,26 @@ public:
     /// Compute RBF interpolation weights
     void computeWeights();
 
+    /// Update the data points and values, reusing the factorization of the points whose coordinates are unchanged
+    void updateData(const MatrixXd& new_data_coordinates, const VectorXd& new_data_values);
+
     /// Choose radial basis function
     double radialBasisFunction(double r) const;
 
     /// Evaluate RBF
     double evaluate(const RowVectorXd& evaluate_coordinate) const;
 
+    /// Evaluate RBF at several points, one per row
+    VectorXd evaluatePoints(const MatrixXd& evaluate_coordinates) const;
+
     /// RBF weights
     VectorXd weights;
 
     /// Data coordinates
-    const MatrixXd data_coordinates;
+    MatrixXd data_coordinates;
 
     /// Data values
-    const VectorXd data_values;
+    VectorXd data_values;
 
     /// RBF kernel
     const std::string kernel;
@@ -53,10 +64,31 @@ public:
     /// ROL evaluate value
     double value(const ROL::Vector<double> &x, double &/*tol*/ );
 
+private:
+    /// Kernel matrix of the factorized points
+    MatrixXd kernel_matrix;
+
+    /// Inverse of the kernel matrix
+    MatrixXd inverse_kernel_matrix;
+
+    /// Coordinates of the factorized points, in the order of the kernel matrix
+    MatrixXd factorized_coordinates;
+
+    /// Row of data_coordinates of each factorized point
+    std::vector<int> factorized_to_data;
+
+    /// Remove a point from the inverse kernel matrix. Returns false if the downdate is ill-conditioned.
+    bool removeFactorizedPoint(const int index);
+
+    /// Border the inverse kernel matrix with a point. Returns false if the update is ill-conditioned.
+    bool appendFactorizedPoint(const int data_index);
+
+    /// Compute the weights from the inverse kernel matrix, with one step of iterative refinement. Returns false if the residual is too large.
+    bool solveFactorizedWeights();
 };
 
 }
 }
 
 
-#endif
\ No newline at end of file
+#endif
@@ -20,11 +20,11 @@ namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
 
 template <int dim, int nstate>
-ROMTestLocation<dim, nstate>::ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution<dim, nstate>> rom_solution)
+ROMTestLocation<dim, nstate>::ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution<dim, nstate>> rom_solution, const MPI_Comm mpi_communicator_input)
         : parameter(parameter)
         , rom_solution(std::move(rom_solution))
-        , mpi_communicator(MPI_COMM_WORLD)
-        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+        , mpi_communicator(mpi_communicator_input)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
         , pcout(std::cout, mpi_rank==0)
 {
     pcout << "Creating ROM test location..." << std::endl;
@@ -35,15 +35,30 @@ ROMTestLocation<dim, nstate>::ROMTestLocation(const RowVectorXd& parameter, std:
     pcout << "ROM test location created. Error estimate updated." << std::endl;
 }
 
+template <int dim, int nstate>
+ROMTestLocation<dim, nstate>::ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution<dim, nstate>> rom_solution, const double fom_to_initial_rom_error)
+        : parameter(parameter)
+        , rom_solution(std::move(rom_solution))
+        , fom_to_initial_rom_error(fom_to_initial_rom_error)
+        , initial_rom_to_final_rom_error(0)
+        , total_error(fom_to_initial_rom_error)
+        , mpi_communicator(MPI_COMM_WORLD)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
+        , pcout(std::cout, mpi_rank==0)
+{
+    pcout << "ROM test location created at " << parameter << " with the error estimate between ROM and FOM " << fom_to_initial_rom_error << std::endl;
+}
+
 template <int dim, int nstate>
 void ROMTestLocation<dim, nstate>::compute_FOM_to_initial_ROM_error(){
     pcout << "Computing adjoint-based error estimate between ROM and FOM..." << std::endl;
 
     dealii::ParameterHandler dummy_handler;
-    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&rom_solution->params, dummy_handler);
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&rom_solution->params, dummy_handler, mpi_communicator);
     flow_solver->dg->solution = rom_solution->solution;
     const bool compute_dRdW = true;
     flow_solver->dg->assemble_residual(compute_dRdW);
+    flow_solver->dg->update_system_matrix_transpose();
     dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose = dealii::TrilinosWrappers::SparseMatrix();
     system_matrix_transpose.copy_from(flow_solver->dg->system_matrix_transpose);
 
@@ -80,10 +95,11 @@ void ROMTestLocation<dim, nstate>::compute_initial_rom_to_final_rom_error(std::s
     pcout << "Computing adjoint-based error estimate between initial ROM and updated ROM..." << std::endl;
 
     dealii::ParameterHandler dummy_handler;
-    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&rom_solution->params, dummy_handler);
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&rom_solution->params, dummy_handler, mpi_communicator);
     flow_solver->dg->solution = rom_solution->solution;
     const bool compute_dRdW = true;
     flow_solver->dg->assemble_residual(compute_dRdW);
+    flow_solver->dg->update_system_matrix_transpose();
 
     const Epetra_CrsMatrix epetra_pod_basis = pod_updated->getPODBasis()->trilinos_matrix();
     const Epetra_CrsMatrix epetra_system_matrix_transpose = flow_solver->dg->system_matrix_transpose.trilinos_matrix();
@@ -16,7 +16,13 @@ class ROMTestLocation
 {
 public:
     /// Constructor
-    ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nstate>> rom_solution);
+    /** The error between the FOM and the ROM is computed on a flow solver distributed over mpi_communicator_input,
+     *  which must be the communicator of the ROM solution.
+     */
+    ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nstate>> rom_solution, const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
+
+    /// Constructor from an error between the FOM and the ROM already computed, e.g. on another communicator
+    ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nstate>> rom_solution, const double fom_to_initial_rom_error);
 
     /// Compute adjoint error estimate between FOM and initial ROM
     void compute_FOM_to_initial_ROM_error();
@@ -0,0 +1,194 @@
+#include "snapshot_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+
+namespace {
+/// Appends the bytes of value to the buffer
+template <typename T>
+void append_bytes(std::vector<char> &buffer, const T value)
+{
+    const std::size_t position = buffer.size();
+    buffer.resize(position + sizeof(T));
+    std::memcpy(buffer.data() + position, &value, sizeof(T));
+}
+
+/// Extracts a value from the buffer at the given position
+template <typename T>
+T extract_bytes(const char *buffer, const std::size_t position)
+{
+    T value;
+    std::memcpy(&value, buffer + position, sizeof(T));
+    return value;
+}
+
+/// Size of the header entries preceding the parameters
+constexpr std::size_t fixed_header_size_in_bytes = 8 + 2*sizeof(uint32_t) + 2*sizeof(uint64_t);
+} // anonymous namespace
+
+uint64_t SnapshotFileHeader::snapshots_offset() const
+{
+    return fixed_header_size_in_bytes + n_snapshots * n_parameters * sizeof(double);
+}
+
+void write_snapshot_file(
+    const std::string &filename,
+    const MatrixXd &local_snapshots,
+    const dealii::IndexSet &locally_owned_rows,
+    const MatrixXd &parameters,
+    const MPI_Comm mpi_communicator)
+{
+    int mpi_rank;
+    MPI_Comm_rank(mpi_communicator, &mpi_rank);
+    if (local_snapshots.rows() != static_cast<long int>(locally_owned_rows.n_elements())) {
+        std::cout << "ERROR: The " << local_snapshots.rows() << " local rows of the snapshots do not match the "
+                  << locally_owned_rows.n_elements() << " locally owned rows. Aborting..." << std::endl;
+        std::abort();
+    }
+    if (parameters.rows() != local_snapshots.cols()) {
+        std::cout << "ERROR: The " << parameters.rows() << " rows of parameters do not match the "
+                  << local_snapshots.cols() << " snapshots. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    SnapshotFileHeader header;
+    header.n_parameters = parameters.cols();
+    header.n_dofs = locally_owned_rows.size();
+    header.n_snapshots = local_snapshots.cols();
+
+    // Remove any previous file, since MPI_MODE_CREATE does not truncate it
+    if (mpi_rank == 0) MPI_File_delete(filename.c_str(), MPI_INFO_NULL);
+    MPI_Barrier(mpi_communicator);
+    MPI_File file;
+    const int ierr = MPI_File_open(mpi_communicator, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+    if (ierr != MPI_SUCCESS) {
+        if (mpi_rank == 0) std::cout << "ERROR: Cannot open file " << filename << std::endl;
+        std::abort();
+    }
+
+    if (mpi_rank == 0) {
+        std::vector<char> packed_header(SnapshotFileHeader::magic_string, SnapshotFileHeader::magic_string+8);
+        append_bytes(packed_header, SnapshotFileHeader::format_version);
+        append_bytes(packed_header, header.n_parameters);
+        append_bytes(packed_header, header.n_dofs);
+        append_bytes(packed_header, header.n_snapshots);
+        for (uint64_t isnapshot = 0; isnapshot < header.n_snapshots; ++isnapshot) {
+            for (uint32_t iparameter = 0; iparameter < header.n_parameters; ++iparameter) {
+                append_bytes(packed_header, parameters(isnapshot, iparameter));
+            }
+        }
+        MPI_File_write_at(file, 0, packed_header.data(), packed_header.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+
+    // Each contiguous range of locally owned rows is a contiguous block of each snapshot
+    for (uint64_t isnapshot = 0; isnapshot < header.n_snapshots; ++isnapshot) {
+        const double *local_snapshot = local_snapshots.data() + isnapshot * local_snapshots.rows();
+        for (auto interval = locally_owned_rows.begin_intervals(); interval != locally_owned_rows.end_intervals(); ++interval) {
+            const MPI_Offset offset = header.snapshots_offset() + (isnapshot * header.n_dofs + interval->first()) * sizeof(double);
+            const unsigned int first_local_row = locally_owned_rows.index_within_set(interval->first());
+            MPI_File_write_at(file, offset, local_snapshot + first_local_row, interval->n_elements(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+        }
+    }
+    MPI_File_close(&file);
+}
+
+bool is_snapshot_file(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    char magic_string[8];
+    if (!file.read(magic_string, 8)) return false;
+    return std::memcmp(magic_string, SnapshotFileHeader::magic_string, 8) == 0;
+}
+
+SnapshotFileReader::SnapshotFileReader(const std::string &filename_input)
+    : filename(filename_input)
+    , mapped_file(nullptr)
+    , mapped_size(0)
+{
+    const int file_descriptor = open(filename.c_str(), O_RDONLY);
+    struct stat file_status;
+    if (file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0) {
+        std::cout << "ERROR: Cannot open file " << filename << std::endl;
+        std::abort();
+    }
+    mapped_size = file_status.st_size;
+    if (mapped_size < fixed_header_size_in_bytes) {
+        std::cout << "ERROR: " << filename << " is too small to be a snapshot file. Aborting..." << std::endl;
+        std::abort();
+    }
+    // The mapping remains valid once the file is closed
+    void *mapping = mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    close(file_descriptor);
+    if (mapping == MAP_FAILED) {
+        std::cout << "ERROR: Cannot map file " << filename << " into memory. Aborting..." << std::endl;
+        std::abort();
+    }
+    mapped_file = static_cast<const char *>(mapping);
+
+    if (std::memcmp(mapped_file, SnapshotFileHeader::magic_string, 8) != 0) {
+        std::cout << "ERROR: " << filename << " is not a snapshot file. Aborting..." << std::endl;
+        std::abort();
+    }
+    std::size_t position = 8;
+    const uint32_t format_version = extract_bytes<uint32_t>(mapped_file, position);
+    position += sizeof(uint32_t);
+    if (format_version != SnapshotFileHeader::format_version) {
+        std::cout << "ERROR: Unsupported version " << format_version << " of snapshot file " << filename << ". Aborting..." << std::endl;
+        std::abort();
+    }
+    header.n_parameters = extract_bytes<uint32_t>(mapped_file, position);
+    position += sizeof(uint32_t);
+    header.n_dofs = extract_bytes<uint64_t>(mapped_file, position);
+    position += sizeof(uint64_t);
+    header.n_snapshots = extract_bytes<uint64_t>(mapped_file, position);
+
+    if (mapped_size != header.snapshots_offset() + header.n_dofs * header.n_snapshots * sizeof(double)) {
+        std::cout << "ERROR: The size of " << filename << " does not match its header. Aborting..." << std::endl;
+        std::abort();
+    }
+}
+
+SnapshotFileReader::~SnapshotFileReader()
+{
+    munmap(const_cast<char *>(mapped_file), mapped_size);
+}
+
+RowVectorXd SnapshotFileReader::get_parameters(const unsigned int isnapshot) const
+{
+    RowVectorXd parameters(header.n_parameters);
+    std::memcpy(parameters.data(), mapped_file + fixed_header_size_in_bytes + isnapshot * header.n_parameters * sizeof(double),
+                header.n_parameters * sizeof(double));
+    return parameters;
+}
+
+MatrixXd SnapshotFileReader::get_rows(const dealii::IndexSet &rows) const
+{
+    if (rows.size() != header.n_dofs) {
+        std::cout << "ERROR: Requesting rows out of " << rows.size() << " from " << filename << ", which has "
+                  << header.n_dofs << " rows. Aborting..." << std::endl;
+        std::abort();
+    }
+    MatrixXd snapshot_rows(rows.n_elements(), header.n_snapshots);
+    for (uint64_t isnapshot = 0; isnapshot < header.n_snapshots; ++isnapshot) {
+        double *snapshot = snapshot_rows.data() + isnapshot * snapshot_rows.rows();
+        for (auto interval = rows.begin_intervals(); interval != rows.end_intervals(); ++interval) {
+            const std::size_t offset = header.snapshots_offset() + (isnapshot * header.n_dofs + interval->first()) * sizeof(double);
+            std::memcpy(snapshot + rows.index_within_set(interval->first()), mapped_file + offset, interval->n_elements() * sizeof(double));
+        }
+    }
+    return snapshot_rows;
+}
+
+}
+}
@@ -0,0 +1,89 @@
+#ifndef __SNAPSHOT_FILE__
+#define __SNAPSHOT_FILE__
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <string>
+
+#include <deal.II/base/index_set.h>
+
+#include <eigen/Eigen/Dense>
+
+namespace PHiLiP {
+namespace ProperOrthogonalDecomposition {
+using Eigen::MatrixXd;
+using Eigen::RowVectorXd;
+
+/// Layout of the binary snapshot files, shared by write_snapshot_file() and SnapshotFileReader.
+/** In the native byte order, a file holds
+ *  - char[8]  the magic string "PHLPSNAP",
+ *  - uint32   the format version,
+ *  - uint32   the number of parameters per snapshot,
+ *  - uint64   the number of degrees of freedom, i.e. of rows, of each snapshot,
+ *  - uint64   the number of snapshots,
+ *  - float64  the parameters of each snapshot, snapshot after snapshot,
+ *  - float64  the snapshots, column-major, i.e. each snapshot is a contiguous block of values.
+ *  The header is a multiple of 8 bytes, such that the values are aligned once mapped into memory.
+ */
+struct SnapshotFileHeader
+{
+    static constexpr char magic_string[9] = "PHLPSNAP"; ///< Identifies the file format
+    static constexpr uint32_t format_version = 1; ///< Version of the layout above
+
+    uint32_t n_parameters; ///< Number of parameters per snapshot
+    uint64_t n_dofs; ///< Number of rows of each snapshot
+    uint64_t n_snapshots; ///< Number of snapshots
+
+    /// Offset in bytes of the first snapshot
+    uint64_t snapshots_offset() const;
+};
+
+/// Writes the snapshots into a binary snapshot file.
+/** Collective over the communicator. Each process writes its locally owned rows of the snapshots, ordered as the
+ *  locally owned rows of the index set. The parameters of the snapshots, one row per snapshot, are taken from the first process.
+ */
+void write_snapshot_file(
+    const std::string &filename,
+    const MatrixXd &local_snapshots,
+    const dealii::IndexSet &locally_owned_rows,
+    const MatrixXd &parameters,
+    const MPI_Comm mpi_communicator);
+
+/// Returns true if the file starts with the magic string of the binary snapshot files
+bool is_snapshot_file(const std::string &filename);
+
+/// Reads a binary snapshot file through a read-only memory mapping.
+/** Only the pages holding the requested rows are loaded, such that each process only touches its locally owned rows.
+ */
+class SnapshotFileReader
+{
+public:
+    /// Constructor. Maps the file into memory and checks its header.
+    explicit SnapshotFileReader(const std::string &filename);
+
+    /// Destructor. Unmaps the file.
+    ~SnapshotFileReader();
+
+    SnapshotFileReader(const SnapshotFileReader &) = delete; ///< Not copyable
+    SnapshotFileReader &operator=(const SnapshotFileReader &) = delete; ///< Not copyable
+
+    /// Header of the file
+    SnapshotFileHeader header;
+
+    /// Returns the parameters of a snapshot
+    RowVectorXd get_parameters(const unsigned int isnapshot) const;
+
+    /// Returns the given rows of all the snapshots, one column per snapshot, ordered as the rows of the index set
+    MatrixXd get_rows(const dealii::IndexSet &rows) const;
+
+private:
+    const std::string filename; ///< Name of the mapped file
+    const char *mapped_file; ///< Start of the memory mapping
+    std::size_t mapped_size; ///< Size of the memory mapping
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "embedded_error_control_check.h"
+#include "flow_solver/flow_solver_factory.h"
+#include <cmath>
+
+namespace PHiLiP {
+namespace Tests {
+
+template <int dim, int nstate>
+EmbeddedErrorControlCheck<dim, nstate>::EmbeddedErrorControlCheck(
+        const PHiLiP::Parameters::AllParameters *const parameters_input,
+        const dealii::ParameterHandler &parameter_handler_input)
+        : TestsBase::TestsBase(parameters_input),
+         parameter_handler(parameter_handler_input)
+{}
+
+template <int dim, int nstate>
+dealii::LinearAlgebra::distributed::Vector<double> EmbeddedErrorControlCheck<dim,nstate>::calculate_reference_solution() const
+{
+    PHiLiP::Parameters::AllParameters params_reference = *(this->all_parameters);
+    const int number_of_timesteps = this->all_parameters->time_refinement_study_param.number_of_timesteps_for_reference_solution;
+    params_reference.ode_solver_param.use_embedded_error_control = false;
+    params_reference.ode_solver_param.initial_time_step = params_reference.flow_solver_param.final_time / number_of_timesteps;
+    pcout << "Using timestep size dt = " << params_reference.ode_solver_param.initial_time_step << " for reference solution." << std::endl;
+
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver_reference = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&params_reference, parameter_handler);
+    static_cast<void>(flow_solver_reference->run());
+
+    return flow_solver_reference->dg->solution;
+}
+
+template <int dim, int nstate>
+double EmbeddedErrorControlCheck<dim,nstate>::calculate_weighted_error_norm(
+        const dealii::LinearAlgebra::distributed::Vector<double> &solution,
+        const dealii::LinearAlgebra::distributed::Vector<double> &reference_solution) const
+{
+    const double atol = this->all_parameters->ode_solver_param.embedded_error_absolute_tolerance;
+    const double rtol = this->all_parameters->ode_solver_param.embedded_error_relative_tolerance;
+
+    double local_error_squared = 0.0;
+    for (const auto idof : solution.locally_owned_elements()) {
+        const double scale = atol + rtol * std::abs(reference_solution[idof]);
+        const double error = (solution[idof] - reference_solution[idof]) / scale;
+        local_error_squared += error * error;
+    }
+    const double error_squared = dealii::Utilities::MPI::sum(local_error_squared, this->mpi_communicator);
+    return std::sqrt(error_squared / solution.size());
+}
+
+template <int dim, int nstate>
+int EmbeddedErrorControlCheck<dim, nstate>::run_test() const
+{
+    if (!this->all_parameters->ode_solver_param.use_embedded_error_control) {
+        pcout << "Error: embedded_error_control_check requires use_embedded_error_control = true. Aborting..." << std::endl;
+        std::abort();
+    }
+    const double final_time = this->all_parameters->flow_solver_param.final_time;
+
+    pcout << "\n\n-------------------------------------------------------" << std::endl;
+    pcout << "Calculating reference solution at final_time = " << final_time << " ..." << std::endl;
+    pcout << "-------------------------------------------------------" << std::endl;
+    const dealii::LinearAlgebra::distributed::Vector<double> reference_solution = calculate_reference_solution();
+
+    pcout << "\n\n-------------------------------------------------------" << std::endl;
+    pcout << "Solving with the embedded error controller ..." << std::endl;
+    pcout << "-------------------------------------------------------" << std::endl;
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(this->all_parameters, parameter_handler);
+    static_cast<void>(flow_solver->run());
+
+    const unsigned int n_accepted_steps = flow_solver->ode_solver->current_iteration;
+    const unsigned int n_rejected_steps = flow_solver->ode_solver->get_n_rejected_steps();
+    const double final_time_actual = flow_solver->ode_solver->current_time;
+    const double weighted_error = calculate_weighted_error_norm(flow_solver->dg->solution, reference_solution);
+    pcout << "Accepted steps: " << n_accepted_steps << ", rejected steps: " << n_rejected_steps << std::endl;
+    pcout << "Weighted error norm at the final time: " << weighted_error << std::endl;
+
+    int testfail = 0;
+    if (std::abs(final_time_actual - final_time) > 1e-12) {
+        pcout << "Final time " << final_time_actual << " does not match the target final time " << final_time << std::endl;
+        testfail = 1;
+    }
+    // The initial time step is chosen too large for the tolerances, the controller must reject it.
+    if (n_rejected_steps == 0) {
+        pcout << "No step was rejected by the error controller." << std::endl;
+        testfail = 1;
+    }
+    // Every accepted step has a local error norm below one. Linear advection does not amplify
+    // the error of previous steps, so the global error is bounded by their sum.
+    if (weighted_error > n_accepted_steps) {
+        pcout << "The global error exceeds the accumulated tolerance of " << n_accepted_steps << " accepted steps." << std::endl;
+        testfail = 1;
+    }
+
+    return testfail;
+}
+
+#if PHILIP_DIM==1
+    template class EmbeddedErrorControlCheck<PHILIP_DIM,PHILIP_DIM>;
+#endif
+} // Tests namespace
+} // PHiLiP namespace
@@ -0,0 +1,44 @@
+#ifndef __EMBEDDED_ERROR_CONTROL_CHECK__
+#define __EMBEDDED_ERROR_CONTROL_CHECK__
+
+#include "dg/dg_base.hpp"
+#include "tests.h"
+
+namespace PHiLiP {
+namespace Tests {
+
+/// Checks the time step controller driven by the embedded error estimate of the RK method
+/** The solution is advanced with use_embedded_error_control from an initial time step too large
+ *  for the tolerances, such that at least one step must be rejected. The final solution is compared
+ *  to a reference solution computed with number_of_timesteps_for_reference_solution constant steps.
+ */
+template <int dim, int nstate>
+class EmbeddedErrorControlCheck: public TestsBase
+{
+public:
+    /// Constructor
+    EmbeddedErrorControlCheck(
+            const Parameters::AllParameters *const parameters_input,
+            const dealii::ParameterHandler &parameter_handler_input);
+
+    /// Parameter handler for storing the .prm file being ran
+    const dealii::ParameterHandler &parameter_handler;
+
+    /// Run test
+    int run_test () const override;
+protected:
+    /// Computes the reference solution at the final time with constant time steps and without error control
+    dealii::LinearAlgebra::distributed::Vector<double> calculate_reference_solution() const;
+
+    /// Weighted RMS norm of the difference with the reference solution, scaled as the embedded error estimate
+    /** Each entry is divided by atol + rtol*|u_ref|, such that a norm below one satisfies the tolerances.
+     */
+    double calculate_weighted_error_norm(
+            const dealii::LinearAlgebra::distributed::Vector<double> &solution,
+            const dealii::LinearAlgebra::distributed::Vector<double> &reference_solution) const;
+};
+
+} // End of Tests namespace
+} // End of PHiLiP namespace
+
+#endif
@@ -222,6 +222,7 @@ int EulerBumpOptimization<dim,nstate>
     const std::array<double,dim> ffd_rectangle_lengths = {{2.8,0.6}};
     const std::array<unsigned int,dim> ffd_ndim_control_pts = {{nx_ffd,2}};
     FreeFormDeformation<dim> ffd( ffd_origin, ffd_rectangle_lengths, ffd_ndim_control_pts);
+    ffd.mesh_mover_param = param.mesh_mover_param;
 
     unsigned int n_design_variables = 0;
     // Vector of ijk indices and dimension.
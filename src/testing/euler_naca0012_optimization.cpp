@@ -461,6 +461,7 @@ int EulerNACAOptimization<dim,nstate>
     const std::array<double,dim> ffd_rectangle_lengths = {{0.9,0.122}};
     const std::array<unsigned int,dim> ffd_ndim_control_pts = {{nx_ffd,3}};
     FreeFormDeformation<dim> ffd( ffd_origin, ffd_rectangle_lengths, ffd_ndim_control_pts);
+    ffd.mesh_mover_param = param.mesh_mover_param;
 
     unsigned int n_design_variables = 0;
     // Vector of ijk indices and dimension.
@@ -0,0 +1,93 @@
+#include "hyper_reduced_order.h"
+#include "reduced_order/pod_basis_offline.h"
+#include "parameters/all_parameters.h"
+#include "functional/functional.h"
+#include "flow_solver/flow_solver.h"
+#include "flow_solver/flow_solver_factory.h"
+#include "ode_solver/ode_solver_factory.h"
+#include <array>
+#include <iostream>
+
+namespace PHiLiP {
+namespace Tests {
+
+template <int dim, int nstate>
+HyperReducedOrder<dim, nstate>::HyperReducedOrder(const Parameters::AllParameters *const parameters_input,
+                                                  const dealii::ParameterHandler &parameter_handler_input)
+        : TestsBase::TestsBase(parameters_input)
+        , parameter_handler(parameter_handler_input)
+{}
+
+template <int dim, int nstate>
+double HyperReducedOrder<dim, nstate>::solve_reduced_order_model(
+        const Parameters::AllParameters *const parameters,
+        const Parameters::ODESolverParam::ODESolverEnum ode_solver_type,
+        dealii::LinearAlgebra::distributed::Vector<double> &solution) const
+{
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(parameters, parameter_handler);
+    std::shared_ptr<ProperOrthogonalDecomposition::OfflinePOD<dim>> pod = std::make_shared<ProperOrthogonalDecomposition::OfflinePOD<dim>>(flow_solver->dg);
+    flow_solver->ode_solver = PHiLiP::ODE::ODESolverFactory<dim, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, pod);
+    // Samples the cells if use_hyper_reduction is set
+    flow_solver->ode_solver->allocate_ode_system();
+    auto functional = FunctionalFactory<dim,nstate,double>::create_Functional(parameters->functional_param, flow_solver->dg);
+
+    flow_solver->ode_solver->steady_state();
+
+    solution = flow_solver->dg->solution;
+    return functional->evaluate_functional(false,false);
+}
+
+template <int dim, int nstate>
+int HyperReducedOrder<dim, nstate>::run_test() const
+{
+    pcout << "Starting hyper-reduced reduced-order test..." << std::endl;
+
+    if (!all_parameters->reduced_order_param.use_hyper_reduction) {
+        pcout << "Error: hyper_reduced_order requires use_hyper_reduction = true. Aborting..." << std::endl;
+        std::abort();
+    }
+    Parameters::AllParameters full_assembly_parameters = *all_parameters;
+    full_assembly_parameters.reduced_order_param.use_hyper_reduction = false;
+
+    const double tolerance = 1E-4;
+    const std::array<Parameters::ODESolverParam::ODESolverEnum,2> ode_solver_types = {
+        Parameters::ODESolverParam::ODESolverEnum::pod_galerkin_solver,
+        Parameters::ODESolverParam::ODESolverEnum::pod_petrov_galerkin_solver};
+    const std::array<std::string,2> ode_solver_names = {"Galerkin", "Petrov-Galerkin"};
+
+    int testfail = 0;
+    for (unsigned int itype = 0; itype < ode_solver_types.size(); ++itype) {
+        pcout << "Solving the full-assembly " << ode_solver_names[itype] << " reduced-order model..." << std::endl;
+        dealii::LinearAlgebra::distributed::Vector<double> full_assembly_solution;
+        const double full_assembly_functional = solve_reduced_order_model(&full_assembly_parameters, ode_solver_types[itype], full_assembly_solution);
+
+        pcout << "Solving the hyper-reduced " << ode_solver_names[itype] << " reduced-order model..." << std::endl;
+        dealii::LinearAlgebra::distributed::Vector<double> hyper_reduced_solution;
+        const double hyper_reduced_functional = solve_reduced_order_model(all_parameters, ode_solver_types[itype], hyper_reduced_solution);
+
+        const double solution_error = ((hyper_reduced_solution-=full_assembly_solution).l2_norm()/full_assembly_solution.l2_norm());
+        const double functional_error = std::abs(hyper_reduced_functional - full_assembly_functional)/std::abs(full_assembly_functional);
+
+        pcout << ode_solver_names[itype] << " hyper-reduction solution error: " << solution_error << std::endl
+              << ode_solver_names[itype] << " hyper-reduction functional error: " << functional_error << std::endl;
+
+        if (solution_error > tolerance || functional_error > tolerance) testfail = 1;
+    }
+
+    if (testfail) {
+        pcout << "Failed!";
+        return -1;
+    }
+    pcout << "Passed!";
+    return 0;
+}
+
+#if PHILIP_DIM==1
+        template class HyperReducedOrder<PHILIP_DIM, PHILIP_DIM>;
+#endif
+
+#if PHILIP_DIM!=1
+        template class HyperReducedOrder<PHILIP_DIM, PHILIP_DIM+2>;
+#endif
+} // Tests namespace
+} // PHiLiP namespace
@@ -0,0 +1,41 @@
+#ifndef __HYPER_REDUCED_ORDER_H__
+#define __HYPER_REDUCED_ORDER_H__
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "tests.h"
+#include "parameters/all_parameters.h"
+
+namespace PHiLiP {
+namespace Tests {
+
+/// Hyper-reduced POD reduced order test, verifies that the hyper-reduction preserves the reduced-order solution
+/** The Galerkin and Petrov-Galerkin reduced-order models are solved with the full assembly of the residual
+ *  and with the ECSW sample of the cells. The solutions and functionals of the hyper-reduced models must match
+ *  the ones of the full-assembly models within the tolerance.
+ */
+template <int dim, int nstate>
+class HyperReducedOrder: public TestsBase
+{
+public:
+    /// Constructor.
+    HyperReducedOrder(const Parameters::AllParameters *const parameters_input,
+                      const dealii::ParameterHandler &parameter_handler_input);
+
+    /// Run hyper-reduced POD reduced order
+    int run_test () const override;
+
+    /// Dummy parameter handler because flowsolver requires it
+    const dealii::ParameterHandler &parameter_handler;
+
+protected:
+    /// Solves the steady reduced-order model of given type and returns its solution and functional
+    double solve_reduced_order_model(
+            const Parameters::AllParameters *const parameters,
+            const Parameters::ODESolverParam::ODESolverEnum ode_solver_type,
+            dealii::LinearAlgebra::distributed::Vector<double> &solution) const;
+};
+} // End of Tests namespace
+} // End of PHiLiP namespace
+
+#endif
@@ -424,6 +424,7 @@ int OptimizationInverseManufactured<dim,nstate>
 
  high_order_grid->volume_nodes += volume_displacements;
  high_order_grid->volume_nodes.update_ghost_values();
+ high_order_grid->mark_volume_nodes_as_modified();
     high_order_grid->update_surface_nodes();
  //{
  // std::function<dealii::Point<dim>(dealii::Point<dim>)> reverse_transformation = reverse_deformation<dim>;
@@ -494,6 +495,7 @@ int OptimizationInverseManufactured<dim,nstate>
  
  high_order_grid->volume_nodes = initial_grid;
  high_order_grid->volume_nodes.update_ghost_values();
+ high_order_grid->mark_volume_nodes_as_modified();
     high_order_grid->update_surface_nodes();
  pcout << "Initial grid: " << std::endl;
  dg->output_results_vtk(9998);
@@ -704,6 +706,7 @@ int OptimizationInverseManufactured<dim,nstate>
     VectorType volume_displacements = meshmover.get_volume_displacements();
     high_order_grid->volume_nodes += volume_displacements;
     high_order_grid->volume_nodes.update_ghost_values();
+    high_order_grid->mark_volume_nodes_as_modified();
     high_order_grid->update_surface_nodes();
 
     ode_solver->steady_state();
@@ -728,6 +731,7 @@ int OptimizationInverseManufactured<dim,nstate>
    dg->solution = old_solution;
    high_order_grid->volume_nodes = old_volume_nodes;
    high_order_grid->volume_nodes.update_ghost_values();
+   high_order_grid->mark_volume_nodes_as_modified();
    high_order_grid->update_surface_nodes();
    step_length *= 0.5;
   }
@@ -1071,6 +1075,7 @@ int OptimizationInverseManufactured<dim,nstate>
  // Make sure that if the volume_nodes are located at the target volume_nodes, then we recover our target functional
  high_order_grid->volume_nodes = target_nodes;
  high_order_grid->volume_nodes.update_ghost_values();
+ high_order_grid->mark_volume_nodes_as_modified();
     high_order_grid->update_surface_nodes();
  // Solve on this new grid
  ode_solver->steady_state();
@@ -7,6 +7,7 @@
 #include "reduced_order/reduced_order_solution.h"
 #include "flow_solver/flow_solver.h"
 #include "flow_solver/flow_solver_factory.h"
+#include "ode_solver/reduced_order_ode_solver.h"
 #include <cmath>
 #include "reduced_order/rbf_interpolation.h"
 #include "ROL_Algorithm.hpp"
@@ -16,11 +17,36 @@
 #include "ROL_Bounds.hpp"
 #include "reduced_order/halton.h"
 #include "reduced_order/min_max_scaler.h"
+#include "reduced_order/kd_tree.h"
 #include "tests.h"
 
 namespace PHiLiP {
 namespace Tests {
 
+namespace {
+
+/// Locally owned elements of the vectors, one column per vector
+MatrixXd get_local_rows(const std::vector<const DealiiVector *> &vectors)
+{
+    MatrixXd local_rows(vectors[0]->locally_owned_elements().n_elements(), vectors.size());
+    for (unsigned int j = 0; j < vectors.size(); ++j) {
+        for (int i = 0; i < local_rows.rows(); ++i) local_rows(i,j) = vectors[j]->local_element(i);
+    }
+    return local_rows;
+}
+
+/// Vector distributed like layout_vector whose locally owned elements are a column of the local rows
+DealiiVector get_column_vector(const MatrixXd &local_rows, const int column, const DealiiVector &layout_vector)
+{
+    DealiiVector vector;
+    vector.reinit(layout_vector);
+    for (int i = 0; i < local_rows.rows(); ++i) vector.local_element(i) = local_rows(i, column);
+    vector.update_ghost_values();
+    return vector;
+}
+
+}
+
 template<int dim, int nstate>
 AdaptiveSampling<dim, nstate>::AdaptiveSampling(const PHiLiP::Parameters::AllParameters *const parameters_input,
                                                 const dealii::ParameterHandler &parameter_handler_input)
@@ -33,8 +59,22 @@ AdaptiveSampling<dim, nstate>::AdaptiveSampling(const PHiLiP::Parameters::AllPar
     flow_solver->dg->assemble_residual(compute_dRdW);
     std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> system_matrix = std::make_shared<dealii::TrilinosWrappers::SparseMatrix>();
     system_matrix->copy_from(flow_solver->dg->system_matrix);
-    current_pod = std::make_shared<ProperOrthogonalDecomposition::OnlinePOD<dim>>(system_matrix);
+    current_pod = std::make_shared<ProperOrthogonalDecomposition::OnlinePOD<dim>>(system_matrix, all_parameters->reduced_order_param.pod_truncation_tolerance);
     nearest_neighbors = std::make_shared<ProperOrthogonalDecomposition::NearestNeighbors>();
+
+    const int n_concurrent_solves = all_parameters->reduced_order_param.n_concurrent_solves;
+    if (n_concurrent_solves > 1) {
+        this->pcout << "Solving the snapshots and ROMs on " << n_concurrent_solves << " groups of processes concurrently." << std::endl;
+        solve_scheduler = std::make_unique<ProperOrthogonalDecomposition::ParameterSolveScheduler<dim>>(n_concurrent_solves, mpi_communicator);
+        std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> group_flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(all_parameters, parameter_handler, solve_scheduler->get_group_communicator());
+        group_flow_solver->dg->assemble_residual(compute_dRdW);
+        std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> group_system_matrix = std::make_shared<dealii::TrilinosWrappers::SparseMatrix>();
+        group_system_matrix->copy_from(group_flow_solver->dg->system_matrix);
+        group_pod = std::make_shared<ProperOrthogonalDecomposition::OnlinePOD<dim>>(group_system_matrix, all_parameters->reduced_order_param.pod_truncation_tolerance);
+        world_dg = flow_solver->dg;
+        group_dg = group_flow_solver->dg;
+        solve_scheduler->set_dof_distributions(world_dg->dof_handler, group_dg->dof_handler);
+    }
 }
 
 template <int dim, int nstate>
@@ -64,6 +104,7 @@ int AdaptiveSampling<dim, nstate>::run_test() const
         nearest_neighbors->updateSnapshots(snapshot_parameters, fom_solution);
         current_pod->addSnapshot(fom_solution);
         current_pod->computeBasis();
+        hyper_reduction_row_weights.reinit(0);
 
         //Update previous ROM errors with updated current_pod
         for(auto it = rom_locations.begin(); it != rom_locations.end(); ++it){
@@ -94,10 +135,7 @@ template <int dim, int nstate>
 void AdaptiveSampling<dim, nstate>::outputIterationData(int iteration) const{
     std::unique_ptr<dealii::TableHandler> snapshot_table = std::make_unique<dealii::TableHandler>();
 
-    std::ofstream solution_out_file("solution_snapshots_iteration_" +  std::to_string(iteration) + ".txt");
-    unsigned int precision = 16;
-    current_pod->dealiiSnapshotMatrix.print_formatted(solution_out_file, precision);
-    solution_out_file.close();
+    current_pod->writeSnapshots("solution_snapshots_iteration_" +  std::to_string(iteration) + ".snap", snapshot_parameters);
 
     for(auto parameters : snapshot_parameters.rowwise()){
         for(int i = 0 ; i < snapshot_parameters.cols() ; i++){
@@ -150,9 +188,15 @@ RowVectorXd AdaptiveSampling<dim, nstate>::getMaxErrorROM() const{
     ProperOrthogonalDecomposition::MinMaxScaler scaler;
     MatrixXd parameters_scaled = scaler.fit_transform(parameters);
 
-    //Construct radial basis function
-    std::string kernel = "thin_plate_spline";
-    ProperOrthogonalDecomposition::RBFInterpolation rbf = ProperOrthogonalDecomposition::RBFInterpolation(parameters_scaled, errors, kernel);
+    //Construct radial basis function, or update it such that only the points added since the last iteration are factorized
+    if(error_surrogate == nullptr){
+        std::string kernel = "thin_plate_spline";
+        error_surrogate = std::make_shared<ProperOrthogonalDecomposition::RBFInterpolation>(parameters_scaled, errors, kernel);
+    }
+    else{
+        error_surrogate->updateData(parameters_scaled, errors);
+    }
+    ProperOrthogonalDecomposition::RBFInterpolation &rbf = *error_surrogate;
 
     // Set parameters.
     ROL::ParameterList parlist;
@@ -168,16 +212,18 @@ RowVectorXd AdaptiveSampling<dim, nstate>::getMaxErrorROM() const{
     parlist.sublist("Status Test").set("Iteration Limit",100);
 
     //Find max error and parameters by minimizing function starting at each ROM location
-    RowVectorXd max_error_params(parameters.cols());
-    max_error = 0;
+    //The optimizations only involve the RBF, such that the starting locations are distributed over the processes
+    //instead of being repeated by all of them. Each result is computed by a single process and the results are summed.
+    const int n_locations = rom_locations.size();
+    const int dimension = parameters.cols();
+    MatrixXd optimized_scaled_parameters = MatrixXd::Zero(n_locations, dimension);
 
-    for(auto it = rom_locations.begin(); it != rom_locations.end(); ++it){
+    for(int ilocation = mpi_rank ; ilocation < n_locations ; ilocation += n_mpi){
 
-        Eigen::RowVectorXd rom_unscaled = it->get()->parameter;
+        Eigen::RowVectorXd rom_unscaled = rom_locations[ilocation]->parameter;
         Eigen::RowVectorXd rom_scaled = scaler.transform(rom_unscaled);
 
         //start bounds
-        int dimension = parameters.cols();
         ROL::Ptr<std::vector<double>> l_ptr = ROL::makePtr<std::vector<double>>(dimension,0.0);
         ROL::Ptr<std::vector<double>> u_ptr = ROL::makePtr<std::vector<double>>(dimension,1.0);
         ROL::Ptr<ROL::Vector<double>> lo = ROL::makePtr<ROL::StdVector<double>>(l_ptr);
@@ -197,13 +243,6 @@ RowVectorXd AdaptiveSampling<dim, nstate>::getMaxErrorROM() const{
             (*x_ptr)[j] = rom_scaled(j);
         }
 
-        this->pcout << "Unscaled parameter: " << rom_unscaled << std::endl;
-        this->pcout << "Scaled parameter: ";
-        for(int j = 0 ; j < dimension ; j++){
-            this->pcout << (*x_ptr)[j] << " ";
-        }
-        this->pcout << std::endl;
-
         ROL::StdVector<double> x(x_ptr);
 
         // Run Algorithm
@@ -218,16 +257,26 @@ RowVectorXd AdaptiveSampling<dim, nstate>::getMaxErrorROM() const{
             rom_scaled(j) = (*x_min)[j];
         }
 
-        RowVectorXd rom_unscaled_optim = scaler.inverse_transform(rom_scaled);
+        optimized_scaled_parameters.row(ilocation) = rom_scaled;
+    }
 
-        this->pcout << "Parameters of optimization convergence: " << rom_unscaled_optim << std::endl;
+    MPI_Allreduce(MPI_IN_PLACE, optimized_scaled_parameters.data(), n_locations*dimension, MPI_DOUBLE, MPI_SUM, mpi_communicator);
+    const MatrixXd optimized_parameters = scaler.inverse_transform(optimized_scaled_parameters);
+    const VectorXd optimized_errors = rbf.evaluatePoints(optimized_scaled_parameters).cwiseAbs();
+
+    RowVectorXd max_error_params(dimension);
+    max_error = 0;
 
-        double error = std::abs(rbf.evaluate(rom_scaled));
+    for(int ilocation = 0 ; ilocation < n_locations ; ilocation++){
+        this->pcout << "Unscaled parameter: " << rom_locations[ilocation]->parameter << std::endl;
+        this->pcout << "Parameters of optimization convergence: " << optimized_parameters.row(ilocation) << std::endl;
+
+        const double error = optimized_errors(ilocation);
         this->pcout << "RBF error at optimization convergence: " << error << std::endl;
         if(error > max_error){
             this->pcout << "RBF error is greater than current max error. Updating max error." << std::endl;
             max_error = error;
-            max_error_params = rom_unscaled_optim;
+            max_error_params = optimized_parameters.row(ilocation);
             this->pcout << "RBF Max error: " << max_error << std::endl;
         }
     }
@@ -246,9 +295,28 @@ RowVectorXd AdaptiveSampling<dim, nstate>::getMaxErrorROM() const{
 
 template <int dim, int nstate>
 void AdaptiveSampling<dim, nstate>::placeInitialSnapshots() const{
-    for(auto snap_param : snapshot_parameters.rowwise()){
-        this->pcout << "Sampling initial snapshot at " << snap_param << std::endl;
-        dealii::LinearAlgebra::distributed::Vector<double> fom_solution = solveSnapshotFOM(snap_param);
+    if(solve_scheduler == nullptr){
+        for(auto snap_param : snapshot_parameters.rowwise()){
+            this->pcout << "Sampling initial snapshot at " << snap_param << std::endl;
+            dealii::LinearAlgebra::distributed::Vector<double> fom_solution = solveSnapshotFOM(snap_param);
+            nearest_neighbors->updateSnapshots(snapshot_parameters, fom_solution);
+            current_pod->addSnapshot(fom_solution);
+        }
+        return;
+    }
+
+    //Each group solves its share of the snapshots, which are then added in order as if they had been solved one after the other
+    const unsigned int n_snapshots = snapshot_parameters.rows();
+    std::vector<MatrixXd> group_solutions(n_snapshots);
+    for(unsigned int isnapshot = 0 ; isnapshot < n_snapshots ; isnapshot++){
+        if(!solve_scheduler->is_task_of_this_group(isnapshot)) continue;
+        const dealii::LinearAlgebra::distributed::Vector<double> fom_solution = solveSnapshotFOM(snapshot_parameters.row(isnapshot), solve_scheduler->get_group_communicator());
+        group_solutions[isnapshot] = get_local_rows({&fom_solution});
+    }
+    for(unsigned int isnapshot = 0 ; isnapshot < n_snapshots ; isnapshot++){
+        this->pcout << "Sampling initial snapshot at " << snapshot_parameters.row(isnapshot) << std::endl;
+        const MatrixXd local_solution = solve_scheduler->group_rows_to_rows(group_solutions[isnapshot], solve_scheduler->group_of_task(isnapshot));
+        const dealii::LinearAlgebra::distributed::Vector<double> fom_solution = get_column_vector(local_solution, 0, world_dg->solution);
         nearest_neighbors->updateSnapshots(snapshot_parameters, fom_solution);
         current_pod->addSnapshot(fom_solution);
     }
@@ -256,11 +324,12 @@ void AdaptiveSampling<dim, nstate>::placeInitialSnapshots() const{
 
 template <int dim, int nstate>
 bool AdaptiveSampling<dim, nstate>::placeROMLocations(const MatrixXd& rom_points) const{
-    bool error_greater_than_tolerance = false;
+    std::vector<RowVectorXd> new_points;
     for(auto midpoint : rom_points.rowwise()){
 
         //Check if ROM point already exists as another ROM point
         auto element = std::find_if(rom_locations.begin(), rom_locations.end(), [&midpoint](std::unique_ptr<ProperOrthogonalDecomposition::ROMTestLocation<dim,nstate>>& location){ return location->parameter.isApprox(midpoint);} );
+        const bool new_point_exists = std::any_of(new_points.begin(), new_points.end(), [&midpoint](const RowVectorXd& point){ return point.isApprox(midpoint);} );
 
         //Check if ROM point already exists as a snapshot
         bool snapshot_exists = false;
@@ -270,21 +339,89 @@ bool AdaptiveSampling<dim, nstate>::placeROMLocations(const MatrixXd& rom_points
             }
         }
 
-        if(element == rom_locations.end() && snapshot_exists == false){
-            //ProperOrthogonalDecomposition::ROMSolution<dim, nstate> rom_solution = solveSnapshotROM(midpoint);
-            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nstate>> rom_solution = solveSnapshotROM(midpoint);
-            rom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::ROMTestLocation<dim,nstate>>(midpoint, std::move(rom_solution)));
-            if(abs(rom_locations.back()->total_error) > all_parameters->reduced_order_param.adaptation_tolerance){
-                error_greater_than_tolerance = true;
-            }
+        if(element == rom_locations.end() && new_point_exists == false && snapshot_exists == false){
+            new_points.push_back(midpoint);
         }
         else{
             this->pcout << "ROM already computed." << std::endl;
         }
     }
+
+    const unsigned int n_previous_locations = rom_locations.size();
+    if(solve_scheduler == nullptr){
+        for(const RowVectorXd& point : new_points){
+            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nstate>> rom_solution = solveSnapshotROM(point);
+            rom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::ROMTestLocation<dim,nstate>>(point, std::move(rom_solution)));
+        }
+    }
+    else if(!new_points.empty()){
+        placeROMLocationsConcurrently(new_points);
+    }
+
+    bool error_greater_than_tolerance = false;
+    for(unsigned int ilocation = n_previous_locations ; ilocation < rom_locations.size() ; ilocation++){
+        if(abs(rom_locations[ilocation]->total_error) > all_parameters->reduced_order_param.adaptation_tolerance){
+            error_greater_than_tolerance = true;
+        }
+    }
     return error_greater_than_tolerance;
 }
 
+template <int dim, int nstate>
+void AdaptiveSampling<dim, nstate>::placeROMLocationsConcurrently(const std::vector<RowVectorXd>& parameters) const{
+    updateGroupPOD(parameters[0]);
+
+    //Each group solves its share of the ROMs and estimates their errors with respect to the FOM
+    const unsigned int n_locations = parameters.size();
+    std::vector<MatrixXd> group_rom_solutions(n_locations);
+    std::vector<double> fom_to_initial_rom_errors(n_locations, 0.0);
+    for(unsigned int ilocation = 0 ; ilocation < n_locations ; ilocation++){
+        if(!solve_scheduler->is_task_of_this_group(ilocation)) continue;
+        std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nstate>> rom_solution = solveSnapshotROM(parameters[ilocation], group_pod, group_hyper_reduction_row_weights, solve_scheduler->get_group_communicator());
+        group_rom_solutions[ilocation] = get_local_rows({&rom_solution->solution, &rom_solution->gradient});
+        const ProperOrthogonalDecomposition::ROMTestLocation<dim,nstate> group_location(parameters[ilocation], std::move(rom_solution), solve_scheduler->get_group_communicator());
+        fom_to_initial_rom_errors[ilocation] = group_location.fom_to_initial_rom_error;
+    }
+
+    //The ROM solutions are then distributed over all the processes, where their errors are later updated with the new bases
+    const DealiiVector gradient_layout(world_dg->locally_owned_dofs, mpi_communicator);
+    for(unsigned int ilocation = 0 ; ilocation < n_locations ; ilocation++){
+        const unsigned int group = solve_scheduler->group_of_task(ilocation);
+        const MatrixXd local_rom_solution = solve_scheduler->group_rows_to_rows(group_rom_solutions[ilocation], group);
+        MPI_Bcast(&fom_to_initial_rom_errors[ilocation], 1, MPI_DOUBLE, solve_scheduler->group_root(group), mpi_communicator);
+
+        std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nstate>> rom_solution = std::make_unique<ProperOrthogonalDecomposition::ROMSolution<dim, nstate>>(
+            reinitParams(parameters[ilocation]),
+            get_column_vector(local_rom_solution, 0, world_dg->solution),
+            get_column_vector(local_rom_solution, 1, gradient_layout));
+        rom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::ROMTestLocation<dim,nstate>>(parameters[ilocation], std::move(rom_solution), fom_to_initial_rom_errors[ilocation]));
+    }
+}
+
+template <int dim, int nstate>
+void AdaptiveSampling<dim, nstate>::updateGroupPOD(const RowVectorXd& parameter) const{
+    //The groups share the cells sampled for current_pod, such that the ROMs are the same as when solved one after the other
+    const bool use_hyper_reduction = all_parameters->reduced_order_param.use_hyper_reduction;
+    if (use_hyper_reduction && hyper_reduction_row_weights.size() == 0) {
+        hyper_reduction_row_weights = computeHyperReductionRowWeights(parameter);
+    }
+
+    const VectorXd &local_reference_state = current_pod->snapshot_pod.get_local_mean();
+    const MatrixXd &local_basis = current_pod->snapshot_pod.get_local_basis();
+    const int n_modes = local_basis.cols();
+    MatrixXd local_rows(local_basis.rows(), n_modes + 2);
+    local_rows.col(0) = local_reference_state;
+    local_rows.middleCols(1, n_modes) = local_basis;
+    local_rows.col(n_modes + 1).setZero();
+    if (use_hyper_reduction) local_rows.col(n_modes + 1) = get_local_rows({&hyper_reduction_row_weights}).col(0);
+
+    const MatrixXd group_local_rows = solve_scheduler->rows_to_group_rows(local_rows);
+    group_pod->setBasis(group_local_rows.col(0), group_local_rows.middleCols(1, n_modes));
+    if (use_hyper_reduction) {
+        group_hyper_reduction_row_weights = get_column_vector(group_local_rows, n_modes + 1, group_dg->solution);
+    }
+}
+
 template <int dim, int nstate>
 void AdaptiveSampling<dim, nstate>::updateNearestExistingROMs(const RowVectorXd& /*parameter*/) const{
 
@@ -296,21 +433,14 @@ void AdaptiveSampling<dim, nstate>::updateNearestExistingROMs(const RowVectorXd&
         rom_points.row(rom_points.rows()-1) = it->get()->parameter;
     }
 
-    //Get distances between each ROM point and all other ROM points
+    //Get nearest ROM points of each ROM point
+    ProperOrthogonalDecomposition::MinMaxScaler scaler;
+    MatrixXd scaled_rom_points = scaler.fit_transform(rom_points);
+    ProperOrthogonalDecomposition::KDTree tree(scaled_rom_points);
     for(auto point : rom_points.rowwise()) {
-        ProperOrthogonalDecomposition::MinMaxScaler scaler;
-        MatrixXd scaled_rom_points = scaler.fit_transform(rom_points);
         RowVectorXd scaled_point = scaler.transform(point);
 
-        VectorXd distances = (scaled_rom_points.rowwise() - scaled_point).rowwise().squaredNorm();
-
-        std::vector<int> index(distances.size());
-        std::iota(index.begin(), index.end(), 0);
-
-        std::sort(index.begin(), index.end(),
-                  [&](const int &a, const int &b) {
-                      return distances[a] < distances[b];
-                  });
+        std::vector<int> index = tree.kNearestNeighbors(scaled_point, rom_points.cols() + 2);
 
         pcout << "Searching ROM points near: " << point << std::endl;
         double local_mean_error = 0;
@@ -328,11 +458,11 @@ void AdaptiveSampling<dim, nstate>::updateNearestExistingROMs(const RowVectorXd&
 }
 
 template <int dim, int nstate>
-dealii::LinearAlgebra::distributed::Vector<double> AdaptiveSampling<dim, nstate>::solveSnapshotFOM(const RowVectorXd& parameter) const{
+dealii::LinearAlgebra::distributed::Vector<double> AdaptiveSampling<dim, nstate>::solveSnapshotFOM(const RowVectorXd& parameter, const MPI_Comm solve_communicator) const{
     this->pcout << "Solving FOM at " << parameter << std::endl;
     Parameters::AllParameters params = reinitParams(parameter);
 
-    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&params, parameter_handler);
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&params, parameter_handler, solve_communicator);
 
     // Solve implicit solution
     auto ode_solver_type = Parameters::ODESolverParam::ODESolverEnum::implicit_solver;
@@ -346,15 +476,32 @@ dealii::LinearAlgebra::distributed::Vector<double> AdaptiveSampling<dim, nstate>
 
 template <int dim, int nstate>
 std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nstate>> AdaptiveSampling<dim, nstate>::solveSnapshotROM(const RowVectorXd& parameter) const{
+    return solveSnapshotROM(parameter, current_pod, hyper_reduction_row_weights, mpi_communicator);
+}
+
+template <int dim, int nstate>
+std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nstate>> AdaptiveSampling<dim, nstate>::solveSnapshotROM(
+    const RowVectorXd& parameter,
+    std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim>> pod,
+    DealiiVector &row_weights,
+    const MPI_Comm solve_communicator) const{
     this->pcout << "Solving ROM at " << parameter << std::endl;
     Parameters::AllParameters params = reinitParams(parameter);
 
-    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&params, parameter_handler);
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&params, parameter_handler, solve_communicator);
 
     // Solve implicit solution
     auto ode_solver_type = Parameters::ODESolverParam::ODESolverEnum::pod_petrov_galerkin_solver;
-    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, current_pod);
+    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, pod);
     //flow_solver->dg->solution = nearest_neighbors->nearestNeighborMidpointSolution(parameter);
+    if (all_parameters->reduced_order_param.use_hyper_reduction) {
+        // The cells are sampled once per POD basis, and the sample is shared by the reduced-order models of all the parameters
+        if (row_weights.size() == 0) {
+            std::shared_ptr<ODE::ReducedOrderODESolver<dim,double>> rom_ode_solver = std::dynamic_pointer_cast<ODE::ReducedOrderODESolver<dim,double>>(flow_solver->ode_solver);
+            row_weights = rom_ode_solver->compute_hyper_reduction_row_weights();
+        }
+        flow_solver->dg->set_hyper_reduction_row_weights(row_weights);
+    }
     flow_solver->ode_solver->allocate_ode_system();
     flow_solver->ode_solver->steady_state();
 
@@ -371,6 +518,16 @@ std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nstate>> Adaptive
     return rom_solution;
 }
 
+template <int dim, int nstate>
+DealiiVector AdaptiveSampling<dim, nstate>::computeHyperReductionRowWeights(const RowVectorXd& parameter) const{
+    Parameters::AllParameters params = reinitParams(parameter);
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(&params, parameter_handler);
+    auto ode_solver_type = Parameters::ODESolverParam::ODESolverEnum::pod_petrov_galerkin_solver;
+    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, current_pod);
+    std::shared_ptr<ODE::ReducedOrderODESolver<dim,double>> rom_ode_solver = std::dynamic_pointer_cast<ODE::ReducedOrderODESolver<dim,double>>(flow_solver->ode_solver);
+    return rom_ode_solver->compute_hyper_reduction_row_weights();
+}
+
 template <int dim, int nstate>
 Parameters::AllParameters AdaptiveSampling<dim, nstate>::reinitParams(const RowVectorXd& parameter) const{
     // Copy all parameters
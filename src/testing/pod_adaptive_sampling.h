@@ -7,6 +7,8 @@
 #include "reduced_order/rom_test_location.h"
 #include <eigen/Eigen/Dense>
 #include "reduced_order/nearest_neighbors.h"
+#include "reduced_order/parameter_solve_scheduler.h"
+#include "reduced_order/rbf_interpolation.h"
 #include "tests.h"
 
 namespace PHiLiP {
@@ -41,9 +43,33 @@ public:
     /// Most up to date POD basis
     std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim>> current_pod;
 
+    /// Weights of the rows of the hyper-reduced residual for current_pod, empty until the cells are sampled
+    mutable DealiiVector hyper_reduction_row_weights;
+
+    /// RBF interpolation of the errors, updated from one iteration to the next
+    mutable std::shared_ptr<ProperOrthogonalDecomposition::RBFInterpolation> error_surrogate;
+
     /// Nearest neighbors of snapshots
     std::shared_ptr<ProperOrthogonalDecomposition::NearestNeighbors> nearest_neighbors;
 
+    /// Groups of processes solving the snapshots and ROMs of different parameters concurrently
+    /** Null unless reduced_order_param.n_concurrent_solves > 1. Declared before the objects distributed over the group
+     *  communicators, such that it is destroyed after them.
+     */
+    std::unique_ptr<ProperOrthogonalDecomposition::ParameterSolveScheduler<dim>> solve_scheduler;
+
+    /// DG distributed over MPI_COMM_WORLD, whose locally owned dofs are the rows of current_pod. Only kept for concurrent solves.
+    std::shared_ptr<DGBase<dim,double>> world_dg;
+
+    /// DG distributed over the group communicator of this process. Only kept for concurrent solves.
+    std::shared_ptr<DGBase<dim,double>> group_dg;
+
+    /// Copy of the basis of current_pod distributed over the group communicator of this process
+    std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim>> group_pod;
+
+    /// Copy of hyper_reduction_row_weights distributed over the group communicator of this process
+    mutable DealiiVector group_hyper_reduction_row_weights;
+
     /// Run test
     int run_test () const override;
 
@@ -57,14 +83,36 @@ public:
     void updateNearestExistingROMs(const RowVectorXd& parameter) const;
 
     /// Compute RBF and find max error
+    /** The maximization of the RBF error surrogate is distributed, one starting ROM location per process at a time.
+     */
     RowVectorXd getMaxErrorROM() const;
 
-    /// Solve full-order snapshot
-    dealii::LinearAlgebra::distributed::Vector<double> solveSnapshotFOM(const RowVectorXd& parameter) const;
+    /// Solve full-order snapshot on the processes of solve_communicator
+    dealii::LinearAlgebra::distributed::Vector<double> solveSnapshotFOM(const RowVectorXd& parameter, const MPI_Comm solve_communicator = MPI_COMM_WORLD) const;
 
-    /// Solve reduced-order solution
+    /// Solve reduced-order solution with current_pod on all the processes
     std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nstate>> solveSnapshotROM(const RowVectorXd& parameter) const;
 
+    /// Solve reduced-order solution with a POD basis distributed over solve_communicator
+    /** The hyper-reduction row_weights are computed if empty, and are distributed like the basis.
+     */
+    std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nstate>> solveSnapshotROM(
+        const RowVectorXd& parameter,
+        std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim>> pod,
+        DealiiVector &row_weights,
+        const MPI_Comm solve_communicator) const;
+
+    /// Sample the cells for the hyper-reduction of the ROMs of current_pod, with the residual at the given parameter
+    DealiiVector computeHyperReductionRowWeights(const RowVectorXd& parameter) const;
+
+    /// Copy the basis of current_pod and its hyper-reduction row weights to the groups of solve_scheduler
+    /** The row weights are computed first if empty, with the residual at the given parameter.
+     */
+    void updateGroupPOD(const RowVectorXd& parameter) const;
+
+    /// Solve the ROMs of the parameters and estimate their errors, concurrently on the groups of solve_scheduler
+    void placeROMLocationsConcurrently(const std::vector<RowVectorXd>& parameters) const;
+
     /// Reinitialize parameters
     Parameters::AllParameters reinitParams(const RowVectorXd& parameter) const;
 
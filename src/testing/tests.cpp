@@ -29,6 +29,7 @@
 #include "shock_1d.h"
 #include "euler_naca0012.hpp"
 #include "reduced_order.h"
+#include "hyper_reduced_order.h"
 #include "convection_diffusion_explicit_periodic.h"
 #include "dual_weighted_residual_mesh_adaptation.h"
 #include "anisotropic_mesh_adaptation_cases.h"
@@ -38,6 +39,7 @@
 #include "taylor_green_vortex_restart_check.h"
 #include "time_refinement_study.h"
 #include "time_refinement_study_reference.h"
+#include "embedded_error_control_check.h"
 #include "h_refinement_study_isentropic_vortex.h"
 #include "burgers_energy_conservation_rrk.h"
 #include "euler_entropy_conserving_split_forms_check.h"
@@ -273,6 +275,8 @@ std::unique_ptr< TestsBase > TestsFactory<dim,nstate,MeshType>
         if constexpr (dim==1 && nstate==1) return std::make_unique<Shock1D<dim,nstate>>(parameters_input);
     } else if(test_type == Test_enum::reduced_order) {
         if constexpr ((dim==2 && nstate==dim+2) || (dim==1 && nstate==1)) return std::make_unique<ReducedOrder<dim,nstate>>(parameters_input, parameter_handler_input);
+    } else if(test_type == Test_enum::hyper_reduced_order) {
+        if constexpr ((dim==2 && nstate==dim+2) || (dim==1 && nstate==1)) return std::make_unique<HyperReducedOrder<dim,nstate>>(parameters_input, parameter_handler_input);
     } else if(test_type == Test_enum::POD_adaptive_sampling) {
         if constexpr ((dim==2 && nstate==dim+2) || (dim==1 && nstate==1)) return std::make_unique<AdaptiveSampling<dim,nstate>>(parameters_input,parameter_handler_input);
     } else if(test_type == Test_enum::adaptive_sampling_testing) {
@@ -295,6 +299,8 @@ std::unique_ptr< TestsBase > TestsFactory<dim,nstate,MeshType>
         if constexpr (dim+2==nstate && dim!=1)  return std::make_unique<HRefinementStudyIsentropicVortex<dim, nstate>>(parameters_input, parameter_handler_input);
     } else if(test_type == Test_enum::time_refinement_study_reference) {
         if constexpr (dim==1 && nstate==1)  return std::make_unique<TimeRefinementStudyReference<dim, nstate>>(parameters_input, parameter_handler_input);
+    } else if(test_type == Test_enum::embedded_error_control_check) {
+        if constexpr (dim==1 && nstate==1)  return std::make_unique<EmbeddedErrorControlCheck<dim, nstate>>(parameters_input, parameter_handler_input);
     } else if(test_type == Test_enum::burgers_energy_conservation_rrk) {
         if constexpr (dim==1 && nstate==1)  return std::make_unique<BurgersEnergyConservationRRK<dim, nstate>>(parameters_input, parameter_handler_input);
     } else if(test_type == Test_enum::euler_entropy_conserving_split_forms_check) {
@@ -60,6 +60,7 @@ echo "  set time_step_factor_residual_exp = 2" >> $file
 echo "  #set print_iteration_modulo              = 1" >> $file
 echo "  set output_final_steady_state_solution_to_file       = true" >> $file
 echo "  set steady_state_final_solution_filename = ${mach[i]}_${alpha[i]}_solution_snapshot" >> $file
+echo "  set steady_state_final_solution_file_format = binary" >> $file
 echo "end" >> $file
 echo "" >> $file
 echo "subsection grid refinement study" >> $file
@@ -0,0 +1,80 @@
+#include <assert.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include "assert_compare_array.h"
+#include "parameters/parameters.h"
+#include "physics/euler.h"
+
+const double TOLERANCE = 1E-12;
+
+// Compares the split fluxes evaluated for a line of solutions at once
+// against the pairwise split fluxes, for every two-point flux type.
+int main (int argc, char * argv[])
+{
+    MPI_Init(&argc, &argv);
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+    using two_point_num_flux_enum = PHiLiP::Parameters::AllParameters::TwoPointNumericalFlux;
+
+    const double a = 1.0 , b = 0.0, c = 1.4;
+    //default parameters
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler); // default fills options
+    PHiLiP::Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    const double min = 0.0;
+    const double max = 1.0;
+    const int nx = 11;
+
+    std::vector<unsigned int> repetitions(dim, nx);
+    dealii::Point<dim,double> corner1, corner2;
+    for (int d=0; d<dim; d++) { 
+        corner1[d] = min;
+        corner2[d] = max;
+    }
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_rectangle(grid, repetitions, corner1, corner2);
+
+    const std::array<two_point_num_flux_enum,4> flux_types = {two_point_num_flux_enum::KG, two_point_num_flux_enum::IR,
+                                                              two_point_num_flux_enum::CH, two_point_num_flux_enum::Ra};
+    for (const two_point_num_flux_enum flux_type : flux_types) {
+        PHiLiP::Physics::Euler<dim, nstate, double> euler_physics(&all_parameters,a,c,a,b,b,nullptr,flux_type);
+
+        // Line of solutions at every vertex, longer than a single batch, and including identical solutions.
+        std::vector<std::array<double,nstate>> conservative_soln_line;
+        for (auto cell : grid.active_cell_iterators()) {
+            for (unsigned int v=0; v < dealii::GeometryInfo<dim>::vertices_per_cell; ++v) {
+                const dealii::Point<dim,double> vertex = cell->vertex(v);
+                std::array<double,nstate> conservative_soln;
+                for (int s=0; s<nstate; s++) {
+                    conservative_soln[s] = euler_physics.manufactured_solution_function->value(vertex, s);
+                }
+                conservative_soln_line.push_back(conservative_soln);
+            }
+            if (conservative_soln_line.size() > 50) break;
+        }
+
+        for (unsigned int i=0; i<conservative_soln_line.size(); i+=7) {
+            const std::array<double,nstate> &conservative_soln = conservative_soln_line[i];
+            std::vector<std::array<dealii::Tensor<1,dim,double>,nstate>> conv_num_split_flux_line;
+            euler_physics.convective_numerical_split_flux_batch(conservative_soln, conservative_soln_line, conv_num_split_flux_line);
+            if (conv_num_split_flux_line.size() != conservative_soln_line.size()) std::abort();
+
+            for (unsigned int j=0; j<conservative_soln_line.size(); ++j) {
+                const std::array<dealii::Tensor<1,dim,double>,nstate> conv_num_split_flux
+                    = euler_physics.convective_numerical_split_flux(conservative_soln, conservative_soln_line[j]);
+                for (int d=0; d<dim; d++) {
+                    std::array<double,nstate> flux_pair, flux_batch;
+                    for (int s=0; s<nstate; s++) {
+                        flux_pair[s] = conv_num_split_flux[s][d];
+                        flux_batch[s] = conv_num_split_flux_line[j][s][d];
+                    }
+                    assert_compare_array<nstate> ( flux_pair, flux_batch, 1.0, TOLERANCE);
+                }
+            }
+        }
+    }
+    MPI_Finalize();
+    return 0;
+}
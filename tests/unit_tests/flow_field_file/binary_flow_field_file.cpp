@@ -0,0 +1,97 @@
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include "physics/initial_conditions/binary_flow_field_file.h"
+
+/// Value of a point, exactly representable in single precision.
+double point_value(const uint64_t global_point, const unsigned int ivalue)
+{
+    return 0.25 + 10.0*global_point + ivalue;
+}
+
+/// Writes a file with a different number of points on each process and checks that it reads back the same.
+/** The number of points of a process exceeds the chunk size on the last process, such that several chunks are streamed. */
+int write_and_read(const bool use_single_precision, dealii::ConditionalOStream &pcout)
+{
+    const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const unsigned int n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    const std::string filename = use_single_precision ? "binary_flow_field_file_float32.bin" : "binary_flow_field_file_float64.bin";
+
+    const unsigned int dim = 3;
+    const unsigned int n_values_per_point = 2*dim+1;
+    const uint64_t n_dofs_per_state = 1234;
+    const double time = 0.125;
+    auto n_points_of_process = [&](const unsigned int iproc) -> uint64_t {
+        return (iproc == n_mpi_processes-1) ? 100000 : 7 + 3*iproc;
+    };
+    uint64_t first_point = 0;
+    for (unsigned int iproc = 0; iproc < mpi_rank; ++iproc) first_point += n_points_of_process(iproc);
+    const uint64_t n_local_points = n_points_of_process(mpi_rank);
+
+    {
+        PHiLiP::BinaryFlowFieldWriter writer(filename, mpi_communicator, dim, n_values_per_point, n_local_points,
+                                             use_single_precision, n_dofs_per_state, time);
+        std::vector<double> point_values(n_values_per_point);
+        for (uint64_t ipoint = 0; ipoint < n_local_points; ++ipoint) {
+            for (unsigned int ivalue = 0; ivalue < n_values_per_point; ++ivalue) point_values[ivalue] = point_value(first_point+ipoint, ivalue);
+            writer.write_point(point_values);
+        }
+        writer.close();
+    }
+
+    int n_failures = 0;
+    PHiLiP::BinaryFlowFieldReader reader(filename, mpi_communicator);
+    if (reader.header.dim != dim || reader.header.n_values_per_point != n_values_per_point
+        || reader.header.n_dofs_per_state != n_dofs_per_state || reader.header.time != time
+        || reader.header.bytes_per_value != (use_single_precision ? sizeof(float) : sizeof(double))) {
+        std::cout << "Process " << mpi_rank << " read a wrong header." << std::endl;
+        ++n_failures;
+    }
+    if (reader.n_local_points != n_local_points) {
+        std::cout << "Process " << mpi_rank << " has " << reader.n_local_points << " points instead of " << n_local_points << std::endl;
+        ++n_failures;
+    } else {
+        std::vector<double> point_values;
+        for (uint64_t ipoint = 0; ipoint < n_local_points; ++ipoint) {
+            reader.read_point(point_values);
+            for (unsigned int ivalue = 0; ivalue < n_values_per_point; ++ivalue) {
+                if (point_values[ivalue] != point_value(first_point+ipoint, ivalue)) {
+                    std::cout << "Process " << mpi_rank << " read " << point_values[ivalue] << " instead of "
+                              << point_value(first_point+ipoint, ivalue) << std::endl;
+                    ++n_failures;
+                }
+            }
+        }
+    }
+    reader.close();
+
+    n_failures = dealii::Utilities::MPI::sum(n_failures, mpi_communicator);
+    pcout << (use_single_precision ? "float32" : "float64") << " file: " << n_failures << " failures." << std::endl;
+    return n_failures;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    int n_failures = 0;
+    n_failures += write_and_read(false, pcout);
+    n_failures += write_and_read(true, pcout);
+
+    if (n_failures > 0) {
+        pcout << "Binary flow field file test failed." << std::endl;
+        return 1;
+    }
+    pcout << "Binary flow field file test passed." << std::endl;
+    return 0;
+}
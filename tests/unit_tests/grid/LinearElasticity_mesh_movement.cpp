@@ -194,6 +194,20 @@ int main (int argc, char * argv[])
                 meshmover(high_order_grid, surface_node_displacements_vector);
             VectorType volume_displacements = meshmover.get_volume_displacements();
 
+            // The AMG-preconditioned mesh mover should recover the same displacements.
+            Parameters::MeshMoverParam amg_mesh_mover_param;
+            amg_mesh_mover_param.preconditioner = Parameters::MeshMoverParam::PreconditionerEnum::amg;
+            MeshMover::LinearElasticity<dim, double>
+                meshmover_amg(high_order_grid, surface_node_displacements_vector, amg_mesh_mover_param);
+            VectorType volume_displacements_amg = meshmover_amg.get_volume_displacements();
+            volume_displacements_amg -= volume_displacements;
+            const double amg_relative_difference = volume_displacements_amg.l2_norm() / volume_displacements.l2_norm();
+            pcout << "Relative difference between the ILUT and AMG preconditioned displacements: " << amg_relative_difference << std::endl;
+            if (amg_relative_difference > 1e-8) {
+                pcout << "AMG preconditioned mesh mover does not match the ILUT preconditioned mesh mover." << std::endl;
+                return 1;
+            }
+
             dealii::IndexSet locally_owned_dofs = high_order_grid.dof_handler_grid.locally_owned_dofs();
             dealii::IndexSet locally_relevant_dofs;
             dealii::DoFTools::extract_locally_relevant_dofs(high_order_grid.dof_handler_grid, locally_relevant_dofs);
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+#include "parameters/parameters_linear_solver.h"
+#include "linear_solver/block_preconditioner.h"
+#include "linear_solver/linear_solver.h"
+
+using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+using PreconditionerEnum = PHiLiP::Parameters::LinearSolverParam::PreconditionerEnum;
+
+/// Fills a block-tridiagonal matrix with blocks of different sizes.
+/** The lower and upper blocks are only set if requested, such that the matrix is block-diagonal,
+ *  block-lower-triangular or block-tridiagonal, while keeping the same sparsity pattern.
+ */
+void build_matrix(
+    const std::vector<unsigned int> &block_sizes,
+    const bool lower_blocks,
+    const bool upper_blocks,
+    dealii::TrilinosWrappers::SparseMatrix &matrix)
+{
+    std::vector<unsigned int> block_start(1, 0);
+    for (const unsigned int size : block_sizes) block_start.push_back(block_start.back() + size);
+    const unsigned int n_blocks = block_sizes.size();
+    const unsigned int n = block_start.back();
+
+    dealii::DynamicSparsityPattern dsp(n, n);
+    for (unsigned int i=0; i<n_blocks; ++i) {
+        const unsigned int j_min = (i==0) ? 0 : i-1;
+        const unsigned int j_max = std::min(i+1, n_blocks-1);
+        for (unsigned int row=block_start[i]; row<block_start[i+1]; ++row) {
+            for (unsigned int col=block_start[j_min]; col<block_start[j_max+1]; ++col) {
+                dsp.add(row, col);
+            }
+        }
+    }
+    const dealii::IndexSet locally_owned = dealii::complete_index_set(n);
+    matrix.reinit(locally_owned, dsp, MPI_COMM_WORLD);
+
+    for (unsigned int i=0; i<n_blocks; ++i) {
+        const unsigned int j_min = (i==0) ? 0 : i-1;
+        const unsigned int j_max = std::min(i+1, n_blocks-1);
+        for (unsigned int j=j_min; j<=j_max; ++j) {
+            if (j < i && !lower_blocks) continue;
+            if (j > i && !upper_blocks) continue;
+            for (unsigned int row=block_start[i]; row<block_start[i+1]; ++row) {
+                for (unsigned int col=block_start[j]; col<block_start[j+1]; ++col) {
+                    double value = static_cast<double>(rand()) / RAND_MAX - 0.5;
+                    if (row == col) value += 10.0;
+                    matrix.set(row, col, value);
+                }
+            }
+        }
+    }
+    matrix.compress(dealii::VectorOperation::insert);
+}
+
+/// Relative residual ||A P^{-1} b - b|| / ||b||.
+double preconditioned_residual(
+    const dealii::TrilinosWrappers::SparseMatrix &matrix,
+    const PHiLiP::BlockPreconditioner &preconditioner)
+{
+    VectorType b(dealii::complete_index_set(matrix.m()), MPI_COMM_WORLD);
+    for (unsigned int i=0; i<b.size(); ++i) b[i] = static_cast<double>(rand()) / RAND_MAX;
+    VectorType x(b), Ax(b);
+    preconditioner.vmult(x, b);
+    matrix.vmult(Ax, x);
+    Ax -= b;
+    return Ax.l2_norm() / b.l2_norm();
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    const std::vector<unsigned int> block_sizes = {3, 4, 2, 5, 3, 4};
+    const double tolerance = 1e-12;
+    int n_failures = 0;
+
+    // Each preconditioner is exact on the block structure it can represent.
+    {
+        dealii::TrilinosWrappers::SparseMatrix matrix;
+        build_matrix(block_sizes, false, false, matrix);
+        PHiLiP::BlockPreconditioner preconditioner(PreconditionerEnum::block_jacobi);
+        preconditioner.initialize(matrix);
+        const double residual = preconditioned_residual(matrix, preconditioner);
+        pcout << "Block-Jacobi on a block-diagonal matrix: " << residual << std::endl;
+        if (residual > tolerance) ++n_failures;
+        if (preconditioner.n_blocks() != block_sizes.size()) {
+            pcout << "Found " << preconditioner.n_blocks() << " element blocks instead of " << block_sizes.size() << std::endl;
+            ++n_failures;
+        }
+    }
+    {
+        dealii::TrilinosWrappers::SparseMatrix matrix;
+        build_matrix(block_sizes, true, false, matrix);
+        PHiLiP::BlockPreconditioner preconditioner(PreconditionerEnum::block_gauss_seidel);
+        preconditioner.initialize(matrix);
+        const double residual = preconditioned_residual(matrix, preconditioner);
+        pcout << "Block Gauss-Seidel on a block-lower-triangular matrix: " << residual << std::endl;
+        if (residual > tolerance) ++n_failures;
+    }
+    {
+        dealii::TrilinosWrappers::SparseMatrix matrix;
+        build_matrix(block_sizes, true, true, matrix);
+        PHiLiP::BlockPreconditioner preconditioner(PreconditionerEnum::block_ilu0);
+        preconditioner.initialize(matrix);
+        const double residual = preconditioned_residual(matrix, preconditioner);
+        pcout << "Block ILU(0) on a block-tridiagonal matrix: " << residual << std::endl;
+        if (residual > tolerance) ++n_failures;
+    }
+
+    // GMRES preconditioned with the block ILU(0) through the linear solver parameters.
+    {
+        dealii::ParameterHandler parameter_handler;
+        PHiLiP::Parameters::LinearSolverParam::declare_parameters(parameter_handler);
+        parameter_handler.enter_subsection("linear solver");
+        parameter_handler.set("linear_solver_type", "gmres");
+        parameter_handler.enter_subsection("gmres options");
+        parameter_handler.set("preconditioner", "block_ilu0");
+        parameter_handler.set("linear_residual_tolerance", 1e-13);
+        parameter_handler.leave_subsection();
+        parameter_handler.leave_subsection();
+        PHiLiP::Parameters::LinearSolverParam param;
+        param.parse_parameters(parameter_handler);
+
+        dealii::TrilinosWrappers::SparseMatrix matrix;
+        build_matrix(block_sizes, true, true, matrix);
+        VectorType rhs(dealii::complete_index_set(matrix.m()), MPI_COMM_WORLD);
+        for (unsigned int i=0; i<rhs.size(); ++i) rhs[i] = static_cast<double>(rand()) / RAND_MAX;
+        VectorType solution(rhs), residual(rhs);
+        const std::pair<unsigned int, double> result = PHiLiP::solve_linear(matrix, rhs, solution, param);
+        matrix.vmult(residual, solution);
+        residual -= rhs;
+        const double relative_residual = residual.l2_norm() / rhs.l2_norm();
+        pcout << "Block ILU(0) preconditioned GMRES took " << result.first
+              << " iterations for a relative residual of " << relative_residual << std::endl;
+        if (result.first > 2 || relative_residual > 1e-10) ++n_failures;
+    }
+
+    if (n_failures > 0) {
+        pcout << n_failures << " block preconditioner checks failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
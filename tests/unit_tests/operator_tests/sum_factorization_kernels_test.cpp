@@ -0,0 +1,156 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <stdlib.h>
+
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+
+#include "parameters/all_parameters.h"
+#include "operators/operators.h"
+
+// Compares the fixed-size sum-factorization kernels used by matrix_vector_mult(),
+// inner_product() and their interleaved versions against the generic implementation.
+// Over-integrated quadratures check the rectangular kernels.
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using real = double;
+    using namespace PHiLiP;
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    bool different = false;
+    const unsigned int poly_min = 1;
+    const unsigned int poly_max = 8;
+    for(unsigned int poly_degree=poly_min; poly_degree<=poly_max; poly_degree++){
+        PHiLiP::OPERATOR::basis_functions<dim,2*dim> basis(nstate, poly_degree, 1);
+        dealii::QGauss<1> quad1D (poly_degree+1);
+        dealii::QGauss<0> quad_face (1);
+        const dealii::FE_DGQ<1> fe_dg(poly_degree);
+        const dealii::FESystem<1,1> fe_system(fe_dg, nstate);
+        basis.build_1D_volume_operator(fe_system,quad1D);
+        basis.build_1D_surface_operator(fe_system,quad_face);
+
+        const unsigned int n_dofs = pow(poly_degree+1,dim);
+        const unsigned int n_quad_pts = pow(quad1D.size(), dim);
+        const unsigned int n_face_quad_pts = pow(quad1D.size(), dim-1);
+
+        std::vector<real> sol_hat(n_dofs);
+        for(unsigned int idof=0; idof<n_dofs; idof++){
+            sol_hat[idof] = 1e-8 + static_cast <float> (rand()) / ( static_cast <float> (RAND_MAX/(30-1e-8)));
+        }
+        std::vector<real> weights(n_quad_pts);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            weights[iquad] = 1e-8 + static_cast <float> (rand()) / ( static_cast <float> (RAND_MAX/(1-1e-8)));
+        }
+
+        // Volume interpolation A*u, the default path uses the fixed-size kernel.
+        std::vector<real> sol_generic(n_quad_pts);
+        std::vector<real> sol_fixed(n_quad_pts);
+        basis.matrix_vector_mult_generic(sol_hat, sol_generic, basis.oneD_vol_operator, basis.oneD_vol_operator, basis.oneD_vol_operator);
+        basis.matrix_vector_mult_1D(sol_hat, sol_fixed, basis.oneD_vol_operator);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            if(std::abs(sol_generic[iquad] - sol_fixed[iquad])>1e-11) different = true;
+        }
+
+        // Surface interpolation on every face.
+        std::vector<real> sol_surf_generic(n_face_quad_pts);
+        std::vector<real> sol_surf_fixed(n_face_quad_pts);
+        for(unsigned int iface=0; iface<2*dim; iface++){
+            const dealii::FullMatrix<real> &surf = basis.oneD_surf_operator[iface%2];
+            const dealii::FullMatrix<real> &vol = basis.oneD_vol_operator;
+            const dealii::FullMatrix<real> &basis_x = (iface/2==0) ? surf : vol;
+            const dealii::FullMatrix<real> &basis_y = (iface/2==1) ? surf : vol;
+            const dealii::FullMatrix<real> &basis_z = (iface/2==2) ? surf : vol;
+            basis.matrix_vector_mult_generic(sol_hat, sol_surf_generic, basis_x, basis_y, basis_z);
+            basis.matrix_vector_mult_surface_1D(iface, sol_hat, sol_surf_fixed, basis.oneD_surf_operator, basis.oneD_vol_operator);
+            for(unsigned int iquad=0; iquad<n_face_quad_pts; iquad++){
+                if(std::abs(sol_surf_generic[iquad] - sol_surf_fixed[iquad])>1e-11) different = true;
+            }
+        }
+
+        // Weighted inner product A^T W u, compared against the generic product with the transposed basis.
+        dealii::FullMatrix<real> vol_transpose(basis.oneD_vol_operator.n(), basis.oneD_vol_operator.m());
+        vol_transpose.copy_transposed(basis.oneD_vol_operator);
+        std::vector<real> weighted_sol(n_quad_pts);
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            weighted_sol[iquad] = sol_fixed[iquad] * weights[iquad];
+        }
+        std::vector<real> inner_generic(n_dofs);
+        std::vector<real> inner_fixed(n_dofs);
+        basis.matrix_vector_mult_generic(weighted_sol, inner_generic, vol_transpose, vol_transpose, vol_transpose);
+        basis.inner_product_1D(sol_fixed, weights, inner_fixed, basis.oneD_vol_operator);
+        for(unsigned int idof=0; idof<n_dofs; idof++){
+            if(std::abs(inner_generic[idof] - inner_fixed[idof])>1e-9) different = true;
+        }
+
+        // Interleaved lanes, compared against each lane applied separately.
+        // Four cells of five states, as in a cell batch of the strong DG volume terms.
+        const int n_lanes = 20;
+        std::vector<std::array<real,n_lanes>> sol_hat_lanes(n_dofs);
+        for(unsigned int idof=0; idof<n_dofs; idof++){
+            for(int ilane=0; ilane<n_lanes; ilane++){
+                sol_hat_lanes[idof][ilane] = (ilane+1) * sol_hat[idof];
+            }
+        }
+        std::vector<std::array<real,n_lanes>> sol_lanes(n_quad_pts);
+        basis.matrix_vector_mult_1D_interleaved(sol_hat_lanes, sol_lanes, basis.oneD_vol_operator);
+        std::vector<std::array<real,n_lanes>> inner_lanes(n_dofs);
+        std::vector<std::array<real,n_lanes>> weighted_sol_lanes;
+        basis.inner_product_1D_interleaved(sol_lanes, weights, inner_lanes, weighted_sol_lanes, basis.oneD_vol_operator);
+        for(int ilane=0; ilane<n_lanes; ilane++){
+            for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+                if(std::abs((ilane+1) * sol_fixed[iquad] - sol_lanes[iquad][ilane])>1e-10) different = true;
+            }
+            for(unsigned int idof=0; idof<n_dofs; idof++){
+                if(std::abs((ilane+1) * inner_fixed[idof] - inner_lanes[idof][ilane])>1e-8) different = true;
+            }
+        }
+
+        // Over-integrated volume operators, where the one-dimensional basis is rectangular.
+        for(unsigned int overintegration=1; overintegration<=2; overintegration++){
+            PHiLiP::OPERATOR::basis_functions<dim,2*dim> basis_overint(nstate, poly_degree, 1);
+            dealii::QGauss<1> quad1D_overint (poly_degree+1+overintegration);
+            basis_overint.build_1D_volume_operator(fe_system,quad1D_overint);
+            const dealii::FullMatrix<real> &vol = basis_overint.oneD_vol_operator;
+            const unsigned int n_quad_pts_overint = pow(quad1D_overint.size(), dim);
+
+            std::vector<real> sol_overint_generic(n_quad_pts_overint);
+            std::vector<real> sol_overint_fixed(n_quad_pts_overint);
+            basis_overint.matrix_vector_mult_generic(sol_hat, sol_overint_generic, vol, vol, vol);
+            basis_overint.matrix_vector_mult_1D(sol_hat, sol_overint_fixed, vol);
+            for(unsigned int iquad=0; iquad<n_quad_pts_overint; iquad++){
+                if(std::abs(sol_overint_generic[iquad] - sol_overint_fixed[iquad])>1e-11) different = true;
+            }
+
+            dealii::FullMatrix<real> vol_overint_transpose(vol.n(), vol.m());
+            vol_overint_transpose.copy_transposed(vol);
+            std::vector<real> weights_overint(n_quad_pts_overint);
+            std::vector<real> weighted_sol_overint(n_quad_pts_overint);
+            for(unsigned int iquad=0; iquad<n_quad_pts_overint; iquad++){
+                weights_overint[iquad] = 1e-8 + static_cast <float> (rand()) / ( static_cast <float> (RAND_MAX/(1-1e-8)));
+                weighted_sol_overint[iquad] = sol_overint_fixed[iquad] * weights_overint[iquad];
+            }
+            std::vector<real> inner_overint_generic(n_dofs);
+            std::vector<real> inner_overint_fixed(n_dofs);
+            basis_overint.matrix_vector_mult_generic(weighted_sol_overint, inner_overint_generic, vol_overint_transpose, vol_overint_transpose, vol_overint_transpose);
+            basis_overint.inner_product_1D(sol_overint_fixed, weights_overint, inner_overint_fixed, vol);
+            for(unsigned int idof=0; idof<n_dofs; idof++){
+                if(std::abs(inner_overint_generic[idof] - inner_overint_fixed[idof])>1e-9) different = true;
+            }
+        }
+    } //end of poly_degree loop
+
+    if(different==true){
+        pcout<<"Fixed-size sum factorization kernels do not recover the generic implementation."<<std::endl;
+        return 1;
+    }
+    return 0;
+}//end of main
@@ -0,0 +1,123 @@
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include "profiling/performance_profiler.h"
+
+/// Reads the csv summary into a map from "<type>,<name>" to the remaining columns.
+std::map<std::string, std::vector<std::string>> read_csv_summary(const std::string &filename)
+{
+    std::map<std::string, std::vector<std::string>> rows;
+    std::ifstream csv_file(filename);
+    std::string line;
+    std::getline(csv_file, line); // header
+    while (std::getline(csv_file, line)) {
+        std::istringstream line_stream(line);
+        std::vector<std::string> columns;
+        std::string column;
+        while (std::getline(line_stream, column, ',')) columns.push_back(column);
+        if (columns.size() < 8) continue;
+        rows[columns[0] + "," + columns[1]] = std::vector<std::string>(columns.begin()+2, columns.end());
+    }
+    return rows;
+}
+
+/// Records nested timers and counters that differ between the processes and checks the reduced summary.
+int main (int argc, char *argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const unsigned int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using PHiLiP::Profiling::PerformanceProfiler;
+    using PHiLiP::Profiling::ScopedTimer;
+    using PHiLiP::Profiling::ScopedSuspension;
+    PerformanceProfiler &profiler = PerformanceProfiler::instance();
+
+    // Nothing is recorded while the profiler is disabled
+    {
+        ScopedTimer disabled_timer("disabled");
+        profiler.add_to_counter("disabled_events");
+    }
+
+    profiler.set_enabled(true);
+    {
+        ScopedTimer outer_timer("outer");
+        for (unsigned int i = 0; i < mpi_rank+1; ++i) {
+            ScopedTimer inner_timer("inner");
+            profiler.add_to_counter("events");
+        }
+        // Timers of other threads are ignored
+        std::thread worker([]() { ScopedTimer worker_timer("worker"); });
+        worker.join();
+        // Timers inside a suspended threaded loop are ignored, the enclosing timer is kept
+        ScopedTimer loop_timer("loop");
+        const ScopedSuspension suspension;
+        ScopedTimer suspended_timer("suspended");
+        profiler.add_to_counter("suspended_events");
+    }
+    // Timer only reached by the last process
+    if (mpi_rank == n_mpi-1) {
+        ScopedTimer last_process_timer("last_process");
+    }
+    // Running timers are included in the summary
+    ScopedTimer running_timer("running");
+
+    const std::string filename_prefix = "performance_profiler_summary";
+    profiler.write_summary(filename_prefix, mpi_communicator);
+
+    int n_failures = 0;
+    if (mpi_rank == 0) {
+        const std::map<std::string, std::vector<std::string>> rows = read_csv_summary(filename_prefix + ".csv");
+        const std::vector<std::string> expected_rows = {"timer,outer", "timer,outer/inner", "timer,outer/loop", "timer,last_process", "timer,running", "counter,events"};
+        for (const std::string &row : expected_rows) {
+            if (rows.find(row) == rows.end()) {
+                pcout << "Missing entry " << row << " in the summary." << std::endl;
+                ++n_failures;
+            }
+        }
+        const std::vector<std::string> unexpected_rows = {"timer,disabled", "counter,disabled_events", "timer,worker", "timer,outer/worker",
+                                                          "timer,outer/loop/suspended", "counter,suspended_events"};
+        for (const std::string &row : unexpected_rows) {
+            if (rows.find(row) != rows.end()) {
+                pcout << "Unexpected entry " << row << " in the summary." << std::endl;
+                ++n_failures;
+            }
+        }
+        if (n_failures == 0) {
+            // Columns: calls, min, max, avg, total, imbalance
+            const std::vector<std::string> &inner = rows.at("timer,outer/inner");
+            if (std::stoul(inner[0]) != n_mpi) {
+                pcout << "Inner timer was called at most " << inner[0] << " times instead of " << n_mpi << std::endl;
+                ++n_failures;
+            }
+            const std::vector<std::string> &events = rows.at("counter,events");
+            const double expected_total = 0.5*n_mpi*(n_mpi+1);
+            const double expected_imbalance = n_mpi / (expected_total / n_mpi);
+            if (std::stod(events[1]) != 1.0 || std::stod(events[2]) != n_mpi || std::stod(events[4]) != expected_total
+                || std::abs(std::stod(events[5]) - expected_imbalance) > 1e-6) {
+                pcout << "Wrong reduction of the event counter." << std::endl;
+                ++n_failures;
+            }
+            const std::vector<std::string> &last_process = rows.at("timer,last_process");
+            if (n_mpi > 1 && std::stod(last_process[1]) != 0.0) {
+                pcout << "Timer not reached by a process should count as zero on that process." << std::endl;
+                ++n_failures;
+            }
+        }
+    }
+    n_failures = dealii::Utilities::MPI::sum(n_failures, mpi_communicator);
+
+    if (n_failures == 0) pcout << "Performance profiler summary is correct." << std::endl;
+    return n_failures;
+}
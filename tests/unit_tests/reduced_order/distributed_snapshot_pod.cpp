@@ -0,0 +1,104 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+
+#include <eigen/Eigen/Dense>
+#include <eigen/Eigen/SVD>
+
+#include "reduced_order/distributed_snapshot_pod.h"
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/// Compares the POD of row-distributed snapshots, added one at a time, with the SVD of all the snapshots.
+int main (int argc, char *argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    int n_failures = 0;
+
+    // Snapshots with a dominant mean and singular values spanning several orders of magnitude
+    const int n_rows = 301;
+    const int n_snapshots = 8;
+    MatrixXd snapshots(n_rows, n_snapshots);
+    for (int i = 0; i < n_rows; ++i) {
+        for (int j = 0; j < n_snapshots; ++j) {
+            snapshots(i,j) = 1.0;
+            for (int k = 1; k < n_snapshots; ++k) snapshots(i,j) += std::pow(10.0, -k) * std::sin(0.01*k*i + 0.7*k*j);
+        }
+    }
+    std::vector<int> row_offsets(n_mpi+1);
+    for (int iproc = 0; iproc <= n_mpi; ++iproc) row_offsets[iproc] = (n_rows * iproc) / n_mpi;
+    const int first_row = row_offsets[mpi_rank];
+    const int n_local_rows = row_offsets[mpi_rank+1] - first_row;
+
+    PHiLiP::ProperOrthogonalDecomposition::DistributedSnapshotPOD snapshot_pod(mpi_communicator);
+    for (int j = 0; j < n_snapshots; ++j) {
+        snapshot_pod.add_snapshot(snapshots.col(j).segment(first_row, n_local_rows));
+    }
+    snapshot_pod.compute_basis(0.0);
+
+    const VectorXd mean = snapshots.rowwise().mean();
+    const MatrixXd centered_snapshots = snapshots.colwise() - mean;
+    const Eigen::BDCSVD<MatrixXd> svd(centered_snapshots, Eigen::ComputeThinU);
+    const VectorXd &singular_values = snapshot_pod.get_singular_values();
+    const int n_modes = singular_values.size();
+    if (n_modes != n_snapshots-1) {
+        std::cout << "Expected " << n_snapshots-1 << " modes, got " << n_modes << std::endl;
+        ++n_failures;
+    }
+    const double singular_value_error = (singular_values - svd.singularValues().head(n_modes)).cwiseQuotient(svd.singularValues().head(n_modes)).cwiseAbs().maxCoeff();
+    if (singular_value_error > 1e-6) {
+        std::cout << "Relative singular value error " << singular_value_error << std::endl;
+        ++n_failures;
+    }
+    if ((snapshot_pod.get_local_mean() - mean.segment(first_row, n_local_rows)).norm() > 1e-14 * std::sqrt(n_rows)) {
+        std::cout << "Wrong mean" << std::endl;
+        ++n_failures;
+    }
+
+    // The basis is orthonormal and reproduces the centered snapshots
+    const MatrixXd &local_basis = snapshot_pod.get_local_basis();
+    const MatrixXd local_overlap = local_basis.transpose() * local_basis;
+    MatrixXd overlap(n_modes, n_modes);
+    MPI_Allreduce(local_overlap.data(), overlap.data(), n_modes*n_modes, MPI_DOUBLE, MPI_SUM, mpi_communicator);
+    const double orthonormality_error = (overlap - MatrixXd::Identity(n_modes, n_modes)).norm();
+    const MatrixXd local_centered_snapshots = centered_snapshots.middleRows(first_row, n_local_rows);
+    const MatrixXd local_coefficients = local_basis.transpose() * local_centered_snapshots;
+    MatrixXd coefficients(n_modes, n_snapshots);
+    MPI_Allreduce(local_coefficients.data(), coefficients.data(), n_modes*n_snapshots, MPI_DOUBLE, MPI_SUM, mpi_communicator);
+    const double local_projection_error = (local_centered_snapshots - local_basis * coefficients).squaredNorm();
+    const double projection_error = std::sqrt(dealii::Utilities::MPI::sum(local_projection_error, mpi_communicator)) / centered_snapshots.norm();
+    if (mpi_rank == 0) std::cout << "Orthonormality error " << orthonormality_error << ", projection error " << projection_error << std::endl;
+    if (orthonormality_error > 1e-12 || projection_error > 1e-10) ++n_failures;
+
+    // Truncation keeps the leading modes holding 1 - 1e-6 of the energy
+    snapshot_pod.compute_basis(1e-6);
+    const VectorXd energy = svd.singularValues().head(n_snapshots-1).cwiseAbs2();
+    int n_expected_modes = 0;
+    double discarded_energy = energy.sum();
+    while (discarded_energy > 1e-6 * energy.sum()) discarded_energy -= energy(n_expected_modes++);
+    if (snapshot_pod.get_singular_values().size() != n_expected_modes) {
+        std::cout << "Truncated basis has " << snapshot_pod.get_singular_values().size() << " modes instead of " << n_expected_modes << std::endl;
+        ++n_failures;
+    }
+
+    // A mode whose singular value is below sqrt(relative_eigenvalue_cutoff) times the largest one is discarded
+    PHiLiP::ProperOrthogonalDecomposition::DistributedSnapshotPOD ill_conditioned_pod(mpi_communicator);
+    for (int j = 0; j < 3; ++j) {
+        VectorXd snapshot(n_rows);
+        for (int i = 0; i < n_rows; ++i) snapshot(i) = 1.0 + (j-1) * std::sin(0.01*i) + 1e-6 * (j==1) * std::cos(0.02*i);
+        ill_conditioned_pod.add_snapshot(snapshot.segment(first_row, n_local_rows));
+    }
+    ill_conditioned_pod.compute_basis(0.0);
+    if (ill_conditioned_pod.get_singular_values().size() != 1) {
+        std::cout << "Ill-conditioned basis has " << ill_conditioned_pod.get_singular_values().size() << " modes instead of 1" << std::endl;
+        ++n_failures;
+    }
+
+    return dealii::Utilities::MPI::max(n_failures, mpi_communicator);
+}
@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <eigen/Eigen/Dense>
+
+#include "reduced_order/kd_tree.h"
+
+using Eigen::MatrixXd;
+using Eigen::RowVectorXd;
+using Eigen::VectorXd;
+
+/// Compares the nearest neighbors found by the k-d tree with a sort of all the distances.
+int main (int /*argc*/, char * /*argv*/[])
+{
+    int n_failures = 0;
+
+    for (int dimension = 1; dimension <= 3; ++dimension) {
+        // Points on a coarse lattice, such that many distances are equal
+        const int n_points = 200;
+        MatrixXd points(n_points, dimension);
+        for (int i = 0; i < n_points; ++i) {
+            for (int j = 0; j < dimension; ++j) points(i,j) = std::round(10.0 * (0.5 + 0.5*std::sin(1.3*i + 2.1*j + 0.7*i*j))) / 10.0;
+        }
+        const PHiLiP::ProperOrthogonalDecomposition::KDTree tree(points);
+
+        for (int iquery = 0; iquery < 60; ++iquery) {
+            RowVectorXd point(dimension);
+            for (int j = 0; j < dimension; ++j) point(j) = 0.5 + 0.5*std::cos(0.9*iquery + 1.7*j);
+            if (iquery % 3 == 0) point = points.row(iquery);
+            const int k = 1 + iquery % 6;
+
+            const VectorXd distances = (points.rowwise() - point).rowwise().squaredNorm();
+            std::vector<int> expected_index(n_points);
+            std::iota(expected_index.begin(), expected_index.end(), 0);
+            std::stable_sort(expected_index.begin(), expected_index.end(),
+                             [&](const int& a, const int& b) { return distances[a] < distances[b]; });
+            expected_index.resize(k);
+
+            if (tree.kNearestNeighbors(point, k) != expected_index) {
+                std::cout << "Wrong " << k << " nearest neighbors of " << point << " in dimension " << dimension << std::endl;
+                ++n_failures;
+            }
+        }
+    }
+
+    return n_failures;
+}
@@ -0,0 +1,55 @@
+#include <cmath>
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+
+#include <eigen/Eigen/Dense>
+
+#include "reduced_order/ecsw_hyper_reduction.h"
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/// Checks the non-negative least-squares solver used to sample the cells of the hyper-reduced models.
+int main (int argc, char *argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int n_failures = 0;
+
+    // Problem with an active constraint: min |x1 + 1|^2 + |x2 - 2|^2 + |x1 + x2 - 1|^2 for x >= 0 gives x = (0, 1.5)
+    MatrixXd A(3,2);
+    A << 1, 0,
+         0, 1,
+         1, 1;
+    VectorXd b(3);
+    b << -1, 2, 1;
+    const VectorXd x = PHiLiP::ProperOrthogonalDecomposition::solve_non_negative_least_squares(A, b, 0.0);
+    if (std::abs(x(0)) > 1e-12 || std::abs(x(1) - 1.5) > 1e-12) {
+        std::cout << "Wrong constrained solution " << x.transpose() << std::endl;
+        ++n_failures;
+    }
+
+    // ECSW-like problem with more cells than equations: the unit weights are a solution,
+    // and a loose tolerance must be met with fewer non-negative weights than equations.
+    const int n_equations = 20;
+    const int n_cells = 200;
+    MatrixXd contributions(n_equations, n_cells);
+    for (int i = 0; i < n_equations; ++i) {
+        for (int j = 0; j < n_cells; ++j) {
+            contributions(i,j) = std::sin(1.0 + 0.37*i*j + 0.11*j) + 0.3;
+        }
+    }
+    const VectorXd reduced_residual = contributions.rowwise().sum();
+    for (const double tolerance : {1e-1, 1e-3, 1e-10}) {
+        const VectorXd weights = PHiLiP::ProperOrthogonalDecomposition::solve_non_negative_least_squares(contributions, reduced_residual, tolerance);
+        const double relative_error = (contributions * weights - reduced_residual).norm() / reduced_residual.norm();
+        const int n_sampled_cells = (weights.array() > 0.0).count();
+        std::cout << "Tolerance " << tolerance << ": " << n_sampled_cells << " sampled cells, relative error " << relative_error << std::endl;
+        if (weights.minCoeff() < 0.0 || relative_error > tolerance || n_sampled_cells > n_equations) {
+            std::cout << "Failed for tolerance " << tolerance << std::endl;
+            ++n_failures;
+        }
+    }
+
+    return n_failures;
+}
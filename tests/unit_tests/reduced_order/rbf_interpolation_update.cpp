@@ -0,0 +1,56 @@
+#include <cmath>
+#include <iostream>
+
+#include <eigen/Eigen/Dense>
+
+#include "reduced_order/rbf_interpolation.h"
+
+using Eigen::MatrixXd;
+using Eigen::RowVectorXd;
+using Eigen::VectorXd;
+
+/// Compares the RBF interpolation updated with points removed and added to the RBF interpolation of the same points.
+int main (int /*argc*/, char * /*argv*/[])
+{
+    int n_failures = 0;
+    const auto coordinate = [](const int i) {
+        RowVectorXd point(2);
+        point << 0.5 + 0.5*std::sin(1.7*i), 0.5 + 0.5*std::cos(2.3*i);
+        return point;
+    };
+    const auto function = [](const RowVectorXd& point) { return std::sin(3.0*point(0)) * std::cos(2.0*point(1)); };
+
+    const std::string kernel = "thin_plate_spline";
+    int n_points = 60;
+    MatrixXd coordinates(n_points, 2);
+    VectorXd values(n_points);
+    for (int i = 0; i < n_points; ++i) {
+        coordinates.row(i) = coordinate(i);
+        values(i) = function(coordinates.row(i));
+    }
+    PHiLiP::ProperOrthogonalDecomposition::RBFInterpolation rbf(coordinates, values, kernel);
+
+    MatrixXd evaluate_coordinates(20, 2);
+    for (int i = 0; i < evaluate_coordinates.rows(); ++i) evaluate_coordinates.row(i) = coordinate(1000 + i);
+
+    for (int iteration = 0; iteration < 5; ++iteration) {
+        // Remove the second point, insert a new point in the middle and change the values, as the adaptive sampling does
+        MatrixXd new_coordinates(n_points, 2);
+        VectorXd new_values(n_points);
+        new_coordinates << coordinates.topRows(1), coordinates.middleRows(2, n_points/2 - 2), coordinate(100 + iteration), coordinates.bottomRows(n_points - n_points/2);
+        for (int i = 0; i < n_points; ++i) new_values(i) = (1.0 + 0.1*iteration) * function(new_coordinates.row(i));
+        coordinates = new_coordinates;
+        values = new_values;
+
+        rbf.updateData(coordinates, values);
+        const PHiLiP::ProperOrthogonalDecomposition::RBFInterpolation direct_rbf(coordinates, values, kernel);
+
+        const double interpolation_error = (rbf.evaluatePoints(coordinates) - values).cwiseAbs().maxCoeff();
+        const double update_error = (rbf.evaluatePoints(evaluate_coordinates) - direct_rbf.evaluatePoints(evaluate_coordinates)).cwiseAbs().maxCoeff();
+        const double batch_error = std::abs(rbf.evaluatePoints(evaluate_coordinates)(3) - rbf.evaluate(evaluate_coordinates.row(3)));
+        std::cout << "Interpolation error " << interpolation_error << ", update error " << update_error << std::endl;
+        if (interpolation_error > 1e-8 || update_error > 1e-8 || batch_error > 1e-12) ++n_failures;
+    }
+
+    return n_failures;
+}
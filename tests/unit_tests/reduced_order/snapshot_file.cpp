@@ -0,0 +1,72 @@
+#include <cmath>
+#include <iostream>
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+
+#include <eigen/Eigen/Dense>
+
+#include "reduced_order/snapshot_file.h"
+
+using Eigen::MatrixXd;
+
+/// Writes row-distributed snapshots into a binary snapshot file and reads them back with a different row distribution.
+int main (int argc, char *argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+    const unsigned int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    int n_failures = 0;
+
+    const unsigned int n_rows = 103;
+    const unsigned int n_snapshots = 4;
+    const unsigned int n_parameters = 2;
+    MatrixXd snapshots(n_rows, n_snapshots);
+    MatrixXd parameters(n_snapshots, n_parameters);
+    for (unsigned int j = 0; j < n_snapshots; ++j) {
+        for (unsigned int i = 0; i < n_rows; ++i) snapshots(i,j) = std::sin(0.1*i + j);
+        for (unsigned int k = 0; k < n_parameters; ++k) parameters(j,k) = j + 0.5*k;
+    }
+
+    // Contiguous rows for writing, as the dofs of a DoFHandler
+    dealii::IndexSet written_rows(n_rows);
+    written_rows.add_range((n_rows * mpi_rank) / n_mpi, (n_rows * (mpi_rank+1)) / n_mpi);
+    MatrixXd local_snapshots(written_rows.n_elements(), n_snapshots);
+    for (unsigned int i = 0; i < written_rows.n_elements(); ++i) local_snapshots.row(i) = snapshots.row(written_rows.nth_index_in_set(i));
+
+    const std::string filename = "snapshot_file_test.snap";
+    PHiLiP::ProperOrthogonalDecomposition::write_snapshot_file(filename, local_snapshots, written_rows, parameters, mpi_communicator);
+
+    if (!PHiLiP::ProperOrthogonalDecomposition::is_snapshot_file(filename)) {
+        std::cout << "File not recognized as a snapshot file" << std::endl;
+        ++n_failures;
+    }
+
+    // Strided rows for reading, such that each process reads from the rows written by the others
+    dealii::IndexSet read_rows(n_rows);
+    for (unsigned int i = mpi_rank; i < n_rows; i += n_mpi) read_rows.add_index(i);
+    read_rows.compress();
+    {
+        const PHiLiP::ProperOrthogonalDecomposition::SnapshotFileReader snapshot_file(filename);
+        if (snapshot_file.header.n_dofs != n_rows || snapshot_file.header.n_snapshots != n_snapshots || snapshot_file.header.n_parameters != n_parameters) {
+            std::cout << "Wrong header" << std::endl;
+            ++n_failures;
+        }
+        for (unsigned int j = 0; j < n_snapshots; ++j) {
+            if (snapshot_file.get_parameters(j) != parameters.row(j)) {
+                std::cout << "Wrong parameters of snapshot " << j << std::endl;
+                ++n_failures;
+            }
+        }
+        const MatrixXd read_snapshots = snapshot_file.get_rows(read_rows);
+        for (unsigned int i = 0; i < read_rows.n_elements(); ++i) {
+            if (read_snapshots.row(i) != snapshots.row(read_rows.nth_index_in_set(i))) {
+                std::cout << "Wrong row " << read_rows.nth_index_in_set(i) << std::endl;
+                ++n_failures;
+            }
+        }
+    }
+
+    return dealii::Utilities::MPI::max(n_failures, mpi_communicator);
+}
@@ -0,0 +1,169 @@
+#include <cmath>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-10;
+
+/** This test checks that the matrix-free product of dRdW with a vector, evaluated with
+ *  forward-mode automatic differentiation, matches the product with the assembled dRdW.
+ *  The matrix-free diagonal blocks are also compared to the assembled ones when run in serial.
+ */
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    // Initialize solution with something
+    using solutionVector = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    solutionVector solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    for (auto it = dg->solution.begin(); it != dg->solution.end(); ++it) {
+        // Away from the exact solution, such that the boundary upwinding is differentiable.
+        (*it) += 1.0;
+    }
+    dg->solution.update_ghost_values();
+
+    // Arbitrary direction
+    solutionVector direction;
+    direction.reinit(dg->right_hand_side);
+    for (const auto idof : dg->locally_owned_dofs) {
+        direction[idof] = 1.0 + 0.1 * std::sin(static_cast<double>(idof));
+    }
+    direction.update_ghost_values();
+
+    pcout << "Evaluating assembled dRdW..." << std::endl;
+    dg->assemble_residual(true, false, false);
+    solutionVector dRdW_times_direction_assembled;
+    dRdW_times_direction_assembled.reinit(dg->right_hand_side);
+    dg->system_matrix.vmult(dRdW_times_direction_assembled, direction);
+
+    pcout << "Evaluating matrix-free dRdW..." << std::endl;
+    solutionVector dRdW_times_direction_matrix_free;
+    dRdW_times_direction_matrix_free.reinit(dg->right_hand_side);
+    dg->apply_dRdW(direction, dRdW_times_direction_matrix_free);
+
+    dRdW_times_direction_matrix_free -= dRdW_times_direction_assembled;
+    const double diff_product = dRdW_times_direction_matrix_free.l2_norm() / dRdW_times_direction_assembled.l2_norm();
+    pcout << "Relative difference of dRdW*v = " << diff_product << std::endl;
+    if (diff_product > TOLERANCE) return 1;
+
+    // A face shared between processors only contributes to one of the blocks.
+    if (dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) != 1) return 0;
+
+    pcout << "Evaluating matrix-free diagonal blocks..." << std::endl;
+    std::vector<dealii::FullMatrix<double>> diagonal_blocks;
+    dg->assemble_dRdW_diagonal_blocks(diagonal_blocks);
+
+    double diff_blocks = 0.0;
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+        const dealii::FullMatrix<double> &block = diagonal_blocks[cell->active_cell_index()];
+        dofs_indices.resize(block.m());
+        cell->get_dof_indices(dofs_indices);
+        for (unsigned int itest=0; itest<block.m(); ++itest) {
+            for (unsigned int itrial=0; itrial<block.n(); ++itrial) {
+                diff_blocks = std::max(diff_blocks, std::abs(block(itest,itrial) - dg->system_matrix.el(dofs_indices[itest], dofs_indices[itrial])));
+            }
+        }
+    }
+    pcout << "Maximum difference of the diagonal blocks = " << diff_blocks << std::endl;
+    if (diff_blocks > TOLERANCE * std::max(1.0, dg->system_matrix.linfty_norm())) return 1;
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    std::vector<PDEType> pde_type {
+        PDEType::diffusion
+        , PDEType::advection
+        , PDEType::euler
+        , PDEType::navier_stokes
+    };
+    std::vector<std::string> pde_name {
+         " PDEType::diffusion "
+        , " PDEType::advection "
+        , " PDEType::euler "
+        , " PDEType::navier_stokes "
+    };
+
+    for (unsigned int ipde = 0; ipde < pde_type.size(); ++ipde) {
+        for (unsigned int poly_degree=1; poly_degree<3; ++poly_degree) {
+            pcout << "Using " << pde_name[ipde] << std::endl;
+            all_parameters.pde_type = pde_type[ipde];
+            all_parameters.diss_num_flux_type = Parameters::AllParameters::DissipativeNumericalFlux::bassi_rebay_2;
+            // Generate grids
+            std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                MPI_COMM_WORLD,
+#endif
+                typename dealii::Triangulation<dim>::MeshSmoothing(
+                    dealii::Triangulation<dim>::smoothing_on_refinement |
+                    dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+            const unsigned int n_subdivisions = 3;
+            dealii::GridGenerator::subdivided_hyper_cube(*grid, n_subdivisions);
+
+            const double random_factor = 0.2;
+            const bool keep_boundary = false;
+            dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+            for (auto &cell : grid->active_cell_iterators()) {
+                for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                    if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                }
+            }
+
+            if ((pde_type[ipde]==PDEType::euler) || (pde_type[ipde]==PDEType::navier_stokes)) {
+                error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+            } else {
+                error = test<dim,1>(poly_degree, grid, all_parameters);
+            }
+            if (error) return error;
+        }
+    }
+
+    return error;
+}